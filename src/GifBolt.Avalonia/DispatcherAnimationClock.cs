@@ -0,0 +1,49 @@
+// <copyright file="DispatcherAnimationClock.cs" company="GifBolt Contributors">
+// Copyright (c) 2026 GifBolt Contributors. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the project root for full license information.
+// </copyright>
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+using System;
+using Avalonia.Threading;
+
+namespace GifBolt.Avalonia
+{
+    /// <summary>
+    /// Provides the <see cref="AnimationClock"/> shared by every animation on the UI thread.
+    /// </summary>
+    internal static class DispatcherAnimationClock
+    {
+        private static AnimationClock? _clock;
+
+        /// <summary>
+        /// Gets the clock of <see cref="Dispatcher.UIThread"/>, creating it on first use.
+        /// </summary>
+        /// <remarks>Must be called on the UI thread.</remarks>
+        public static AnimationClock UIThread => _clock ??= Create();
+
+        private static AnimationClock Create()
+        {
+            // One timer for all animations, armed for the earliest deadline among them
+            var timer = new DispatcherTimer(DispatcherPriority.Render);
+            var clock = new AnimationClock(delay =>
+            {
+                timer.Stop();
+                if (delay.HasValue)
+                {
+                    timer.Interval = delay.Value;
+                    timer.Start();
+                }
+            });
+
+            timer.Tick += (sender, e) =>
+            {
+                timer.Stop();
+                clock.Tick();
+            };
+
+            return clock;
+        }
+    }
+}
@@ -6,7 +6,7 @@
 // SPDX-FileCopyrightText: 2026 GifBolt Contributors
 
 using System;
-using System.Runtime.InteropServices;
+using System.Threading.Tasks;
 using Avalonia;
 using Avalonia.Controls;
 using Avalonia.Media;
@@ -18,18 +18,22 @@ using GifBolt;
 namespace GifBolt.Avalonia
 {
     /// <summary>
-    /// Avalonia-specific GIF animation controller using DispatcherTimer for frame timing.
+    /// Avalonia-specific GIF animation controller driven by the UI thread's shared animation clock.
     /// </summary>
     /// <remarks>
     /// Manages GIF animation playback on Avalonia Image controls using a WriteableBitmap
-    /// and DispatcherTimer for frame timing. Handles asynchronous loading and frame rendering.
+    /// and a shared <see cref="AnimationClock"/> for frame timing. Handles asynchronous loading
+    /// and frame rendering.
     /// </remarks>
-    internal sealed class GifAnimationController : GifAnimationControllerBase
+    internal sealed class GifAnimationController : GifAnimationControllerBase, IAnimationClockTarget
     {
         private readonly Image _image;
         private WriteableBitmap? _writeableBitmap;
-        private DispatcherTimer? _animationTimer;
-        private DateTime _frameStartTime;
+        private WriteableBitmap? _backBitmap;
+        private Task<bool>? _preparation;
+        private int _preparedFrame = -1;
+        private AnimationClock? _clock;
+        private TimeSpan _frameStartTime;
         private bool _wasPlayingBeforeHidden;
         private ScalingFilter _scalingFilter = ScalingFilter.None;
 
@@ -97,87 +101,70 @@ namespace GifBolt.Avalonia
                         return;
                     }
 
-                    WriteableBitmap wb;
-                    byte[]? initialPixels = null;
-
                     // Check if scaling is disabled (None filter) or enabled
-                    if (this._scalingFilter == ScalingFilter.None)
-                    {
-                        // Use native GIF resolution without scaling
-                        wb = new WriteableBitmap(
-                            new PixelSize(this.Player.Width, this.Player.Height),
-                            new Vector(96, 96),
-                            PixelFormat.Bgra8888,
-                            AlphaFormat.Premul);
-
-                        if (this.Player.TryGetFramePixelsBgra32Premultiplied(0, out byte[] bgraPixels) &&
-                            bgraPixels.Length > 0)
-                        {
-                            initialPixels = bgraPixels;
-                        }
-                    }
-                    else
+                    int bitmapWidth = this.Player.Width;
+                    int bitmapHeight = this.Player.Height;
+                    if (this._scalingFilter != ScalingFilter.None)
                     {
                         // Scale to display size with selected filter
                         int displayWidth = Math.Max(1, (int)this._image.Bounds.Width);
                         int displayHeight = Math.Max(1, (int)this._image.Bounds.Height);
 
-                        if (displayWidth < 10 || displayHeight < 10)
+                        if (displayWidth >= 10 && displayHeight >= 10)
                         {
-                            displayWidth = this.Player.Width;
-                            displayHeight = this.Player.Height;
+                            bitmapWidth = displayWidth;
+                            bitmapHeight = displayHeight;
                         }
+                    }
 
-                        // Get scaled frame 0 pixels on background thread
-                        if (this.Player.TryGetFramePixelsBgra32PremultipliedScaled(
-                            0,
-                            displayWidth,
-                            displayHeight,
-                            out byte[] bgraPixels,
-                            out int outWidth,
-                            out int outHeight,
-                            filter: this._scalingFilter) &&
-                            bgraPixels.Length > 0)
-                        {
-                            wb = new WriteableBitmap(
-                                new PixelSize(outWidth, outHeight),
-                                new Vector(96, 96),
-                                PixelFormat.Bgra8888,
-                                AlphaFormat.Premul);
+                    var wb = new WriteableBitmap(
+                        new PixelSize(bitmapWidth, bitmapHeight),
+                        new Vector(96, 96),
+                        PixelFormat.Bgra8888,
+                        AlphaFormat.Premul);
 
-                            initialPixels = bgraPixels;
-                        }
-                        else
-                        {
-                            // Fallback: failed to get scaled pixels
-                            var error = new InvalidOperationException("Failed to decode initial frame.");
-                            Dispatcher.UIThread.Post(() => onError?.Invoke(error));
-                            return;
-                        }
+                    // Render frame 0 straight into the bitmap on the background thread
+                    bool rendered;
+                    using (var buffer = wb.Lock())
+                    {
+                        int byteCount = buffer.RowBytes * buffer.Size.Height;
+                        rendered = this._scalingFilter == ScalingFilter.None
+                            ? this.Player.TryCopyFramePixelsBgra32Premultiplied(0, buffer.Address, buffer.RowBytes, byteCount)
+                            : this.Player.TryCopyFramePixelsBgra32PremultipliedScaled(
+                                0,
+                                bitmapWidth,
+                                bitmapHeight,
+                                buffer.Address,
+                                buffer.RowBytes,
+                                byteCount,
+                                filter: this._scalingFilter);
                     }
 
-                    // Copy pixels to bitmap on background thread
-                    if (initialPixels != null)
+                    if (!rendered)
                     {
-                        using (var buffer = wb.Lock())
-                        {
-                            Marshal.Copy(initialPixels, 0, buffer.Address, initialPixels.Length);
-                        }
+                        var error = new InvalidOperationException("Failed to decode initial frame.");
+                        Dispatcher.UIThread.Post(() => onError?.Invoke(error));
+                        return;
+                    }
 
-                        Dispatcher.UIThread.Post(() =>
+                    // Second bitmap of the same size: the next frame is prepared into it off the
+                    // UI thread, then the two are swapped at the frame's deadline
+                    var back = new WriteableBitmap(
+                        new PixelSize(bitmapWidth, bitmapHeight),
+                        new Vector(96, 96),
+                        PixelFormat.Bgra8888,
+                        AlphaFormat.Premul);
+
+                    Dispatcher.UIThread.Post(() =>
                     {
                         this._writeableBitmap = wb;
+                        this._backBitmap = back;
                         this._image.Source = this._writeableBitmap;
                         this._image.InvalidateVisual();
 
-                        this._animationTimer = new DispatcherTimer
-                        {
-                            Interval = TimeSpan.FromMilliseconds(16),
-                        };
-                        this._animationTimer.Tick += this.OnRenderTick;
+                        this._clock = DispatcherAnimationClock.UIThread;
                         onLoaded?.Invoke();
-                        });
-                    }
+                    });
                 }
                 catch (Exception ex)
                 {
@@ -228,40 +215,37 @@ namespace GifBolt.Avalonia
         /// Starts playback of the animation.
         /// </summary>
         /// <remarks>
-        /// Immediately renders the current frame and starts the animation timer.
-        /// The timer interval is adjusted based on the first frame's delay.
+        /// Immediately renders the current frame and queues the next frame change on the
+        /// shared clock.
         /// </remarks>
         public override void Play()
         {
             this.Player?.Play();
             this.IsPlaying = true;
-            this._frameStartTime = DateTime.UtcNow;
+            this._frameStartTime = AnimationClock.Now;
 
             // Render the current frame immediately to avoid delay
             if (this._writeableBitmap != null && this.Player != null)
             {
                 this.RenderFrame(this.Player.CurrentFrame);
+                this.BeginPreparingNextFrame();
             }
 
-            if (this._animationTimer != null)
-            {
-                // Always use 16ms fixed interval - frame advancement is time-based, not timer-based
-                this._animationTimer.Interval = TimeSpan.FromMilliseconds(FrameTimingHelper.MinRenderIntervalMs);
-                this._animationTimer.Start();
-            }
+            // The clock wakes only when this or another animation is due
+            this._clock?.Schedule(this, this.GetFrameDeadline());
         }
 
         /// <summary>
         /// Pauses playback of the animation.
         /// </summary>
         /// <remarks>
-        /// Stops the animation timer but preserves the current frame position.
+        /// Leaves the animation clock but preserves the current frame position.
         /// </remarks>
         public override void Pause()
         {
             this.Player?.Pause();
             this.IsPlaying = false;
-            this._animationTimer?.Stop();
+            this._clock?.Unschedule(this);
         }
 
         /// <summary>
@@ -274,14 +258,14 @@ namespace GifBolt.Avalonia
         {
             this.Player?.Stop();
             this.IsPlaying = false;
-            this._animationTimer?.Stop();
+            this._clock?.Unschedule(this);
         }
 
         /// <summary>
         /// Renders a specific frame to the WriteableBitmap.
         /// </summary>
         /// <remarks>
-        /// Thread-safe method that locks the bitmap, copies pixel data, and invalidates
+        /// Thread-safe method that locks the bitmap, writes the frame into it, and invalidates
         /// the visual to trigger a redraw.
         /// </remarks>
         /// <param name="frameIndex">The index of the frame to render.</param>
@@ -294,42 +278,35 @@ namespace GifBolt.Avalonia
 
             try
             {
-                byte[] bgraPixels;
                 bool success;
-
-                // Check if scaling is disabled or enabled
-                if (this._scalingFilter == ScalingFilter.None)
-                {
-                    // Use native resolution without scaling
-                    success = this.Player.TryGetFramePixelsBgra32Premultiplied(frameIndex, out bgraPixels);
-                }
-                else
+                using (var buffer = this._writeableBitmap.Lock())
                 {
-                    // Scale to display size with selected filter
-                    int displayWidth = this._writeableBitmap.PixelSize.Width;
-                    int displayHeight = this._writeableBitmap.PixelSize.Height;
-
-                    success = this.Player.TryGetFramePixelsBgra32PremultipliedScaled(
-                        frameIndex,
-                        displayWidth,
-                        displayHeight,
-                        out bgraPixels,
-                        out int outWidth,
-                        out int outHeight,
-                        filter: this._scalingFilter);
-                }
+                    // Write straight into the locked bitmap; no managed buffers per frame
+                    int byteCount = buffer.RowBytes * buffer.Size.Height;
 
-                if (success)
-                {
-                    if (bgraPixels.Length == 0)
+                    // Check if scaling is disabled or enabled
+                    if (this._scalingFilter == ScalingFilter.None)
                     {
-                        return;
+                        // Use native resolution without scaling
+                        success = this.Player.TryCopyFramePixelsBgra32Premultiplied(
+                            frameIndex, buffer.Address, buffer.RowBytes, byteCount);
                     }
-
-                    using (var buffer = this._writeableBitmap.Lock())
+                    else
                     {
-                        Marshal.Copy(bgraPixels, 0, buffer.Address, bgraPixels.Length);
+                        // Scale to display size with selected filter
+                        success = this.Player.TryCopyFramePixelsBgra32PremultipliedScaled(
+                            frameIndex,
+                            buffer.Size.Width,
+                            buffer.Size.Height,
+                            buffer.Address,
+                            buffer.RowBytes,
+                            byteCount,
+                            filter: this._scalingFilter);
                     }
+                }
+
+                if (success)
+                {
                     this._image.InvalidateVisual();
                 }
             }
@@ -340,60 +317,166 @@ namespace GifBolt.Avalonia
         }
 
         /// <summary>
-        /// Handles the animation timer tick event.
+        /// Advances to the next frame once the current one has been shown for its delay.
         /// </summary>
         /// <remarks>
-        /// Called at regular intervals to advance frames and update the display.
+        /// Called by the shared clock in a batch with every other animation due.
         /// Respects frame delays and repeat behavior.
         /// </remarks>
-        private void OnRenderTick(object? sender, EventArgs e)
+        /// <param name="now">The clock time of the batch.</param>
+        /// <returns>The deadline of the frame shown next, or <c>null</c> once playback ends.</returns>
+        TimeSpan? IAnimationClockTarget.OnClockDue(TimeSpan now)
         {
-            if (this.Player == null || !this.IsPlaying || this._writeableBitmap == null || this._animationTimer == null)
+            if (this.Player == null || !this.IsPlaying || this._writeableBitmap == null)
             {
-                return;
+                return null;
             }
 
             try
             {
-                // Get the frame delay for the current frame (use as-is, don't clamp)
-                // GIFs are encoded with specific frame delays for a reason
-                int frameDelayMs = this.Player.GetFrameDelayMs(this.Player.CurrentFrame);
-                if (frameDelayMs <= 0)
+                TimeSpan dueTime = this.GetFrameDeadline();
+
+                // Advance to the next frame using shared helper
+                var advanceResult = FrameAdvanceHelper.AdvanceFrame(
+                    this.Player.CurrentFrame,
+                    this.Player.FrameCount,
+                    this.RepeatCount);
+
+                if (advanceResult.IsComplete)
                 {
-                    // Safety: if delay is 0 or negative, use the configured default
-                    frameDelayMs = FrameTimingHelper.DefaultMinFrameDelayMs;
+                    this.Stop();
+                    return null;
                 }
 
-                long elapsedMs = (long)(DateTime.UtcNow - this._frameStartTime).TotalMilliseconds;
+                // A frame still being prepared is looked at again with the next batch rather
+                // than waited for on the UI thread
+                if (this._preparation != null && !this._preparation.IsCompleted)
+                {
+                    return now + TimeSpan.FromMilliseconds(FrameTimingHelper.MinRenderIntervalMs);
+                }
 
-                // Only advance frame if enough time has elapsed for the current frame
-                if (elapsedMs >= frameDelayMs)
+                // Show the prepared frame, or render it here if there is none
+                if (!this.PresentPreparedFrame(advanceResult.NextFrame))
                 {
-                    // Advance to the next frame using shared helper
-                    var advanceResult = FrameAdvanceHelper.AdvanceFrame(
-                        this.Player.CurrentFrame,
-                        this.Player.FrameCount,
-                        this.RepeatCount);
+                    this.RenderFrame(advanceResult.NextFrame);
+                }
 
-                    if (advanceResult.IsComplete)
-                    {
-                        this.Stop();
-                        return;
-                    }
+                this.RepeatCount = advanceResult.UpdatedRepeatCount;
 
-                    // Update the current frame and repeat count
-                    this.Player.CurrentFrame = advanceResult.NextFrame;
-                    this.RepeatCount = advanceResult.UpdatedRepeatCount;
-                    this._frameStartTime = DateTime.UtcNow;
-                }
+                // Make the frame current and record it as shown in one native call. A new frame
+                // is late by the time from its due time until it is on screen.
+                this._frameStartTime = AnimationClock.Now;
+                this.Player.PresentFrame(advanceResult.NextFrame, (this._frameStartTime - dueTime).TotalMilliseconds);
 
-                // Always render on every tick for smooth visual feedback
-                this.RenderFrame(this.Player.CurrentFrame);
+                // Start on the frame after this one once the swap has been rendered, so the
+                // bitmap swapped out is no longer on screen when it is written
+                Dispatcher.UIThread.Post(this.BeginPreparingNextFrame, DispatcherPriority.Background);
+                return this.GetFrameDeadline();
             }
             catch
             {
-                // Suppress render errors to avoid interrupting animation loop
+                // Suppress render errors and try again with the next batch
+                return now + TimeSpan.FromMilliseconds(FrameTimingHelper.MinRenderIntervalMs);
+            }
+        }
+
+        /// <summary>
+        /// Starts writing the frame that follows the current one into the back bitmap on a
+        /// background thread.
+        /// </summary>
+        private void BeginPreparingNextFrame()
+        {
+            if (this.Player == null || !this.IsPlaying || this._backBitmap == null)
+            {
+                return;
+            }
+
+            var advanceResult = FrameAdvanceHelper.AdvanceFrame(
+                this.Player.CurrentFrame,
+                this.Player.FrameCount,
+                this.RepeatCount);
+
+            if (advanceResult.IsComplete)
+            {
+                return;
+            }
+
+            // Keep a preparation of the right frame, or one that is still writing
+            int frameIndex = advanceResult.NextFrame;
+            if (this._preparation != null &&
+                (this._preparedFrame == frameIndex || !this._preparation.IsCompleted))
+            {
+                return;
+            }
+
+            GifPlayer player = this.Player;
+            WriteableBitmap bitmap = this._backBitmap;
+            ScalingFilter filter = this._scalingFilter;
+            this._preparedFrame = frameIndex;
+            this._preparation = Task.Run(() =>
+            {
+                using (var buffer = bitmap.Lock())
+                {
+                    int byteCount = buffer.RowBytes * buffer.Size.Height;
+                    return filter == ScalingFilter.None
+                        ? player.TryCopyFramePixelsBgra32Premultiplied(frameIndex, buffer.Address, buffer.RowBytes, byteCount)
+                        : player.TryCopyFramePixelsBgra32PremultipliedScaled(
+                            frameIndex,
+                            buffer.Size.Width,
+                            buffer.Size.Height,
+                            buffer.Address,
+                            buffer.RowBytes,
+                            byteCount,
+                            filter: filter);
+                }
+            });
+        }
+
+        /// <summary>
+        /// Shows the frame prepared in the back bitmap by swapping the two bitmaps.
+        /// </summary>
+        /// <param name="frameIndex">The frame due now.</param>
+        /// <returns>true if the prepared frame was shown; false if there was none for this frame.</returns>
+        /// <remarks>The preparation must have completed.</remarks>
+        private bool PresentPreparedFrame(int frameIndex)
+        {
+            Task<bool>? preparation = this._preparation;
+            WriteableBitmap? back = this._backBitmap;
+            if (preparation == null || back == null)
+            {
+                return false;
             }
+
+            this._preparation = null;
+            if (preparation.Status != TaskStatus.RanToCompletion || !preparation.Result ||
+                this._preparedFrame != frameIndex)
+            {
+                return false;
+            }
+
+            // The bitmap shown so far receives the frame after this one
+            this._backBitmap = this._writeableBitmap;
+            this._writeableBitmap = back;
+            this._image.Source = back;
+            this._image.InvalidateVisual();
+            return true;
+        }
+
+        /// <summary>
+        /// Gets the clock time at which the current frame has been shown for its delay.
+        /// </summary>
+        /// <returns>The deadline of the current frame.</returns>
+        private TimeSpan GetFrameDeadline()
+        {
+            // Use the GIF's frame delay as-is; GIFs are encoded with specific delays for a reason
+            int frameDelayMs = this.Player?.GetFrameDelayMs(this.Player.CurrentFrame) ?? 0;
+            if (frameDelayMs <= 0)
+            {
+                // Safety: if delay is 0 or negative, use the configured default
+                frameDelayMs = FrameTimingHelper.DefaultMinFrameDelayMs;
+            }
+
+            return this._frameStartTime + TimeSpan.FromMilliseconds(frameDelayMs);
         }
 
         /// <summary>
@@ -459,7 +542,7 @@ namespace GifBolt.Avalonia
         /// Releases all resources held by the animation controller.
         /// </summary>
         /// <remarks>
-        /// Stops the animation timer and disposes the underlying player.
+        /// Leaves the animation clock and disposes the underlying player.
         /// </remarks>
         public override void Dispose()
         {
@@ -468,8 +551,11 @@ namespace GifBolt.Avalonia
             this._image.DetachedFromVisualTree -= this.OnImageDetachedFromVisualTree;
             this._image.PropertyChanged -= this.OnImagePropertyChanged;
 
-            this._animationTimer?.Stop();
-            this._animationTimer = null;
+            this.IsPlaying = false;
+            this._clock?.Unschedule(this);
+            this._clock = null;
+            this._backBitmap = null;
+            this._preparation = null;
             base.Dispose();
         }
     }
@@ -0,0 +1,250 @@
+// <copyright file="AnimationClock.cs" company="GifBolt Contributors">
+// Copyright (c) 2026 GifBolt Contributors. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the project root for full license information.
+// </copyright>
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+
+namespace GifBolt
+{
+    /// <summary>
+    /// Drives any number of animations from a single UI timer.
+    /// </summary>
+    /// <remarks>
+    /// Animations are kept in a queue ordered by deadline. The timer is armed for the earliest
+    /// deadline only, and every animation due when it fires is advanced in the same batch, so
+    /// the work on the UI thread grows with the number of frame changes rather than with the
+    /// number of animations. Batches are at least <see cref="MinTickInterval"/> apart.
+    /// A clock is not thread-safe: create one per UI thread and use it from that thread only.
+    /// </remarks>
+    public sealed class AnimationClock
+    {
+        private static readonly Stopwatch _stopwatch = Stopwatch.StartNew();
+
+        // A timer firing marginally before a deadline still advances that animation
+        private static readonly TimeSpan _dueTolerance = TimeSpan.FromMilliseconds(1);
+
+        private readonly Action<TimeSpan?> _arm;
+        private readonly SortedSet<Entry> _queue = new SortedSet<Entry>(EntryComparer.Instance);
+        private readonly Dictionary<IAnimationClockTarget, Entry> _entries =
+            new Dictionary<IAnimationClockTarget, Entry>();
+        private readonly List<Entry> _due = new List<Entry>();
+        private long _nextSequence;
+        private TimeSpan? _armedFor;
+        private TimeSpan? _lastBatch;
+        private bool _inTick;
+
+        /// <summary>
+        /// Initializes a new instance of the <see cref="AnimationClock"/> class.
+        /// </summary>
+        /// <param name="arm">
+        /// Arms the UI timer to call <see cref="Tick"/> once after the given delay, replacing
+        /// any earlier arming, or stops it when passed <c>null</c>.
+        /// </param>
+        /// <exception cref="ArgumentNullException">Thrown when arm is null.</exception>
+        public AnimationClock(Action<TimeSpan?> arm)
+        {
+            this._arm = arm ?? throw new ArgumentNullException(nameof(arm));
+            this.MinTickInterval = TimeSpan.FromMilliseconds(FrameTimingHelper.MinRenderIntervalMs);
+        }
+
+        /// <summary>
+        /// Gets the current clock time, shared by every clock in the process.
+        /// </summary>
+        public static TimeSpan Now => _stopwatch.Elapsed;
+
+        /// <summary>
+        /// Gets or sets the shortest time between two batches.
+        /// </summary>
+        public TimeSpan MinTickInterval { get; set; }
+
+        /// <summary>
+        /// Gets the number of animations waiting for a deadline.
+        /// </summary>
+        public int Count => this._entries.Count;
+
+        /// <summary>
+        /// Queues an animation for a deadline, replacing the one it was queued for.
+        /// </summary>
+        /// <param name="target">The animation.</param>
+        /// <param name="deadline">The clock time at which it is next due.</param>
+        /// <exception cref="ArgumentNullException">Thrown when target is null.</exception>
+        public void Schedule(IAnimationClockTarget target, TimeSpan deadline)
+        {
+            if (target == null)
+            {
+                throw new ArgumentNullException(nameof(target));
+            }
+
+            if (this._entries.TryGetValue(target, out Entry? entry))
+            {
+                this._queue.Remove(entry);
+            }
+            else
+            {
+                entry = new Entry(target);
+                this._entries.Add(target, entry);
+            }
+
+            entry.Deadline = deadline;
+            entry.Sequence = this._nextSequence++;
+            this._queue.Add(entry);
+            this.Rearm();
+        }
+
+        /// <summary>
+        /// Removes an animation from the queue; does nothing if it is not queued.
+        /// </summary>
+        /// <param name="target">The animation.</param>
+        public void Unschedule(IAnimationClockTarget target)
+        {
+            if (target == null || !this._entries.TryGetValue(target, out Entry? entry))
+            {
+                return;
+            }
+
+            this._queue.Remove(entry);
+            this._entries.Remove(target);
+            this.Rearm();
+        }
+
+        /// <summary>
+        /// Advances every animation whose deadline is due; called by the UI timer.
+        /// </summary>
+        public void Tick()
+        {
+            if (this._inTick)
+            {
+                return;
+            }
+
+            this._inTick = true;
+            this._armedFor = null;
+            try
+            {
+                TimeSpan now = Now;
+                while (this._queue.Count > 0 && this._queue.Min!.Deadline <= now + _dueTolerance)
+                {
+                    Entry entry = this._queue.Min!;
+                    this._queue.Remove(entry);
+                    this._entries.Remove(entry.Target);
+                    this._due.Add(entry);
+                }
+
+                if (this._due.Count > 0)
+                {
+                    this._lastBatch = now;
+                }
+
+                foreach (Entry entry in this._due)
+                {
+                    TimeSpan? next;
+                    try
+                    {
+                        next = entry.Target.OnClockDue(now);
+                    }
+                    catch
+                    {
+                        // A failing animation leaves the clock; the others keep running
+                        next = null;
+                    }
+
+                    // The target may have queued itself again (Play) while it was being advanced
+                    if (next.HasValue && !this._entries.ContainsKey(entry.Target))
+                    {
+                        entry.Deadline = next.Value;
+                        entry.Sequence = this._nextSequence++;
+                        this._entries.Add(entry.Target, entry);
+                        this._queue.Add(entry);
+                    }
+                }
+            }
+            finally
+            {
+                this._due.Clear();
+                this._inTick = false;
+            }
+
+            this.Rearm();
+        }
+
+        private void Rearm()
+        {
+            if (this._inTick)
+            {
+                return;
+            }
+
+            if (this._queue.Count == 0)
+            {
+                if (this._armedFor.HasValue)
+                {
+                    this._armedFor = null;
+                    this._arm(null);
+                }
+
+                return;
+            }
+
+            TimeSpan wake = this._queue.Min!.Deadline;
+            if (this._lastBatch.HasValue && wake < this._lastBatch.Value + this.MinTickInterval)
+            {
+                wake = this._lastBatch.Value + this.MinTickInterval;
+            }
+
+            if (this._armedFor == wake)
+            {
+                return;
+            }
+
+            this._armedFor = wake;
+            TimeSpan delay = wake - Now;
+            this._arm(delay > TimeSpan.Zero ? delay : TimeSpan.Zero);
+        }
+
+        private sealed class Entry
+        {
+            public Entry(IAnimationClockTarget target)
+            {
+                this.Target = target;
+            }
+
+            public IAnimationClockTarget Target { get; }
+
+            public TimeSpan Deadline { get; set; }
+
+            // Orders animations sharing a deadline by when they were queued
+            public long Sequence { get; set; }
+        }
+
+        private sealed class EntryComparer : IComparer<Entry>
+        {
+            public static readonly EntryComparer Instance = new EntryComparer();
+
+            public int Compare(Entry? x, Entry? y)
+            {
+                if (ReferenceEquals(x, y))
+                {
+                    return 0;
+                }
+
+                if (x == null)
+                {
+                    return -1;
+                }
+
+                if (y == null)
+                {
+                    return 1;
+                }
+
+                int byDeadline = x.Deadline.CompareTo(y.Deadline);
+                return byDeadline != 0 ? byDeadline : x.Sequence.CompareTo(y.Sequence);
+            }
+        }
+    }
+}
@@ -22,6 +22,9 @@ public sealed class GifPlayer : IDisposable
 {
     private DecoderHandle? _decoder;
 
+    // Frame delays read once per load (and minimum delay change), so ticks need no native call
+    private int[] _frameDelaysMs = Array.Empty<int>();
+
     /// <summary>Gets or sets the percentage of frames to cache (0.0 to 1.0). Default is 0.25 (25%).</summary>
     /// <remarks>Applied when a GIF is loaded. Use SetMaxCachedFrames() to override with an absolute value.</remarks>
     public float CachePercentage { get; set; } = 0.25f;
@@ -45,6 +48,13 @@ public sealed class GifPlayer : IDisposable
     /// </remarks>
     public bool EnablePrefetching { get; set; } = false;
 
+    /// <summary>Gets or sets the cache frames are shared through with other processes, or null to share none.</summary>
+    /// <remarks>
+    /// Applied when a GIF is loaded. Only GIFs read completely are shared, at their full size.
+    /// The player does not own the cache; keep it open while the player uses it.
+    /// </remarks>
+    public SharedFrameCache? SharedCache { get; set; }
+
     /// <summary>Gets the total number of frames in the GIF.</summary>
     public int FrameCount { get; private set; }
 
@@ -225,17 +235,225 @@ public sealed class GifPlayer : IDisposable
         return true;
     }
 
+    /// <summary>
+    /// Writes the BGRA32 premultiplied pixels of the specified frame into caller memory, such as a locked bitmap back buffer.
+    /// </summary>
+    /// <param name="frameIndex">The index of the frame.</param>
+    /// <param name="destination">Destination of <see cref="Height"/> rows of <see cref="Width"/> pixels.</param>
+    /// <param name="stride">Bytes from the start of one destination row to the next.</param>
+    /// <param name="byteCount">Size of the destination in bytes.</param>
+    /// <returns>true if the frame was written; false on error or if the destination is too small.</returns>
+    /// <remarks>
+    /// Allocates nothing; when <paramref name="stride"/> is <c>Width * 4</c> the frame is converted straight into the destination.
+    /// May be called from a background thread to prepare the next frame while another thread drives playback;
+    /// a player disposed meanwhile keeps its decoder until the copy returns.
+    /// </remarks>
+    public bool TryCopyFramePixelsBgra32Premultiplied(int frameIndex, IntPtr destination, int stride, int byteCount)
+    {
+        if (frameIndex < 0 || frameIndex >= this.FrameCount || destination == IntPtr.Zero)
+        {
+            return false;
+        }
+
+        DecoderHandle? decoder = this.AcquireDecoder();
+        if (decoder == null)
+        {
+            return false;
+        }
+
+        try
+        {
+            return Native.gb_decoder_copy_frame_pixels_bgra32_premultiplied(
+                decoder.DangerousGetHandle(), frameIndex, destination, stride, byteCount) != 0;
+        }
+        finally
+        {
+            decoder.DangerousRelease();
+        }
+    }
+
+    /// <summary>
+    /// Writes the BGRA32 premultiplied pixels of the specified frame, scaled to target dimensions, into caller memory.
+    /// </summary>
+    /// <param name="frameIndex">The index of the frame.</param>
+    /// <param name="targetWidth">The output width in pixels.</param>
+    /// <param name="targetHeight">The output height in pixels.</param>
+    /// <param name="destination">Destination of <paramref name="targetHeight"/> rows of <paramref name="targetWidth"/> pixels.</param>
+    /// <param name="stride">Bytes from the start of one destination row to the next.</param>
+    /// <param name="byteCount">Size of the destination in bytes.</param>
+    /// <param name="filter">The scaling filter to use (Nearest, Bilinear, Bicubic, Lanczos).</param>
+    /// <returns>true if the frame was written; false on error or if the destination is too small.</returns>
+    /// <remarks>
+    /// Allocates nothing; when <paramref name="stride"/> is <c>targetWidth * 4</c> the frame is scaled straight into the destination.
+    /// May be called from a background thread, as for <see cref="TryCopyFramePixelsBgra32Premultiplied(int, IntPtr, int, int)"/>.
+    /// </remarks>
+    public bool TryCopyFramePixelsBgra32PremultipliedScaled(int frameIndex, int targetWidth, int targetHeight,
+                                                            IntPtr destination, int stride, int byteCount,
+                                                            ScalingFilter filter = ScalingFilter.Bilinear)
+    {
+        if (frameIndex < 0 || frameIndex >= this.FrameCount || destination == IntPtr.Zero)
+        {
+            return false;
+        }
+
+        DecoderHandle? decoder = this.AcquireDecoder();
+        if (decoder == null)
+        {
+            return false;
+        }
+
+        try
+        {
+            return Native.gb_decoder_copy_frame_pixels_bgra32_premultiplied_scaled(
+                decoder.DangerousGetHandle(), frameIndex, targetWidth, targetHeight, (int)filter,
+                destination, stride, byteCount) != 0;
+        }
+        finally
+        {
+            decoder.DangerousRelease();
+        }
+    }
+
+#if NET6_0_OR_GREATER
+    /// <summary>
+    /// Writes the BGRA32 premultiplied pixels of the specified frame into a caller buffer.
+    /// </summary>
+    /// <param name="frameIndex">The index of the frame.</param>
+    /// <param name="destination">Destination of <see cref="Height"/> rows of <see cref="Width"/> pixels.</param>
+    /// <param name="stride">Bytes from the start of one destination row to the next.</param>
+    /// <returns>true if the frame was written; false on error or if the destination is too small.</returns>
+    public bool TryCopyFramePixelsBgra32Premultiplied(int frameIndex, Span<byte> destination, int stride)
+    {
+        if (frameIndex < 0 || frameIndex >= this.FrameCount)
+        {
+            return false;
+        }
+
+        DecoderHandle? decoder = this.AcquireDecoder();
+        if (decoder == null)
+        {
+            return false;
+        }
+
+        try
+        {
+            return Native.gb_decoder_copy_frame_pixels_bgra32_premultiplied(
+                decoder.DangerousGetHandle(), frameIndex, destination, stride) != 0;
+        }
+        finally
+        {
+            decoder.DangerousRelease();
+        }
+    }
+
+    /// <summary>
+    /// Writes the BGRA32 premultiplied pixels of the specified frame, scaled to target dimensions, into a caller buffer.
+    /// </summary>
+    /// <param name="frameIndex">The index of the frame.</param>
+    /// <param name="targetWidth">The output width in pixels.</param>
+    /// <param name="targetHeight">The output height in pixels.</param>
+    /// <param name="destination">Destination of <paramref name="targetHeight"/> rows of <paramref name="targetWidth"/> pixels.</param>
+    /// <param name="stride">Bytes from the start of one destination row to the next.</param>
+    /// <param name="filter">The scaling filter to use (Nearest, Bilinear, Bicubic, Lanczos).</param>
+    /// <returns>true if the frame was written; false on error or if the destination is too small.</returns>
+    public bool TryCopyFramePixelsBgra32PremultipliedScaled(int frameIndex, int targetWidth, int targetHeight,
+                                                            Span<byte> destination, int stride,
+                                                            ScalingFilter filter = ScalingFilter.Bilinear)
+    {
+        if (frameIndex < 0 || frameIndex >= this.FrameCount)
+        {
+            return false;
+        }
+
+        DecoderHandle? decoder = this.AcquireDecoder();
+        if (decoder == null)
+        {
+            return false;
+        }
+
+        try
+        {
+            return Native.gb_decoder_copy_frame_pixels_bgra32_premultiplied_scaled(
+                decoder.DangerousGetHandle(), frameIndex, targetWidth, targetHeight, (int)filter,
+                destination, stride) != 0;
+        }
+        finally
+        {
+            decoder.DangerousRelease();
+        }
+    }
+#endif
+
     /// <summary>Gets the display duration of the specified frame.</summary>
     /// <param name="frameIndex">The index of the frame.</param>
     /// <returns>The frame delay in milliseconds.</returns>
     public int GetFrameDelayMs(int frameIndex)
     {
-        if (this._decoder == null || frameIndex < 0 || frameIndex >= this.FrameCount)
+        int[] delays = this._frameDelaysMs;
+        return frameIndex >= 0 && frameIndex < delays.Length ? delays[frameIndex] : 0;
+    }
+
+    /// <summary>
+    /// Gets what kinds of alpha the specified composed frame contains.
+    /// </summary>
+    /// <param name="frameIndex">The index of the frame.</param>
+    /// <returns>
+    /// <see cref="FrameAlpha.Opaque"/> when the frame can be shown without blending, or
+    /// <see cref="FrameAlpha.Translucent"/> when it is unknown or on error.
+    /// </returns>
+    /// <remarks>Composes the frame if it is not cached; the class itself costs no pixel pass.</remarks>
+    public FrameAlpha GetFrameAlpha(int frameIndex)
+    {
+        if (frameIndex < 0 || frameIndex >= this.FrameCount)
+        {
+            return FrameAlpha.Translucent;
+        }
+
+        DecoderHandle? decoder = this.AcquireDecoder();
+        if (decoder == null)
         {
-            return 0;
+            return FrameAlpha.Translucent;
         }
 
-        return Native.gb_decoder_get_frame_delay_ms(this._decoder.DangerousGetHandle(), frameIndex);
+        try
+        {
+            int alpha = Native.gb_decoder_get_frame_alpha(decoder.DangerousGetHandle(), frameIndex);
+            return alpha < 0 ? FrameAlpha.Translucent : (FrameAlpha)alpha;
+        }
+        finally
+        {
+            decoder.DangerousRelease();
+        }
+    }
+
+    /// <summary>
+    /// Builds a small, low frame rate copy of the loaded GIF that plays without a decoder.
+    /// </summary>
+    /// <param name="maxWidth">Width of the box the preview is fitted into, keeping the aspect ratio.</param>
+    /// <param name="maxHeight">Height of the box the preview is fitted into.</param>
+    /// <param name="maxFps">Highest frame rate kept; 0 keeps every frame.</param>
+    /// <returns>The preview, or null if no GIF is loaded or the arguments are invalid.</returns>
+    /// <remarks>
+    /// Composes every frame once and blocks until the whole GIF has been read; the player can be
+    /// disposed afterwards. Call from the thread that drives playback.
+    /// </remarks>
+    public GifPreview? CreatePreview(int maxWidth = 128, int maxHeight = 128, int maxFps = 12)
+    {
+        DecoderHandle? decoder = this.AcquireDecoder();
+        if (decoder == null)
+        {
+            return null;
+        }
+
+        try
+        {
+            return GifPreview.FromHandle(
+                Native.gb_preview_create(decoder.DangerousGetHandle(), maxWidth, maxHeight, maxFps));
+        }
+        finally
+        {
+            decoder.DangerousRelease();
+        }
     }
 
     /// <summary>
@@ -247,6 +465,7 @@ public sealed class GifPlayer : IDisposable
         if (this._decoder != null)
         {
             Native.gb_decoder_set_min_frame_delay_ms(this._decoder.DangerousGetHandle(), minDelayMs);
+            this.ReadInfo();
         }
     }
 
@@ -293,16 +512,218 @@ public sealed class GifPlayer : IDisposable
     /// </summary>
     /// <remarks>
     /// Call this when looping back to frame 0 to ensure proper frame composition
-    /// without reloading the entire GIF.
+    /// without reloading the entire GIF. May be called from the thread that prepares frames.
     /// </remarks>
     public void ResetCanvas()
+    {
+        DecoderHandle? decoder = this.AcquireDecoder();
+        if (decoder == null)
+        {
+            return;
+        }
+
+        try
+        {
+            Native.gb_decoder_reset_canvas(decoder.DangerousGetHandle());
+        }
+        finally
+        {
+            decoder.DangerousRelease();
+        }
+    }
+
+    /// <summary>
+    /// Releases decoder memory that can be rebuilt on demand.
+    /// </summary>
+    /// <param name="level">How aggressively to trim.</param>
+    /// <returns>The number of bytes freed.</returns>
+    /// <remarks>
+    /// May be called from any thread. Pixel pointers obtained earlier become invalid, so do not use them while a trim may run.
+    /// </remarks>
+    public long TrimMemory(MemoryTrimLevel level)
+    {
+        if (this._decoder != null)
+        {
+            return Native.gb_decoder_trim_memory(this._decoder.DangerousGetHandle(), (int)level);
+        }
+        return 0;
+    }
+
+    /// <summary>
+    /// Releases rebuildable memory from every decoder in the process.
+    /// </summary>
+    /// <param name="level">How aggressively to trim.</param>
+    /// <returns>The total number of bytes freed.</returns>
+    /// <remarks>
+    /// Intended for OS memory-pressure notifications, from any thread. Invalidates the pixel pointers of every player.
+    /// </remarks>
+    public static long TrimAllMemory(MemoryTrimLevel level) => Native.gb_trim_memory((int)level);
+
+    /// <summary>
+    /// Gets the work counters and memory footprint of this player's decoder.
+    /// </summary>
+    /// <returns>The decoder statistics, or all zeros when no GIF is loaded.</returns>
+    /// <remarks>
+    /// Call from the thread that drives this player.
+    /// </remarks>
+    public DecoderStats GetStats()
+    {
+        if (this._decoder != null && Native.gb_decoder_get_stats(this._decoder.DangerousGetHandle(), out DecoderStats stats) != 0)
+        {
+            return stats;
+        }
+        return default;
+    }
+
+    /// <summary>
+    /// Gets the statistics summed over every decoder in the process, including destroyed ones.
+    /// </summary>
+    /// <returns>The process-wide statistics.</returns>
+    public static DecoderStats GetProcessStats()
+    {
+        Native.gb_get_process_stats(out DecoderStats stats);
+        return stats;
+    }
+
+    /// <summary>
+    /// Records that a frame was shown, for playback quality statistics.
+    /// </summary>
+    /// <param name="frameIndex">The frame shown.</param>
+    /// <param name="latenessMs">Time from the frame's due time until it was shown, in milliseconds; 0 or less if on time.</param>
+    /// <param name="droppedFrames">Frames skipped without being shown, to catch up, before this one.</param>
+    /// <remarks>
+    /// Call right after presenting the frame, from any thread. A frame more than
+    /// 17 ms late is charged to its cause: a late tick, the frame not being ready, conversion or lock waits.
+    /// </remarks>
+    public void RecordFramePresented(int frameIndex, double latenessMs, int droppedFrames = 0)
     {
         if (this._decoder != null)
         {
-            Native.gb_decoder_reset_canvas(this._decoder.DangerousGetHandle());
+            Native.gb_decoder_record_frame_presented(
+                this._decoder.DangerousGetHandle(), frameIndex, (long)(latenessMs * 1000000.0), droppedFrames);
+        }
+    }
+
+    /// <summary>
+    /// Makes a frame the current one and records that it was shown, in a single native call.
+    /// </summary>
+    /// <param name="frameIndex">The frame shown.</param>
+    /// <param name="latenessMs">Time from the frame's due time until it was shown, in milliseconds; 0 or less if on time.</param>
+    /// <param name="droppedFrames">Frames skipped without being shown, to catch up, before this one.</param>
+    /// <returns>The frame's delay and the loading progress, or all zeros when no GIF is loaded.</returns>
+    /// <remarks>
+    /// Does what setting <see cref="CurrentFrame"/> and calling <see cref="RecordFramePresented"/> do,
+    /// for render loops that present a frame on every tick.
+    /// </remarks>
+    public FrameStatus PresentFrame(int frameIndex, double latenessMs, int droppedFrames = 0)
+    {
+        this._currentFrame = frameIndex;
+        if (this._decoder != null &&
+            Native.gb_decoder_present_frame(
+                this._decoder.DangerousGetHandle(), frameIndex, (long)(latenessMs * 1000000.0), droppedFrames, out FrameStatus status) != 0)
+        {
+            return status;
+        }
+        return default;
+    }
+
+    /// <summary>
+    /// Gets the playback quality recorded for this player.
+    /// </summary>
+    /// <returns>The playback statistics, or all zeros when no GIF is loaded.</returns>
+    public PlaybackStats GetPlaybackStats()
+    {
+        if (this._decoder != null && Native.gb_decoder_get_playback_stats(this._decoder.DangerousGetHandle(), out PlaybackStats stats) != 0)
+        {
+            return stats;
         }
+        return default;
+    }
+
+    /// <summary>
+    /// Gets the playback quality summed over every player in the process, including destroyed ones.
+    /// </summary>
+    /// <returns>The process-wide playback statistics; the number to alert on in production.</returns>
+    public static PlaybackStats GetProcessPlaybackStats()
+    {
+        Native.gb_get_process_playback_stats(out PlaybackStats stats);
+        return stats;
     }
 
+    /// <summary>
+    /// Starts recording a timeline of native decode, compose, convert and scale work across threads.
+    /// </summary>
+    /// <returns><c>true</c> if tracing started; <c>false</c> if the native library was built without it.</returns>
+    public static bool StartTracing() => Native.gb_trace_start() != 0;
+
+    /// <summary>
+    /// Stops recording the native timeline; the recording is kept for <see cref="DumpTrace"/>.
+    /// </summary>
+    public static void StopTracing() => Native.gb_trace_stop();
+
+    /// <summary>
+    /// Writes the recorded timeline as Chrome trace-event JSON, viewable in Perfetto.
+    /// </summary>
+    /// <param name="path">Output file path.</param>
+    /// <returns><c>true</c> if the file was written.</returns>
+    public static bool DumpTrace(string path) => Native.gb_trace_dump(path) != 0;
+
+    /// <summary>
+    /// Starts recording every native call, with its arguments, thread and timing, so that the
+    /// session can be replayed offline with GifBolt.Replay.
+    /// </summary>
+    /// <param name="path">Output file path; overwritten.</param>
+    /// <param name="embedBuffers"><c>true</c> to store GIFs loaded from memory in the recording,
+    /// so that it replays without them; <c>false</c> to store content hashes only.</param>
+    /// <returns><c>true</c> if recording started.</returns>
+    public static bool StartCallRecording(string path, bool embedBuffers = false)
+        => Native.gb_record_start(path, embedBuffers ? Native.GB_RECORD_EMBED_BUFFERS : 0) != 0;
+
+    /// <summary>
+    /// Stops recording native calls and closes the recording file.
+    /// </summary>
+    public static void StopCallRecording() => Native.gb_record_stop();
+
+    /// <summary>
+    /// Replaces the built-in threading and GPU offload thresholds with ones measured on this
+    /// host. The profile is read from <paramref name="profilePath"/> if it was measured on a
+    /// host like this one; otherwise the native kernels are timed (a few hundred
+    /// milliseconds) and the result is saved there.
+    /// </summary>
+    /// <param name="profilePath">Profile file, or <c>null</c> to calibrate without saving.</param>
+    /// <returns>The profile in effect; players loading GIFs from now on use it.</returns>
+    public static TuningProfile Calibrate(string? profilePath = null)
+    {
+        if (Native.gb_calibrate(profilePath, out TuningProfile profile) == 0)
+        {
+            throw new InvalidOperationException("Calibration failed.");
+        }
+
+        return profile;
+    }
+
+    /// <summary>
+    /// Gets the threading and GPU offload thresholds in effect.
+    /// </summary>
+    /// <returns>The profile in effect.</returns>
+    public static TuningProfile GetTuningProfile()
+    {
+        Native.gb_get_tuning_profile(out TuningProfile profile);
+        return profile;
+    }
+
+    /// <summary>
+    /// Replaces the threading and GPU offload thresholds for players loading GIFs from now on.
+    /// </summary>
+    /// <param name="profile">The thresholds; zero thread counts take the host defaults.</param>
+    public static void SetTuningProfile(TuningProfile profile)
+        => Native.gb_set_tuning_profile(ref profile);
+
+    /// <summary>
+    /// Restores the built-in threading and GPU offload thresholds.
+    /// </summary>
+    public static void ResetTuningProfile() => Native.gb_reset_tuning_profile();
+
     /// <summary>Releases the unmanaged resources associated with the player.</summary>
     public void Dispose()
     {
@@ -310,6 +731,31 @@ public sealed class GifPlayer : IDisposable
         GC.SuppressFinalize(this);
     }
 
+    /// <summary>
+    /// Takes a reference on the decoder, so that it outlives a concurrent <see cref="Dispose"/>.
+    /// </summary>
+    /// <returns>The decoder, to release with <see cref="SafeHandle.DangerousRelease"/>; or null if there is none.</returns>
+    private DecoderHandle? AcquireDecoder()
+    {
+        DecoderHandle? decoder = this._decoder;
+        if (decoder == null)
+        {
+            return null;
+        }
+
+        bool added = false;
+        try
+        {
+            decoder.DangerousAddRef(ref added);
+        }
+        catch (ObjectDisposedException)
+        {
+            // Disposed between reading the field and taking the reference
+        }
+
+        return added ? decoder : null;
+    }
+
     private void DisposeDecoder()
     {
         if (this._decoder != null)
@@ -318,6 +764,7 @@ public sealed class GifPlayer : IDisposable
             Native.gb_decoder_stop_prefetching(this._decoder.DangerousGetHandle());
             this._decoder.Dispose();
             this._decoder = null;
+            this._frameDelaysMs = Array.Empty<int>();
         }
     }
 
@@ -378,22 +825,50 @@ public sealed class GifPlayer : IDisposable
     private void AssignDecoder(DecoderHandle handle)
     {
         this._decoder = handle;
-        this.Width = Native.gb_decoder_get_width(this._decoder.DangerousGetHandle());
-        this.Height = Native.gb_decoder_get_height(this._decoder.DangerousGetHandle());
-        this.FrameCount = Native.gb_decoder_get_frame_count(this._decoder.DangerousGetHandle());
-        this.IsLooping = Native.gb_decoder_get_loop_count(this._decoder.DangerousGetHandle()) < 0;
+        this.ReadInfo();
         this.CurrentFrame = 0;
 
         // Set adaptive cache size based on frame count
         uint adaptiveCacheSize = this.CalculateAdaptiveCacheSize();
         Native.gb_decoder_set_max_cached_frames(this._decoder.DangerousGetHandle(), adaptiveCacheSize);
 
+        IntPtr sharedCache = this.SharedCache?.GetHandle() ?? IntPtr.Zero;
+        if (sharedCache != IntPtr.Zero)
+        {
+            Native.gb_decoder_set_shared_cache(this._decoder.DangerousGetHandle(), sharedCache);
+        }
+
         if (this.EnablePrefetching)
         {
             Native.gb_decoder_start_prefetching(this._decoder.DangerousGetHandle(), 0);
         }
     }
 
+    /// <summary>
+    /// Reads the dimensions, frame count, looping and frame delays of the loaded GIF in one call.
+    /// </summary>
+    private void ReadInfo()
+    {
+        if (this._decoder == null || Native.gb_decoder_get_info(this._decoder.DangerousGetHandle(), out DecoderInfo info) == 0)
+        {
+            return;
+        }
+
+        this.Width = info.Width;
+        this.Height = info.Height;
+        this.FrameCount = info.FrameCount;
+        this.IsLooping = info.LoopCount < 0;
+
+        // The native array changes with the next load, so keep a copy
+        var delays = new int[Math.Max(0, info.FrameCount)];
+        if (delays.Length > 0 && info.FrameDelaysMs != IntPtr.Zero)
+        {
+            Marshal.Copy(info.FrameDelaysMs, delays, 0, delays.Length);
+        }
+
+        this._frameDelaysMs = delays;
+    }
+
     private uint CalculateAdaptiveCacheSize()
     {
         if (this.FrameCount <= 0)
@@ -0,0 +1,160 @@
+// <copyright file="GifPreview.cs" company="GifBolt Contributors">
+// Copyright (c) 2026 GifBolt Contributors. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the project root for full license information.
+// </copyright>
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+using GifBolt.Internal;
+using System;
+using System.Runtime.InteropServices;
+
+namespace GifBolt;
+
+/// <summary>
+/// A small, low frame rate copy of an animation for hover previews and list tiles.
+/// Plays without a decoder: frames are stored palette-indexed, quantized to 256 colors when they have more,
+/// so a tile costs one palette lookup per pixel instead of decoding and scaling the source.
+/// </summary>
+public sealed class GifPreview : IDisposable
+{
+    private PreviewHandle? _preview;
+    private int[] _frameDelaysMs = Array.Empty<int>();
+    private int[] _sourceFrames = Array.Empty<int>();
+
+    private GifPreview(PreviewHandle preview)
+    {
+        this._preview = preview;
+        Native.gb_preview_get_info(preview.DangerousGetHandle(), out PreviewInfo info);
+        this.Width = info.Width;
+        this.Height = info.Height;
+        this.FrameCount = info.FrameCount;
+        this.IsLooping = info.LoopCount == -1;
+        this.IsIndexed = info.Indexed != 0;
+        this.MemoryBytes = info.MemoryBytes;
+        if (info.FrameCount > 0)
+        {
+            this._frameDelaysMs = new int[info.FrameCount];
+            this._sourceFrames = new int[info.FrameCount];
+            Marshal.Copy(info.FrameDelaysMs, this._frameDelaysMs, 0, info.FrameCount);
+            Marshal.Copy(info.SourceFrames, this._sourceFrames, 0, info.FrameCount);
+        }
+    }
+
+    /// <summary>Gets the width of the preview in pixels.</summary>
+    public int Width { get; }
+
+    /// <summary>Gets the height of the preview in pixels.</summary>
+    public int Height { get; }
+
+    /// <summary>Gets the number of frames kept.</summary>
+    public int FrameCount { get; }
+
+    /// <summary>Gets a value indicating whether the source GIF loops indefinitely.</summary>
+    public bool IsLooping { get; }
+
+    /// <summary>Gets a value indicating whether the pixels are stored palette-indexed.</summary>
+    public bool IsIndexed { get; }
+
+    /// <summary>Gets the native memory the preview holds, in bytes.</summary>
+    public int MemoryBytes { get; }
+
+    /// <summary>
+    /// Reads a preview written by <see cref="Save"/>.
+    /// </summary>
+    /// <param name="path">Path of the preview file.</param>
+    /// <returns>The preview, or null if the file cannot be read or is not a preview.</returns>
+    public static GifPreview? Load(string path)
+    {
+        if (string.IsNullOrEmpty(path))
+        {
+            return null;
+        }
+
+        return FromHandle(Native.gb_preview_load(path));
+    }
+
+    /// <summary>
+    /// Writes the preview to a file, so that tiles can be shown without reading the source GIF.
+    /// </summary>
+    /// <param name="path">Path of the preview file; replaced if it exists.</param>
+    /// <returns>true if the file was written; otherwise false.</returns>
+    public bool Save(string path)
+    {
+        if (this._preview == null || string.IsNullOrEmpty(path))
+        {
+            return false;
+        }
+
+        return Native.gb_preview_save(this._preview.DangerousGetHandle(), path) != 0;
+    }
+
+    /// <summary>
+    /// Gets the display duration of a frame; a dropped source frame's time is added to the kept frame before it.
+    /// </summary>
+    /// <param name="frameIndex">The index of the frame.</param>
+    /// <returns>The delay in milliseconds.</returns>
+    public int GetFrameDelayMs(int frameIndex) => this._frameDelaysMs[frameIndex];
+
+    /// <summary>
+    /// Gets the index of the source frame a preview frame was made from, so that playback can continue
+    /// at the same point once a <see cref="GifPlayer"/> takes over.
+    /// </summary>
+    /// <param name="frameIndex">The index of the preview frame.</param>
+    /// <returns>The index of the source frame.</returns>
+    public int GetSourceFrame(int frameIndex) => this._sourceFrames[frameIndex];
+
+    /// <summary>
+    /// Writes the BGRA32 premultiplied pixels of a frame into caller memory.
+    /// </summary>
+    /// <param name="frameIndex">The index of the frame.</param>
+    /// <param name="destination">Destination of <see cref="Height"/> rows of <see cref="Width"/> pixels.</param>
+    /// <param name="stride">Bytes from the start of one destination row to the next.</param>
+    /// <param name="byteCount">Size of the destination in bytes.</param>
+    /// <returns>true if the frame was written; false on error or if the destination is too small.</returns>
+    /// <remarks>May be called from any thread.</remarks>
+    public bool TryCopyFramePixelsBgra32Premultiplied(int frameIndex, IntPtr destination, int stride, int byteCount)
+    {
+        PreviewHandle? preview = this._preview;
+        if (preview == null || frameIndex < 0 || frameIndex >= this.FrameCount || destination == IntPtr.Zero)
+        {
+            return false;
+        }
+
+        bool added = false;
+        try
+        {
+            preview.DangerousAddRef(ref added);
+            return Native.gb_preview_copy_frame_pixels_bgra32_premultiplied(
+                preview.DangerousGetHandle(), frameIndex, destination, stride, byteCount) != 0;
+        }
+        catch (ObjectDisposedException)
+        {
+            return false;
+        }
+        finally
+        {
+            if (added)
+            {
+                preview.DangerousRelease();
+            }
+        }
+    }
+
+    /// <summary>Releases the native preview.</summary>
+    public void Dispose()
+    {
+        this._preview?.Dispose();
+        this._preview = null;
+    }
+
+    /// <summary>
+    /// Wraps a native preview, or returns null for a failed call.
+    /// </summary>
+    /// <param name="handle">Handle returned by gb_preview_create or gb_preview_load.</param>
+    /// <returns>The preview, or null if <paramref name="handle"/> is null.</returns>
+    internal static GifPreview? FromHandle(IntPtr handle)
+    {
+        return handle == IntPtr.Zero ? null : new GifPreview(new PreviewHandle(handle));
+    }
+}
@@ -0,0 +1,24 @@
+// <copyright file="IAnimationClockTarget.cs" company="GifBolt Contributors">
+// Copyright (c) 2026 GifBolt Contributors. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the project root for full license information.
+// </copyright>
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+using System;
+
+namespace GifBolt
+{
+    /// <summary>
+    /// An animation driven by an <see cref="AnimationClock"/>.
+    /// </summary>
+    public interface IAnimationClockTarget
+    {
+        /// <summary>
+        /// Advances the animation once its deadline is due.
+        /// </summary>
+        /// <param name="now">The clock time of the batch the call belongs to.</param>
+        /// <returns>The clock time of the next deadline, or <c>null</c> to leave the clock.</returns>
+        TimeSpan? OnClockDue(TimeSpan now);
+    }
+}
@@ -30,10 +30,299 @@ namespace GifBolt
         /// <summary>Lanczos resampling - highest quality, slowest.</summary>
         Lanczos = 3,
     }
+
+    /// <summary>
+    /// How much decoder memory to release under memory pressure.
+    /// Each level also performs the steps of the levels below it.
+    /// </summary>
+    public enum MemoryTrimLevel
+    {
+        /// <summary>Drop converted, scaled and mip caches.</summary>
+        Caches = 0,
+
+        /// <summary>Also drop cached frames except the most recently used one.</summary>
+        ColdFrames = 1,
+
+        /// <summary>Also drop every cached frame and the composition canvases.</summary>
+        Composition = 2,
+
+        /// <summary>Also release pooled buffers and arenas.</summary>
+        Complete = 3,
+    }
+
+    /// <summary>
+    /// Work counters and memory footprint of a decoder, or of every decoder in the process.
+    /// Counters accumulate from the decoder's creation; byte counts describe what is held now.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct DecoderStats
+    {
+        /// <summary>Composed frames served from the frame cache.</summary>
+        public ulong FrameCacheHits;
+
+        /// <summary>Composed frames copied into the frame cache.</summary>
+        public ulong FrameCacheMisses;
+
+        /// <summary>Frames dropped from the frame cache.</summary>
+        public ulong FrameCacheEvictions;
+
+        /// <summary>Scaled requests served from a cached mip chain.</summary>
+        public ulong MipCacheHits;
+
+        /// <summary>Scaled requests that had to build a mip chain.</summary>
+        public ulong MipCacheMisses;
+
+        /// <summary>Mip chains dropped from the mip cache.</summary>
+        public ulong MipCacheEvictions;
+
+        /// <summary>Frame rasters LZW-decoded while reading the GIF.</summary>
+        public ulong FramesDecoded;
+
+        /// <summary>Frames color-mapped and composed onto the canvas.</summary>
+        public ulong FramesComposed;
+
+        /// <summary>Frames converted to BGRA premultiplied.</summary>
+        public ulong FramesConverted;
+
+        /// <summary>Scaled frames returned.</summary>
+        public ulong FramesScaled;
+
+        /// <summary>Wall time reading rasters, in nanoseconds (includes waiting for streamed bytes).</summary>
+        public ulong LzwTimeNs;
+
+        /// <summary>Wall time color mapping and composing, in nanoseconds.</summary>
+        public ulong ComposeTimeNs;
+
+        /// <summary>Wall time converting to BGRA premultiplied, in nanoseconds.</summary>
+        public ulong ConvertTimeNs;
+
+        /// <summary>Wall time building mip chains and resampling, in nanoseconds.</summary>
+        public ulong ScaleTimeNs;
+
+        /// <summary>CPU time of every thread while working for the decoder, in nanoseconds.</summary>
+        public ulong ThreadCpuTimeNs;
+
+        /// <summary>Bytes held by color-indexed rasters and color maps.</summary>
+        public ulong RasterBytes;
+
+        /// <summary>Bytes held by the composition canvases and frames composed ahead.</summary>
+        public ulong CanvasBytes;
+
+        /// <summary>Bytes held by the frame, converted, scaled and mip caches.</summary>
+        public ulong CacheBytes;
+
+        /// <summary>Bytes held by idle pooled buffers, arenas and spare mip chains.</summary>
+        public ulong PoolBytes;
+    }
+
+    /// <summary>
+    /// Presentation quality of a player's playback, or of every player in the process,
+    /// as reported with <see cref="GifPlayer.RecordFramePresented"/>.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct PlaybackStats
+    {
+        /// <summary>Buckets of <see cref="LatenessHistogram"/>.</summary>
+        public const int LatenessBucketCount = 12;
+
+        /// <summary>Frames shown.</summary>
+        public ulong FramesPresented;
+
+        /// <summary>Frames shown more than 17 ms (one 60 Hz refresh) past their due time.</summary>
+        public ulong FramesLate;
+
+        /// <summary>Frames skipped without being shown, to catch up.</summary>
+        public ulong FramesDropped;
+
+        /// <summary>Late frames whose tick itself ran late (busy UI thread, timer slack).</summary>
+        public ulong LateSchedule;
+
+        /// <summary>Late frames that had not been read or composed when due.</summary>
+        public ulong LateDecodeNotReady;
+
+        /// <summary>Late frames held up by conversion or scaling.</summary>
+        public ulong LateConversion;
+
+        /// <summary>Late frames held up waiting for a background decode to release the decoder.</summary>
+        public ulong LateLockWait;
+
+        /// <summary>Lateness summed over the frames shown, in nanoseconds.</summary>
+        public ulong TotalLatenessNs;
+
+        /// <summary>Largest lateness of a frame shown, in nanoseconds.</summary>
+        public ulong MaxLatenessNs;
+
+        /// <summary>
+        /// Frames shown by lateness: [0] under 1 ms, [i] from 2^(i-1) to 2^i ms, [11] 1024 ms and up.
+        /// </summary>
+        [MarshalAs(UnmanagedType.ByValArray, SizeConst = LatenessBucketCount)]
+        public ulong[] LatenessHistogram;
+    }
+
+    /// <summary>
+    /// Where the thresholds of a <see cref="TuningProfile"/> came from.
+    /// </summary>
+    public enum TuningSource : uint
+    {
+        /// <summary>Built-in defaults.</summary>
+        Defaults = 0,
+
+        /// <summary>Measured on this host.</summary>
+        Calibrated = 1,
+
+        /// <summary>Read from a profile file measured earlier on this host.</summary>
+        Loaded = 2,
+
+        /// <summary>Set by the application.</summary>
+        Host = 3,
+    }
+
+    /// <summary>
+    /// Threading and GPU offload thresholds shared by every player in the process.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct TuningProfile
+    {
+        /// <summary>Frames of at least this many pixels are converted on several threads.</summary>
+        public ulong ConvertParallelMinPixels;
+
+        /// <summary>Threads a parallel conversion is split across, the calling thread included.</summary>
+        public uint ConvertThreads;
+
+        /// <summary>Worker threads in each decoder's pool.</summary>
+        public uint WorkerThreads;
+
+        /// <summary>Smallest source, in pixels, scaled on the GPU; <see cref="ulong.MaxValue"/> never.</summary>
+        public ulong GpuScaleMinPixels;
+
+        /// <summary>Hardware threads of the host the profile was measured on.</summary>
+        public uint HardwareThreads;
+
+        /// <summary>Where the thresholds came from.</summary>
+        public TuningSource Source;
+    }
+
+    /// <summary>
+    /// State of a player after a frame was shown, as returned by <see cref="GifPlayer.PresentFrame"/>.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct FrameStatus
+    {
+        /// <summary>Display duration of the frame shown, in milliseconds.</summary>
+        public int FrameDelayMs;
+
+        /// <summary>Frames read so far.</summary>
+        public int AvailableFrameCount;
+
+        /// <summary>1 once every frame has been read; 0 while frames are still arriving.</summary>
+        public int LoadComplete;
+    }
+
+    /// <summary>
+    /// What kinds of alpha a composed frame contains.
+    /// </summary>
+    public enum FrameAlpha
+    {
+        /// <summary>Every pixel is opaque; the frame can be drawn without blending.</summary>
+        Opaque = 0,
+
+        /// <summary>Pixels are opaque or fully transparent.</summary>
+        Binary = 1,
+
+        /// <summary>Partial alpha may be present.</summary>
+        Translucent = 2,
+    }
+
+    /// <summary>
+    /// Occupancy of a shared frame cache and this process's use of it.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct SharedCacheStats
+    {
+        /// <summary>Lookups by this process that mapped a frame.</summary>
+        public ulong Hits;
+
+        /// <summary>Lookups by this process that found nothing.</summary>
+        public ulong Misses;
+
+        /// <summary>Frames this process published.</summary>
+        public ulong Inserts;
+
+        /// <summary>Frames this process evicted to stay within the budget.</summary>
+        public ulong Evictions;
+
+        /// <summary>Frames in the cache, over all processes.</summary>
+        public ulong Entries;
+
+        /// <summary>Bytes of those frames.</summary>
+        public ulong UsedBytes;
+
+        /// <summary>Byte budget, set by the process that created the cache.</summary>
+        public ulong BudgetBytes;
+    }
 }
 
 namespace GifBolt.Internal
 {
+    /// <summary>
+    /// Description of a loaded GIF, laid out as gb_decoder_info_t.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    internal struct DecoderInfo
+    {
+        /// <summary>Width in pixels.</summary>
+        public int Width;
+
+        /// <summary>Height in pixels.</summary>
+        public int Height;
+
+        /// <summary>Total number of frames.</summary>
+        public int FrameCount;
+
+        /// <summary>-1 if the GIF loops indefinitely; 0 otherwise.</summary>
+        public int LoopCount;
+
+        /// <summary>Background color as 0xAABBGGRR.</summary>
+        public uint BackgroundColor;
+
+        /// <summary>Minimum applied to every frame delay, in milliseconds.</summary>
+        public int MinFrameDelayMs;
+
+        /// <summary>FrameCount delays in milliseconds, owned by the decoder.</summary>
+        public IntPtr FrameDelaysMs;
+    }
+
+    /// <summary>
+    /// Description of a preview proxy, laid out as gb_preview_info_t.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    internal struct PreviewInfo
+    {
+        /// <summary>Width in pixels.</summary>
+        public int Width;
+
+        /// <summary>Height in pixels.</summary>
+        public int Height;
+
+        /// <summary>Frames kept.</summary>
+        public int FrameCount;
+
+        /// <summary>-1 if the source loops indefinitely; 0 otherwise.</summary>
+        public int LoopCount;
+
+        /// <summary>1 if pixels are stored palette-indexed.</summary>
+        public int Indexed;
+
+        /// <summary>Memory the proxy holds, in bytes.</summary>
+        public int MemoryBytes;
+
+        /// <summary>FrameCount delays in milliseconds, owned by the proxy.</summary>
+        public IntPtr FrameDelaysMs;
+
+        /// <summary>FrameCount source frame indices, owned by the proxy.</summary>
+        public IntPtr SourceFrames;
+    }
+
     /// <summary>
     /// Manual P/Invoke for GifBolt.Native using LoadLibrary + GetProcAddress.
     /// Provides managed access to native decoder functions without delay-load dependencies.
@@ -50,14 +339,32 @@ namespace GifBolt.Internal
         private static GbDecoderGetHeightDelegate? _gbDecoderGetHeight;
         private static GbDecoderGetLoopCountDelegate? _gbDecoderGetLoopCount;
         private static GbDecoderGetFrameDelayMsDelegate? _gbDecoderGetFrameDelayMs;
+        private static GbDecoderGetFrameAlphaDelegate? _gbDecoderGetFrameAlpha;
         private static GbDecoderGetFramePixelsRgba32Delegate? _gbDecoderGetFramePixelsRgba32;
         private static GbDecoderGetFramePixelsBgra32PremultipliedDelegate? _gbDecoderGetFramePixelsBgra32Premultiplied;
         private static GbDecoderGetBackgroundColorDelegate? _gbDecoderGetBackgroundColor;
         private static GbDecoderSetMinFrameDelayMsDelegate? _gbDecoderSetMinFrameDelayMs;
-        private static GbDecoderGetMinFrameDelayMsDelegate? _gbDecoderGetMinFrameDelayMs;
         private static GbDecoderSetMaxCachedFramesDelegate? _gbDecoderSetMaxCachedFrames;
+#if NET6_0_OR_GREATER
+        // Called on every load or tick, so invoked through function pointers instead of
+        // marshalling delegates; the getters that neither block nor lock also skip the GC transition
+        private static unsafe delegate* unmanaged[Cdecl]<IntPtr, DecoderInfo*, int> _gbDecoderGetInfo;
+        private static unsafe delegate* unmanaged[Cdecl]<IntPtr, int, long, int, FrameStatus*, int> _gbDecoderPresentFrame;
+        private static unsafe delegate* unmanaged[Cdecl, SuppressGCTransition]<IntPtr, int> _gbDecoderGetMinFrameDelayMs;
+        private static unsafe delegate* unmanaged[Cdecl, SuppressGCTransition]<IntPtr, uint> _gbDecoderGetMaxCachedFrames;
+#else
+        private static GbDecoderGetInfoDelegate? _gbDecoderGetInfo;
+        private static GbDecoderPresentFrameDelegate? _gbDecoderPresentFrame;
+        private static GbDecoderGetMinFrameDelayMsDelegate? _gbDecoderGetMinFrameDelayMs;
         private static GbDecoderGetMaxCachedFramesDelegate? _gbDecoderGetMaxCachedFrames;
+#endif
         private static GbDecoderGetFramePixelsBgra32PremultipliedScaledDelegate? _gbDecoderGetFramePixelsBgra32PremultipliedScaled;
+        private static GbDecoderCopyFramePixelsBgra32PremultipliedDelegate? _gbDecoderCopyFramePixelsBgra32Premultiplied;
+        private static GbDecoderCopyFramePixelsBgra32PremultipliedScaledDelegate? _gbDecoderCopyFramePixelsBgra32PremultipliedScaled;
+#if NET6_0_OR_GREATER
+        private static GbDecoderCopyFramePixelsBgra32PremultipliedToRefDelegate? _gbDecoderCopyFramePixelsBgra32PremultipliedToRef;
+        private static GbDecoderCopyFramePixelsBgra32PremultipliedScaledToRefDelegate? _gbDecoderCopyFramePixelsBgra32PremultipliedScaledToRef;
+#endif
         private static GbVersionGetMajorDelegate? _gbVersionGetMajor;
         private static GbVersionGetMinorDelegate? _gbVersionGetMinor;
         private static GbVersionGetPatchDelegate? _gbVersionGetPatch;
@@ -68,6 +375,33 @@ namespace GifBolt.Internal
         private static GbDecoderStopPrefetchingDelegate? _gbDecoderStopPrefetching;
         private static GbDecoderSetCurrentFrameDelegate? _gbDecoderSetCurrentFrame;
         private static GbDecoderResetCanvasDelegate? _gbDecoderResetCanvas;
+        private static GbDecoderTrimMemoryDelegate? _gbDecoderTrimMemory;
+        private static GbTrimMemoryDelegate? _gbTrimMemory;
+        private static GbDecoderGetStatsDelegate? _gbDecoderGetStats;
+        private static GbGetProcessStatsDelegate? _gbGetProcessStats;
+        private static GbDecoderRecordFramePresentedDelegate? _gbDecoderRecordFramePresented;
+        private static GbDecoderGetPlaybackStatsDelegate? _gbDecoderGetPlaybackStats;
+        private static GbGetProcessPlaybackStatsDelegate? _gbGetProcessPlaybackStats;
+        private static GbTraceStartDelegate? _gbTraceStart;
+        private static GbTraceStopDelegate? _gbTraceStop;
+        private static GbTraceDumpDelegate? _gbTraceDump;
+        private static GbRecordStartDelegate? _gbRecordStart;
+        private static GbRecordStopDelegate? _gbRecordStop;
+        private static GbCalibrateDelegate? _gbCalibrate;
+        private static GbGetTuningProfileDelegate? _gbGetTuningProfile;
+        private static GbSetTuningProfileDelegate? _gbSetTuningProfile;
+        private static GbResetTuningProfileDelegate? _gbResetTuningProfile;
+        private static GbPreviewCreateDelegate? _gbPreviewCreate;
+        private static GbPreviewLoadDelegate? _gbPreviewLoad;
+        private static GbPreviewSaveDelegate? _gbPreviewSave;
+        private static GbPreviewDestroyDelegate? _gbPreviewDestroy;
+        private static GbPreviewGetInfoDelegate? _gbPreviewGetInfo;
+        private static GbPreviewCopyFramePixelsBgra32PremultipliedDelegate? _gbPreviewCopyFramePixelsBgra32Premultiplied;
+        private static GbSharedCacheOpenDelegate? _gbSharedCacheOpen;
+        private static GbSharedCacheCloseDelegate? _gbSharedCacheClose;
+        private static GbSharedCacheGetStatsDelegate? _gbSharedCacheGetStats;
+        private static GbSharedCacheRemoveDelegate? _gbSharedCacheRemove;
+        private static GbDecoderSetSharedCacheDelegate? _gbDecoderSetSharedCache;
 
         // Static constructor to load DLL and resolve function pointers
         static Native()
@@ -90,14 +424,33 @@ namespace GifBolt.Internal
             _gbDecoderGetHeight = GetDelegate<GbDecoderGetHeightDelegate>("gb_decoder_get_height");
             _gbDecoderGetLoopCount = GetDelegate<GbDecoderGetLoopCountDelegate>("gb_decoder_get_loop_count");
             _gbDecoderGetFrameDelayMs = GetDelegate<GbDecoderGetFrameDelayMsDelegate>("gb_decoder_get_frame_delay_ms");
+            _gbDecoderGetFrameAlpha = GetDelegate<GbDecoderGetFrameAlphaDelegate>("gb_decoder_get_frame_alpha");
             _gbDecoderGetFramePixelsRgba32 = GetDelegate<GbDecoderGetFramePixelsRgba32Delegate>("gb_decoder_get_frame_pixels_rgba32");
             _gbDecoderGetFramePixelsBgra32Premultiplied = GetDelegate<GbDecoderGetFramePixelsBgra32PremultipliedDelegate>("gb_decoder_get_frame_pixels_bgra32_premultiplied");
             _gbDecoderGetBackgroundColor = GetDelegate<GbDecoderGetBackgroundColorDelegate>("gb_decoder_get_background_color");
             _gbDecoderSetMinFrameDelayMs = GetDelegate<GbDecoderSetMinFrameDelayMsDelegate>("gb_decoder_set_min_frame_delay_ms");
-            _gbDecoderGetMinFrameDelayMs = GetDelegate<GbDecoderGetMinFrameDelayMsDelegate>("gb_decoder_get_min_frame_delay_ms");
             _gbDecoderSetMaxCachedFrames = GetDelegate<GbDecoderSetMaxCachedFramesDelegate>("gb_decoder_set_max_cached_frames");
+#if NET6_0_OR_GREATER
+            unsafe
+            {
+                _gbDecoderGetInfo = (delegate* unmanaged[Cdecl]<IntPtr, DecoderInfo*, int>)GetExport("gb_decoder_get_info");
+                _gbDecoderPresentFrame = (delegate* unmanaged[Cdecl]<IntPtr, int, long, int, FrameStatus*, int>)GetExport("gb_decoder_present_frame");
+                _gbDecoderGetMinFrameDelayMs = (delegate* unmanaged[Cdecl, SuppressGCTransition]<IntPtr, int>)GetExport("gb_decoder_get_min_frame_delay_ms");
+                _gbDecoderGetMaxCachedFrames = (delegate* unmanaged[Cdecl, SuppressGCTransition]<IntPtr, uint>)GetExport("gb_decoder_get_max_cached_frames");
+            }
+#else
+            _gbDecoderGetInfo = GetDelegate<GbDecoderGetInfoDelegate>("gb_decoder_get_info");
+            _gbDecoderPresentFrame = GetDelegate<GbDecoderPresentFrameDelegate>("gb_decoder_present_frame");
+            _gbDecoderGetMinFrameDelayMs = GetDelegate<GbDecoderGetMinFrameDelayMsDelegate>("gb_decoder_get_min_frame_delay_ms");
             _gbDecoderGetMaxCachedFrames = GetDelegate<GbDecoderGetMaxCachedFramesDelegate>("gb_decoder_get_max_cached_frames");
+#endif
             _gbDecoderGetFramePixelsBgra32PremultipliedScaled = GetDelegate<GbDecoderGetFramePixelsBgra32PremultipliedScaledDelegate>("gb_decoder_get_frame_pixels_bgra32_premultiplied_scaled");
+            _gbDecoderCopyFramePixelsBgra32Premultiplied = GetDelegate<GbDecoderCopyFramePixelsBgra32PremultipliedDelegate>("gb_decoder_copy_frame_pixels_bgra32_premultiplied");
+            _gbDecoderCopyFramePixelsBgra32PremultipliedScaled = GetDelegate<GbDecoderCopyFramePixelsBgra32PremultipliedScaledDelegate>("gb_decoder_copy_frame_pixels_bgra32_premultiplied_scaled");
+#if NET6_0_OR_GREATER
+            _gbDecoderCopyFramePixelsBgra32PremultipliedToRef = GetDelegate<GbDecoderCopyFramePixelsBgra32PremultipliedToRefDelegate>("gb_decoder_copy_frame_pixels_bgra32_premultiplied");
+            _gbDecoderCopyFramePixelsBgra32PremultipliedScaledToRef = GetDelegate<GbDecoderCopyFramePixelsBgra32PremultipliedScaledToRefDelegate>("gb_decoder_copy_frame_pixels_bgra32_premultiplied_scaled");
+#endif
             _gbVersionGetMajor = GetDelegate<GbVersionGetMajorDelegate>("gb_version_get_major");
             _gbVersionGetMinor = GetDelegate<GbVersionGetMinorDelegate>("gb_version_get_minor");
             _gbVersionGetPatch = GetDelegate<GbVersionGetPatchDelegate>("gb_version_get_patch");
@@ -108,6 +461,33 @@ namespace GifBolt.Internal
             _gbDecoderStopPrefetching = GetDelegate<GbDecoderStopPrefetchingDelegate>("gb_decoder_stop_prefetching");
             _gbDecoderSetCurrentFrame = GetDelegate<GbDecoderSetCurrentFrameDelegate>("gb_decoder_set_current_frame");
             _gbDecoderResetCanvas = GetDelegate<GbDecoderResetCanvasDelegate>("gb_decoder_reset_canvas");
+            _gbDecoderTrimMemory = GetDelegate<GbDecoderTrimMemoryDelegate>("gb_decoder_trim_memory");
+            _gbTrimMemory = GetDelegate<GbTrimMemoryDelegate>("gb_trim_memory");
+            _gbDecoderGetStats = GetDelegate<GbDecoderGetStatsDelegate>("gb_decoder_get_stats");
+            _gbGetProcessStats = GetDelegate<GbGetProcessStatsDelegate>("gb_get_process_stats");
+            _gbDecoderRecordFramePresented = GetDelegate<GbDecoderRecordFramePresentedDelegate>("gb_decoder_record_frame_presented");
+            _gbDecoderGetPlaybackStats = GetDelegate<GbDecoderGetPlaybackStatsDelegate>("gb_decoder_get_playback_stats");
+            _gbGetProcessPlaybackStats = GetDelegate<GbGetProcessPlaybackStatsDelegate>("gb_get_process_playback_stats");
+            _gbTraceStart = GetDelegate<GbTraceStartDelegate>("gb_trace_start");
+            _gbTraceStop = GetDelegate<GbTraceStopDelegate>("gb_trace_stop");
+            _gbTraceDump = GetDelegate<GbTraceDumpDelegate>("gb_trace_dump");
+            _gbRecordStart = GetDelegate<GbRecordStartDelegate>("gb_record_start");
+            _gbRecordStop = GetDelegate<GbRecordStopDelegate>("gb_record_stop");
+            _gbCalibrate = GetDelegate<GbCalibrateDelegate>("gb_calibrate");
+            _gbGetTuningProfile = GetDelegate<GbGetTuningProfileDelegate>("gb_get_tuning_profile");
+            _gbSetTuningProfile = GetDelegate<GbSetTuningProfileDelegate>("gb_set_tuning_profile");
+            _gbResetTuningProfile = GetDelegate<GbResetTuningProfileDelegate>("gb_set_tuning_profile");
+            _gbPreviewCreate = GetDelegate<GbPreviewCreateDelegate>("gb_preview_create");
+            _gbPreviewLoad = GetDelegate<GbPreviewLoadDelegate>("gb_preview_load");
+            _gbPreviewSave = GetDelegate<GbPreviewSaveDelegate>("gb_preview_save");
+            _gbPreviewDestroy = GetDelegate<GbPreviewDestroyDelegate>("gb_preview_destroy");
+            _gbPreviewGetInfo = GetDelegate<GbPreviewGetInfoDelegate>("gb_preview_get_info");
+            _gbPreviewCopyFramePixelsBgra32Premultiplied = GetDelegate<GbPreviewCopyFramePixelsBgra32PremultipliedDelegate>("gb_preview_copy_frame_pixels_bgra32_premultiplied");
+            _gbSharedCacheOpen = GetDelegate<GbSharedCacheOpenDelegate>("gb_shared_cache_open");
+            _gbSharedCacheClose = GetDelegate<GbSharedCacheCloseDelegate>("gb_shared_cache_close");
+            _gbSharedCacheGetStats = GetDelegate<GbSharedCacheGetStatsDelegate>("gb_shared_cache_get_stats");
+            _gbSharedCacheRemove = GetDelegate<GbSharedCacheRemoveDelegate>("gb_shared_cache_remove");
+            _gbDecoderSetSharedCache = GetDelegate<GbDecoderSetSharedCacheDelegate>("gb_decoder_set_shared_cache");
             _gbVersionGetMajor?.Invoke();
 
         }
@@ -140,6 +520,9 @@ namespace GifBolt.Internal
         [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
         private delegate int GbDecoderGetFrameDelayMsDelegate(IntPtr decoder, int index);
 
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate int GbDecoderGetFrameAlphaDelegate(IntPtr decoder, int index);
+
         [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
         private delegate IntPtr GbDecoderGetFramePixelsRgba32Delegate(IntPtr decoder, int index, out int byteCount);
 
@@ -153,13 +536,21 @@ namespace GifBolt.Internal
         private delegate void GbDecoderSetMinFrameDelayMsDelegate(IntPtr decoder, int minDelayMs);
 
         [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
-        private delegate int GbDecoderGetMinFrameDelayMsDelegate(IntPtr decoder);
+        private delegate void GbDecoderSetMaxCachedFramesDelegate(IntPtr decoder, uint maxFrames);
 
+#if !NET6_0_OR_GREATER
         [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
-        private delegate void GbDecoderSetMaxCachedFramesDelegate(IntPtr decoder, uint maxFrames);
+        private delegate int GbDecoderGetInfoDelegate(IntPtr decoder, out DecoderInfo info);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate int GbDecoderPresentFrameDelegate(IntPtr decoder, int index, long latenessNs, int droppedFrames, out FrameStatus status);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate int GbDecoderGetMinFrameDelayMsDelegate(IntPtr decoder);
 
         [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
         private delegate uint GbDecoderGetMaxCachedFramesDelegate(IntPtr decoder);
+#endif
 
         [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
         [System.Diagnostics.CodeAnalysis.SuppressMessage("StyleCop.CSharp.ReadabilityRules", "SA1117:Parameters should be on same line or separate lines", Justification = "<En attente>")]
@@ -167,6 +558,21 @@ namespace GifBolt.Internal
             IntPtr decoder, int index, int targetWidth, int targetHeight,
             out int outWidth, out int outHeight, out int byteCount, int filterType);
 
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate int GbDecoderCopyFramePixelsBgra32PremultipliedDelegate(IntPtr decoder, int index, IntPtr dest, int destStride, int destByteCount);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate int GbDecoderCopyFramePixelsBgra32PremultipliedScaledDelegate(IntPtr decoder, int index, int targetWidth, int targetHeight, int filterType, IntPtr dest, int destStride, int destByteCount);
+
+#if NET6_0_OR_GREATER
+        // Same entry points taking the first byte of a span, which the marshaller pins for the call
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate int GbDecoderCopyFramePixelsBgra32PremultipliedToRefDelegate(IntPtr decoder, int index, ref byte dest, int destStride, int destByteCount);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate int GbDecoderCopyFramePixelsBgra32PremultipliedScaledToRefDelegate(IntPtr decoder, int index, int targetWidth, int targetHeight, int filterType, ref byte dest, int destStride, int destByteCount);
+#endif
+
         [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
         private delegate int GbVersionGetMajorDelegate();
 
@@ -197,6 +603,87 @@ namespace GifBolt.Internal
         [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
         private delegate void GbDecoderResetCanvasDelegate(IntPtr decoder);
 
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate long GbDecoderTrimMemoryDelegate(IntPtr decoder, int level);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate long GbTrimMemoryDelegate(int level);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate int GbDecoderGetStatsDelegate(IntPtr decoder, out DecoderStats stats);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate int GbGetProcessStatsDelegate(out DecoderStats stats);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate void GbDecoderRecordFramePresentedDelegate(IntPtr decoder, int index, long latenessNs, int droppedFrames);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate int GbDecoderGetPlaybackStatsDelegate(IntPtr decoder, out PlaybackStats stats);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate int GbGetProcessPlaybackStatsDelegate(out PlaybackStats stats);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate int GbTraceStartDelegate();
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate void GbTraceStopDelegate();
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate int GbTraceDumpDelegate(string path);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate int GbRecordStartDelegate(string path, int flags);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate void GbRecordStopDelegate();
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate int GbCalibrateDelegate(string? profilePath, out TuningProfile profile);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate int GbGetTuningProfileDelegate(out TuningProfile profile);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate int GbSetTuningProfileDelegate(ref TuningProfile profile);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate int GbResetTuningProfileDelegate(IntPtr profile);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate IntPtr GbPreviewCreateDelegate(IntPtr decoder, int maxWidth, int maxHeight, int maxFps);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate IntPtr GbPreviewLoadDelegate(string path);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate int GbPreviewSaveDelegate(IntPtr preview, string path);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate void GbPreviewDestroyDelegate(IntPtr preview);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate int GbPreviewGetInfoDelegate(IntPtr preview, out PreviewInfo info);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate int GbPreviewCopyFramePixelsBgra32PremultipliedDelegate(IntPtr preview, int index, IntPtr dest, int destStride, int destByteCount);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate IntPtr GbSharedCacheOpenDelegate(string name, long budgetBytes);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate void GbSharedCacheCloseDelegate(IntPtr cache);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate int GbSharedCacheGetStatsDelegate(IntPtr cache, out SharedCacheStats stats);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate void GbSharedCacheRemoveDelegate(string name);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate int GbDecoderSetSharedCacheDelegate(IntPtr decoder, IntPtr cache);
+
 #if NET6_0_OR_GREATER
         /// <summary>
         /// Cross-platform native library loading for .NET 6+.
@@ -278,6 +765,11 @@ namespace GifBolt.Internal
 
             return Marshal.GetDelegateForFunctionPointer<T>(addr);
         }
+
+        /// <summary>
+        /// Gets the address of an unmanaged function exported by the native library.
+        /// </summary>
+        private static IntPtr GetExport(string symbol) => NativeLibrary.GetExport(_hModule, symbol);
 #else
         // Windows-only native library loading for .NET Standard 2.0
         private static void LoadLibraryWindows()
@@ -417,6 +909,33 @@ namespace GifBolt.Internal
         /// <returns>Frame delay in milliseconds.</returns>
         internal static int gb_decoder_get_frame_delay_ms(IntPtr decoder, int index) => _gbDecoderGetFrameDelayMs(decoder, index);
 
+        /// <summary>
+        /// Gets the alpha classification of a composed frame.
+        /// </summary>
+        /// <param name="decoder">Pointer to the decoder.</param>
+        /// <param name="index">Index of the frame.</param>
+        /// <returns>A <see cref="FrameAlpha"/> value, or -1 on error.</returns>
+        internal static int gb_decoder_get_frame_alpha(IntPtr decoder, int index) => _gbDecoderGetFrameAlpha(decoder, index);
+
+        /// <summary>
+        /// Gets the dimensions, frame count, loop count and frame delays of a GIF in one call.
+        /// </summary>
+        /// <param name="decoder">Pointer to the decoder.</param>
+        /// <param name="info">Receives the description; its delays stay valid until the next load or minimum delay change.</param>
+        /// <returns>1 on success; 0 on error.</returns>
+#if NET6_0_OR_GREATER
+        internal static unsafe int gb_decoder_get_info(IntPtr decoder, out DecoderInfo info)
+        {
+            DecoderInfo result;
+            int ok = _gbDecoderGetInfo(decoder, &result);
+            info = result;
+            return ok;
+        }
+#else
+        internal static int gb_decoder_get_info(IntPtr decoder, out DecoderInfo info)
+             => _gbDecoderGetInfo(decoder, out info);
+#endif
+
         /// <summary>
         /// Gets the raw RGBA32 pixel data for a frame.
         /// </summary>
@@ -457,8 +976,13 @@ namespace GifBolt.Internal
         /// </summary>
         /// <param name="decoder">Pointer to the decoder.</param>
         /// <returns>Minimum frame delay in milliseconds.</returns>
+#if NET6_0_OR_GREATER
+        internal static unsafe int gb_decoder_get_min_frame_delay_ms(IntPtr decoder)
+             => _gbDecoderGetMinFrameDelayMs(decoder);
+#else
         internal static int gb_decoder_get_min_frame_delay_ms(IntPtr decoder)
              => _gbDecoderGetMinFrameDelayMs(decoder);
+#endif
 
         /// <summary>
         /// Sets the maximum number of frames to cache in memory.
@@ -473,8 +997,13 @@ namespace GifBolt.Internal
         /// </summary>
         /// <param name="decoder">Pointer to the decoder.</param>
         /// <returns>Maximum number of cached frames.</returns>
+#if NET6_0_OR_GREATER
+        internal static unsafe uint gb_decoder_get_max_cached_frames(IntPtr decoder)
+             => _gbDecoderGetMaxCachedFrames(decoder);
+#else
         internal static uint gb_decoder_get_max_cached_frames(IntPtr decoder)
              => _gbDecoderGetMaxCachedFrames(decoder);
+#endif
 
         /// <summary>
         /// Gets scaled BGRA32 premultiplied pixel data for a frame.
@@ -499,6 +1028,60 @@ namespace GifBolt.Internal
             int filterType)
              => _gbDecoderGetFramePixelsBgra32PremultipliedScaled(decoder, index, targetWidth, targetHeight, out outWidth, out outHeight, out byteCount, filterType);
 
+        /// <summary>
+        /// Writes the BGRA32 premultiplied pixels of a frame into caller memory.
+        /// </summary>
+        /// <param name="decoder">Pointer to the decoder.</param>
+        /// <param name="index">Frame index.</param>
+        /// <param name="dest">Destination of height rows of width pixels.</param>
+        /// <param name="destStride">Bytes from the start of one destination row to the next.</param>
+        /// <param name="destByteCount">Size of the destination in bytes.</param>
+        /// <returns>1 if the frame was written; 0 on error or if the destination is too small.</returns>
+        internal static int gb_decoder_copy_frame_pixels_bgra32_premultiplied(IntPtr decoder, int index, IntPtr dest, int destStride, int destByteCount)
+             => _gbDecoderCopyFramePixelsBgra32Premultiplied(decoder, index, dest, destStride, destByteCount);
+
+        /// <summary>
+        /// Writes the BGRA32 premultiplied pixels of a frame, scaled to target dimensions, into caller memory.
+        /// </summary>
+        /// <param name="decoder">Pointer to the decoder.</param>
+        /// <param name="index">Frame index.</param>
+        /// <param name="targetWidth">Output width in pixels.</param>
+        /// <param name="targetHeight">Output height in pixels.</param>
+        /// <param name="filterType">Scaling filter type (e.g., nearest, bilinear).</param>
+        /// <param name="dest">Destination of targetHeight rows of targetWidth pixels.</param>
+        /// <param name="destStride">Bytes from the start of one destination row to the next.</param>
+        /// <param name="destByteCount">Size of the destination in bytes.</param>
+        /// <returns>1 if the frame was written; 0 on error or if the destination is too small.</returns>
+        internal static int gb_decoder_copy_frame_pixels_bgra32_premultiplied_scaled(IntPtr decoder, int index, int targetWidth, int targetHeight, int filterType, IntPtr dest, int destStride, int destByteCount)
+             => _gbDecoderCopyFramePixelsBgra32PremultipliedScaled(decoder, index, targetWidth, targetHeight, filterType, dest, destStride, destByteCount);
+
+#if NET6_0_OR_GREATER
+        /// <summary>
+        /// Writes the BGRA32 premultiplied pixels of a frame into a managed buffer.
+        /// </summary>
+        /// <param name="decoder">Pointer to the decoder.</param>
+        /// <param name="index">Frame index.</param>
+        /// <param name="dest">Destination of height rows of width pixels.</param>
+        /// <param name="destStride">Bytes from the start of one destination row to the next.</param>
+        /// <returns>1 if the frame was written; 0 on error or if the destination is too small.</returns>
+        internal static int gb_decoder_copy_frame_pixels_bgra32_premultiplied(IntPtr decoder, int index, Span<byte> dest, int destStride)
+             => dest.IsEmpty ? 0 : _gbDecoderCopyFramePixelsBgra32PremultipliedToRef(decoder, index, ref MemoryMarshal.GetReference(dest), destStride, dest.Length);
+
+        /// <summary>
+        /// Writes the BGRA32 premultiplied pixels of a frame, scaled to target dimensions, into a managed buffer.
+        /// </summary>
+        /// <param name="decoder">Pointer to the decoder.</param>
+        /// <param name="index">Frame index.</param>
+        /// <param name="targetWidth">Output width in pixels.</param>
+        /// <param name="targetHeight">Output height in pixels.</param>
+        /// <param name="filterType">Scaling filter type (e.g., nearest, bilinear).</param>
+        /// <param name="dest">Destination of targetHeight rows of targetWidth pixels.</param>
+        /// <param name="destStride">Bytes from the start of one destination row to the next.</param>
+        /// <returns>1 if the frame was written; 0 on error or if the destination is too small.</returns>
+        internal static int gb_decoder_copy_frame_pixels_bgra32_premultiplied_scaled(IntPtr decoder, int index, int targetWidth, int targetHeight, int filterType, Span<byte> dest, int destStride)
+             => dest.IsEmpty ? 0 : _gbDecoderCopyFramePixelsBgra32PremultipliedScaledToRef(decoder, index, targetWidth, targetHeight, filterType, ref MemoryMarshal.GetReference(dest), destStride, dest.Length);
+#endif
+
         /// <summary>
         /// Gets the major version of GifBolt.
         /// </summary>
@@ -567,5 +1150,245 @@ namespace GifBolt.Internal
         /// <param name="decoder">Pointer to the decoder.</param>
         internal static void gb_decoder_reset_canvas(IntPtr decoder)
              => _gbDecoderResetCanvas(decoder);
+
+        /// <summary>
+        /// Releases decoder memory that can be rebuilt on demand.
+        /// </summary>
+        /// <param name="decoder">Pointer to the decoder.</param>
+        /// <param name="level">Trim level (0-3, see <see cref="MemoryTrimLevel"/>).</param>
+        /// <returns>The number of bytes freed.</returns>
+        internal static long gb_decoder_trim_memory(IntPtr decoder, int level)
+             => _gbDecoderTrimMemory(decoder, level);
+
+        /// <summary>
+        /// Releases rebuildable memory from every live decoder in the process.
+        /// </summary>
+        /// <param name="level">Trim level (0-3, see <see cref="MemoryTrimLevel"/>).</param>
+        /// <returns>The total number of bytes freed.</returns>
+        internal static long gb_trim_memory(int level) => _gbTrimMemory(level);
+
+        /// <summary>
+        /// Gets the work counters and memory footprint of a decoder.
+        /// </summary>
+        /// <param name="decoder">Pointer to the decoder.</param>
+        /// <param name="stats">Receives the statistics.</param>
+        /// <returns>1 on success; 0 on error.</returns>
+        internal static int gb_decoder_get_stats(IntPtr decoder, out DecoderStats stats)
+             => _gbDecoderGetStats(decoder, out stats);
+
+        /// <summary>
+        /// Gets the statistics summed over every decoder in the process.
+        /// </summary>
+        /// <param name="stats">Receives the statistics.</param>
+        /// <returns>1 on success; 0 on error.</returns>
+        internal static int gb_get_process_stats(out DecoderStats stats)
+             => _gbGetProcessStats(out stats);
+
+        /// <summary>
+        /// Records that a frame was shown, for playback quality statistics.
+        /// </summary>
+        /// <param name="decoder">Pointer to the decoder.</param>
+        /// <param name="index">The frame shown.</param>
+        /// <param name="latenessNs">Time from the frame's due time until it was shown.</param>
+        /// <param name="droppedFrames">Frames skipped without being shown before this one.</param>
+        internal static void gb_decoder_record_frame_presented(IntPtr decoder, int index, long latenessNs, int droppedFrames)
+             => _gbDecoderRecordFramePresented(decoder, index, latenessNs, droppedFrames);
+
+        /// <summary>
+        /// Moves the playback position to a frame, records it as shown and returns its status.
+        /// </summary>
+        /// <param name="decoder">Pointer to the decoder.</param>
+        /// <param name="index">The frame shown.</param>
+        /// <param name="latenessNs">Time from the frame's due time until it was shown.</param>
+        /// <param name="droppedFrames">Frames skipped without being shown before this one.</param>
+        /// <param name="status">Receives the frame's delay and the loading progress.</param>
+        /// <returns>1 on success; 0 on error.</returns>
+#if NET6_0_OR_GREATER
+        internal static unsafe int gb_decoder_present_frame(IntPtr decoder, int index, long latenessNs, int droppedFrames, out FrameStatus status)
+        {
+            FrameStatus result;
+            int ok = _gbDecoderPresentFrame(decoder, index, latenessNs, droppedFrames, &result);
+            status = result;
+            return ok;
+        }
+#else
+        internal static int gb_decoder_present_frame(IntPtr decoder, int index, long latenessNs, int droppedFrames, out FrameStatus status)
+             => _gbDecoderPresentFrame(decoder, index, latenessNs, droppedFrames, out status);
+#endif
+
+        /// <summary>
+        /// Gets the playback quality recorded for a decoder.
+        /// </summary>
+        /// <param name="decoder">Pointer to the decoder.</param>
+        /// <param name="stats">Receives the statistics.</param>
+        /// <returns>1 on success; 0 on error.</returns>
+        internal static int gb_decoder_get_playback_stats(IntPtr decoder, out PlaybackStats stats)
+             => _gbDecoderGetPlaybackStats(decoder, out stats);
+
+        /// <summary>
+        /// Gets the playback quality summed over every decoder in the process.
+        /// </summary>
+        /// <param name="stats">Receives the statistics.</param>
+        /// <returns>1 on success; 0 on error.</returns>
+        internal static int gb_get_process_playback_stats(out PlaybackStats stats)
+             => _gbGetProcessPlaybackStats(out stats);
+
+        /// <summary>
+        /// Starts recording native trace spans, discarding any previous recording.
+        /// </summary>
+        /// <returns>1 if tracing started; 0 if the native library was built without tracing.</returns>
+        internal static int gb_trace_start() => _gbTraceStart();
+
+        /// <summary>
+        /// Stops recording native trace spans.
+        /// </summary>
+        internal static void gb_trace_stop() => _gbTraceStop();
+
+        /// <summary>
+        /// Writes the recorded trace spans as Chrome trace-event JSON.
+        /// </summary>
+        /// <param name="path">Output file path.</param>
+        /// <returns>1 if the file was written; 0 on error.</returns>
+        internal static int gb_trace_dump(string path) => _gbTraceDump(path);
+
+        /// <summary>
+        /// Flag for <see cref="gb_record_start"/>: store loaded buffers in the recording.
+        /// </summary>
+        internal const int GB_RECORD_EMBED_BUFFERS = 1;
+
+        /// <summary>
+        /// Starts recording every native decoder and renderer call to a file, for replay.
+        /// </summary>
+        /// <param name="path">Output file path; overwritten.</param>
+        /// <param name="flags">0, or <see cref="GB_RECORD_EMBED_BUFFERS"/>.</param>
+        /// <returns>1 if recording started; 0 if the file cannot be created.</returns>
+        internal static int gb_record_start(string path, int flags) => _gbRecordStart(path, flags);
+
+        /// <summary>
+        /// Stops recording native calls and closes the recording file.
+        /// </summary>
+        internal static void gb_record_stop() => _gbRecordStop();
+
+        /// <summary>
+        /// Loads a calibrated tuning profile from a file, or calibrates and saves one there.
+        /// </summary>
+        /// <param name="profilePath">Profile file, or <c>null</c> to calibrate without saving.</param>
+        /// <param name="profile">Receives the profile put into effect.</param>
+        /// <returns>1 on success; 0 on error.</returns>
+        internal static int gb_calibrate(string? profilePath, out TuningProfile profile)
+             => _gbCalibrate(profilePath, out profile);
+
+        /// <summary>
+        /// Gets the tuning profile in effect.
+        /// </summary>
+        /// <param name="profile">Receives the profile.</param>
+        /// <returns>1 on success; 0 on error.</returns>
+        internal static int gb_get_tuning_profile(out TuningProfile profile)
+             => _gbGetTuningProfile(out profile);
+
+        /// <summary>
+        /// Replaces the tuning profile in effect, for decoders loaded afterwards.
+        /// </summary>
+        /// <param name="profile">The thresholds to use.</param>
+        /// <returns>1 on success; 0 on error.</returns>
+        internal static int gb_set_tuning_profile(ref TuningProfile profile)
+             => _gbSetTuningProfile(ref profile);
+
+        /// <summary>
+        /// Restores the built-in tuning defaults.
+        /// </summary>
+        internal static void gb_reset_tuning_profile() => _gbResetTuningProfile(IntPtr.Zero);
+
+        /// <summary>
+        /// Builds a preview proxy from a loaded GIF in a single pass.
+        /// </summary>
+        /// <param name="decoder">Pointer to the decoder; it can be destroyed once this returns.</param>
+        /// <param name="maxWidth">Width of the box the proxy is fitted into.</param>
+        /// <param name="maxHeight">Height of the box the proxy is fitted into.</param>
+        /// <param name="maxFps">Highest frame rate kept; 0 keeps every frame.</param>
+        /// <returns>Pointer to the proxy, or <see cref="IntPtr.Zero"/> on error.</returns>
+        internal static IntPtr gb_preview_create(IntPtr decoder, int maxWidth, int maxHeight, int maxFps)
+             => _gbPreviewCreate(decoder, maxWidth, maxHeight, maxFps);
+
+        /// <summary>
+        /// Reads a preview proxy written by <see cref="gb_preview_save"/>.
+        /// </summary>
+        /// <param name="path">Path of the proxy file.</param>
+        /// <returns>Pointer to the proxy, or <see cref="IntPtr.Zero"/> if the file is not a proxy.</returns>
+        internal static IntPtr gb_preview_load(string path) => _gbPreviewLoad(path);
+
+        /// <summary>
+        /// Writes a preview proxy to a file.
+        /// </summary>
+        /// <param name="preview">Pointer to the proxy.</param>
+        /// <param name="path">Path of the proxy file; replaced if it exists.</param>
+        /// <returns>1 if the file was written; 0 on error.</returns>
+        internal static int gb_preview_save(IntPtr preview, string path) => _gbPreviewSave(preview, path);
+
+        /// <summary>
+        /// Destroys a preview proxy.
+        /// </summary>
+        /// <param name="preview">Pointer to the proxy.</param>
+        internal static void gb_preview_destroy(IntPtr preview) => _gbPreviewDestroy(preview);
+
+        /// <summary>
+        /// Gets the size, frame delays and storage of a preview proxy in one call.
+        /// </summary>
+        /// <param name="preview">Pointer to the proxy.</param>
+        /// <param name="info">Receives the description; its arrays live as long as the proxy.</param>
+        /// <returns>1 on success; 0 on error.</returns>
+        internal static int gb_preview_get_info(IntPtr preview, out PreviewInfo info)
+             => _gbPreviewGetInfo(preview, out info);
+
+        /// <summary>
+        /// Writes the BGRA32 premultiplied pixels of a proxy frame into caller memory.
+        /// </summary>
+        /// <param name="preview">Pointer to the proxy.</param>
+        /// <param name="index">Index of the frame.</param>
+        /// <param name="dest">Destination of height rows of width pixels.</param>
+        /// <param name="destStride">Bytes from the start of one destination row to the next.</param>
+        /// <param name="destByteCount">Size of the destination in bytes.</param>
+        /// <returns>1 if the frame was written; 0 on error or if the destination is too small.</returns>
+        internal static int gb_preview_copy_frame_pixels_bgra32_premultiplied(IntPtr preview, int index, IntPtr dest, int destStride, int destByteCount)
+             => _gbPreviewCopyFramePixelsBgra32Premultiplied(preview, index, dest, destStride, destByteCount);
+
+        /// <summary>
+        /// Opens a shared frame cache, creating it if no process has.
+        /// </summary>
+        /// <param name="name">1 to 16 characters from [A-Za-z0-9_-], the same in every process.</param>
+        /// <param name="budgetBytes">Largest total size of the cached frames; only used on creation.</param>
+        /// <returns>Pointer to the cache handle, or <see cref="IntPtr.Zero"/> if it cannot be opened.</returns>
+        internal static IntPtr gb_shared_cache_open(string name, long budgetBytes)
+             => _gbSharedCacheOpen(name, budgetBytes);
+
+        /// <summary>
+        /// Closes this process's handle to a shared cache.
+        /// </summary>
+        /// <param name="cache">Pointer to the cache handle.</param>
+        internal static void gb_shared_cache_close(IntPtr cache) => _gbSharedCacheClose(cache);
+
+        /// <summary>
+        /// Gets the occupancy of a shared cache and this process's hit counts.
+        /// </summary>
+        /// <param name="cache">Pointer to the cache handle.</param>
+        /// <param name="stats">Receives the statistics.</param>
+        /// <returns>1 on success; 0 on error.</returns>
+        internal static int gb_shared_cache_get_stats(IntPtr cache, out SharedCacheStats stats)
+             => _gbSharedCacheGetStats(cache, out stats);
+
+        /// <summary>
+        /// Removes a shared cache's objects from the system.
+        /// </summary>
+        /// <param name="name">The name the cache was opened with.</param>
+        internal static void gb_shared_cache_remove(string name) => _gbSharedCacheRemove(name);
+
+        /// <summary>
+        /// Looks frames of a decoder up in a shared cache and publishes the ones it converts.
+        /// </summary>
+        /// <param name="decoder">Pointer to the decoder.</param>
+        /// <param name="cache">Pointer to the cache handle, or <see cref="IntPtr.Zero"/> to stop sharing.</param>
+        /// <returns>1 on success; 0 on error.</returns>
+        internal static int gb_decoder_set_shared_cache(IntPtr decoder, IntPtr cache)
+             => _gbDecoderSetSharedCache(decoder, cache);
     }
 }
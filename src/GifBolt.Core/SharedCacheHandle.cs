@@ -0,0 +1,54 @@
+// <copyright file="SharedCacheHandle.cs" company="GifBolt Contributors">
+// Copyright (c) 2026 GifBolt Contributors. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the project root for full license information.
+// </copyright>
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+using System;
+using System.Runtime.InteropServices;
+
+namespace GifBolt.Internal
+{
+    /// <summary>
+    /// Wraps a native shared frame cache handle from the GifBolt.Native library.
+    /// Implements <see cref="SafeHandle"/> for safe cleanup of unmanaged resources.
+    /// </summary>
+    internal sealed class SharedCacheHandle : SafeHandle
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="SharedCacheHandle"/> class with an invalid handle.
+        /// </summary>
+        public SharedCacheHandle() : base(IntPtr.Zero, true)
+        {
+        }
+
+        /// <summary>
+        /// Initializes a new instance of the <see cref="SharedCacheHandle"/> class with an existing native handle.
+        /// </summary>
+        /// <param name="existing">The existing native shared frame cache handle to wrap.</param>
+        public SharedCacheHandle(IntPtr existing) : base(IntPtr.Zero, true)
+        {
+            this.SetHandle(existing);
+        }
+
+        /// <summary>
+        /// Gets a value indicating whether the native handle is invalid.
+        /// </summary>
+        public override bool IsInvalid => this.handle == IntPtr.Zero;
+
+        /// <summary>
+        /// Releases the unmanaged native shared frame cache handle.
+        /// </summary>
+        /// <returns>true if the handle was released successfully; otherwise false.</returns>
+        protected override bool ReleaseHandle()
+        {
+            if (!this.IsInvalid)
+            {
+                Native.gb_shared_cache_close(this.handle);
+                this.SetHandle(IntPtr.Zero);
+            }
+            return true;
+        }
+    }
+}
@@ -0,0 +1,90 @@
+// <copyright file="SharedFrameCache.cs" company="GifBolt Contributors">
+// Copyright (c) 2026 GifBolt Contributors. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the project root for full license information.
+// </copyright>
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+using GifBolt.Internal;
+using System;
+
+namespace GifBolt;
+
+/// <summary>
+/// Frames shared by every process that opens a cache under the same name.
+/// The first process to convert a frame of a GIF publishes it; the others map it read-only
+/// instead of composing it again. Available where POSIX shared memory is (Linux, macOS).
+/// </summary>
+public sealed class SharedFrameCache : IDisposable
+{
+    private SharedCacheHandle? _cache;
+
+    private SharedFrameCache(SharedCacheHandle cache)
+    {
+        this._cache = cache;
+    }
+
+    /// <summary>
+    /// Opens a shared cache, creating it if no process has.
+    /// </summary>
+    /// <param name="name">1 to 16 characters from [A-Za-z0-9_-], the same in every process.</param>
+    /// <param name="budgetBytes">Largest total size of the cached frames; only used by the process that creates the cache.</param>
+    /// <returns>The cache, or null if the name is invalid or shared memory is unavailable.</returns>
+    public static SharedFrameCache? Open(string name, long budgetBytes)
+    {
+        if (string.IsNullOrEmpty(name) || budgetBytes <= 0)
+        {
+            return null;
+        }
+
+        IntPtr handle = Native.gb_shared_cache_open(name, budgetBytes);
+        return handle == IntPtr.Zero ? null : new SharedFrameCache(new SharedCacheHandle(handle));
+    }
+
+    /// <summary>
+    /// Removes a cache's shared memory from the system, for example when the last process of a fleet exits.
+    /// </summary>
+    /// <param name="name">The name the cache was opened with.</param>
+    /// <remarks>Processes that have the cache open keep using it.</remarks>
+    public static void Remove(string name)
+    {
+        if (!string.IsNullOrEmpty(name))
+        {
+            Native.gb_shared_cache_remove(name);
+        }
+    }
+
+    /// <summary>
+    /// Gets the occupancy of the cache and this process's hit counts.
+    /// </summary>
+    /// <returns>The statistics, or all zeros once disposed.</returns>
+    public SharedCacheStats GetStats()
+    {
+        if (this._cache == null)
+        {
+            return default;
+        }
+
+        Native.gb_shared_cache_get_stats(this._cache.DangerousGetHandle(), out SharedCacheStats stats);
+        return stats;
+    }
+
+    /// <summary>
+    /// Closes this process's handle. Players the cache was set on keep using it until they load another GIF.
+    /// </summary>
+    public void Dispose()
+    {
+        this._cache?.Dispose();
+        this._cache = null;
+    }
+
+    /// <summary>
+    /// Gets the native handle, for setting the cache on a decoder.
+    /// </summary>
+    /// <returns>The handle, or <see cref="IntPtr.Zero"/> once disposed.</returns>
+    internal IntPtr GetHandle()
+    {
+        SharedCacheHandle? cache = this._cache;
+        return cache == null || cache.IsClosed ? IntPtr.Zero : cache.DangerousGetHandle();
+    }
+}
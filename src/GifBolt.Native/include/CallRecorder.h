@@ -0,0 +1,186 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/// \file CallRecorder.h
+/// \brief Opt-in recording of C ABI calls, so that a host's call sequence can be replayed
+/// offline (see GifBolt.Replay).
+///
+/// Every recorded call keeps its arguments, result, thread, handle and timing. Loaded
+/// buffers are identified by a content hash and, on request, embedded in the recording.
+/// Recording starts with gb_record_start, or at library load when the GIFBOLT_RECORD_CALLS
+/// environment variable names the output file (GIFBOLT_RECORD_BUFFERS=1 embeds buffers).
+
+namespace GifBolt
+{
+namespace CallRecorder
+{
+
+/// \brief Recorded C ABI functions. The values are stored in recordings; never renumber.
+enum class CallId : uint16_t
+{
+    DecoderCreate = 1,
+    DecoderDestroy = 2,
+    LoadFromPath = 3,
+    LoadFromMemory = 4,
+    LoadFromUrl = 5,
+    SetMinFrameDelayMs = 6,
+    SetMaxCachedFrames = 7,
+    SetMipmapsEnabled = 8,
+    TrimMemory = 9,
+    TrimAllMemory = 10,
+    SetHttpCacheDirectory = 11,
+    GetAvailableFrameCount = 12,
+    IsLoadComplete = 13,
+    GetFrameCount = 14,
+    GetWidth = 15,
+    GetHeight = 16,
+    GetLoopCount = 17,
+    GetFrameDelayMs = 18,
+    GetFramePixelsRGBA32 = 19,
+    GetFramePixelsBGRA32 = 20,
+    GetFramePixelsBGRA32Scaled = 21,
+    GetBackgroundColor = 22,
+    StartPrefetching = 23,
+    StopPrefetching = 24,
+    SetCurrentFrame = 25,
+    ResetCanvas = 26,
+    RecordFramePresented = 27,
+    RendererCreate = 28,
+    RendererDestroy = 29,
+    RendererInitialize = 30,
+    RendererLoadGif = 31,
+    RendererLoadGifFromMemory = 32,
+    RendererPlay = 33,
+    RendererPause = 34,
+    RendererStop = 35,
+    RendererSetLooping = 36,
+    RendererRender = 37,
+    CopyFramePixelsBGRA32 = 38,
+    CopyFramePixelsBGRA32Scaled = 39,
+    GetInfo = 40,
+    PresentFrame = 41,
+    GetFrameAlpha = 42,
+    CreatePreview = 43
+};
+
+constexpr uint32_t MAX_CALL_ARGS = 4;  ///< Integer arguments kept per call
+constexpr uint32_t NO_HANDLE = 0;      ///< Call not made on a decoder or renderer
+
+/// \struct RecordedCall
+/// \brief One C ABI call read back from a recording.
+struct RecordedCall
+{
+    CallId id = CallId::DecoderCreate;
+    uint32_t threadId = 0;             ///< Recording-local id of the calling thread, from 1
+    uint32_t handle = NO_HANDLE;       ///< Recording-local id of the decoder or renderer
+    uint64_t startNs = 0;              ///< Since the recording started
+    uint64_t durationNs = 0;
+    int64_t result = 0;                ///< Return value; 1/0 for functions returning a pointer
+    uint32_t argCount = 0;
+    int64_t args[MAX_CALL_ARGS] = {};  ///< Integer arguments, in declaration order
+    std::string text;                  ///< Path or URL argument
+    uint64_t contentHash = 0;          ///< HashContent of a loaded buffer, or 0
+};
+
+/// \struct Recording
+/// \brief The calls of a recording, in start order, and its embedded buffers.
+struct Recording
+{
+    std::vector<RecordedCall> calls;
+    std::unordered_map<uint64_t, std::vector<uint8_t>> buffers;  ///< By content hash
+};
+
+/// \brief Starts recording C ABI calls to a file, replacing any recording in progress.
+/// \param path Output file; overwritten.
+/// \param embedBuffers true to store each distinct loaded buffer in the file, so that a replay
+///                    needs nothing else; false to store content hashes only.
+/// \return false if the file cannot be created.
+bool Start(const std::string& path, bool embedBuffers);
+
+/// \brief Stops recording, flushes and closes the file.
+void Stop();
+
+namespace Detail
+{
+extern std::atomic<bool> g_enabled;  ///< Set between Start and Stop
+}  // namespace Detail
+
+/// \brief Determines whether calls are being recorded.
+/// \details A relaxed load, so an unrecorded call costs one predictable branch.
+inline bool IsEnabled()
+{
+    return Detail::g_enabled.load(std::memory_order_relaxed);
+}
+
+/// \brief Reads a recording back.
+/// \param path Recording file.
+/// \param recording Receives the calls, sorted by start time, and the embedded buffers.
+/// \return false if the file is missing or is not a recording. A recording cut short (by a
+///         crash) is read up to its last complete record.
+bool Read(const std::string& path, Recording& recording);
+
+/// \brief Hashes a buffer (64-bit FNV-1a), as stored in RecordedCall::contentHash.
+uint64_t HashContent(const void* data, size_t length);
+
+/// \brief Gets the C ABI function name of a call, for reports.
+const char* GetCallName(CallId id);
+
+/// \brief Records a C ABI call, from construction to destruction, while recording is on.
+class ScopedCall
+{
+   public:
+    /// \param handle Decoder or renderer the call is made on, or nullptr.
+    /// \param args Integer arguments; those past MAX_CALL_ARGS are ignored.
+    ScopedCall(CallId id, const void* handle, std::initializer_list<int64_t> args = {});
+    ~ScopedCall();
+
+    ScopedCall(const ScopedCall&) = delete;
+    ScopedCall& operator=(const ScopedCall&) = delete;
+
+    /// \brief Records the path or URL argument.
+    void SetText(const char* text);
+
+    /// \brief Records the content hash of a loaded buffer, embedding it if requested.
+    /// \remarks The buffer must stay valid until the destructor, which hashes it.
+    void SetContent(const void* data, size_t length);
+
+    /// \brief Records the handle a create call returns.
+    void SetCreatedHandle(const void* handle);
+
+    /// \brief Records the return value.
+    /// \return value, so that a return statement can wrap the call.
+    template <typename T>
+    T Result(T value)
+    {
+        this->_call.result = static_cast<int64_t>(value);
+        return value;
+    }
+
+    /// \brief Records whether a pointer was returned.
+    /// \return value.
+    const void* Result(const void* value)
+    {
+        this->_call.result = value != nullptr ? 1 : 0;
+        return value;
+    }
+
+   private:
+    bool _active = false;  ///< Recording was on at construction
+    const void* _handle = nullptr;
+    const void* _content = nullptr;  ///< Loaded buffer, hashed at destruction
+    size_t _contentLength = 0;
+    RecordedCall _call;
+};
+
+}  // namespace CallRecorder
+}  // namespace GifBolt
@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "ScalingFilter.h"
+
+namespace GifBolt
+{
+namespace Kernels
+{
+
+/// \brief Maps palette indices to RGBA32 pixels (0xAABBGGRR).
+/// \param raster Palette indices, one byte per pixel.
+/// \param paletteRGB Palette entries as packed R, G, B bytes (giflib's GifColorType layout),
+///                   or nullptr when the frame has no palette.
+/// \param colorCount Number of palette entries.
+/// \param pixels Destination, pixelCount pixels.
+/// \param pixelCount Number of pixels to map.
+/// \param transparentIndex Index mapped to fully transparent, or -1.
+/// \remarks Indices past the palette map to opaque black.
+void ApplyColorMap(const uint8_t* raster, const uint8_t* paletteRGB, int colorCount,
+                   uint32_t* pixels, size_t pixelCount, int transparentIndex);
+
+/// \brief Clears a rectangle of the canvas to transparent (GIF RestoreBackground disposal).
+/// \return The number of pixels that were not transparent before, which lets the caller track
+///         how much of the canvas is transparent without scanning it.
+/// \remarks The part of the rectangle outside the canvas is ignored.
+size_t ClearRect(uint32_t* canvas, uint32_t canvasWidth, uint32_t canvasHeight, uint32_t x,
+               uint32_t y, uint32_t width, uint32_t height);
+
+/// \brief Draws a frame onto the canvas, leaving the canvas where the frame is transparent.
+/// \param framePixels RGBA32 pixels of the frame, frameWidth * frameHeight.
+/// \param frameWidth Frame width in pixels.
+/// \param frameHeight Frame height in pixels.
+/// \param offsetX Position of the frame on the canvas.
+/// \param offsetY Position of the frame on the canvas.
+/// \param canvas RGBA32 canvas, canvasWidth * canvasHeight.
+/// \param canvasWidth Canvas width in pixels.
+/// \param canvasHeight Canvas height in pixels.
+/// \return The number of canvas pixels that were transparent and are now covered.
+/// \remarks Pixels whose alpha is 0 are skipped; the part of the frame outside the canvas is
+///          clipped.
+size_t BlitFrame(const uint32_t* framePixels, uint32_t frameWidth, uint32_t frameHeight,
+               uint32_t offsetX, uint32_t offsetY, uint32_t* canvas, uint32_t canvasWidth,
+               uint32_t canvasHeight);
+
+/// \brief Scales a BGRA32 premultiplied image on the CPU.
+/// \param sourceBGRA Source pixels.
+/// \param sourceWidth Source width in pixels.
+/// \param sourceHeight Source height in pixels.
+/// \param dest Destination buffer (targetWidth * targetHeight * 4 bytes).
+/// \param targetWidth Destination width in pixels.
+/// \param targetHeight Destination height in pixels.
+/// \param filter The scaling filter to use.
+/// \param opaque Whether every source pixel is opaque; the alpha channel is then written as 255
+///               instead of being filtered, for the same result.
+void ScaleBGRA(const uint8_t* sourceBGRA, uint32_t sourceWidth, uint32_t sourceHeight,
+               uint8_t* dest, uint32_t targetWidth, uint32_t targetHeight, ScalingFilter filter,
+               bool opaque = false);
+
+/// \brief Halves a BGRA32 premultiplied image with a 2x2 box filter.
+/// \details Odd source dimensions clamp the last row/column, so every destination pixel
+///          averages samples that exist in the source.
+/// \param source Source pixels.
+/// \param sourceWidth Source width in pixels.
+/// \param sourceHeight Source height in pixels.
+/// \param dest Destination buffer (destWidth * destHeight * 4 bytes).
+/// \param destWidth Destination width (max(1, sourceWidth / 2)).
+/// \param destHeight Destination height (max(1, sourceHeight / 2)).
+/// \param opaque Whether every source pixel is opaque, as for ScaleBGRA.
+void DownsampleBox2x(const uint8_t* source, uint32_t sourceWidth, uint32_t sourceHeight,
+                     uint8_t* dest, uint32_t destWidth, uint32_t destHeight, bool opaque = false);
+
+}  // namespace Kernels
+}  // namespace GifBolt
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -13,6 +14,8 @@
 namespace GifBolt
 {
 
+class SharedFrameCache;
+
 /// \enum DisposalMethod
 /// \brief Specifies how to dispose of a frame before rendering the next one.
 enum class DisposalMethod : uint8_t
@@ -23,6 +26,116 @@ enum class DisposalMethod : uint8_t
     RestorePrevious = 3     ///< Restore to previous frame state
 };
 
+/// \enum FrameAlpha
+/// \brief What kinds of alpha a composed frame contains, so opaque content can skip alpha work.
+enum class FrameAlpha : uint8_t
+{
+    Opaque = 0,      ///< Every pixel has alpha 255
+    Binary = 1,      ///< Pixels are opaque or fully transparent with zero color
+    Translucent = 2  ///< Partial alpha may be present (or the frame was not classified)
+};
+
+/// \enum TrimLevel
+/// \brief How much memory a decoder gives back under memory pressure.
+/// Each level also performs the steps of the levels below it.
+enum class TrimLevel : uint8_t
+{
+    Caches = 0,       ///< Drop converted, scaled and mip caches (rebuilt on the next request)
+    ColdFrames = 1,   ///< Also drop cached composed frames except the most recently used one
+    Composition = 2,  ///< Also drop every cached frame and the composition canvases; frames
+                      ///< are recomposed from frame 0 on the next request
+    Complete = 3      ///< Also release pooled buffers and arenas and shrink bookkeeping
+};
+
+/// \struct DecoderStats
+/// \brief Work counters and memory footprint of a decoder, or of every decoder in the process.
+/// Counters accumulate from the decoder's creation; byte counts describe what is held now.
+struct DecoderStats
+{
+    // Cache activity by tier
+    uint64_t frameCacheHits = 0;       ///< Composed frames served from the frame cache
+    uint64_t frameCacheMisses = 0;     ///< Composed frames copied from the canvas into the cache
+    uint64_t frameCacheEvictions = 0;  ///< Frames dropped from the frame cache
+    uint64_t mipCacheHits = 0;         ///< Scaled requests served from a cached mip chain
+    uint64_t mipCacheMisses = 0;       ///< Scaled requests that had to build a mip chain
+    uint64_t mipCacheEvictions = 0;    ///< Mip chains dropped from the mip cache
+
+    // Work done
+    uint64_t framesDecoded = 0;    ///< Frame rasters LZW-decoded while reading the GIF
+    uint64_t framesComposed = 0;   ///< Frames color-mapped and composed onto the canvas
+    uint64_t framesConverted = 0;  ///< Frames converted to BGRA premultiplied
+    uint64_t framesScaled = 0;     ///< Scaled frames returned
+
+    // Cumulative wall-clock time, in nanoseconds
+    uint64_t lzwTimeNs = 0;        ///< Reading rasters (includes waiting for streamed bytes)
+    uint64_t composeTimeNs = 0;    ///< Color mapping and composition
+    uint64_t convertTimeNs = 0;    ///< RGBA to BGRA premultiplied conversion
+    uint64_t scaleTimeNs = 0;      ///< Building mip chains and resampling
+    uint64_t threadCpuTimeNs = 0;  ///< CPU time of every thread while working for the decoder
+
+    // Memory currently held, in bytes
+    uint64_t rasterBytes = 0;      ///< Color-indexed rasters and color maps of the frames read
+    uint64_t canvasBytes = 0;      ///< Composition canvases and frames composed ahead
+    uint64_t cacheBytes = 0;       ///< Frame, converted, scaled and mip caches
+    uint64_t poolBytes = 0;        ///< Idle pooled buffers, arenas and spare mip chains
+    uint64_t frameCacheBytes = 0;  ///< Part of cacheBytes held by composed frames
+};
+
+/// \struct LoadTimings
+/// \brief Where the time from a load call to the first displayed frame went, in nanoseconds.
+/// Stages that run on the loader thread overlap the caller's wait for frame 0, so the sum
+/// approximates the time to first pixel rather than matching it exactly.
+struct LoadTimings
+{
+    uint64_t openNs = 0;     ///< Opening the file, copying the memory source or connecting
+    uint64_t headerNs = 0;   ///< Reading the header, screen descriptor and global color map
+    uint64_t slurpNs = 0;    ///< Loader start-up and the records ahead of frame 0's raster
+    uint64_t decodeNs = 0;   ///< LZW-decoding frame 0's raster
+    uint64_t composeNs = 0;  ///< Color mapping and composing frame 0
+    uint64_t convertNs = 0;  ///< Converting frame 0 to BGRA premultiplied
+    uint64_t scaleNs = 0;    ///< Scaling frame 0 and building its mip chain
+};
+
+/// \enum LateFrameCause
+/// \brief What made a frame miss its presentation deadline.
+/// A late frame is charged to the largest part of its lateness.
+enum class LateFrameCause : uint8_t
+{
+    Schedule = 0,        ///< The playback tick itself ran late (busy UI thread, timer slack)
+    DecodeNotReady = 1,  ///< The frame had not arrived or had not been composed when due
+    Conversion = 2,      ///< Converting or scaling the frame
+    LockWait = 3         ///< Waiting for a background decode to release the decoder
+};
+
+/// A frame shown more than one 60 Hz refresh past its due time counts as late
+constexpr uint64_t LATE_FRAME_TOLERANCE_NS = 17000000;
+
+/// Buckets of PlaybackStats::latenessHistogram
+constexpr uint32_t LATENESS_BUCKET_COUNT = 12;
+
+/// \struct PlaybackStats
+/// \brief Presentation quality of a decoder's playback, or of every decoder in the process, as
+/// reported by the playback layer through GifDecoder::RecordFramePresented.
+struct PlaybackStats
+{
+    uint64_t framesPresented = 0;  ///< Frames shown
+    uint64_t framesLate = 0;       ///< Frames shown more than LATE_FRAME_TOLERANCE_NS past due
+    uint64_t framesDropped = 0;    ///< Frames skipped without being shown, to catch up
+
+    // framesLate by LateFrameCause
+    uint64_t lateSchedule = 0;
+    uint64_t lateDecodeNotReady = 0;
+    uint64_t lateConversion = 0;
+    uint64_t lateLockWait = 0;
+
+    uint64_t totalLatenessNs = 0;  ///< Summed over the frames shown
+    uint64_t maxLatenessNs = 0;
+
+    /// Frames shown, by lateness: bucket 0 counts frames under 1 ms late, bucket i frames
+    /// [2^(i-1), 2^i) ms late, and the last bucket frames 1024 ms late or more.
+    uint64_t latenessHistogram[LATENESS_BUCKET_COUNT] = {};
+};
+
 /// \struct GifFrame
 /// \brief Represents a single frame in a GIF image.
 /// Contains pixel data and timing information for rendering.
@@ -36,6 +149,7 @@ struct GifFrame
     uint32_t delayMs;              ///< Display duration in milliseconds
     DisposalMethod disposal;       ///< Frame disposal method
     int32_t transparentIndex;      ///< Index of transparent color (-1 if none)
+    FrameAlpha alpha = FrameAlpha::Translucent;  ///< Alpha classification of composed pixels
 };
 
 /// \class GifDecoder
@@ -63,6 +177,84 @@ class GifDecoder
     /// \return The maximum number of cached frames.
     uint32_t GetMaxCachedFrames() const;
 
+    /// \brief Enables or disables per-frame mip pyramids for scaled frame requests.
+    /// \param enabled true to build a premultiplied box-filtered mip chain for each cached
+    ///                frame and resample scaled requests from the nearest larger level.
+    /// \remarks Costs about 1.33x one frame's memory per cached frame, but lets several
+    ///          display sizes of the same animation share one chain.
+    void SetMipmapsEnabled(bool enabled);
+
+    /// \brief Gets whether mip pyramids are used for scaled frame requests.
+    /// \return true if mip chains are enabled; false otherwise.
+    bool GetMipmapsEnabled() const;
+
+    /// \brief Shares converted frames with other processes through a shared frame cache.
+    /// \param cache An open cache, or nullptr to stop sharing. Decoders may share one cache.
+    /// \remarks Once a GIF has been read completely, its frames are looked up by content
+    ///          before they are composed, so every process showing the same GIF maps the frames
+    ///          one of them converted. Frames this decoder converts are published in turn.
+    void SetSharedFrameCache(std::shared_ptr<SharedFrameCache> cache);
+
+    /// \brief Releases memory that can be rebuilt on demand.
+    /// \param level How aggressively to trim (see TrimLevel).
+    /// \return The number of bytes freed.
+    /// \remarks May be called from any thread: it waits for frame requests and background
+    ///          composition in progress. At every level, pointers returned earlier by
+    ///          GetFramePixelsBGRA32Premultiplied and GetFramePixelsBGRA32PremultipliedScaled
+    ///          (the converted, scaled and mip caches) become invalid, so do not use them while
+    ///          a trim may run; the Copy variants write into caller memory instead. The frame
+    ///          returned by the last GetFrame call survives below TrimLevel::Composition.
+    size_t TrimMemory(TrimLevel level);
+
+    /// \brief Trims every live decoder in the process.
+    /// \param level How aggressively to trim (see TrimLevel).
+    /// \return The total number of bytes freed.
+    /// \remarks Intended for OS memory-pressure notifications, from any thread. Invalidates
+    ///          the pixel pointers of every decoder, as TrimMemory does.
+    static size_t TrimAllMemory(TrimLevel level);
+
+    /// \brief Gets the work counters and memory footprint of this decoder.
+    /// \return Counters accumulated since the decoder was created, and the bytes held now.
+    /// \remarks Counters are relaxed atomics bumped as work happens, so they are always on.
+    ///          Byte counts walk the caches: call from the thread that drives this decoder.
+    DecoderStats GetStats() const;
+
+    /// \brief Gets the statistics of every decoder in the process.
+    /// \return Counters and bytes summed over live decoders, plus the counters of destroyed
+    ///         decoders.
+    /// \remarks Call from the thread that drives the decoders.
+    static DecoderStats GetProcessStats();
+
+    /// \brief Gets the time spent reaching frame 0 of the current load, stage by stage.
+    /// \return Open and header time of the load (the loader thread opens the source a second
+    ///         time, which is included), and the work done on frame 0 since.
+    /// \remarks Call right after the first frame is shown to get its time to first pixel;
+    ///          frame 0 work done later, such as re-decoding it after eviction, adds up.
+    LoadTimings GetLoadTimings() const;
+
+    /// \brief Records that a frame was shown, for playback quality statistics.
+    /// \param frameIndex The frame shown. A late frame is attributed using the decoder's most
+    ///                   recent request for it (see LateFrameCause).
+    /// \param latenessNs Time from the frame's due time until it was shown; 0 if on time.
+    /// \param droppedFrames Frames skipped without being shown, to catch up, before this one.
+    /// \remarks Late frames also produce a trace span and a deadline_miss probe. Call right
+    ///          after presenting, from any thread.
+    void RecordFramePresented(uint32_t frameIndex, uint64_t latenessNs,
+                              uint32_t droppedFrames = 0);
+
+    /// \brief Gets the playback quality recorded for this decoder.
+    /// \remarks May be called from any thread, while frames are being recorded.
+    PlaybackStats GetPlaybackStats() const;
+
+    /// \brief Gets the playback quality summed over every decoder in the process.
+    /// \return Live decoders' statistics plus those of destroyed decoders.
+    /// \remarks May be called from any thread, while frames are being recorded.
+    static PlaybackStats GetProcessPlaybackStats();
+
+    /// \brief Gets the process-unique id that tags this decoder's trace events and probes.
+    /// \return A nonzero id, assigned when the decoder is created.
+    uint32_t GetDecoderId() const;
+
     /// \brief Initializes a new instance of the GifDecoder class.
     GifDecoder();
 
@@ -81,20 +273,66 @@ class GifDecoder
     bool LoadFromMemory(const uint8_t* data, size_t length);
 
     /// \brief Loads a GIF image from a URL.
-    /// \param url The URL to the GIF image.
-    /// \return true if the GIF was loaded successfully; false otherwise.
+    /// \param url An http:// or file:// URL to the GIF image.
+    /// \return true once the GIF header has been received; false otherwise.
+    /// \remarks The body keeps downloading in the background and frames become available
+    ///          as their bytes arrive (see GetAvailableFrameCount). https:// is not supported.
     bool LoadFromUrl(const std::string& url);
 
+    /// \brief Sets the process-wide directory used to cache HTTP responses for LoadFromUrl.
+    /// \param directory Cache directory (created on demand), or empty to disable caching.
+    /// \remarks Cached responses are reused while fresh and revalidated with their ETag or
+    ///          Last-Modified validators once stale.
+    static void SetHttpCacheDirectory(const std::string& directory);
+
+    /// \brief Sets how long LoadFromUrl may wait to connect to each address of a host.
+    /// \param timeoutMs Timeout in milliseconds, or 0 for the default of 10 seconds.
+    static void SetHttpConnectTimeoutMs(int timeoutMs);
+
     /// \brief Gets the total number of frames in the GIF.
     /// \return The number of frames, or 0 if no GIF is loaded.
+    /// \remarks Blocks until the whole GIF has been read (for URLs, downloaded).
     uint32_t GetFrameCount() const;
 
+    /// \brief Gets the number of frames read so far, without waiting for the rest.
+    /// \return The number of frames that can be requested without blocking on I/O.
+    uint32_t GetAvailableFrameCount() const;
+
+    /// \brief Determines whether every frame of the GIF has been read.
+    /// \return true once loading has finished (or failed); false while frames are arriving.
+    bool IsLoadComplete() const;
+
     /// \brief Gets the frame data at the specified index.
     /// \param index The zero-based index of the frame.
     /// \return A reference to the GifFrame at the specified index.
     /// \throws std::out_of_range if index >= GetFrameCount().
+    /// \remarks Waits for the frame to arrive when the GIF is still loading.
     const GifFrame& GetFrame(uint32_t index) const;
 
+    /// \brief Gets the display duration of a frame without decoding it.
+    /// \param index The zero-based index of the frame.
+    /// \return The delay in milliseconds, with the minimum frame delay applied.
+    /// \throws std::out_of_range if index >= GetFrameCount().
+    /// \remarks Waits for the frame's records to arrive when the GIF is still loading, but
+    ///          never for a frame another thread is producing.
+    uint32_t GetFrameDelayMs(uint32_t index) const;
+
+    /// \brief Gets the display duration of every frame at once.
+    /// \return One delay per frame in milliseconds, with the minimum frame delay applied.
+    /// \remarks Blocks until the whole GIF has been read, like GetFrameCount. The array is owned
+    ///          by the decoder and stays at the same address until the next load; after
+    ///          SetMinFrameDelayMs its values are rewritten in place by the next call.
+    const std::vector<uint32_t>& GetFrameDelaysMs() const;
+
+    /// \brief Gets the alpha classification of a composed frame.
+    /// \param index The zero-based index of the frame.
+    /// \return Opaque when the frame covers the whole canvas, Binary when some pixels are
+    ///         transparent. GIF composition never produces partial alpha.
+    /// \throws std::out_of_range if index >= GetFrameCount().
+    /// \remarks Composes the frame if it is not cached. The class is counted while frames are
+    ///          composed, so it costs no extra pass over the pixels.
+    FrameAlpha GetFrameAlpha(uint32_t index);
+
     /// \brief Gets the width of the GIF image.
     /// \return The width in pixels, or 0 if no GIF is loaded.
     uint32_t GetWidth() const;
@@ -131,6 +369,35 @@ class GifDecoder
         uint32_t index, uint32_t targetWidth, uint32_t targetHeight, uint32_t& outWidth,
         uint32_t& outHeight, ScalingFilter filter = ScalingFilter::Bilinear);
 
+    /// \brief Writes BGRA premultiplied pixels of a frame into caller memory, such as a locked
+    /// bitmap, without going through an intermediate buffer when rows are packed.
+    /// \details Both Copy functions may be called from a background thread while another thread
+    ///          drives playback: frame requests on one decoder are serialized, and the caller's
+    ///          memory is the only output. Pointers and references returned by the getters
+    ///          above stay valid only while no other thread requests frames.
+    /// \param index The zero-based index of the frame.
+    /// \param dest Destination of GetHeight() rows of GetWidth() pixels.
+    /// \param destStride Bytes from the start of one destination row to the next.
+    /// \param destSize Size of the destination in bytes.
+    /// \return true if the frame was written; false on error or if the destination is too small.
+    bool CopyFramePixelsBGRA32Premultiplied(uint32_t index, uint8_t* dest, size_t destStride,
+                                            size_t destSize);
+
+    /// \brief Writes BGRA premultiplied pixels of a frame, scaled to target dimensions, into
+    /// caller memory.
+    /// \param index The zero-based index of the frame.
+    /// \param targetWidth The output width in pixels.
+    /// \param targetHeight The output height in pixels.
+    /// \param dest Destination of targetHeight rows of targetWidth pixels.
+    /// \param destStride Bytes from the start of one destination row to the next.
+    /// \param destSize Size of the destination in bytes.
+    /// \param filter The scaling filter to use (Nearest, Bilinear, Bicubic, Lanczos).
+    /// \return true if the frame was written; false on error or if the destination is too small.
+    bool CopyFramePixelsBGRA32PremultipliedScaled(uint32_t index, uint32_t targetWidth,
+                                                  uint32_t targetHeight, uint8_t* dest,
+                                                  size_t destStride, size_t destSize,
+                                                  ScalingFilter filter = ScalingFilter::Bilinear);
+
     /// \brief Starts background prefetching of frames ahead of the current playback position.
     /// \param startFrame The frame to start prefetching from.
     /// \remarks This starts a background thread that decodes frames ahead of playback,
@@ -150,6 +417,18 @@ class GifDecoder
     ///          This clears the canvas and resets disposal state without reloading the GIF.
     void ResetCanvas();
 
+    /// \brief Composes every frame in order on the calling thread and passes each to a visitor.
+    /// \param visit Called with the frame index, the composed canvas (GetHeight() rows of
+    ///              GetWidth() RGBA pixels, valid only during the call) and the frame's alpha
+    ///              class; returns false to stop.
+    /// \return true if every frame was visited; false if no GIF is loaded or the visitor
+    ///         stopped.
+    /// \remarks Waits for the whole GIF to be read. The decode lock is held throughout, so
+    ///          background decode cannot move the canvas while a frame is visited. Cached
+    ///          frames are kept; composition continues after the last frame.
+    bool VisitComposedFrames(
+        const std::function<bool(uint32_t, const uint32_t*, FrameAlpha)>& visit);
+
    private:
     class Impl;
     std::unique_ptr<Impl> _pImpl;  ///< Opaque implementation (Pimpl pattern)
@@ -3,9 +3,11 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <memory_resource>
+#include <optional>
 #include <vector>
 
 namespace GifBolt
@@ -16,23 +18,27 @@ namespace Memory
 /// \brief PMR-based memory pool for frame allocations.
 /// \details Uses C++17 std::pmr::monotonic_buffer_resource for efficient
 ///          frame-by-frame allocations without individual deallocations.
+///          The backing buffer is allocated on first use and can be released under
+///          memory pressure.
 class FrameMemoryPool
 {
    public:
     /// \brief Initializes a frame memory pool with the specified initial capacity.
     /// \param initialBytes Initial buffer size in bytes (default: 4MB for ~2 full HD frames).
-    explicit FrameMemoryPool(size_t initialBytes = 4 * 1024 * 1024)
-        : m_Buffer(initialBytes),
-          m_Resource(m_Buffer.data(), m_Buffer.size()),
-          m_Allocator(&m_Resource)
+    explicit FrameMemoryPool(size_t initialBytes = 4 * 1024 * 1024) : m_InitialBytes(initialBytes)
     {
     }
 
-    /// \brief Gets the PMR allocator for this pool.
+    /// \brief Gets the PMR allocator for this pool, allocating the buffer if needed.
     /// \return A polymorphic allocator that uses this pool's memory resource.
     std::pmr::polymorphic_allocator<std::byte> GetAllocator()
     {
-        return m_Allocator;
+        if (!m_Resource)
+        {
+            m_Buffer.resize(m_InitialBytes);
+            m_Resource.emplace(m_Buffer.data(), m_Buffer.size());
+        }
+        return std::pmr::polymorphic_allocator<std::byte>(&*m_Resource);
     }
 
     /// \brief Resets the pool, making all allocated memory available for reuse.
@@ -40,7 +46,21 @@ class FrameMemoryPool
     ///          Call this between GIF loading operations to reuse memory.
     void Reset()
     {
-        m_Resource.release();
+        if (m_Resource)
+        {
+            m_Resource->release();
+        }
+    }
+
+    /// \brief Frees the backing buffer; it is re-created by the next GetAllocator call.
+    /// \details Memory previously allocated from the pool must no longer be in use.
+    /// \return The number of bytes released.
+    size_t Release()
+    {
+        const size_t released = m_Buffer.capacity();
+        m_Resource.reset();
+        std::vector<std::byte>().swap(m_Buffer);
+        return released;
     }
 
     /// \brief Gets the total capacity of the pool in bytes.
@@ -50,9 +70,137 @@ class FrameMemoryPool
     }
 
    private:
-    std::vector<std::byte> m_Buffer;                         ///< Pre-allocated buffer
-    std::pmr::monotonic_buffer_resource m_Resource;          ///< PMR memory resource
-    std::pmr::polymorphic_allocator<std::byte> m_Allocator;  ///< PMR allocator
+    size_t m_InitialBytes;                                          ///< Buffer size on first use
+    std::vector<std::byte> m_Buffer;                                ///< Backing buffer
+    std::optional<std::pmr::monotonic_buffer_resource> m_Resource;  ///< PMR memory resource
+};
+
+/// \brief Recycles std::vector buffers in size classes.
+/// \details Buffers handed back with Release() are reused by later Acquire() calls of the same
+///          size class, so workloads that keep requesting the same sizes stop allocating after
+///          warm-up. Classes step by a quarter of a power of two, so a buffer is at most 25%
+///          larger than requested. Not thread-safe.
+/// \tparam T Element type.
+template <typename T>
+class BufferPool
+{
+   public:
+    /// \brief Initializes an empty pool.
+    /// \param maxBuffersPerClass Idle buffers kept per size class; extra buffers are freed.
+    explicit BufferPool(size_t maxBuffersPerClass = 16) : m_MaxBuffersPerClass(maxBuffersPerClass)
+    {
+    }
+
+    /// \brief Gets a buffer holding count elements, reusing an idle one when possible.
+    /// \param count Number of elements; the contents are unspecified.
+    std::vector<T> Acquire(size_t count)
+    {
+        const size_t sizeClass = SizeClassFor(count);
+        if (sizeClass < m_Classes.size() && !m_Classes[sizeClass].empty())
+        {
+            std::vector<T> buffer = std::move(m_Classes[sizeClass].back());
+            m_Classes[sizeClass].pop_back();
+            m_PooledBytes -= buffer.capacity() * sizeof(T);
+            buffer.resize(count);
+            return buffer;
+        }
+
+        std::vector<T> buffer;
+        buffer.reserve(ClassCapacity(sizeClass));
+        buffer.resize(count);
+        return buffer;
+    }
+
+    /// \brief Returns a buffer to the pool.
+    /// \param buffer Buffer to recycle; it is left empty.
+    void Release(std::vector<T>&& buffer)
+    {
+        if (buffer.capacity() == 0)
+        {
+            return;
+        }
+
+        // File the buffer under the largest class it can fully serve
+        size_t sizeClass = SizeClassFor(buffer.capacity());
+        if (ClassCapacity(sizeClass) > buffer.capacity())
+        {
+            if (sizeClass == 0)
+            {
+                return;
+            }
+            --sizeClass;
+        }
+
+        if (m_Classes.size() <= sizeClass)
+        {
+            m_Classes.resize(sizeClass + 1);
+        }
+        std::vector<std::vector<T>>& idle = m_Classes[sizeClass];
+        if (idle.size() >= m_MaxBuffersPerClass)
+        {
+            std::vector<T>().swap(buffer);
+            return;
+        }
+
+        buffer.clear();
+        m_PooledBytes += buffer.capacity() * sizeof(T);
+        idle.push_back(std::move(buffer));
+    }
+
+    /// \brief Frees every idle buffer.
+    /// \return The number of bytes released.
+    size_t Trim()
+    {
+        const size_t released = m_PooledBytes;
+        std::vector<std::vector<std::vector<T>>>().swap(m_Classes);
+        m_PooledBytes = 0;
+        return released;
+    }
+
+    /// \brief Gets the number of bytes held by idle buffers.
+    size_t GetPooledBytes() const
+    {
+        return m_PooledBytes;
+    }
+
+    /// \brief Gets the capacity Acquire gives a buffer of count elements. Buffers allocated
+    ///        elsewhere with this capacity are filed back under the class they serve.
+    static size_t GetAcquireCapacity(size_t count)
+    {
+        return ClassCapacity(SizeClassFor(count));
+    }
+
+   private:
+    /// \brief Gets the element capacity of a size class: 1, 2, 3, 4, 5, 6, 7, 8, 10, 12, ...
+    static size_t ClassCapacity(size_t sizeClass)
+    {
+        if (sizeClass < 4)
+        {
+            return sizeClass + 1;
+        }
+        const size_t group = sizeClass / 4;
+        return (5 + sizeClass % 4) << (group - 1);
+    }
+
+    /// \brief Gets the smallest size class whose capacity holds count elements.
+    static size_t SizeClassFor(size_t count)
+    {
+        if (count <= 4)
+        {
+            return (count == 0) ? 0 : count - 1;
+        }
+        size_t group = 1;
+        while ((static_cast<size_t>(8) << (group - 1)) < count)
+        {
+            ++group;
+        }
+        const size_t step = static_cast<size_t>(1) << (group - 1);
+        return 4 * group + (count + step - 1) / step - 5;
+    }
+
+    size_t m_MaxBuffersPerClass;
+    size_t m_PooledBytes = 0;
+    std::vector<std::vector<std::vector<T>>> m_Classes;  ///< Idle buffers per size class
 };
 
 /// \brief Small vector optimization for temporary buffers.
@@ -209,6 +357,7 @@ class ArenaAllocator
             alignedOffset = 0;
 
             m_Chunks.push_back(m_CurrentChunk);
+            m_ReservedBytes += newChunkSize;
         }
 
         void* ptr = m_CurrentChunk + alignedOffset;
@@ -217,6 +366,23 @@ class ArenaAllocator
         return ptr;
     }
 
+    /// \brief Makes the arena's memory available again without returning it to the heap.
+    /// \details Keeps only the most recent chunk, which is the largest one when requests keep
+    ///          growing, so a steady stream of same-sized requests stops allocating.
+    void Rewind()
+    {
+        if (m_Chunks.size() > 1)
+        {
+            for (size_t i = 0; i + 1 < m_Chunks.size(); ++i)
+            {
+                ::operator delete(m_Chunks[i]);
+            }
+            m_Chunks.erase(m_Chunks.begin(), m_Chunks.end() - 1);
+            m_ReservedBytes = m_CurrentChunkSize;
+        }
+        m_CurrentOffset = 0;
+    }
+
     /// \brief Resets the arena, freeing all allocated memory.
     void Reset()
     {
@@ -228,6 +394,13 @@ class ArenaAllocator
         m_CurrentChunk = nullptr;
         m_CurrentOffset = 0;
         m_CurrentChunkSize = 0;
+        m_ReservedBytes = 0;
+    }
+
+    /// \brief Gets the number of bytes held in chunks, whether handed out or not.
+    size_t GetReservedBytes() const
+    {
+        return m_ReservedBytes;
     }
 
     /// \brief Gets the total number of bytes allocated across all chunks.
@@ -253,6 +426,7 @@ class ArenaAllocator
     uint8_t* m_CurrentChunk;
     size_t m_CurrentOffset;
     size_t m_CurrentChunkSize;
+    size_t m_ReservedBytes = 0;
     std::vector<uint8_t*> m_Chunks;
 };
 
@@ -19,6 +19,9 @@ namespace Renderer
 namespace PixelFormats
 {
 
+// Fixed thresholds of the standalone helpers below. GifDecoder uses the thresholds of the
+// tuning profile instead, which start from these values and can be calibrated (Tuning.h)
+
 // Threshold for enabling multi-threading (pixels)
 // Below this, single-threaded is faster due to thread overhead
 constexpr size_t THREADING_THRESHOLD = 100000;  // ~316x316 image
@@ -234,6 +237,29 @@ inline void ConvertRGBAToBGRAPremultipliedChunk(const uint8_t* source, uint8_t*
     }
 }
 
+/// \brief Converts RGBA to BGRA premultiplied for pixels known to have alpha 0 or 255 only.
+/// \param source Source buffer containing RGBA pixel data.
+/// \param dest Destination buffer for BGRA pixel data.
+/// \param startPixel Starting pixel index (inclusive).
+/// \param endPixel Ending pixel index (exclusive).
+///
+/// Gives the same result as ConvertRGBAToBGRAPremultipliedChunk when every pixel is either
+/// opaque or fully transparent with zero color, which is what GIF composition produces: no
+/// premultiplication is needed, so each pixel is a single branch-free swap of R and B.
+inline void SwizzleRGBAToBGRAChunk(const uint8_t* source, uint8_t* dest, size_t startPixel,
+                                   size_t endPixel)
+{
+    for (size_t i = startPixel; i < endPixel; ++i)
+    {
+        uint32_t pixel;
+        std::memcpy(&pixel, source + i * 4, sizeof(pixel));
+        // Byte order is the same on every supported host, so bytes 0 and 2 are the low and
+        // third bytes of the little-endian word
+        pixel = (pixel & 0xFF00FF00u) | ((pixel & 0x000000FFu) << 16) | ((pixel >> 16) & 0xFFu);
+        std::memcpy(dest + i * 4, &pixel, sizeof(pixel));
+    }
+}
+
 /// \brief Converts RGBA to BGRA with premultiplied alpha in a single pass (multi-threaded).
 /// \param source Source buffer containing RGBA pixel data.
 /// \param dest Destination buffer for BGRA premultiplied pixel data (must be pre-allocated).
@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/// \file PreviewProxy.h
+/// \brief Small, low frame rate copies of an animation for hover previews and list tiles.
+///
+/// A proxy is produced by one pass over a loaded decoder. It keeps only the frames a target
+/// frame rate needs, downscaled to fit a target box, and stores them palette-indexed: with
+/// their exact colors when they share at most 256, otherwise quantized to 256 by median cut.
+/// Playing a proxy needs no decoder: each frame is one palette lookup per pixel. Proxies can
+/// be saved next to a cache so that tiles never touch the source GIF; the full decoder is
+/// only needed when the item is opened.
+
+namespace GifBolt
+{
+
+class GifDecoder;
+
+/// \struct PreviewOptions
+/// \brief Size and frame rate of a preview proxy.
+struct PreviewOptions
+{
+    uint32_t maxWidth = 128;   ///< Width of the box the proxy is fitted into
+    uint32_t maxHeight = 128;  ///< Height of the box the proxy is fitted into
+    uint32_t maxFps = 12;      ///< Highest frame rate kept; 0 keeps every frame
+    bool exactColors = false;  ///< Store frames with more than 256 colors as BGRA, unquantized
+};
+
+/// \enum PreviewStorage
+/// \brief How a proxy keeps its pixels.
+enum class PreviewStorage : uint8_t
+{
+    Indexed8 = 0,  ///< One byte per pixel into a palette of BGRA premultiplied colors
+    Bgra32 = 1     ///< BGRA premultiplied pixels of frames with more than 256 colors, when
+                   ///< PreviewOptions::exactColors is set
+};
+
+/// \class PreviewProxy
+/// \brief A downscaled, temporally decimated animation that plays without a decoder.
+/// \details Not thread-safe while it is generated or loaded; once built, any number of
+///          threads may copy frames from it.
+class PreviewProxy
+{
+   public:
+    /// \brief Builds the proxy from a loaded GIF in a single pass.
+    /// \param source Decoder with a GIF loaded; waits for the whole GIF to be read.
+    /// \param options Target box and frame rate. The proxy keeps the source's aspect ratio
+    ///                and is never larger than the source.
+    /// \return true on success; false if no GIF is loaded, the options are empty, or a frame
+    ///         could not be decoded.
+    /// \remarks Every frame is composed once, in order (see GifDecoder::VisitComposedFrames),
+    ///          but only the frames the frame rate keeps are converted and scaled. A dropped
+    ///          frame's time is added to the kept frame before it, so a loop lasts as long as
+    ///          the source's. A decoder that has been playing can be used.
+    bool Generate(GifDecoder& source, const PreviewOptions& options);
+
+    /// \brief Reads a proxy written by SaveToFile.
+    /// \param path Path of the proxy file.
+    /// \return true on success; false if the file cannot be read or is not a valid proxy.
+    bool LoadFromFile(const std::string& path);
+
+    /// \brief Writes the proxy to a file.
+    /// \param path Path of the proxy file, replaced if it exists.
+    /// \return true on success; false if the proxy is empty or the file cannot be written.
+    bool SaveToFile(const std::string& path) const;
+
+    /// \brief Gets the proxy width in pixels, or 0 if it is empty.
+    uint32_t GetWidth() const;
+
+    /// \brief Gets the proxy height in pixels, or 0 if it is empty.
+    uint32_t GetHeight() const;
+
+    /// \brief Gets the number of frames kept.
+    uint32_t GetFrameCount() const;
+
+    /// \brief Determines whether the source GIF loops indefinitely.
+    bool IsLooping() const;
+
+    /// \brief Gets how the pixels are stored.
+    PreviewStorage GetStorage() const;
+
+    /// \brief Gets the display duration of every frame, in milliseconds.
+    const std::vector<uint32_t>& GetFrameDelaysMs() const;
+
+    /// \brief Gets the index of the source frame each proxy frame was made from, so that
+    /// playback can continue at the same point once the full decoder takes over.
+    const std::vector<uint32_t>& GetSourceFrames() const;
+
+    /// \brief Writes BGRA premultiplied pixels of a frame into caller memory.
+    /// \param index The zero-based index of the frame.
+    /// \param dest Destination of GetHeight() rows of GetWidth() pixels.
+    /// \param destStride Bytes from the start of one destination row to the next.
+    /// \param destSize Size of the destination in bytes.
+    /// \return true if the frame was written; false if the index is out of range or the
+    ///         destination is too small.
+    bool CopyFramePixelsBGRA32Premultiplied(uint32_t index, uint8_t* dest, size_t destStride,
+                                            size_t destSize) const;
+
+    /// \brief Gets the memory the proxy holds, in bytes.
+    size_t GetMemoryBytes() const;
+
+   private:
+    /// \brief Stores a frame of packed BGRA pixels, moving to Bgra32 storage once the frames
+    /// no longer fit a 256-color palette.
+    /// \param colors Palette index of each color seen so far, kept by Generate.
+    void AppendFrame(const uint8_t* bgra, std::unordered_map<uint32_t, uint8_t>& colors);
+
+    /// \brief Moves Bgra32 frames to Indexed8 storage with a median cut palette.
+    void Quantize();
+
+    uint32_t _width = 0;
+    uint32_t _height = 0;
+    bool _looping = false;
+    PreviewStorage _storage = PreviewStorage::Indexed8;
+    std::vector<uint32_t> _palette;       ///< BGRA premultiplied colors of Indexed8 storage
+    std::vector<uint8_t> _pixels;         ///< Frames back to back, one or four bytes per pixel
+    std::vector<uint32_t> _frameDelaysMs;
+    std::vector<uint32_t> _sourceFrames;
+};
+
+}  // namespace GifBolt
@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#pragma once
+
+/// \file Probes.h
+/// \brief USDT static tracepoints (provider "gifbolt") for bpftrace, perf and SystemTap.
+///
+/// A disabled probe is a single nop in the instruction stream; arguments are only read
+/// when a tracer attaches. Probes and their arguments:
+///   load_start      decoder id, source kind (1 file, 2 memory, 3 URL)
+///   load_done       decoder id, frames read, duration ns, 1 if every frame was read
+///   frame_decode    decoder id, frame, width, height, duration ns
+///   cache_hit       decoder id, tier (0 frame, 1 mip), frame
+///   cache_miss      decoder id, tier, frame
+///   cache_evict     decoder id, tier, evicted frame
+///   prefetch_issue  decoder id, frame, origin (0 prefetch thread, 1 opportunistic task)
+///   task_enqueue    pool address, task sequence, queue depth after enqueue
+///   task_dequeue    pool address, task sequence, queue depth after dequeue
+///   deadline_miss   decoder id, frame, frame delay ms, lateness ns
+/// For example: bpftrace -e 'usdt:./libGifBolt.Native.so:gifbolt:frame_decode
+///                           { @us = hist(arg4 / 1000); }'
+
+/// \def GIFBOLT_USDT
+/// \brief 1 to compile the probes in, 0 to compile them out.
+/// \details Set by the GIFBOLT_ENABLE_USDT CMake option; otherwise defaults to 1 on Linux
+///          when <sys/sdt.h> (systemtap-sdt-dev) is available.
+#ifndef GIFBOLT_USDT
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#define GIFBOLT_USDT 1
+#endif
+#endif
+#endif
+#ifndef GIFBOLT_USDT
+#define GIFBOLT_USDT 0
+#endif
+
+#if GIFBOLT_USDT
+#include <sys/sdt.h>
+
+#define GIFBOLT_PROBE2(name, a, b) DTRACE_PROBE2(gifbolt, name, a, b)
+#define GIFBOLT_PROBE3(name, a, b, c) DTRACE_PROBE3(gifbolt, name, a, b, c)
+#define GIFBOLT_PROBE4(name, a, b, c, d) DTRACE_PROBE4(gifbolt, name, a, b, c, d)
+#define GIFBOLT_PROBE5(name, a, b, c, d, e) DTRACE_PROBE5(gifbolt, name, a, b, c, d, e)
+#else
+// Arguments stay in an unevaluated operand so values computed only for a probe do not
+// trigger unused-variable warnings
+#define GIFBOLT_PROBE2(name, a, b) static_cast<void>(sizeof(a) + sizeof(b))
+#define GIFBOLT_PROBE3(name, a, b, c) static_cast<void>(sizeof(a) + sizeof(b) + sizeof(c))
+#define GIFBOLT_PROBE4(name, a, b, c, d) \
+    static_cast<void>(sizeof(a) + sizeof(b) + sizeof(c) + sizeof(d))
+#define GIFBOLT_PROBE5(name, a, b, c, d, e) \
+    static_cast<void>(sizeof(a) + sizeof(b) + sizeof(c) + sizeof(d) + sizeof(e))
+#endif
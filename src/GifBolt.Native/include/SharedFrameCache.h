@@ -0,0 +1,198 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/// \file SharedFrameCache.h
+/// \brief Frame cache shared by every process that opens it under the same name.
+///
+/// Processes that show the same GIFs (renderer workers, a thumbnailer, the UI) would each
+/// decode them. With a shared cache, the first process to convert a frame publishes it and
+/// the others map it read-only instead of composing and converting it again.
+///
+/// The cache is an index segment in POSIX shared memory plus one shared memory object per
+/// frame. The index is a fixed table of slots probed by key hash and updated with atomic
+/// operations only, so no process ever blocks another. A slot's state and reference count
+/// share one atomic word: readers pin a slot while they map its frame, and only unpinned
+/// slots are evicted, least recently used first, to keep the frames within a byte budget.
+/// A frame object stays valid for readers that mapped it even after it is evicted.
+///
+/// Pins and write claims are recorded with the id of the process that holds them, so that
+/// eviction can reclaim those of a process that exited without releasing them. Processes
+/// sharing a cache must therefore see each other's process ids (one PID namespace).
+
+namespace GifBolt
+{
+
+/// \struct SharedFrameKey
+/// \brief Identifies a frame in a shared cache.
+struct SharedFrameKey
+{
+    uint64_t contentHash = 0;  ///< Hash of the GIF's decoded content (not of its path)
+    uint32_t frameIndex = 0;   ///< Zero-based frame index
+    uint32_t format = 0;       ///< Pixel format of the stored frame (see SharedFrameFormat)
+    uint32_t width = 0;        ///< Frame width in pixels
+    uint32_t height = 0;       ///< Frame height in pixels
+
+    bool operator==(const SharedFrameKey& other) const
+    {
+        return this->contentHash == other.contentHash &&
+               this->frameIndex == other.frameIndex && this->format == other.format &&
+               this->width == other.width && this->height == other.height;
+    }
+};
+
+/// \enum SharedFrameFormat
+/// \brief Pixel formats stored in a shared cache.
+enum class SharedFrameFormat : uint32_t
+{
+    Bgra32Premultiplied = 1  ///< Full-size composed frames, as GetFramePixelsBGRA32Premultiplied
+};
+
+/// \struct SharedCacheStats
+/// \brief Occupancy of a shared cache and this process's use of it.
+struct SharedCacheStats
+{
+    uint64_t hits = 0;         ///< Lookups by this process that mapped a frame
+    uint64_t misses = 0;       ///< Lookups by this process that found nothing
+    uint64_t inserts = 0;      ///< Frames this process published
+    uint64_t evictions = 0;    ///< Frames this process evicted to stay within the budget
+    uint64_t entries = 0;      ///< Frames in the cache, over all processes
+    uint64_t usedBytes = 0;    ///< Bytes of those frames
+    uint64_t budgetBytes = 0;  ///< Byte budget, set by the process that created the cache
+};
+
+/// \class SharedFrameCache
+/// \brief Handle to a named frame cache shared between processes.
+/// \details Thread-safe once open. Supported where POSIX shared memory is (Linux, macOS);
+///          elsewhere Open fails and decoders behave as if no cache were set.
+class SharedFrameCache
+{
+   public:
+    /// \class View
+    /// \brief A frame mapped read-only, pinned in the cache until the view is unpinned or
+    ///        destroyed.
+    class View
+    {
+       public:
+        View() = default;
+        ~View();
+        View(View&& other) noexcept;
+        View& operator=(View&& other) noexcept;
+        View(const View&) = delete;
+        View& operator=(const View&) = delete;
+
+        /// \brief Gets the frame's bytes, or nullptr for an empty view.
+        const uint8_t* GetData() const;
+
+        /// \brief Gets the number of bytes of the frame.
+        size_t GetSize() const;
+
+        /// \brief Determines whether the view holds a frame.
+        explicit operator bool() const;
+
+        /// \brief Lets the cache evict the frame; the mapping stays readable until Reset.
+        void Unpin();
+
+        /// \brief Unmaps the frame and unpins its slot.
+        void Reset();
+
+       private:
+        friend class SharedFrameCache;
+        SharedFrameCache* _cache = nullptr;  ///< Set while pinned
+        uint32_t _pin = 0;
+        void* _mapping = nullptr;
+        size_t _size = 0;
+    };
+
+    SharedFrameCache() = default;
+    ~SharedFrameCache();
+    SharedFrameCache(const SharedFrameCache&) = delete;
+    SharedFrameCache& operator=(const SharedFrameCache&) = delete;
+
+    /// \brief Determines whether shared caches are available on this platform.
+    static bool IsSupported();
+
+    /// \brief Opens the cache with the given name, creating it if no process has.
+    /// \param name 1 to 16 characters from [A-Za-z0-9_-], the same in every process.
+    /// \param budgetBytes Largest total size of the cached frames. Only used by the process
+    ///                    that creates the cache; later processes adopt its budget.
+    /// \param slotCount Number of index slots, rounded up to a power of two; likewise only
+    ///                  used on creation.
+    /// \return true on success; false if the name is invalid, shared memory is unavailable,
+    ///         or an existing cache has an incompatible layout.
+    bool Open(const std::string& name, uint64_t budgetBytes, uint32_t slotCount = 4096);
+
+    /// \brief Closes this process's handle. Frames stay in the cache for other processes.
+    /// \remarks Every View must have been destroyed.
+    void Close();
+
+    /// \brief Determines whether the cache is open.
+    bool IsOpen() const;
+
+    /// \brief Maps a cached frame read-only.
+    /// \param key The frame to look up.
+    /// \return The frame, or an empty view if it is not cached.
+    View Find(const SharedFrameKey& key);
+
+    /// \brief Publishes a frame for every process.
+    /// \param key Identifies the frame.
+    /// \param data The frame's bytes.
+    /// \param size Number of bytes.
+    /// \return true if the frame was stored; false if it is already cached, larger than the
+    ///         budget, or no room could be freed because every cached frame is in use.
+    bool Insert(const SharedFrameKey& key, const uint8_t* data, size_t size);
+
+    /// \brief Gets the cache's occupancy and this process's hit and insert counts.
+    SharedCacheStats GetStats() const;
+
+    /// \brief Removes a cache's shared memory objects from the system.
+    /// \param name The name passed to Open.
+    /// \remarks Processes that have the cache open keep using it; a later Open creates a new
+    ///          cache.
+    static void Remove(const std::string& name);
+
+   private:
+    struct Header;
+    struct Slot;
+
+    /// \brief Frees one unpinned frame, least recently used first, or if none is, reclaims
+    ///        the pins and write claims of processes that exited.
+    /// \return true if a frame or reservation was freed, or a frame unpinned.
+    bool EvictOne();
+
+    /// \brief Frees the frame of a slot if it is published and unpinned.
+    bool EvictSlot(uint32_t slot);
+
+    /// \brief Undoes the pins and write claims of processes that exited without releasing
+    ///        them.
+    /// \return true if anything was reclaimed.
+    bool ReclaimDeadOwners();
+
+    /// \brief Pins a slot if it holds a published frame, so that it cannot be evicted.
+    /// \return The pin record to pass to Release, or NO_SLOT if the slot was not pinned.
+    uint32_t Pin(uint32_t slot);
+
+    /// \brief Unpins a slot pinned by Pin.
+    /// \param pin The pin record Pin returned.
+    void Release(uint32_t pin);
+
+    std::string GetFrameObjectName(uint32_t slot) const;
+
+    std::string _name;
+    Header* _header = nullptr;
+    Slot* _slots = nullptr;
+    std::atomic<uint64_t>* _pins = nullptr;  ///< Pin records, as many as slots
+    size_t _mappingSize = 0;
+    std::atomic<uint64_t> _hits{0};
+    std::atomic<uint64_t> _misses{0};
+    std::atomic<uint64_t> _inserts{0};
+    std::atomic<uint64_t> _evictions{0};
+};
+
+}  // namespace GifBolt
@@ -3,16 +3,19 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
 #include <functional>
 #include <future>
 #include <memory>
 #include <mutex>
-#include <queue>
 #include <thread>
 #include <vector>
 
+#include "Probes.h"
+#include "Trace.h"
+
 namespace GifBolt
 {
 
@@ -75,12 +78,32 @@ class ThreadPool
                 throw std::runtime_error("Cannot enqueue on stopped ThreadPool");
             }
 
-            this->_tasks.emplace([task]() { (*task)(); });
+            this->PushTask([task]() { (*task)(); });
         }
         this->_condition.notify_one();
         return result;
     }
 
+    /// \brief Queues a fire-and-forget task.
+    /// \details Unlike Enqueue, no future or shared state is created, so small callables (a
+    ///          lambda capturing a pointer and an index) are queued without heap allocation.
+    /// \param f Function to execute.
+    /// \return true if the task was queued; false if the pool is stopping.
+    template <typename F>
+    bool Post(F&& f)
+    {
+        {
+            std::unique_lock<std::mutex> lock(this->_queueMutex);
+            if (this->_stop)
+            {
+                return false;
+            }
+            this->PushTask(std::function<void()>(std::forward<F>(f)));
+        }
+        this->_condition.notify_one();
+        return true;
+    }
+
     /// \brief Gets the number of worker threads.
     /// \return Number of threads in the pool.
     size_t GetThreadCount() const
@@ -89,41 +112,92 @@ class ThreadPool
     }
 
    private:
+    /// \brief Appends a task to the ring buffer, growing it when full.
+    /// \remarks Caller must hold _queueMutex.
+    void PushTask(std::function<void()>&& task)
+    {
+        if (this->_taskCount == this->_tasks.size())
+        {
+            const size_t capacity = std::max<size_t>(8, this->_tasks.size() * 2);
+            std::vector<std::function<void()>> grown(capacity);
+            std::vector<uint64_t> grownQueuedNs(capacity);
+            for (size_t i = 0; i < this->_taskCount; ++i)
+            {
+                const size_t slot = (this->_taskHead + i) % this->_tasks.size();
+                grown[i] = std::move(this->_tasks[slot]);
+                grownQueuedNs[i] = this->_taskQueuedNs[slot];
+            }
+            this->_tasks.swap(grown);
+            this->_taskQueuedNs.swap(grownQueuedNs);
+            this->_taskHead = 0;
+        }
+        const size_t slot = (this->_taskHead + this->_taskCount) % this->_tasks.size();
+        this->_tasks[slot] = std::move(task);
+        this->_taskQueuedNs[slot] = Trace::IsEnabled() ? Trace::NowNs() : 0;
+        ++this->_taskCount;
+        GIFBOLT_PROBE3(task_enqueue, this, this->_tasksQueued, this->_taskCount);
+        ++this->_tasksQueued;
+    }
+
     /// \brief Worker thread function that processes tasks from the queue.
     void WorkerThread()
     {
+        GIFBOLT_TRACE_THREAD_NAME("GifBolt pool");
         while (true)
         {
             std::function<void()> task;
+            uint64_t queuedNs = 0;
             {
                 std::unique_lock<std::mutex> lock(this->_queueMutex);
                 this->_condition.wait(lock,
-                                      [this] { return this->_stop || !this->_tasks.empty(); });
+                                      [this] { return this->_stop || this->_taskCount > 0; });
 
-                if (this->_stop && this->_tasks.empty())
+                if (this->_stop && this->_taskCount == 0)
                 {
                     return;
                 }
 
-                if (!this->_tasks.empty())
+                if (this->_taskCount > 0)
                 {
-                    task = std::move(this->_tasks.front());
-                    this->_tasks.pop();
+                    // Tasks run in queue order, so the oldest one's sequence number follows
+                    // from the counts
+                    GIFBOLT_PROBE3(task_dequeue, this, this->_tasksQueued - this->_taskCount,
+                                   this->_taskCount - 1);
+                    task = std::move(this->_tasks[this->_taskHead]);
+                    queuedNs = this->_taskQueuedNs[this->_taskHead];
+                    this->_tasks[this->_taskHead] = nullptr;
+                    this->_taskHead = (this->_taskHead + 1) % this->_tasks.size();
+                    --this->_taskCount;
                 }
             }
 
             if (task)
             {
+#if GIFBOLT_TRACING
+                // Time spent waiting in the queue shows up as its own span
+                if (queuedNs != 0 && Trace::IsEnabled())
+                {
+                    Trace::RecordSpan("ThreadPool.Queued", queuedNs, Trace::NowNs(),
+                                      Trace::NO_DECODER, Trace::NO_FRAME);
+                }
+#else
+                static_cast<void>(queuedNs);
+#endif
+                GIFBOLT_TRACE_SPAN("ThreadPool.Task", Trace::NO_DECODER, Trace::NO_FRAME);
                 task();
             }
         }
     }
 
-    std::vector<std::thread> _workers;         ///< Worker threads
-    std::queue<std::function<void()>> _tasks;  ///< Task queue
-    std::mutex _queueMutex;                    ///< Mutex for queue access
-    std::condition_variable _condition;        ///< Condition variable for task availability
-    std::atomic<bool> _stop;                   ///< Stop flag
+    std::vector<std::thread> _workers;          ///< Worker threads
+    std::vector<std::function<void()>> _tasks;  ///< Ring buffer of queued tasks
+    std::vector<uint64_t> _taskQueuedNs;        ///< Trace time each task was queued (0 = off)
+    size_t _taskHead = 0;                       ///< Index of the oldest queued task
+    size_t _taskCount = 0;                      ///< Number of queued tasks
+    uint64_t _tasksQueued = 0;                  ///< Tasks queued since construction
+    std::mutex _queueMutex;                     ///< Mutex for queue access
+    std::condition_variable _condition;         ///< Condition variable for task availability
+    std::atomic<bool> _stop;                    ///< Stop flag
 };
 
 }  // namespace GifBolt
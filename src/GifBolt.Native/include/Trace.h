@@ -0,0 +1,134 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+/// \def GIFBOLT_TRACING
+/// \brief 1 to compile trace spans in (the default), 0 to compile them out entirely.
+/// \details Set by the GIFBOLT_ENABLE_TRACING CMake option.
+#ifndef GIFBOLT_TRACING
+#define GIFBOLT_TRACING 1
+#endif
+
+namespace GifBolt
+{
+namespace Trace
+{
+
+constexpr uint32_t NO_DECODER = 0;         ///< Span not tied to a decoder
+constexpr uint32_t NO_FRAME = UINT32_MAX;  ///< Span not tied to a frame
+
+/// \brief Starts recording spans, discarding the events of any previous session.
+/// \return false if tracing was compiled out.
+bool Start();
+
+/// \brief Stops recording spans; recorded events are kept until the next Start.
+void Stop();
+
+namespace Detail
+{
+extern std::atomic<bool> g_enabled;  ///< Set between Start and Stop
+}  // namespace Detail
+
+/// \brief Determines whether spans are being recorded.
+/// \details A relaxed load, so disabled spans cost one predictable branch.
+inline bool IsEnabled()
+{
+    return Detail::g_enabled.load(std::memory_order_relaxed);
+}
+
+/// \brief Writes the recorded events as Chrome trace-event JSON (loadable in Perfetto).
+/// \param path Output file path.
+/// \return true if the file was written.
+bool Dump(const std::string& path);
+
+/// \brief Gets a timestamp on the trace clock, in nanoseconds.
+uint64_t NowNs();
+
+/// \brief Names the calling thread in dumped traces.
+/// \param name Thread name; must outlive the trace (use a string literal).
+void SetThreadName(const char* name);
+
+/// \brief Records a complete span in the calling thread's ring buffer.
+/// \param name Span name; must be a string literal.
+void RecordSpan(const char* name, uint64_t startNs, uint64_t endNs, uint32_t decoderId,
+                uint32_t frameIndex);
+
+/// \brief Records an instant event in the calling thread's ring buffer.
+/// \param name Event name; must be a string literal.
+void RecordInstant(const char* name, uint32_t decoderId, uint32_t frameIndex);
+
+/// \brief Records the lifetime of a scope as a span while tracing is enabled.
+class ScopedSpan
+{
+   public:
+    ScopedSpan(const char* name, uint32_t decoderId, uint32_t frameIndex)
+    {
+        if (IsEnabled())
+        {
+            this->_name = name;
+            this->_decoderId = decoderId;
+            this->_frameIndex = frameIndex;
+            this->_startNs = NowNs();
+        }
+    }
+
+    ~ScopedSpan()
+    {
+        if (this->_name != nullptr)
+        {
+            RecordSpan(this->_name, this->_startNs, NowNs(), this->_decoderId, this->_frameIndex);
+        }
+    }
+
+    ScopedSpan(const ScopedSpan&) = delete;
+    ScopedSpan& operator=(const ScopedSpan&) = delete;
+
+   private:
+    const char* _name = nullptr;  ///< Null when tracing was off at construction
+    uint32_t _decoderId = NO_DECODER;
+    uint32_t _frameIndex = NO_FRAME;
+    uint64_t _startNs = 0;
+};
+
+}  // namespace Trace
+}  // namespace GifBolt
+
+#define GIFBOLT_TRACE_CONCAT_INNER(a, b) a##b
+#define GIFBOLT_TRACE_CONCAT(a, b) GIFBOLT_TRACE_CONCAT_INNER(a, b)
+
+#if GIFBOLT_TRACING
+/// \brief Records the rest of the enclosing scope as a span.
+#define GIFBOLT_TRACE_SPAN(name, decoderId, frameIndex)                                  \
+    const ::GifBolt::Trace::ScopedSpan GIFBOLT_TRACE_CONCAT(gifboltTraceSpan, __LINE__)( \
+        name, decoderId, frameIndex)
+/// \brief Records an instant event.
+#define GIFBOLT_TRACE_INSTANT(name, decoderId, frameIndex)                \
+    do                                                                    \
+    {                                                                     \
+        if (::GifBolt::Trace::IsEnabled())                                \
+        {                                                                 \
+            ::GifBolt::Trace::RecordInstant(name, decoderId, frameIndex); \
+        }                                                                 \
+    } while (false)
+/// \brief Records a span whose start and end (on the trace clock) were taken elsewhere.
+#define GIFBOLT_TRACE_COMPLETE(name, startNs, endNs, decoderId, frameIndex)            \
+    do                                                                                 \
+    {                                                                                  \
+        if (::GifBolt::Trace::IsEnabled())                                             \
+        {                                                                              \
+            ::GifBolt::Trace::RecordSpan(name, startNs, endNs, decoderId, frameIndex); \
+        }                                                                              \
+    } while (false)
+/// \brief Names the calling thread in dumped traces.
+#define GIFBOLT_TRACE_THREAD_NAME(name) ::GifBolt::Trace::SetThreadName(name)
+#else
+#define GIFBOLT_TRACE_SPAN(name, decoderId, frameIndex) static_cast<void>(0)
+#define GIFBOLT_TRACE_INSTANT(name, decoderId, frameIndex) static_cast<void>(0)
+#define GIFBOLT_TRACE_COMPLETE(name, startNs, endNs, decoderId, frameIndex) static_cast<void>(0)
+#define GIFBOLT_TRACE_THREAD_NAME(name) static_cast<void>(0)
+#endif
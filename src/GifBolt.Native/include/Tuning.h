@@ -0,0 +1,85 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace GifBolt
+{
+
+namespace Renderer
+{
+class IDeviceCommandContext;
+}  // namespace Renderer
+
+/// \enum TuningSource
+/// \brief Where the thresholds of a TuningProfile came from.
+enum class TuningSource : uint8_t
+{
+    Defaults = 0,    ///< Built-in constants (PixelConversion.h)
+    Calibrated = 1,  ///< Measured on this host
+    Loaded = 2,      ///< Read from a profile file measured earlier on this host
+    Host = 3         ///< Set by the host application
+};
+
+/// \struct TuningProfile
+/// \brief CPU threading and GPU offload thresholds used by every decoder in the process.
+/// \details The defaults were measured on one developer machine and reproduce the behavior of
+///          earlier releases. Calibration replaces them with values measured on the host.
+struct TuningProfile
+{
+    /// Frames of at least this many pixels are converted to BGRA premultiplied in parallel
+    uint64_t convertParallelMinPixels = 100000;
+    /// Threads (the caller included) a parallel conversion is split across; 0 = one per
+    /// decoder pool worker plus the caller
+    uint32_t convertThreads = 0;
+    /// Worker threads in each decoder's pool; 0 = one less than the hardware threads
+    uint32_t workerThreads = 0;
+    /// Scaled frames whose source has at least this many pixels try the GPU first, where a
+    /// GPU context exists; UINT64_MAX never tries it
+    uint64_t gpuScaleMinPixels = 0;
+    uint32_t hardwareThreads = 0;  ///< Hardware threads of the host measured (0 = unknown)
+    TuningSource source = TuningSource::Defaults;
+};
+
+namespace Tuning
+{
+
+/// \brief Gets the profile in effect.
+/// \details When the GIFBOLT_CALIBRATE environment variable is set, the first call loads or
+///          calibrates the profile as CalibrateOrLoad does, with the variable as the profile
+///          path ("1" calibrates without saving).
+TuningProfile GetProfile();
+
+/// \brief Replaces the profile in effect; decoders loaded afterwards size their pools by it.
+void SetProfile(const TuningProfile& profile);
+
+/// \brief Restores the built-in defaults.
+void ResetProfile();
+
+/// \brief Times the conversion and scaling kernels on this host and derives the thresholds.
+/// \param gpu GPU context to compare scaling against, or nullptr to create the platform's
+///            default context (none on Linux).
+/// \return The measured profile; it is not put into effect.
+/// \remarks Takes on the order of 100-300 ms and uses every hardware thread while it runs.
+TuningProfile Calibrate(Renderer::IDeviceCommandContext* gpu = nullptr);
+
+/// \brief Writes a profile as "key=value" lines.
+/// \return false if the file cannot be written.
+bool SaveProfile(const TuningProfile& profile, const std::string& path);
+
+/// \brief Reads a profile written by SaveProfile.
+/// \return false if the file is missing or malformed, or was measured on a host with a
+///         different number of hardware threads.
+bool LoadProfile(const std::string& path, TuningProfile& profile);
+
+/// \brief Puts a profile from a file into effect, or calibrates and saves one if the file is
+/// missing or stale.
+/// \param path Profile file, or empty to calibrate without saving.
+/// \return The profile put into effect.
+TuningProfile CalibrateOrLoad(const std::string& path);
+
+}  // namespace Tuning
+}  // namespace GifBolt
@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace GifBolt
+{
+namespace Net
+{
+
+/// \class StreamBuffer
+/// \brief Growing byte buffer filled by a download and read concurrently by decoders.
+///
+/// Bytes are only ever appended, so every reader sees the same prefix of the response body.
+/// Readers block until the bytes they ask for arrive or the download finishes.
+class StreamBuffer
+{
+   public:
+    /// \brief Appends downloaded bytes and wakes blocked readers.
+    /// \param data Pointer to the bytes to append.
+    /// \param length Number of bytes to append.
+    void Append(const uint8_t* data, size_t length);
+
+    /// \brief Marks the stream as complete; no further bytes will be appended.
+    /// \param succeeded true if the whole body was received; false if the download failed.
+    void Finish(bool succeeded);
+
+    /// \brief Copies bytes at the given offset, blocking until they are available.
+    /// \param offset Byte offset within the body.
+    /// \param destination Buffer receiving the bytes.
+    /// \param length Number of bytes requested.
+    /// \param cancel Flag that aborts the wait when set (see WakeReaders).
+    /// \return The number of bytes copied; less than length only at the end of the stream
+    ///         or when cancelled.
+    size_t Read(size_t offset, uint8_t* destination, size_t length,
+                const std::atomic<bool>& cancel);
+
+    /// \brief Wakes every blocked reader so it can re-check its cancel flag.
+    void WakeReaders();
+
+    /// \brief Gets whether the download has finished (successfully or not).
+    bool IsComplete() const;
+
+    /// \brief Gets whether the download finished with the whole body received.
+    bool Succeeded() const;
+
+    /// \brief Gets the number of bytes received so far.
+    size_t GetSize() const;
+
+   private:
+    mutable std::mutex _mutex;
+    std::condition_variable _dataAvailable;
+    std::vector<uint8_t> _data;
+    bool _complete = false;
+    bool _succeeded = false;
+};
+
+/// \brief Starts loading an http:// URL and returns the stream its body is written to.
+/// \param url Absolute http:// URL. Redirects to other http:// URLs are followed.
+/// \return A stream that fills in the background, or nullptr if the URL is not supported.
+/// \remarks Concurrent requests for the same URL share a single download. When a cache
+///          directory is set, fresh responses are served from disk and stale ones are
+///          revalidated with If-None-Match / If-Modified-Since.
+std::shared_ptr<StreamBuffer> OpenUrl(const std::string& url);
+
+/// \brief Converts a file:// URL into a local file system path.
+/// \param url The URL to convert.
+/// \param path Receives the percent-decoded path on success.
+/// \return true if url is a file:// URL; false otherwise.
+bool FileUrlToPath(const std::string& url, std::string& path);
+
+/// \brief Sets how long connecting to each address of a host may take.
+/// \param timeoutMs Timeout in milliseconds, or 0 for the default of 10 seconds.
+/// \remarks Loads read the GIF header synchronously, so this bounds how long an unreachable
+///          host stalls LoadFromUrl. Receiving has its own timeouts once connected.
+void SetConnectTimeoutMs(int timeoutMs);
+
+/// \brief Gets the connect timeout set by SetConnectTimeoutMs.
+int GetConnectTimeoutMs();
+
+/// \brief Sets the directory used to cache HTTP responses on disk.
+/// \param directory Cache directory (created on demand), or empty to disable the cache.
+void SetCacheDirectory(const std::string& directory);
+
+/// \brief Gets the directory used to cache HTTP responses on disk.
+/// \return The cache directory, or an empty string if the cache is disabled.
+std::string GetCacheDirectory();
+
+}  // namespace Net
+}  // namespace GifBolt
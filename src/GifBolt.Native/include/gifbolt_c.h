@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include <stdint.h>
+
 #include "gifbolt_version.h"
 
 #ifdef __cplusplus
@@ -56,6 +58,26 @@ extern "C"
     /// \return 1 if successful; 0 otherwise.
     GB_API int gb_decoder_load_from_memory(gb_decoder_t decoder, const void* data, int length);
 
+    /// \brief Loads a GIF from an http:// or file:// URL, decoding frames as bytes arrive.
+    /// \param decoder The decoder handle.
+    /// \param url The URL of the GIF image.
+    /// \return 1 once the GIF header has been received; 0 otherwise.
+    GB_API int gb_decoder_load_from_url(gb_decoder_t decoder, const char* url);
+
+    /// \brief Gets the number of frames read so far without waiting for the rest to load.
+    /// \param decoder The decoder handle.
+    /// \return The number of frames available, or 0 on error.
+    GB_API int gb_decoder_get_available_frame_count(gb_decoder_t decoder);
+
+    /// \brief Determines whether every frame of the GIF has been read.
+    /// \param decoder The decoder handle.
+    /// \return 1 once loading has finished (or failed); 0 while frames are still arriving.
+    GB_API int gb_decoder_is_load_complete(gb_decoder_t decoder);
+
+    /// \brief Sets the process-wide directory used to cache HTTP responses.
+    /// \param directory Cache directory, or NULL/empty to disable the cache.
+    GB_API void gb_set_http_cache_directory(const char* directory);
+
     /// \brief Gets the total number of frames in the loaded GIF.
     /// \param decoder The decoder handle.
     /// \return The frame count, or 0 if no GIF is loaded or on error.
@@ -81,8 +103,31 @@ extern "C"
     /// \param decoder The decoder handle.
     /// \param index The zero-based frame index.
     /// \return The frame delay in milliseconds, or 0 on error.
+    /// \remarks Does not decode the frame, nor wait for a frame being copied on another thread.
     GB_API int gb_decoder_get_frame_delay_ms(gb_decoder_t decoder, int index);
 
+    /// \struct gb_decoder_info_t
+    /// \brief What playback needs to know about a loaded GIF, read with gb_decoder_get_info.
+    typedef struct gb_decoder_info_t
+    {
+        int32_t width;                    ///< Width in pixels
+        int32_t height;                   ///< Height in pixels
+        int32_t frame_count;              ///< Total number of frames
+        int32_t loop_count;               ///< As returned by gb_decoder_get_loop_count
+        uint32_t background_color;        ///< As returned by gb_decoder_get_background_color
+        int32_t min_frame_delay_ms;       ///< Minimum applied to every frame delay
+        const uint32_t* frame_delays_ms;  ///< frame_count delays in milliseconds, decoder-owned
+    } gb_decoder_info_t;
+
+    /// \brief Gets the dimensions, frame count, loop count and frame delays of a GIF in one call.
+    /// \param decoder The decoder handle.
+    /// \param[out] info Receives the description. Its frame_delays_ms array stays valid until
+    ///                  the next load or gb_decoder_set_min_frame_delay_ms.
+    /// \return 1 on success; 0 if an argument is NULL or on error.
+    /// \remarks Blocks until every frame has been read, like gb_decoder_get_frame_count. Call
+    ///          from the thread that drives the decoder.
+    GB_API int gb_decoder_get_info(gb_decoder_t decoder, gb_decoder_info_t* info);
+
     /// \brief Gets the RGBA32 pixel data for the specified frame.
     /// \param decoder The decoder handle.
     /// \param index The zero-based frame index.
@@ -102,6 +147,25 @@ extern "C"
     GB_API const void* gb_decoder_get_frame_pixels_bgra32_premultiplied(gb_decoder_t decoder,
                                                                         int index, int* byteCount);
 
+    /// \def GB_FRAME_ALPHA_OPAQUE
+    /// \brief Every pixel of the frame has alpha 255.
+#define GB_FRAME_ALPHA_OPAQUE 0
+    /// \def GB_FRAME_ALPHA_BINARY
+    /// \brief Pixels are opaque or fully transparent with zero color.
+#define GB_FRAME_ALPHA_BINARY 1
+    /// \def GB_FRAME_ALPHA_TRANSLUCENT
+    /// \brief Partial alpha may be present.
+#define GB_FRAME_ALPHA_TRANSLUCENT 2
+
+    /// \brief Gets the alpha classification of a composed frame (see GifBolt::FrameAlpha).
+    /// \param decoder The decoder handle.
+    /// \param index The zero-based frame index.
+    /// \return One of the GB_FRAME_ALPHA_ values, or -1 on error.
+    /// \remarks Hosts can upload opaque frames as opaque textures and draw them without
+    ///          blending. The frame's premultiplied pixels are then identical to its plain BGRA
+    ///          pixels.
+    GB_API int gb_decoder_get_frame_alpha(gb_decoder_t decoder, int index);
+
     /// \brief Gets the background color of the GIF.
     /// \param decoder The decoder handle.
     /// \return The background color as RGBA32 (0xAABBGGRR), or 0xFF000000 (black) on error.
@@ -166,6 +230,12 @@ extern "C"
     GB_API int GifBolt_Render(gb_renderer_t renderer);
 
     GB_API void gb_decoder_set_min_frame_delay_ms(gb_decoder_t decoder, int minDelayMs);
+
+    /// \brief Gets the minimum frame delay.
+    /// \param decoder The decoder handle.
+    /// \return The minimum delay in milliseconds, or 0 on error.
+    /// \remarks Neither blocks, locks nor records, so it may be called without a GC transition
+    ///          (SuppressGCTransition).
     GB_API int gb_decoder_get_min_frame_delay_ms(gb_decoder_t decoder);
 
     /// \brief Sets the maximum number of frames to cache in memory.
@@ -176,8 +246,219 @@ extern "C"
     /// \brief Gets the maximum number of frames cached in memory.
     /// \param decoder The decoder handle.
     /// \return The maximum number of cached frames, or 0 on error.
+    /// \remarks Neither blocks, locks nor records, so it may be called without a GC transition.
     GB_API unsigned int gb_decoder_get_max_cached_frames(gb_decoder_t decoder);
 
+    /// \brief Enables or disables per-frame mip pyramids for scaled frame requests.
+    /// \param decoder The decoder handle.
+    /// \param enabled 1 to serve scaled requests from a box-filtered mip chain; 0 to always
+    ///                scale from the full-resolution frame.
+    /// \remarks Useful when the same animation is displayed at several sizes at once.
+    GB_API void gb_decoder_set_mipmaps_enabled(gb_decoder_t decoder, int enabled);
+
+    /// \brief Gets whether mip pyramids are used for scaled frame requests.
+    /// \param decoder The decoder handle.
+    /// \return 1 if enabled; 0 if disabled or on error.
+    GB_API int gb_decoder_get_mipmaps_enabled(gb_decoder_t decoder);
+
+    /// \brief Releases decoder memory that can be rebuilt on demand.
+    /// \param decoder The decoder handle.
+    /// \param level 0 = converted/scaled/mip caches, 1 = also cold cached frames,
+    ///              2 = also all cached frames and composition canvases,
+    ///              3 = also pooled buffers and arenas. Out-of-range values are clamped.
+    /// \return The number of bytes freed, or 0 on error.
+    /// \remarks May be called from any thread; it waits for frame requests in progress.
+    ///          Pointers returned earlier by the gb_decoder_get_frame_pixels_* functions (the
+    ///          converted, scaled and mip caches) become invalid at every level, so do not use
+    ///          them while a trim may run; the copy functions write into caller memory instead.
+    GB_API int64_t gb_decoder_trim_memory(gb_decoder_t decoder, int level);
+
+    /// \brief Releases rebuildable memory from every live decoder in the process.
+    /// \param level Trim level, as for gb_decoder_trim_memory.
+    /// \return The total number of bytes freed.
+    /// \remarks Intended for OS memory-pressure notifications, from any thread. Invalidates
+    ///          the pixel pointers of every decoder, as gb_decoder_trim_memory does.
+    GB_API int64_t gb_trim_memory(int level);
+
+    /// \struct gb_decoder_stats_t
+    /// \brief Work counters and memory footprint of a decoder (see GifBolt::DecoderStats).
+    /// Counters accumulate from the decoder's creation; byte counts describe what is held now.
+    typedef struct gb_decoder_stats_t
+    {
+        uint64_t frame_cache_hits;       ///< Composed frames served from the frame cache
+        uint64_t frame_cache_misses;     ///< Composed frames copied into the frame cache
+        uint64_t frame_cache_evictions;  ///< Frames dropped from the frame cache
+        uint64_t mip_cache_hits;         ///< Scaled requests served from a cached mip chain
+        uint64_t mip_cache_misses;       ///< Scaled requests that had to build a mip chain
+        uint64_t mip_cache_evictions;    ///< Mip chains dropped from the mip cache
+        uint64_t frames_decoded;         ///< Frame rasters LZW-decoded while reading the GIF
+        uint64_t frames_composed;        ///< Frames color-mapped and composed onto the canvas
+        uint64_t frames_converted;       ///< Frames converted to BGRA premultiplied
+        uint64_t frames_scaled;          ///< Scaled frames returned
+        uint64_t lzw_time_ns;            ///< Wall time reading rasters
+        uint64_t compose_time_ns;        ///< Wall time color mapping and composing
+        uint64_t convert_time_ns;        ///< Wall time converting to BGRA premultiplied
+        uint64_t scale_time_ns;          ///< Wall time building mip chains and resampling
+        uint64_t thread_cpu_time_ns;     ///< CPU time of every thread working for the decoder
+        uint64_t raster_bytes;           ///< Color-indexed rasters and color maps
+        uint64_t canvas_bytes;           ///< Composition canvases and frames composed ahead
+        uint64_t cache_bytes;            ///< Frame, converted, scaled and mip caches
+        uint64_t pool_bytes;             ///< Idle pooled buffers, arenas and spare mip chains
+    } gb_decoder_stats_t;
+
+    /// \brief Gets the work counters and memory footprint of a decoder.
+    /// \param decoder The decoder handle.
+    /// \param[out] stats Receives the statistics.
+    /// \return 1 on success; 0 if an argument is NULL.
+    /// \remarks Counters are always on. Call from the thread that drives the decoder.
+    GB_API int gb_decoder_get_stats(gb_decoder_t decoder, gb_decoder_stats_t* stats);
+
+    /// \brief Gets the statistics summed over every decoder in the process.
+    /// \param[out] stats Receives live decoders' counters and bytes plus the counters of
+    ///                   destroyed decoders.
+    /// \return 1 on success; 0 if stats is NULL.
+    /// \remarks Call from the thread that drives the decoders.
+    GB_API int gb_get_process_stats(gb_decoder_stats_t* stats);
+
+    /// \def GB_LATENESS_BUCKET_COUNT
+    /// \brief Buckets of gb_playback_stats_t::lateness_histogram.
+#define GB_LATENESS_BUCKET_COUNT 12
+
+    /// \struct gb_playback_stats_t
+    /// \brief Presentation quality of a decoder's playback (see GifBolt::PlaybackStats), as
+    /// reported with gb_decoder_record_frame_presented.
+    typedef struct gb_playback_stats_t
+    {
+        uint64_t frames_presented;       ///< Frames shown
+        uint64_t frames_late;            ///< Frames shown more than 17 ms past due
+        uint64_t frames_dropped;         ///< Frames skipped without being shown
+        uint64_t late_schedule;          ///< Late frames whose tick itself ran late
+        uint64_t late_decode_not_ready;  ///< Late frames not yet read or composed when due
+        uint64_t late_conversion;        ///< Late frames held up by conversion or scaling
+        uint64_t late_lock_wait;         ///< Late frames held up by a background decode's lock
+        uint64_t total_lateness_ns;      ///< Lateness summed over the frames shown
+        uint64_t max_lateness_ns;        ///< Largest lateness of a frame shown
+        /// Frames shown by lateness: [0] under 1 ms, [i] [2^(i-1), 2^i) ms, [11] 1024 ms and up
+        uint64_t lateness_histogram[GB_LATENESS_BUCKET_COUNT];
+    } gb_playback_stats_t;
+
+    /// \brief Records that a frame was shown, for playback quality statistics.
+    /// \param decoder The decoder handle.
+    /// \param index The frame shown; lateness is attributed using the decoder's most recent
+    ///              request for it.
+    /// \param latenessNs Time from the frame's due time until it was shown; 0 or negative if on
+    ///                   time.
+    /// \param droppedFrames Frames skipped without being shown, to catch up, before this one.
+    /// \remarks Call right after presenting, from any thread. Late frames also produce a trace
+    ///          span named after their cause.
+    GB_API void gb_decoder_record_frame_presented(gb_decoder_t decoder, int index,
+                                                  int64_t latenessNs, int droppedFrames);
+
+    /// \struct gb_frame_status_t
+    /// \brief State of a decoder after a frame was shown, returned by gb_decoder_present_frame.
+    typedef struct gb_frame_status_t
+    {
+        int32_t frame_delay_ms;         ///< Display duration of the frame shown
+        int32_t available_frame_count;  ///< Frames read so far
+        int32_t load_complete;          ///< 1 once every frame has been read
+    } gb_frame_status_t;
+
+    /// \brief Reports a frame as shown and returns what the next tick needs, in one call.
+    /// \param decoder The decoder handle.
+    /// \param index The frame shown.
+    /// \param latenessNs As for gb_decoder_record_frame_presented.
+    /// \param droppedFrames As for gb_decoder_record_frame_presented.
+    /// \param[out] status Receives the frame's delay and the loading progress; may be NULL.
+    /// \return 1 on success; 0 if decoder is NULL or index is negative.
+    /// \remarks Does the work of gb_decoder_set_current_frame and
+    ///          gb_decoder_record_frame_presented, so that a tick crosses into native code once.
+    ///          Call from the thread that drives the decoder.
+    GB_API int gb_decoder_present_frame(gb_decoder_t decoder, int index, int64_t latenessNs,
+                                        int droppedFrames, gb_frame_status_t* status);
+
+    /// \brief Gets the playback quality recorded for a decoder.
+    /// \param decoder The decoder handle.
+    /// \param[out] stats Receives the statistics.
+    /// \return 1 on success; 0 if an argument is NULL.
+    GB_API int gb_decoder_get_playback_stats(gb_decoder_t decoder, gb_playback_stats_t* stats);
+
+    /// \brief Gets the playback quality summed over every decoder in the process.
+    /// \param[out] stats Receives live and destroyed decoders' statistics.
+    /// \return 1 on success; 0 if stats is NULL.
+    /// \remarks May be called from any thread, while frames are being recorded.
+    GB_API int gb_get_process_playback_stats(gb_playback_stats_t* stats);
+
+    /// \brief Starts recording trace spans (decode, compose, convert, scale, pool tasks and
+    /// prefetch) into per-thread ring buffers, discarding any previous recording.
+    /// \return 1 if tracing started; 0 if the library was built without tracing.
+    GB_API int gb_trace_start(void);
+
+    /// \brief Stops recording trace spans; the recording is kept for gb_trace_dump.
+    GB_API void gb_trace_stop(void);
+
+    /// \brief Writes the recorded spans as Chrome trace-event JSON, viewable in Perfetto or
+    /// chrome://tracing.
+    /// \param path Output file path.
+    /// \return 1 if the file was written; 0 on error.
+    /// \remarks Each thread keeps its most recent 8192 events.
+    GB_API int gb_trace_dump(const char* path);
+
+    /// \def GB_RECORD_EMBED_BUFFERS
+    /// \brief gb_record_start flag: store each distinct buffer passed to a load in the
+    /// recording, so that it replays without the original files.
+#define GB_RECORD_EMBED_BUFFERS 1
+
+    /// \brief Starts recording every decoder and renderer call (arguments, result, thread and
+    /// timing) to a compact binary file, for replay with GifBolt.Replay.
+    /// \param path Output file; overwritten. Any recording in progress is stopped first.
+    /// \param flags 0, or GB_RECORD_EMBED_BUFFERS. Without it, buffers loaded from memory are
+    ///              identified by a content hash only.
+    /// \return 1 if recording started; 0 if the file cannot be created.
+    /// \remarks Setting the GIFBOLT_RECORD_CALLS environment variable to a path records from
+    ///          library load until unload (GIFBOLT_RECORD_BUFFERS=1 embeds buffers). Statistics,
+    ///          trace, recording and shared cache functions are not recorded; of the preview
+    ///          functions, only gb_preview_create is, as a call on its decoder.
+    GB_API int gb_record_start(const char* path, int flags);
+
+    /// \brief Stops recording calls, and flushes and closes the recording file.
+    GB_API void gb_record_stop(void);
+
+    /// \struct gb_tuning_profile_t
+    /// \brief Threading and GPU offload thresholds shared by every decoder (see
+    /// GifBolt::TuningProfile).
+    typedef struct gb_tuning_profile_t
+    {
+        uint64_t convert_parallel_min_pixels;  ///< Smallest frame converted on several threads
+        uint32_t convert_threads;   ///< Threads a parallel conversion uses, the caller included
+        uint32_t worker_threads;    ///< Worker threads in each decoder's pool
+        uint64_t gpu_scale_min_pixels;  ///< Smallest source scaled on the GPU; UINT64_MAX never
+        uint32_t hardware_threads;  ///< Hardware threads of the host the profile was measured on
+        /// 0 built-in defaults, 1 calibrated, 2 loaded from a profile file, 3 set by the host
+        uint32_t source;
+    } gb_tuning_profile_t;
+
+    /// \brief Puts a calibrated tuning profile into effect: loads it from a profile file, or
+    /// times the conversion and scaling kernels on this host and saves the result there.
+    /// \param profilePath Profile file, or NULL to calibrate without saving. A file measured on
+    ///                    a host with a different number of hardware threads is recalibrated.
+    /// \param[out] profile Receives the profile put into effect; may be NULL.
+    /// \return 1 on success; 0 on error.
+    /// \remarks Calibrating takes a few hundred milliseconds. Decoders load files with the
+    ///          profile in effect at that time. Setting the GIFBOLT_CALIBRATE environment
+    ///          variable to a profile path does the same on first use ("1" skips saving).
+    GB_API int gb_calibrate(const char* profilePath, gb_tuning_profile_t* profile);
+
+    /// \brief Gets the tuning profile in effect, with defaults resolved for this host.
+    /// \param[out] profile Receives the profile.
+    /// \return 1 on success; 0 if profile is NULL.
+    GB_API int gb_get_tuning_profile(gb_tuning_profile_t* profile);
+
+    /// \brief Replaces the tuning profile in effect, for decoders loaded afterwards.
+    /// \param profile The thresholds to use; 0 thread counts take the host defaults. NULL
+    ///                restores the built-in defaults.
+    /// \return 1 on success; 0 on error.
+    GB_API int gb_set_tuning_profile(const gb_tuning_profile_t* profile);
+
     /// \brief Gets BGRA32 pixel data with premultiplied alpha for the specified frame, scaled to
     /// target dimensions.
     /// \param decoder The decoder handle.
@@ -194,6 +475,38 @@ extern "C"
         gb_decoder_t decoder, int index, int targetWidth, int targetHeight, int* outWidth,
         int* outHeight, int* byteCount, int filterType);
 
+    /// \brief Writes BGRA32 premultiplied pixels of a frame into caller memory, such as a
+    /// locked bitmap, instead of returning a pointer to copy from.
+    /// \param decoder The decoder handle.
+    /// \param index The zero-based frame index.
+    /// \param dest Destination of gb_decoder_get_height rows of gb_decoder_get_width pixels.
+    /// \param destStride Bytes from the start of one destination row to the next.
+    /// \param destByteCount Size of the destination in bytes.
+    /// \return 1 if the frame was written; 0 on error or if the destination is too small.
+    /// \remarks When destStride is width * 4 the frame is converted straight into dest.
+    ///          Both copy functions may be called from a background thread, to prepare the
+    ///          next frame while the UI thread keeps driving the decoder; frame requests on one
+    ///          decoder are serialized.
+    GB_API int gb_decoder_copy_frame_pixels_bgra32_premultiplied(gb_decoder_t decoder, int index,
+                                                                 void* dest, int destStride,
+                                                                 int destByteCount);
+
+    /// \brief Writes BGRA32 premultiplied pixels of a frame, scaled to target dimensions, into
+    /// caller memory.
+    /// \param decoder The decoder handle.
+    /// \param index The zero-based frame index.
+    /// \param targetWidth The output width in pixels.
+    /// \param targetHeight The output height in pixels.
+    /// \param filterType The scaling filter to use (0=Nearest, 1=Bilinear, 2=Bicubic, 3=Lanczos).
+    /// \param dest Destination of targetHeight rows of targetWidth pixels.
+    /// \param destStride Bytes from the start of one destination row to the next.
+    /// \param destByteCount Size of the destination in bytes.
+    /// \return 1 if the frame was written; 0 on error or if the destination is too small.
+    /// \remarks When destStride is targetWidth * 4 the frame is scaled straight into dest.
+    GB_API int gb_decoder_copy_frame_pixels_bgra32_premultiplied_scaled(
+        gb_decoder_t decoder, int index, int targetWidth, int targetHeight, int filterType,
+        void* dest, int destStride, int destByteCount);
+
     /// \brief Starts background prefetching of frames ahead of the current playback position.
     /// \param decoder The decoder handle.
     /// \param startFrame The frame to start prefetching from.
@@ -217,6 +530,130 @@ extern "C"
     GB_API void gb_decoder_reset_canvas(gb_decoder_t decoder);
     /// @}
 
+    /// \typedef gb_preview_t
+    /// \brief Opaque handle to a preview proxy (see GifBolt::PreviewProxy).
+    typedef void* gb_preview_t;
+
+    /// \defgroup Preview Preview Proxy Functions
+    /// Small, low frame rate copies of an animation for hover previews and list tiles, which
+    /// play without a decoder.
+    /// @{
+
+    /// \struct gb_preview_info_t
+    /// \brief Description of a preview proxy, read with gb_preview_get_info.
+    typedef struct gb_preview_info_t
+    {
+        int32_t width;                    ///< Width in pixels
+        int32_t height;                   ///< Height in pixels
+        int32_t frame_count;              ///< Frames kept
+        int32_t loop_count;               ///< -1 if the source loops indefinitely; 0 otherwise
+        int32_t indexed;                  ///< 1 if pixels are stored palette-indexed
+        int32_t memory_bytes;             ///< Memory the proxy holds
+        const uint32_t* frame_delays_ms;  ///< frame_count delays in milliseconds
+        const uint32_t* source_frames;    ///< Source frame each proxy frame was made from
+    } gb_preview_info_t;
+
+    /// \brief Builds a preview proxy from a loaded GIF in a single pass.
+    /// \param decoder Decoder with a GIF loaded; it can be destroyed once this returns.
+    /// \param maxWidth Width of the box the proxy is fitted into, keeping the aspect ratio.
+    /// \param maxHeight Height of the box the proxy is fitted into.
+    /// \param maxFps Highest frame rate kept; 0 keeps every frame.
+    /// \return A handle to the proxy, or NULL on error. Destroy it with gb_preview_destroy.
+    /// \remarks Blocks until the whole GIF has been read. Call from the thread that drives
+    ///          the decoder.
+    GB_API gb_preview_t gb_preview_create(gb_decoder_t decoder, int maxWidth, int maxHeight,
+                                          int maxFps);
+
+    /// \brief Reads a preview proxy written by gb_preview_save.
+    /// \param path Path of the proxy file.
+    /// \return A handle to the proxy, or NULL if the file cannot be read or is not a proxy.
+    GB_API gb_preview_t gb_preview_load(const char* path);
+
+    /// \brief Writes a preview proxy to a file, for example next to an HTTP cache.
+    /// \param preview The proxy handle.
+    /// \param path Path of the proxy file; replaced if it exists.
+    /// \return 1 if the file was written; 0 on error.
+    GB_API int gb_preview_save(gb_preview_t preview, const char* path);
+
+    /// \brief Destroys a preview proxy.
+    /// \param preview The proxy handle (can be NULL).
+    GB_API void gb_preview_destroy(gb_preview_t preview);
+
+    /// \brief Gets the size, frame delays and storage of a preview proxy in one call.
+    /// \param preview The proxy handle.
+    /// \param[out] info Receives the description; its arrays live as long as the proxy.
+    /// \return 1 on success; 0 if an argument is NULL.
+    GB_API int gb_preview_get_info(gb_preview_t preview, gb_preview_info_t* info);
+
+    /// \brief Writes the BGRA32 premultiplied pixels of a proxy frame into caller memory.
+    /// \param preview The proxy handle.
+    /// \param index The zero-based frame index.
+    /// \param dest Destination of height rows of width pixels.
+    /// \param destStride Bytes from the start of one destination row to the next.
+    /// \param destByteCount Size of the destination in bytes.
+    /// \return 1 if the frame was written; 0 on error or if the destination is too small.
+    /// \remarks May be called from any thread; the proxy is not modified.
+    GB_API int gb_preview_copy_frame_pixels_bgra32_premultiplied(gb_preview_t preview, int index,
+                                                                 void* dest, int destStride,
+                                                                 int destByteCount);
+    /// @}
+
+    /// \typedef gb_shared_cache_t
+    /// \brief Opaque handle to a frame cache shared between processes (see
+    /// GifBolt::SharedFrameCache).
+    typedef void* gb_shared_cache_t;
+
+    /// \defgroup SharedCache Shared Frame Cache Functions
+    /// Frames converted by one process and mapped read-only by every other process that shows
+    /// the same GIF. Available where POSIX shared memory is (Linux, macOS).
+    /// @{
+
+    /// \struct gb_shared_cache_stats_t
+    /// \brief Occupancy of a shared cache and this process's use of it.
+    typedef struct gb_shared_cache_stats_t
+    {
+        uint64_t hits;          ///< Lookups by this process that mapped a frame
+        uint64_t misses;        ///< Lookups by this process that found nothing
+        uint64_t inserts;       ///< Frames this process published
+        uint64_t evictions;     ///< Frames this process evicted to stay within the budget
+        uint64_t entries;       ///< Frames in the cache, over all processes
+        uint64_t used_bytes;    ///< Bytes of those frames
+        uint64_t budget_bytes;  ///< Byte budget, set by the process that created the cache
+    } gb_shared_cache_stats_t;
+
+    /// \brief Opens a shared frame cache, creating it if no process has.
+    /// \param name 1 to 16 characters from [A-Za-z0-9_-], the same in every process.
+    /// \param budgetBytes Largest total size of the cached frames; only used on creation.
+    /// \return A handle, or NULL if the name is invalid or shared memory is unavailable.
+    ///         Close it with gb_shared_cache_close.
+    GB_API gb_shared_cache_t gb_shared_cache_open(const char* name, int64_t budgetBytes);
+
+    /// \brief Closes this process's handle to a shared cache.
+    /// \param cache The cache handle (can be NULL).
+    /// \remarks Decoders the cache was set on keep using it until they are destroyed or given
+    ///          another cache.
+    GB_API void gb_shared_cache_close(gb_shared_cache_t cache);
+
+    /// \brief Gets the occupancy of a shared cache and this process's hit counts.
+    /// \param cache The cache handle.
+    /// \param[out] stats Receives the statistics.
+    /// \return 1 on success; 0 if an argument is NULL.
+    GB_API int gb_shared_cache_get_stats(gb_shared_cache_t cache, gb_shared_cache_stats_t* stats);
+
+    /// \brief Removes a shared cache's objects from the system, for example at fleet shutdown.
+    /// \param name The name passed to gb_shared_cache_open.
+    /// \remarks Processes that have the cache open keep using it.
+    GB_API void gb_shared_cache_remove(const char* name);
+
+    /// \brief Looks frames of a decoder up in a shared cache and publishes the ones it converts.
+    /// \param decoder The decoder handle.
+    /// \param cache The cache handle, or NULL to stop sharing.
+    /// \return 1 on success; 0 if decoder is NULL.
+    /// \remarks Only GIFs that have been read completely are shared; call from the thread
+    ///          that drives the decoder.
+    GB_API int gb_decoder_set_shared_cache(gb_decoder_t decoder, gb_shared_cache_t cache);
+    /// @}
+
 #ifdef __cplusplus
 }
 #endif
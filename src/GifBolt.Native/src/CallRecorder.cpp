@@ -0,0 +1,596 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#include "CallRecorder.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <unordered_set>
+
+#include "Trace.h"
+
+namespace GifBolt
+{
+namespace CallRecorder
+{
+
+namespace Detail
+{
+std::atomic<bool> g_enabled{false};
+}  // namespace Detail
+
+namespace
+{
+// File layout: MAGIC, a varint FORMAT_VERSION, then records. Each record starts with a varint
+// tag. Integers are LEB128 varints, signed ones zigzag-encoded, hashes 8 little-endian bytes.
+//   TAG_CALL:   id, flags, thread, handle, start delta from the previous call, duration,
+//               result, arg count, args, [text length, text] if FLAG_TEXT, [hash] if FLAG_HASH
+//   TAG_BUFFER: hash, length, bytes; written once per distinct buffer, before its first call
+const char MAGIC[4] = {'G', 'B', 'R', 'C'};
+constexpr uint64_t FORMAT_VERSION = 1;
+constexpr uint64_t TAG_CALL = 1;
+constexpr uint64_t TAG_BUFFER = 2;
+constexpr uint64_t FLAG_TEXT = 1;
+constexpr uint64_t FLAG_HASH = 2;
+constexpr size_t FLUSH_BYTES = 64 * 1024;  ///< Encoded records buffered before a write
+
+struct RecorderState
+{
+    std::mutex mutex;
+    std::FILE* file = nullptr;
+    bool embedBuffers = false;
+    uint64_t startNs = 0;     ///< Trace clock at Start
+    uint64_t lastCallNs = 0;  ///< Start of the previous call record, for delta encoding
+    std::vector<uint8_t> pending;
+    std::unordered_map<const void*, uint32_t> handles;  ///< Live handle -> recording id
+    uint32_t nextHandle = 1;
+    std::unordered_set<uint64_t> writtenBuffers;
+};
+
+RecorderState& GetState()
+{
+    static RecorderState state;
+    return state;
+}
+
+std::atomic<uint32_t> g_nextThreadId{1};
+thread_local uint32_t t_threadId = 0;  ///< Assigned on the thread's first recorded call
+
+uint32_t GetThreadId()
+{
+    if (t_threadId == 0)
+    {
+        t_threadId = g_nextThreadId.fetch_add(1, std::memory_order_relaxed);
+    }
+    return t_threadId;
+}
+
+void PutVarint(std::vector<uint8_t>& out, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        out.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+void PutSigned(std::vector<uint8_t>& out, int64_t value)
+{
+    PutVarint(out, (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+}
+
+void PutFixed64(std::vector<uint8_t>& out, uint64_t value)
+{
+    for (int byte = 0; byte < 8; ++byte)
+    {
+        out.push_back(static_cast<uint8_t>(value >> (byte * 8)));
+    }
+}
+
+/// \brief Writes the buffered records; the state mutex must be held.
+void Flush(RecorderState& state)
+{
+    if (state.file != nullptr && !state.pending.empty())
+    {
+        std::fwrite(state.pending.data(), 1, state.pending.size(), state.file);
+        std::fflush(state.file);
+    }
+    state.pending.clear();
+}
+
+/// \brief Gets the recording id of a handle; the state mutex must be held.
+/// \details Handles created before the recording started get an id on first use.
+uint32_t GetHandleId(RecorderState& state, const void* handle)
+{
+    if (handle == nullptr)
+    {
+        return NO_HANDLE;
+    }
+    auto it = state.handles.find(handle);
+    if (it == state.handles.end())
+    {
+        it = state.handles.emplace(handle, state.nextHandle++).first;
+    }
+    return it->second;
+}
+
+bool IsCreate(CallId id)
+{
+    return id == CallId::DecoderCreate || id == CallId::RendererCreate;
+}
+
+bool IsDestroy(CallId id)
+{
+    return id == CallId::DecoderDestroy || id == CallId::RendererDestroy;
+}
+
+/// \brief Reads a recording's bytes, stopping at the end of the data.
+class Reader
+{
+   public:
+    Reader(const uint8_t* data, size_t size) : _data(data), _size(size)
+    {
+    }
+
+    bool AtEnd() const
+    {
+        return this->_position >= this->_size;
+    }
+
+    bool Varint(uint64_t& value)
+    {
+        value = 0;
+        for (int shift = 0; shift < 64; shift += 7)
+        {
+            if (this->AtEnd())
+            {
+                return false;
+            }
+            const uint8_t byte = this->_data[this->_position++];
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool Signed(int64_t& value)
+    {
+        uint64_t encoded = 0;
+        if (!this->Varint(encoded))
+        {
+            return false;
+        }
+        value = static_cast<int64_t>(encoded >> 1) ^ -static_cast<int64_t>(encoded & 1);
+        return true;
+    }
+
+    bool Fixed64(uint64_t& value)
+    {
+        if (this->_size - this->_position < 8)
+        {
+            return false;
+        }
+        value = 0;
+        for (int byte = 0; byte < 8; ++byte)
+        {
+            value |= static_cast<uint64_t>(this->_data[this->_position++]) << (byte * 8);
+        }
+        return true;
+    }
+
+    bool Bytes(uint64_t length, const uint8_t*& bytes)
+    {
+        if (length > this->_size - this->_position)
+        {
+            return false;
+        }
+        bytes = this->_data + this->_position;
+        this->_position += static_cast<size_t>(length);
+        return true;
+    }
+
+   private:
+    const uint8_t* _data;
+    size_t _size;
+    size_t _position = 0;
+};
+
+bool ReadCall(Reader& reader, uint64_t& previousStartNs, RecordedCall& call)
+{
+    uint64_t id = 0;
+    uint64_t flags = 0;
+    uint64_t threadId = 0;
+    uint64_t handle = 0;
+    int64_t startDelta = 0;
+    uint64_t argCount = 0;
+    if (!reader.Varint(id) || !reader.Varint(flags) || !reader.Varint(threadId) ||
+        !reader.Varint(handle) || !reader.Signed(startDelta) ||
+        !reader.Varint(call.durationNs) || !reader.Signed(call.result) ||
+        !reader.Varint(argCount) || argCount > MAX_CALL_ARGS)
+    {
+        return false;
+    }
+    call.id = static_cast<CallId>(id);
+    call.threadId = static_cast<uint32_t>(threadId);
+    call.handle = static_cast<uint32_t>(handle);
+    call.startNs = previousStartNs + static_cast<uint64_t>(startDelta);
+    previousStartNs = call.startNs;
+    call.argCount = static_cast<uint32_t>(argCount);
+    for (uint32_t arg = 0; arg < call.argCount; ++arg)
+    {
+        if (!reader.Signed(call.args[arg]))
+        {
+            return false;
+        }
+    }
+    if ((flags & FLAG_TEXT) != 0)
+    {
+        uint64_t length = 0;
+        const uint8_t* text = nullptr;
+        if (!reader.Varint(length) || !reader.Bytes(length, text))
+        {
+            return false;
+        }
+        call.text.assign(reinterpret_cast<const char*>(text), static_cast<size_t>(length));
+    }
+    return (flags & FLAG_HASH) == 0 || reader.Fixed64(call.contentHash);
+}
+
+/// \brief Starts a recording named by GIFBOLT_RECORD_CALLS when the library loads, and
+/// flushes it when the library unloads.
+struct EnvironmentRecording
+{
+    bool started = false;
+
+    EnvironmentRecording()
+    {
+        const char* path = std::getenv("GIFBOLT_RECORD_CALLS");
+        if (path != nullptr && path[0] != '\0')
+        {
+            const char* embed = std::getenv("GIFBOLT_RECORD_BUFFERS");
+            this->started = Start(path, embed != nullptr && std::strcmp(embed, "1") == 0);
+        }
+    }
+
+    ~EnvironmentRecording()
+    {
+        if (this->started)
+        {
+            Stop();
+        }
+    }
+};
+
+const EnvironmentRecording g_environmentRecording;
+}  // namespace
+
+bool Start(const std::string& path, bool embedBuffers)
+{
+    Stop();
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (file == nullptr)
+    {
+        return false;
+    }
+
+    RecorderState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.file = file;
+    state.embedBuffers = embedBuffers;
+    state.startNs = Trace::NowNs();
+    state.lastCallNs = 0;
+    state.handles.clear();
+    state.nextHandle = 1;
+    state.writtenBuffers.clear();
+    state.pending.assign(MAGIC, MAGIC + sizeof(MAGIC));
+    PutVarint(state.pending, FORMAT_VERSION);
+    Detail::g_enabled.store(true, std::memory_order_relaxed);
+    return true;
+}
+
+void Stop()
+{
+    RecorderState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    Detail::g_enabled.store(false, std::memory_order_relaxed);
+    if (state.file == nullptr)
+    {
+        return;
+    }
+    Flush(state);
+    std::fclose(state.file);
+    state.file = nullptr;
+    state.handles.clear();
+}
+
+bool Read(const std::string& path, Recording& recording)
+{
+    recording = Recording();
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr)
+    {
+        return false;
+    }
+    std::vector<uint8_t> bytes;
+    uint8_t chunk[64 * 1024];
+    size_t read = 0;
+    while ((read = std::fread(chunk, 1, sizeof(chunk), file)) > 0)
+    {
+        bytes.insert(bytes.end(), chunk, chunk + read);
+    }
+    std::fclose(file);
+
+    uint64_t version = 0;
+    Reader reader(bytes.data(), bytes.size());
+    const uint8_t* magic = nullptr;
+    if (!reader.Bytes(sizeof(MAGIC), magic) || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0 ||
+        !reader.Varint(version) || version != FORMAT_VERSION)
+    {
+        return false;
+    }
+
+    uint64_t previousStartNs = 0;
+    uint64_t tag = 0;
+    while (!reader.AtEnd() && reader.Varint(tag))
+    {
+        if (tag == TAG_CALL)
+        {
+            RecordedCall call;
+            if (!ReadCall(reader, previousStartNs, call))
+            {
+                break;
+            }
+            recording.calls.push_back(std::move(call));
+        }
+        else if (tag == TAG_BUFFER)
+        {
+            uint64_t hash = 0;
+            uint64_t length = 0;
+            const uint8_t* data = nullptr;
+            if (!reader.Fixed64(hash) || !reader.Varint(length) || !reader.Bytes(length, data))
+            {
+                break;
+            }
+            recording.buffers[hash].assign(data, data + length);
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    // Calls are written as they return; replay wants them as they were made
+    std::stable_sort(recording.calls.begin(), recording.calls.end(),
+                     [](const RecordedCall& a, const RecordedCall& b)
+                     { return a.startNs < b.startNs; });
+    return true;
+}
+
+uint64_t HashContent(const void* data, size_t length)
+{
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < length; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+const char* GetCallName(CallId id)
+{
+    switch (id)
+    {
+        case CallId::DecoderCreate:
+            return "gb_decoder_create";
+        case CallId::DecoderDestroy:
+            return "gb_decoder_destroy";
+        case CallId::LoadFromPath:
+            return "gb_decoder_load_from_path";
+        case CallId::LoadFromMemory:
+            return "gb_decoder_load_from_memory";
+        case CallId::LoadFromUrl:
+            return "gb_decoder_load_from_url";
+        case CallId::SetMinFrameDelayMs:
+            return "gb_decoder_set_min_frame_delay_ms";
+        case CallId::SetMaxCachedFrames:
+            return "gb_decoder_set_max_cached_frames";
+        case CallId::SetMipmapsEnabled:
+            return "gb_decoder_set_mipmaps_enabled";
+        case CallId::TrimMemory:
+            return "gb_decoder_trim_memory";
+        case CallId::TrimAllMemory:
+            return "gb_trim_memory";
+        case CallId::SetHttpCacheDirectory:
+            return "gb_set_http_cache_directory";
+        case CallId::GetAvailableFrameCount:
+            return "gb_decoder_get_available_frame_count";
+        case CallId::IsLoadComplete:
+            return "gb_decoder_is_load_complete";
+        case CallId::GetFrameCount:
+            return "gb_decoder_get_frame_count";
+        case CallId::GetWidth:
+            return "gb_decoder_get_width";
+        case CallId::GetHeight:
+            return "gb_decoder_get_height";
+        case CallId::GetLoopCount:
+            return "gb_decoder_get_loop_count";
+        case CallId::GetFrameDelayMs:
+            return "gb_decoder_get_frame_delay_ms";
+        case CallId::GetFramePixelsRGBA32:
+            return "gb_decoder_get_frame_pixels_rgba32";
+        case CallId::GetFramePixelsBGRA32:
+            return "gb_decoder_get_frame_pixels_bgra32_premultiplied";
+        case CallId::GetFramePixelsBGRA32Scaled:
+            return "gb_decoder_get_frame_pixels_bgra32_premultiplied_scaled";
+        case CallId::CopyFramePixelsBGRA32:
+            return "gb_decoder_copy_frame_pixels_bgra32_premultiplied";
+        case CallId::CopyFramePixelsBGRA32Scaled:
+            return "gb_decoder_copy_frame_pixels_bgra32_premultiplied_scaled";
+        case CallId::GetBackgroundColor:
+            return "gb_decoder_get_background_color";
+        case CallId::StartPrefetching:
+            return "gb_decoder_start_prefetching";
+        case CallId::StopPrefetching:
+            return "gb_decoder_stop_prefetching";
+        case CallId::SetCurrentFrame:
+            return "gb_decoder_set_current_frame";
+        case CallId::ResetCanvas:
+            return "gb_decoder_reset_canvas";
+        case CallId::RecordFramePresented:
+            return "gb_decoder_record_frame_presented";
+        case CallId::GetInfo:
+            return "gb_decoder_get_info";
+        case CallId::PresentFrame:
+            return "gb_decoder_present_frame";
+        case CallId::GetFrameAlpha:
+            return "gb_decoder_get_frame_alpha";
+        case CallId::CreatePreview:
+            return "gb_preview_create";
+        case CallId::RendererCreate:
+            return "GifBolt_Create";
+        case CallId::RendererDestroy:
+            return "GifBolt_Destroy";
+        case CallId::RendererInitialize:
+            return "GifBolt_Initialize";
+        case CallId::RendererLoadGif:
+            return "GifBolt_LoadGif";
+        case CallId::RendererLoadGifFromMemory:
+            return "GifBolt_LoadGifFromMemory";
+        case CallId::RendererPlay:
+            return "GifBolt_Play";
+        case CallId::RendererPause:
+            return "GifBolt_Pause";
+        case CallId::RendererStop:
+            return "GifBolt_Stop";
+        case CallId::RendererSetLooping:
+            return "GifBolt_SetLooping";
+        case CallId::RendererRender:
+            return "GifBolt_Render";
+    }
+    return "unknown";
+}
+
+ScopedCall::ScopedCall(CallId id, const void* handle, std::initializer_list<int64_t> args)
+{
+    if (!IsEnabled())
+    {
+        return;
+    }
+    this->_active = true;
+    this->_handle = handle;
+    this->_call.id = id;
+    for (const int64_t arg : args)
+    {
+        if (this->_call.argCount < MAX_CALL_ARGS)
+        {
+            this->_call.args[this->_call.argCount++] = arg;
+        }
+    }
+    this->_call.startNs = Trace::NowNs();
+}
+
+ScopedCall::~ScopedCall()
+{
+    if (!this->_active)
+    {
+        return;
+    }
+    const uint64_t endNs = Trace::NowNs();
+    RecordedCall& call = this->_call;
+    const uint32_t threadId = GetThreadId();
+    // Hashed after the call so that its duration is not inflated
+    if (this->_content != nullptr)
+    {
+        call.contentHash = HashContent(this->_content, this->_contentLength);
+    }
+
+    RecorderState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (state.file == nullptr || call.startNs < state.startNs)
+    {
+        return;  // Stopped, or restarted, while the call ran
+    }
+    if (IsCreate(call.id))
+    {
+        state.handles.erase(this->_handle);  // A new object, even at a freed object's address
+    }
+    const uint32_t handle = GetHandleId(state, this->_handle);
+    if (IsDestroy(call.id))
+    {
+        state.handles.erase(this->_handle);
+    }
+    if (this->_content != nullptr && state.embedBuffers &&
+        state.writtenBuffers.insert(call.contentHash).second)
+    {
+        // Large buffers go straight to the file rather than through the pending records
+        PutVarint(state.pending, TAG_BUFFER);
+        PutFixed64(state.pending, call.contentHash);
+        PutVarint(state.pending, this->_contentLength);
+        Flush(state);
+        std::fwrite(this->_content, 1, this->_contentLength, state.file);
+    }
+
+    uint64_t flags = 0;
+    flags |= call.text.empty() ? 0 : FLAG_TEXT;
+    flags |= this->_content != nullptr ? FLAG_HASH : 0;
+    const uint64_t startNs = call.startNs - state.startNs;
+    std::vector<uint8_t>& out = state.pending;
+    PutVarint(out, TAG_CALL);
+    PutVarint(out, static_cast<uint64_t>(call.id));
+    PutVarint(out, flags);
+    PutVarint(out, threadId);
+    PutVarint(out, handle);
+    PutSigned(out, static_cast<int64_t>(startNs - state.lastCallNs));
+    PutVarint(out, endNs - call.startNs);
+    PutSigned(out, call.result);
+    PutVarint(out, call.argCount);
+    for (uint32_t arg = 0; arg < call.argCount; ++arg)
+    {
+        PutSigned(out, call.args[arg]);
+    }
+    if ((flags & FLAG_TEXT) != 0)
+    {
+        PutVarint(out, call.text.size());
+        out.insert(out.end(), call.text.begin(), call.text.end());
+    }
+    if ((flags & FLAG_HASH) != 0)
+    {
+        PutFixed64(out, call.contentHash);
+    }
+    state.lastCallNs = startNs;
+    if (out.size() >= FLUSH_BYTES)
+    {
+        Flush(state);
+    }
+}
+
+void ScopedCall::SetText(const char* text)
+{
+    if (this->_active && text != nullptr)
+    {
+        this->_call.text = text;
+    }
+}
+
+void ScopedCall::SetContent(const void* data, size_t length)
+{
+    this->_content = data;
+    this->_contentLength = length;
+}
+
+void ScopedCall::SetCreatedHandle(const void* handle)
+{
+    this->_handle = handle;
+}
+
+}  // namespace CallRecorder
+}  // namespace GifBolt
@@ -0,0 +1,349 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#include "FrameKernels.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace GifBolt
+{
+namespace Kernels
+{
+
+void ApplyColorMap(const uint8_t* raster, const uint8_t* paletteRGB, int colorCount,
+                   uint32_t* pixels, size_t pixelCount, int transparentIndex)
+{
+    for (size_t i = 0; i < pixelCount; ++i)
+    {
+        int colorIndex = raster[i];
+
+        // Check if this pixel is transparent
+        if (transparentIndex >= 0 && colorIndex == transparentIndex)
+        {
+            pixels[i] = 0x00000000;  // Fully transparent
+        }
+        else if (paletteRGB && colorIndex < colorCount)
+        {
+            const uint8_t* color = paletteRGB + colorIndex * 3;
+            // Convert to RGBA32 format: 0xAABBGGRR (little-endian ABGR in memory = RGBA)
+            pixels[i] = 0xFF000000 | (color[2] << 16) | (color[1] << 8) | color[0];
+        }
+        else
+        {
+            pixels[i] = 0xFF000000;  // Opaque black
+        }
+    }
+}
+
+size_t ClearRect(uint32_t* canvas, uint32_t canvasWidth, uint32_t canvasHeight, uint32_t x,
+                 uint32_t y, uint32_t width, uint32_t height)
+{
+    size_t cleared = 0;
+    for (uint32_t row = 0; row < height; ++row)
+    {
+        uint32_t canvasY = y + row;
+        if (canvasY >= canvasHeight)
+        {
+            continue;
+        }
+        for (uint32_t column = 0; column < width; ++column)
+        {
+            uint32_t canvasX = x + column;
+            if (canvasX >= canvasWidth)
+            {
+                continue;
+            }
+            uint32_t& pixel = canvas[canvasY * canvasWidth + canvasX];
+            cleared += (pixel >> 24) != 0;
+            pixel = 0x00000000;  // fully transparent
+        }
+    }
+    return cleared;
+}
+
+size_t BlitFrame(const uint32_t* framePixels, uint32_t frameWidth, uint32_t frameHeight,
+                 uint32_t offsetX, uint32_t offsetY, uint32_t* canvas, uint32_t canvasWidth,
+                 uint32_t canvasHeight)
+{
+    size_t covered = 0;
+    for (uint32_t y = 0; y < frameHeight; ++y)
+    {
+        for (uint32_t x = 0; x < frameWidth; ++x)
+        {
+            uint32_t canvasX = offsetX + x;
+            uint32_t canvasY = offsetY + y;
+
+            if (canvasX >= canvasWidth || canvasY >= canvasHeight)
+            {
+                continue;
+            }
+
+            uint32_t srcPixel = framePixels[y * frameWidth + x];
+            uint32_t alpha = (srcPixel >> 24) & 0xFF;
+
+            // Skip fully transparent pixels - don't overwrite canvas
+            if (alpha == 0)
+            {
+                continue;
+            }
+
+            uint32_t& pixel = canvas[canvasY * canvasWidth + canvasX];
+            covered += (pixel >> 24) == 0;
+            pixel = srcPixel;
+        }
+    }
+    return covered;
+}
+
+void ScaleBGRA(const uint8_t* sourceBGRA, uint32_t sourceWidth, uint32_t sourceHeight,
+               uint8_t* dest, uint32_t targetWidth, uint32_t targetHeight, ScalingFilter filter,
+               bool opaque)
+{
+    // Filtering alpha that is 255 everywhere gives 255, so opaque images skip that channel
+    const int channels = opaque ? 3 : 4;
+
+    // CPU scaling implementation based on filter type
+    const float xRatio = static_cast<float>(sourceWidth) / targetWidth;
+    const float yRatio = static_cast<float>(sourceHeight) / targetHeight;
+
+    switch (filter)
+    {
+        case ScalingFilter::Nearest:
+            // Nearest-neighbor (point sampling) - fastest
+            for (uint32_t y = 0; y < targetHeight; ++y)
+            {
+                for (uint32_t x = 0; x < targetWidth; ++x)
+                {
+                    const uint32_t srcX = static_cast<uint32_t>(x * xRatio);
+                    const uint32_t srcY = static_cast<uint32_t>(y * yRatio);
+                    const uint32_t srcIdx = (srcY * sourceWidth + srcX) * 4;
+                    const uint32_t dstIdx = (y * targetWidth + x) * 4;
+
+                    dest[dstIdx + 0] = sourceBGRA[srcIdx + 0];
+                    dest[dstIdx + 1] = sourceBGRA[srcIdx + 1];
+                    dest[dstIdx + 2] = sourceBGRA[srcIdx + 2];
+                    dest[dstIdx + 3] = sourceBGRA[srcIdx + 3];
+                }
+            }
+            break;
+
+        case ScalingFilter::Bilinear:
+        default:
+            // Bilinear interpolation - good balance
+            for (uint32_t y = 0; y < targetHeight; ++y)
+            {
+                for (uint32_t x = 0; x < targetWidth; ++x)
+                {
+                    const float srcX = x * xRatio;
+                    const float srcY = y * yRatio;
+
+                    const uint32_t x0 = static_cast<uint32_t>(srcX);
+                    const uint32_t y0 = static_cast<uint32_t>(srcY);
+                    const uint32_t x1 = (x0 + 1 < sourceWidth) ? (x0 + 1) : x0;
+                    const uint32_t y1 = (y0 + 1 < sourceHeight) ? (y0 + 1) : y0;
+
+                    const float fracX = srcX - x0;
+                    const float fracY = srcY - y0;
+
+                    const uint32_t idx00 = (y0 * sourceWidth + x0) * 4;
+                    const uint32_t idx10 = (y0 * sourceWidth + x1) * 4;
+                    const uint32_t idx01 = (y1 * sourceWidth + x0) * 4;
+                    const uint32_t idx11 = (y1 * sourceWidth + x1) * 4;
+
+                    for (int c = 0; c < channels; ++c)
+                    {
+                        const float v00 = sourceBGRA[idx00 + c];
+                        const float v10 = sourceBGRA[idx10 + c];
+                        const float v01 = sourceBGRA[idx01 + c];
+                        const float v11 = sourceBGRA[idx11 + c];
+
+                        const float vTop = v00 * (1.0f - fracX) + v10 * fracX;
+                        const float vBottom = v01 * (1.0f - fracX) + v11 * fracX;
+                        const float vFinal = vTop * (1.0f - fracY) + vBottom * fracY;
+
+                        dest[(y * targetWidth + x) * 4 + c] =
+                            static_cast<uint8_t>(vFinal + 0.5f);
+                    }
+                    if (opaque)
+                    {
+                        dest[(y * targetWidth + x) * 4 + 3] = 255;
+                    }
+                }
+            }
+            break;
+
+        case ScalingFilter::Bicubic:
+        {
+            // Bicubic (Catmull-Rom) interpolation - higher quality
+            auto cubicWeight = [](float x) -> float
+            {
+                const float a = -0.5f;  // Catmull-Rom parameter
+                const float absX = std::abs(x);
+                if (absX <= 1.0f)
+                {
+                    return ((a + 2.0f) * absX - (a + 3.0f)) * absX * absX + 1.0f;
+                }
+                else if (absX < 2.0f)
+                {
+                    return ((a * absX - 5.0f * a) * absX + 8.0f * a) * absX - 4.0f * a;
+                }
+                return 0.0f;
+            };
+
+            for (uint32_t y = 0; y < targetHeight; ++y)
+            {
+                for (uint32_t x = 0; x < targetWidth; ++x)
+                {
+                    const float srcX = x * xRatio;
+                    const float srcY = y * yRatio;
+                    const int x0 = static_cast<int>(srcX);
+                    const int y0 = static_cast<int>(srcY);
+                    const float dx = srcX - x0;
+                    const float dy = srcY - y0;
+
+                    float result[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+                    float weightSum = 0.0f;
+
+                    // Sample 4x4 neighborhood
+                    for (int j = -1; j <= 2; ++j)
+                    {
+                        for (int i = -1; i <= 2; ++i)
+                        {
+                            const int sx =
+                                std::min(std::max(x0 + i, 0), static_cast<int>(sourceWidth) - 1);
+                            const int sy =
+                                std::min(std::max(y0 + j, 0), static_cast<int>(sourceHeight) - 1);
+                            const float wx = cubicWeight(i - dx);
+                            const float wy = cubicWeight(j - dy);
+                            const float weight = wx * wy;
+
+                            const uint32_t srcIdx = (sy * sourceWidth + sx) * 4;
+                            for (int c = 0; c < channels; ++c)
+                            {
+                                result[c] += sourceBGRA[srcIdx + c] * weight;
+                            }
+                            weightSum += weight;
+                        }
+                    }
+
+                    const uint32_t dstIdx = (y * targetWidth + x) * 4;
+                    if (weightSum > 0.0f)
+                    {
+                        for (int c = 0; c < channels; ++c)
+                        {
+                            dest[dstIdx + c] = static_cast<uint8_t>(
+                                std::min(std::max(result[c] / weightSum, 0.0f), 255.0f));
+                        }
+                        if (opaque)
+                        {
+                            dest[dstIdx + 3] = 255;
+                        }
+                    }
+                }
+            }
+            break;
+        }
+
+        case ScalingFilter::Lanczos:
+        {
+            // Lanczos-3 resampling - highest quality
+            const float a = 3.0f;
+            auto lanczosWeight = [](float x, float a) -> float
+            {
+                if (std::abs(x) < 0.001f)
+                    return 1.0f;
+                if (std::abs(x) >= a)
+                    return 0.0f;
+                const float pi = 3.14159265359f;
+                const float piX = pi * x;
+                return a * std::sin(piX) * std::sin(piX / a) / (piX * piX);
+            };
+
+            for (uint32_t y = 0; y < targetHeight; ++y)
+            {
+                for (uint32_t x = 0; x < targetWidth; ++x)
+                {
+                    const float srcX = x * xRatio;
+                    const float srcY = y * yRatio;
+                    const int x0 = static_cast<int>(srcX);
+                    const int y0 = static_cast<int>(srcY);
+                    const float dx = srcX - x0;
+                    const float dy = srcY - y0;
+
+                    float result[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+                    float weightSum = 0.0f;
+
+                    const int radius = static_cast<int>(std::ceil(a));
+                    for (int j = -radius; j <= radius; ++j)
+                    {
+                        for (int i = -radius; i <= radius; ++i)
+                        {
+                            const int sx =
+                                std::min(std::max(x0 + i, 0), static_cast<int>(sourceWidth) - 1);
+                            const int sy =
+                                std::min(std::max(y0 + j, 0), static_cast<int>(sourceHeight) - 1);
+                            const float wx = lanczosWeight(i - dx, a);
+                            const float wy = lanczosWeight(j - dy, a);
+                            const float weight = wx * wy;
+
+                            const uint32_t srcIdx = (sy * sourceWidth + sx) * 4;
+                            for (int c = 0; c < channels; ++c)
+                            {
+                                result[c] += sourceBGRA[srcIdx + c] * weight;
+                            }
+                            weightSum += weight;
+                        }
+                    }
+
+                    const uint32_t dstIdx = (y * targetWidth + x) * 4;
+                    if (weightSum > 0.0f)
+                    {
+                        for (int c = 0; c < channels; ++c)
+                        {
+                            dest[dstIdx + c] = static_cast<uint8_t>(
+                                std::min(std::max(result[c] / weightSum, 0.0f), 255.0f));
+                        }
+                        if (opaque)
+                        {
+                            dest[dstIdx + 3] = 255;
+                        }
+                    }
+                }
+            }
+            break;
+        }
+    }
+}
+
+void DownsampleBox2x(const uint8_t* source, uint32_t sourceWidth, uint32_t sourceHeight,
+                     uint8_t* dest, uint32_t destWidth, uint32_t destHeight, bool opaque)
+{
+    const int channels = opaque ? 3 : 4;
+    for (uint32_t y = 0; y < destHeight; ++y)
+    {
+        const uint32_t y0 = std::min(y * 2, sourceHeight - 1);
+        const uint32_t y1 = std::min(y * 2 + 1, sourceHeight - 1);
+        const uint8_t* row0 = source + static_cast<size_t>(y0) * sourceWidth * 4;
+        const uint8_t* row1 = source + static_cast<size_t>(y1) * sourceWidth * 4;
+        uint8_t* out = dest + static_cast<size_t>(y) * destWidth * 4;
+
+        for (uint32_t x = 0; x < destWidth; ++x)
+        {
+            const uint32_t x0 = std::min(x * 2, sourceWidth - 1) * 4;
+            const uint32_t x1 = std::min(x * 2 + 1, sourceWidth - 1) * 4;
+            for (int c = 0; c < channels; ++c)
+            {
+                const uint32_t sum = row0[x0 + c] + row0[x1 + c] + row1[x0 + c] + row1[x1 + c];
+                out[x * 4 + c] = static_cast<uint8_t>((sum + 2) / 4);
+            }
+            if (opaque)
+            {
+                out[x * 4 + 3] = 255;
+            }
+        }
+    }
+}
+
+}  // namespace Kernels
+}  // namespace GifBolt
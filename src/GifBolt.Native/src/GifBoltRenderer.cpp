@@ -67,7 +67,10 @@ bool GifBoltRenderer::LoadGif(const std::string& path)
         return false;
     }
 
-    if (!pImpl->m_Decoder->LoadFromFile(path))
+    const bool isUrl = path.find("://") != std::string::npos;
+    const bool loaded =
+        isUrl ? pImpl->m_Decoder->LoadFromUrl(path) : pImpl->m_Decoder->LoadFromFile(path);
+    if (!loaded)
     {
         return false;
     }
@@ -128,7 +131,9 @@ bool GifBoltRenderer::Render()
         return false;
     }
 
-    // Update frame if playing
+    // Update frame if playing; a new frame was due at the end of the previous one's delay
+    bool advanced = false;
+    std::chrono::steady_clock::time_point due;
     if (pImpl->m_Playing)
     {
         auto now = std::chrono::steady_clock::now();
@@ -139,6 +144,8 @@ bool GifBoltRenderer::Render()
 
         if (elapsed.count() >= currentFrame.delayMs)
         {
+            advanced = true;
+            due = pImpl->m_LastFrameTime + std::chrono::milliseconds(currentFrame.delayMs);
             pImpl->m_CurrentFrame++;
             if (pImpl->m_CurrentFrame >= pImpl->m_Decoder->GetFrameCount())
             {
@@ -150,6 +157,7 @@ bool GifBoltRenderer::Render()
                 {
                     pImpl->m_CurrentFrame = pImpl->m_Decoder->GetFrameCount() - 1;
                     pImpl->m_Playing = false;
+                    advanced = false;  // The last frame stays up; nothing new is shown
                 }
             }
             pImpl->m_LastFrameTime = now;
@@ -178,6 +186,16 @@ bool GifBoltRenderer::Render()
                                         pImpl->m_Height);
     pImpl->m_DeviceContext->EndFrame();
 
+    // Lateness runs until the frame is presented, so fetching it counts
+    if (advanced)
+    {
+        const auto late = std::chrono::steady_clock::now() - due;
+        pImpl->m_Decoder->RecordFramePresented(
+            pImpl->m_CurrentFrame,
+            static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(late).count()));
+    }
+
     return true;
 }
 
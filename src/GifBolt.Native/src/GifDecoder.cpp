@@ -3,21 +3,40 @@
 
 #include "GifDecoder.h"
 
+#include "FrameKernels.h"
 #include "IDeviceCommandContext.h"
 #include "MemoryPool.h"
 #include "PixelConversion.h"
+#include "Probes.h"
+#include "SharedFrameCache.h"
 #include "ThreadPool.h"
+#include "Trace.h"
+#include "Tuning.h"
+#include "UrlLoader.h"
 #if defined(__APPLE__)
 #include "MetalDeviceCommandContext.h"
 #endif
 #ifdef _WIN32
 #include "D3D11DeviceCommandContext.h"
+#include <windows.h>
 #endif
 #include <gif_lib.h>
 
+#include <fcntl.h>
+#ifdef _WIN32
+#include <io.h>
+#endif
+
 #include <algorithm>
+#include <array>
 #include <atomic>
+#include <chrono>
+#include <climits>
+#include <cmath>
+#include <condition_variable>
+#include <cstdlib>
 #include <cstring>
+#include <ctime>
 #include <fstream>
 #include <mutex>
 #include <stdexcept>
@@ -28,6 +47,9 @@ namespace GifBolt
 
 namespace
 {
+// Kernels::ApplyColorMap reads giflib palettes as packed R, G, B bytes
+static_assert(sizeof(GifColorType) == 3, "GifColorType is expected to be packed RGB");
+
 struct MemoryBufferContext
 {
     const uint8_t* data = nullptr;
@@ -65,6 +87,496 @@ int ReadFromMemory(GifFileType* gif, GifByteType* destination, int size)
     context->offset += toCopy;
     return static_cast<int>(toCopy);
 }
+
+struct StreamReadContext
+{
+    std::shared_ptr<Net::StreamBuffer> stream;  ///< Body being downloaded
+    const std::atomic<bool>* cancel = nullptr;  ///< Aborts blocked reads when set
+    size_t offset = 0;
+};
+
+int ReadFromStream(GifFileType* gif, GifByteType* destination, int size)
+{
+    if ((gif == nullptr) || (destination == nullptr) || (size <= 0))
+    {
+        return GIF_ERROR;
+    }
+
+    auto* context = static_cast<StreamReadContext*>(gif->UserData);
+    if (context == nullptr || !context->stream)
+    {
+        return GIF_ERROR;
+    }
+
+    // Blocks until the download has delivered the requested bytes (or ended)
+    const size_t copied = context->stream->Read(context->offset, destination,
+                                                static_cast<size_t>(size), *context->cancel);
+    context->offset += copied;
+    return static_cast<int>(copied);
+}
+
+/// \brief Frees a vector's storage.
+/// \return The number of bytes released.
+template <typename T>
+size_t ReleaseBuffer(std::vector<T>& buffer)
+{
+    const size_t bytes = buffer.capacity() * sizeof(T);
+    std::vector<T>().swap(buffer);
+    return bytes;
+}
+
+/// \brief O(1) least-recently-used bookkeeping for cache slots keyed by frame index.
+/// \details Slots are never reordered, so a payload vector indexed by slot needs no shuffling
+///          on lookups. A frame-indexed table maps keys to slots and an intrusive list over
+///          the slots keeps the recency order.
+class LruIndex
+{
+   public:
+    static constexpr uint32_t NONE = UINT32_MAX;
+
+    /// \brief Finds the slot holding key and marks it most recently used.
+    /// \return The slot, or NONE if key is not cached.
+    uint32_t Find(uint32_t key)
+    {
+        if (key >= this->_slotOfKey.size() || this->_slotOfKey[key] == NONE)
+        {
+            return NONE;
+        }
+        const uint32_t slot = this->_slotOfKey[key];
+        this->Unlink(slot);
+        this->LinkMostRecent(slot);
+        return slot;
+    }
+
+    /// \brief Assigns a slot to key and marks it most recently used.
+    /// \param capacity Slots in use before the least recently used one is reassigned.
+    /// \param evictedKey Receives the key the slot was taken from, or NONE for a new or
+    ///                   free slot.
+    /// \return A free slot left by RetainOnly if there is one, else a new slot
+    ///         (== GetSlotCount() - 1) while below capacity, otherwise the slot evicted from
+    ///         its previous key.
+    uint32_t Insert(uint32_t key, uint32_t capacity, uint32_t* evictedKey = nullptr)
+    {
+        uint32_t evicted = NONE;
+        uint32_t slot = this->_leastRecent;
+        if (slot != NONE && this->_keyOfSlot[slot] == NONE)
+        {
+            this->Unlink(slot);
+        }
+        else if (this->GetSlotCount() < capacity || slot == NONE)
+        {
+            slot = this->GetSlotCount();
+            this->_keyOfSlot.push_back(NONE);
+            this->_previous.push_back(NONE);
+            this->_next.push_back(NONE);
+        }
+        else
+        {
+            this->Unlink(slot);
+            evicted = this->_keyOfSlot[slot];
+            this->_slotOfKey[evicted] = NONE;
+        }
+        if (evictedKey != nullptr)
+        {
+            *evictedKey = evicted;
+        }
+
+        if (key >= this->_slotOfKey.size())
+        {
+            this->_slotOfKey.resize(static_cast<size_t>(key) + 1, NONE);
+        }
+        this->_slotOfKey[key] = slot;
+        this->_keyOfSlot[slot] = key;
+        this->LinkMostRecent(slot);
+        return slot;
+    }
+
+    /// \brief Forgets the highest-numbered slot (used when the capacity shrinks).
+    /// \return The key the slot held, or NONE if it was free.
+    uint32_t RemoveLastSlot()
+    {
+        const uint32_t slot = this->GetSlotCount() - 1;
+        const uint32_t key = this->_keyOfSlot[slot];
+        this->Unlink(slot);
+        if (key != NONE)
+        {
+            this->_slotOfKey[key] = NONE;
+        }
+        this->_keyOfSlot.pop_back();
+        this->_previous.pop_back();
+        this->_next.pop_back();
+        return key;
+    }
+
+    /// \brief Forgets every key but the one in keptSlot. The other slots stay, as free slots
+    ///        that Insert hands out before evicting any key.
+    void RetainOnly(uint32_t keptSlot)
+    {
+        this->_leastRecent = NONE;
+        this->_mostRecent = NONE;
+        for (uint32_t slot = 0; slot < this->GetSlotCount(); ++slot)
+        {
+            const uint32_t key = this->_keyOfSlot[slot];
+            if (slot != keptSlot && key != NONE)
+            {
+                this->_slotOfKey[key] = NONE;
+                this->_keyOfSlot[slot] = NONE;
+            }
+            if (slot != keptSlot)
+            {
+                this->LinkMostRecent(slot);
+            }
+        }
+        this->LinkMostRecent(keptSlot);
+    }
+
+    /// \brief Forgets every key, keeping the storage for reuse.
+    void Clear()
+    {
+        for (uint32_t key : this->_keyOfSlot)
+        {
+            if (key != NONE)
+            {
+                this->_slotOfKey[key] = NONE;
+            }
+        }
+        this->_keyOfSlot.clear();
+        this->_previous.clear();
+        this->_next.clear();
+        this->_leastRecent = NONE;
+        this->_mostRecent = NONE;
+    }
+
+    /// \brief Forgets every key and frees the storage.
+    /// \return The number of bytes released.
+    size_t Release()
+    {
+        this->Clear();
+        return ReleaseBuffer(this->_slotOfKey) + ReleaseBuffer(this->_keyOfSlot) +
+               ReleaseBuffer(this->_previous) + ReleaseBuffer(this->_next);
+    }
+
+    uint32_t GetSlotCount() const
+    {
+        return static_cast<uint32_t>(this->_keyOfSlot.size());
+    }
+
+    uint32_t GetMostRecentSlot() const
+    {
+        return this->_mostRecent;
+    }
+
+   private:
+    void Unlink(uint32_t slot)
+    {
+        const uint32_t previous = this->_previous[slot];
+        const uint32_t next = this->_next[slot];
+        (previous == NONE ? this->_leastRecent : this->_next[previous]) = next;
+        (next == NONE ? this->_mostRecent : this->_previous[next]) = previous;
+    }
+
+    void LinkMostRecent(uint32_t slot)
+    {
+        this->_previous[slot] = this->_mostRecent;
+        this->_next[slot] = NONE;
+        (this->_mostRecent == NONE ? this->_leastRecent : this->_next[this->_mostRecent]) = slot;
+        this->_mostRecent = slot;
+    }
+
+    std::vector<uint32_t> _slotOfKey;  ///< Slot of each key, or NONE
+    std::vector<uint32_t> _keyOfSlot;  ///< Key held by each slot
+    std::vector<uint32_t> _previous;   ///< Next less recently used slot
+    std::vector<uint32_t> _next;       ///< Next more recently used slot
+    uint32_t _leastRecent = NONE;
+    uint32_t _mostRecent = NONE;
+};
+
+/// \brief Live decoders, so memory pressure can be handled process-wide.
+struct DecoderRegistry
+{
+    std::mutex mutex;
+    std::vector<GifDecoder*> decoders;
+    DecoderStats retired;  ///< Counters of destroyed decoders (byte counts stay 0)
+    PlaybackStats retiredPlayback;  ///< Playback statistics of destroyed decoders
+};
+
+DecoderRegistry& GetDecoderRegistry()
+{
+    static DecoderRegistry registry;
+    return registry;
+}
+
+/// \brief Hands out the ids that tag a decoder's trace events.
+uint32_t NextDecoderId()
+{
+    static std::atomic<uint32_t> nextId{1};
+    return nextId.fetch_add(1, std::memory_order_relaxed);
+}
+
+/// \brief Adds one set of statistics to another, field by field.
+void AddStats(DecoderStats& total, const DecoderStats& stats)
+{
+    total.frameCacheHits += stats.frameCacheHits;
+    total.frameCacheMisses += stats.frameCacheMisses;
+    total.frameCacheEvictions += stats.frameCacheEvictions;
+    total.mipCacheHits += stats.mipCacheHits;
+    total.mipCacheMisses += stats.mipCacheMisses;
+    total.mipCacheEvictions += stats.mipCacheEvictions;
+    total.framesDecoded += stats.framesDecoded;
+    total.framesComposed += stats.framesComposed;
+    total.framesConverted += stats.framesConverted;
+    total.framesScaled += stats.framesScaled;
+    total.lzwTimeNs += stats.lzwTimeNs;
+    total.composeTimeNs += stats.composeTimeNs;
+    total.convertTimeNs += stats.convertTimeNs;
+    total.scaleTimeNs += stats.scaleTimeNs;
+    total.threadCpuTimeNs += stats.threadCpuTimeNs;
+    total.rasterBytes += stats.rasterBytes;
+    total.canvasBytes += stats.canvasBytes;
+    total.cacheBytes += stats.cacheBytes;
+    total.poolBytes += stats.poolBytes;
+    total.frameCacheBytes += stats.frameCacheBytes;
+}
+
+/// \brief Adds one set of playback statistics to another.
+void AddPlaybackStats(PlaybackStats& total, const PlaybackStats& stats)
+{
+    total.framesPresented += stats.framesPresented;
+    total.framesLate += stats.framesLate;
+    total.framesDropped += stats.framesDropped;
+    total.lateSchedule += stats.lateSchedule;
+    total.lateDecodeNotReady += stats.lateDecodeNotReady;
+    total.lateConversion += stats.lateConversion;
+    total.lateLockWait += stats.lateLockWait;
+    total.totalLatenessNs += stats.totalLatenessNs;
+    total.maxLatenessNs = std::max(total.maxLatenessNs, stats.maxLatenessNs);
+    for (uint32_t bucket = 0; bucket < LATENESS_BUCKET_COUNT; ++bucket)
+    {
+        total.latenessHistogram[bucket] += stats.latenessHistogram[bucket];
+    }
+}
+
+/// \brief Gets the PlaybackStats::latenessHistogram bucket of a lateness.
+uint32_t GetLatenessBucket(uint64_t latenessNs)
+{
+    uint64_t milliseconds = latenessNs / 1000000;
+    uint32_t bucket = 0;
+    while (milliseconds > 0 && bucket < LATENESS_BUCKET_COUNT - 1)
+    {
+        milliseconds >>= 1;
+        ++bucket;
+    }
+    return bucket;
+}
+
+/// \brief Gets the CPU time consumed so far by the calling thread, in nanoseconds.
+uint64_t GetThreadCpuTimeNs()
+{
+#ifdef _WIN32
+    FILETIME creation;
+    FILETIME exit;
+    FILETIME kernel;
+    FILETIME user;
+    if (!GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user))
+    {
+        return 0;
+    }
+    // FILETIME counts 100 ns intervals
+    const uint64_t kernelTicks = (static_cast<uint64_t>(kernel.dwHighDateTime) << 32) |
+                                 kernel.dwLowDateTime;
+    const uint64_t userTicks = (static_cast<uint64_t>(user.dwHighDateTime) << 32) |
+                               user.dwLowDateTime;
+    return (kernelTicks + userTicks) * 100;
+#else
+    timespec now{};
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now) != 0)
+    {
+        return 0;
+    }
+    return static_cast<uint64_t>(now.tv_sec) * 1000000000ull + static_cast<uint64_t>(now.tv_nsec);
+#endif
+}
+
+/// \brief Gets the nanoseconds elapsed since a steady_clock time point.
+uint64_t GetElapsedNs(std::chrono::steady_clock::time_point start)
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now() - start)
+                                     .count());
+}
+
+/// \brief Where the time of a frame request went, to attribute a late frame to its cause.
+struct RequestTimings
+{
+    uint32_t frameIndex = UINT32_MAX;  ///< Frame requested, or UINT32_MAX before any request
+    uint64_t decodeNs = 0;             ///< Waiting for the frame's bytes and composing it
+    uint64_t lockWaitNs = 0;           ///< Waiting for a background decode to release the lock
+    uint64_t convertNs = 0;            ///< Converting and scaling
+};
+
+/// The outermost frame request running on this thread, if any
+thread_local RequestTimings* t_activeRequest = nullptr;
+
+/// \brief Locks a decoder mutex, charging the wait to the calling thread's frame request.
+/// \details Uncontended locks are not timed.
+void LockForRequest(std::unique_lock<std::mutex>& lock)
+{
+    if (t_activeRequest == nullptr || lock.try_lock())
+    {
+        if (!lock.owns_lock())
+        {
+            lock.lock();
+        }
+        return;
+    }
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    lock.lock();
+    t_activeRequest->lockWaitNs += GetElapsedNs(start);
+}
+
+/// \brief Splits the time of a public frame request into waiting for the composed frame, lock
+/// waits and conversion, and stores the split when the request ends.
+/// \details A request made while another is running on the same thread (the scaled getter
+///          calls the unscaled one) is part of the outer request.
+class ScopedFrameRequest
+{
+   public:
+    ScopedFrameRequest(RequestTimings& destination, std::mutex& destinationMutex,
+                       uint32_t frameIndex)
+    {
+        if (t_activeRequest == nullptr)
+        {
+            this->_destination = &destination;
+            this->_destinationMutex = &destinationMutex;
+            this->_timings.frameIndex = frameIndex;
+            this->_start = std::chrono::steady_clock::now();
+            t_activeRequest = &this->_timings;
+        }
+    }
+
+    ~ScopedFrameRequest()
+    {
+        if (this->_destination == nullptr)
+        {
+            return;
+        }
+        const uint64_t totalNs = GetElapsedNs(this->_start);
+        const uint64_t frameNs = this->_frameReady ? this->_frameNs : totalNs;
+        this->_timings.decodeNs =
+            frameNs > this->_timings.lockWaitNs ? frameNs - this->_timings.lockWaitNs : 0;
+        this->_timings.convertNs = totalNs - frameNs;
+        {
+            // Read by the playback thread while frames are produced on another
+            std::lock_guard<std::mutex> lock(*this->_destinationMutex);
+            *this->_destination = this->_timings;
+        }
+        t_activeRequest = nullptr;
+    }
+
+    /// \brief Marks the composed frame as available; the rest of the request is conversion.
+    void FrameReady()
+    {
+        if (this->_destination != nullptr && !this->_frameReady)
+        {
+            this->_frameNs = GetElapsedNs(this->_start);
+            this->_frameReady = true;
+        }
+    }
+
+    ScopedFrameRequest(const ScopedFrameRequest&) = delete;
+    ScopedFrameRequest& operator=(const ScopedFrameRequest&) = delete;
+
+   private:
+    RequestTimings* _destination = nullptr;  ///< Null for a nested request
+    std::mutex* _destinationMutex = nullptr;
+    RequestTimings _timings;
+    std::chrono::steady_clock::time_point _start;
+    uint64_t _frameNs = 0;
+    bool _frameReady = false;
+};
+
+/// \brief Adds the wall-clock time and thread CPU time spent in a scope to two counters, and
+/// optionally the wall-clock time to a third.
+class ScopedWorkTimer
+{
+   public:
+    ScopedWorkTimer(std::atomic<uint64_t>& wallNs, std::atomic<uint64_t>& cpuNs,
+                    std::atomic<uint64_t>* stageNs = nullptr)
+        : _wallNs(wallNs),
+          _cpuNs(cpuNs),
+          _stageNs(stageNs),
+          _wallStart(std::chrono::steady_clock::now()),
+          _cpuStart(GetThreadCpuTimeNs())
+    {
+    }
+
+    ~ScopedWorkTimer()
+    {
+        const uint64_t wallNs = GetElapsedNs(this->_wallStart);
+        this->_wallNs.fetch_add(wallNs, std::memory_order_relaxed);
+        this->_cpuNs.fetch_add(GetThreadCpuTimeNs() - this->_cpuStart, std::memory_order_relaxed);
+        if (this->_stageNs != nullptr)
+        {
+            this->_stageNs->fetch_add(wallNs, std::memory_order_relaxed);
+        }
+    }
+
+    ScopedWorkTimer(const ScopedWorkTimer&) = delete;
+    ScopedWorkTimer& operator=(const ScopedWorkTimer&) = delete;
+
+   private:
+    std::atomic<uint64_t>& _wallNs;
+    std::atomic<uint64_t>& _cpuNs;
+    std::atomic<uint64_t>* _stageNs;
+    std::chrono::steady_clock::time_point _wallStart;
+    uint64_t _cpuStart;
+};
+
+/// \brief Whether a caller buffer holds rows of rowBytes bytes, destStride bytes apart.
+bool FitsStridedBuffer(size_t rowBytes, uint32_t rows, const uint8_t* dest, size_t destStride,
+                       size_t destSize)
+{
+    return dest != nullptr && rowBytes > 0 && rows > 0 && destStride >= rowBytes &&
+           destStride * (rows - 1) + rowBytes <= destSize;
+}
+
+/// \brief Copies packed rows into a strided buffer; nothing to do if they were written there.
+void CopyRows(const uint8_t* source, size_t rowBytes, uint32_t rows, uint8_t* dest,
+              size_t destStride)
+{
+    if (source == dest)
+    {
+        return;
+    }
+    for (uint32_t row = 0; row < rows; ++row)
+    {
+        std::memcpy(dest + row * destStride, source + row * rowBytes, rowBytes);
+    }
+}
+
+/// \brief Folds bytes into a 64-bit hash, eight at a time. Not cryptographic: it tells apart
+/// GIFs that a shared frame cache would otherwise confuse.
+uint64_t HashBytes(const void* data, size_t length, uint64_t hash)
+{
+    constexpr uint64_t MULTIPLIER = 0x9E3779B97F4A7C15ull;
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    size_t offset = 0;
+    for (; offset + 8 <= length; offset += 8)
+    {
+        uint64_t word;
+        std::memcpy(&word, bytes + offset, 8);
+        hash = (hash ^ word) * MULTIPLIER;
+        hash ^= hash >> 32;
+    }
+    uint64_t tail = length;
+    for (; offset < length; ++offset)
+    {
+        tail = (tail << 8) | bytes[offset];
+    }
+    hash = (hash ^ tail) * MULTIPLIER;
+    return hash ^ (hash >> 29);
+}
+
 }  // namespace
 
 class GifDecoder::Impl
@@ -74,47 +586,102 @@ class GifDecoder::Impl
     {
         None = 0,
         File = 1,
-        Memory = 2
+        Memory = 2,
+        Url = 3
     };
 
     // Lazy frame caching: store only N frames instead of all frames
     uint32_t MAX_CACHED_FRAMES = 10;  ///< Maximum frames to cache in memory
-    std::vector<GifFrame> _frameCache;   ///< LRU cache for decoded frames
-    std::vector<uint32_t> _cachedFrameIndices;  ///< Indices of frames in cache (for LRU tracking)
-    std::vector<bool> _frameDecoded;  ///< Track which frames have been decoded
+    std::vector<GifFrame> _frameCache;   ///< LRU cache for decoded frames, indexed by slot
+    LruIndex _frameCacheIndex;           ///< Frame index <-> cache slot, in LRU order
+    uint32_t _decodedFrontier = 0;  ///< Frames [0, frontier) are composed, in order
+    uint32_t _compositionGeneration = 0;  ///< Bumped whenever composition restarts at frame 0
+    uint32_t _opportunisticTarget = 0;    ///< Frontier the queued background decode will reach
+
+    /// \brief A frame copied off the canvas as it was composed, held until GetOrDecodeFrame
+    /// moves it into _frameCache.
+    struct ComposedFrame
+    {
+        uint32_t frameIndex = LruIndex::NONE;   ///< Frame held, or NONE for a free slot
+        FrameAlpha alpha = FrameAlpha::Binary;  ///< Alpha classification of the pixels
+        std::vector<uint32_t> pixels;           ///< Composed RGBA pixels, full canvas size
+    };
+    std::vector<ComposedFrame> _composedFrames;  ///< Ring of frames composed ahead (_decodeMutex)
     std::vector<uint32_t> _canvas;    ///< Accumulated canvas for frame composition
     DisposalMethod _previousDisposal = DisposalMethod::None;  ///< Previous frame disposal
     uint32_t _prevFrameWidth = 0;
     uint32_t _prevFrameHeight = 0;
     uint32_t _prevFrameOffsetX = 0;
     uint32_t _prevFrameOffsetY = 0;
-    uint32_t _minFrameDelayMs = 10;         ///< Délai minimal configurable
+    std::atomic<uint32_t> _minFrameDelayMs{10};  ///< Délai minimal configurable
     std::vector<uint32_t> _previousCanvas;  ///< Saved canvas for RestorePrevious
+    size_t _canvasTransparentPixels = 0;    ///< Pixels of _canvas with alpha 0
+    size_t _previousCanvasTransparentPixels = 0;  ///< Same for _previousCanvas
     uint32_t _width = 0;
     uint32_t _height = 0;
     uint32_t _backgroundColor = 0xFF000000;  ///< Default: opaque black
     bool _looping = false;
     std::vector<uint8_t> _bgraPremultipliedCache;  ///< Cache for BGRA premultiplied pixels
+    std::vector<uint8_t> _scaledCache;             ///< Output buffer for scaled frames
     std::shared_ptr<Renderer::IDeviceCommandContext> _deviceContext;  ///< GPU context for scaling
 
     // Background loading support
-    GifFileType* _gif = nullptr;  ///< GIF file handle after slurp
-    uint32_t _frameCount = 0;     ///< Total number of frames
-    std::string _filePath;        ///< Stored for background loading
-    std::shared_ptr<void> _gifUserData;  ///< Keeps memory source alive for giflib callbacks
-
-    std::thread _backgroundLoader;            ///< Background thread for DGifSlurp
-    std::mutex _gifMutex;                     ///< Protect gif pointer access
-    std::atomic<bool> _slurpComplete{false};  ///< Whether DGifSlurp finished
-    std::atomic<bool> _slurpFailed{false};    ///< Whether DGifSlurp failed
+    GifFileType* _gif = nullptr;            ///< GIF file handle, filled in while slurping
+    std::atomic<uint32_t> _frameCount{0};   ///< Frames read so far (total once loaded)
+    std::string _filePath;                  ///< Stored for background loading
+    std::shared_ptr<void> _gifUserData;     ///< Keeps memory source alive for giflib callbacks
+    std::shared_ptr<Net::StreamBuffer> _stream;  ///< Download feeding a URL source
+
+    std::thread _backgroundLoader;              ///< Background thread reading frame records
+    std::mutex _gifMutex;                       ///< Protect gif pointer and SavedImages access
+    std::condition_variable _frameAvailable;    ///< Signalled when a frame is read or loading ends
+    std::atomic<bool> _loadInProgress{false};   ///< Whether the background loader is running
+    std::atomic<bool> _cancelLoad{false};       ///< Asks the background loader to stop
+    std::atomic<bool> _slurpComplete{false};    ///< Whether all frame records were read
+    std::atomic<bool> _slurpFailed{false};      ///< Whether loading failed before any frame
+    size_t _savedImageCapacity = 0;             ///< Allocated length of gif->SavedImages
+
+    // Graphics control values parsed once per frame as it is read (structure of arrays,
+    // guarded by _gifMutex like SavedImages)
+    std::vector<int32_t> _frameDelayCs;  ///< Delay in 1/100 s, or -1 without a control block
+    std::vector<DisposalMethod> _frameDisposal;    ///< Disposal method
+    std::vector<int16_t> _frameTransparentIndex;   ///< Transparent color index, or -1
+    std::vector<uint32_t> _frameDelaysMs;  ///< GetFrameDelaysMs result, built once loaded
+    bool _frameDelaysValid = false;        ///< Whether _frameDelaysMs is up to date
+    /// Guards _frameDelaysMs and _frameDelaysValid; separate from _frameMutex so that reading
+    /// the delays never waits for a frame being decoded.
+    std::mutex _frameDelaysMutex;
 
     // Memory optimization: PMR allocator pool for frame data
     Memory::FrameMemoryPool _framePool;  ///< PMR pool for frame allocations
     Memory::ArenaAllocator _tempArena;   ///< Arena for temporary decode buffers
+    Memory::BufferPool<uint32_t> _pixelPool;  ///< Recycled pixel buffers of cached frames
 
     // Thread pool for parallel frame decoding
     std::unique_ptr<ThreadPool> _threadPool;  ///< Thread pool for parallel decoding
     std::mutex _decodeMutex;                  ///< Protect frame decoding state
+    /// Serializes the frame cache, mip chains and output buffers, so that one thread can
+    /// produce frames while another drives playback. Taken before _decodeMutex.
+    std::mutex _frameMutex;
+
+    // Thresholds from the tuning profile in effect when the file was loaded (Tuning.h)
+    uint64_t _convertParallelMinPixels = Renderer::PixelFormats::THREADING_THRESHOLD;
+    uint32_t _convertThreads = 1;     ///< Threads a parallel conversion uses, this one included
+    uint64_t _gpuScaleMinPixels = 0;  ///< Smallest source scaled on the GPU
+
+    /// \brief One RGBA to BGRA premultiplied conversion split across _threadPool.
+    struct ConversionBatch
+    {
+        const uint8_t* source = nullptr;
+        uint8_t* dest = nullptr;
+        size_t pixelCount = 0;
+        size_t chunkCount = 0;
+        bool swizzleOnly = false;  ///< Pixels are opaque or zero, so no premultiplication
+        size_t pending = 0;  ///< Chunks still running on pool workers
+        std::mutex mutex;
+        std::condition_variable done;
+    };
+    ConversionBatch _conversion;  ///< Reused so large conversions do not spawn threads
 
     // Async prefetching support
     std::atomic<bool> _prefetchingEnabled{true};      ///< Enable/disable prefetching
@@ -123,27 +690,213 @@ class GifDecoder::Impl
     std::atomic<bool> _prefetchThreadRunning{false};  ///< Prefetch thread active
     std::mutex _prefetchMutex;                        ///< Protect prefetch state
     static constexpr uint32_t PREFETCH_AHEAD = 5;     ///< Number of frames to decode ahead
+    static constexpr uint32_t OPPORTUNISTIC_AHEAD = 3;  ///< Frames composed ahead of a request
+    /// Frames _composedFrames holds: enough for everything prefetching composes ahead
+    static constexpr uint32_t COMPOSED_FRAME_SLOTS = PREFETCH_AHEAD + OPPORTUNISTIC_AHEAD + 1;
+
+    // Mip pyramid support for multi-size consumers
+    /// \brief One level of a premultiplied BGRA mip chain.
+    struct MipLevel
+    {
+        uint32_t width = 0;           ///< Level width in pixels
+        uint32_t height = 0;          ///< Level height in pixels
+        std::vector<uint8_t> pixels;  ///< BGRA32 premultiplied pixels
+    };
+    bool _mipmapsEnabled = false;                  ///< Serve scaled requests from mip chains
+    std::vector<std::vector<MipLevel>> _mipCache;  ///< LRU cache of mip chains, by slot
+    LruIndex _mipCacheIndex;                       ///< Frame index <-> mip cache slot
+    std::vector<std::vector<MipLevel>> _spareMipChains;  ///< Chains kept for reuse
+
+    // Frames shared with other processes (see GifDecoder::SetSharedFrameCache)
+    std::shared_ptr<SharedFrameCache> _sharedCache;
+    SharedFrameCache::View _sharedView;  ///< ConvertFrame result mapped from _sharedCache, unpinned
+    uint64_t _contentHash = 0;           ///< Hash of the decoded GIF, or 0 until computed
 
     SourceKind _sourceKind = SourceKind::None;  ///< Current source type
     std::vector<uint8_t> _memoryData;           ///< Memory-backed GIF bytes
+    const uint32_t _decoderId = NextDecoderId();  ///< Tags this decoder's trace events and probes
+
+    // Statistics (see GifDecoder::GetStats). Relaxed atomics: they only have to be exact once
+    // the threads that bump them have gone quiet.
+    enum Counter : size_t
+    {
+        FrameCacheHits,
+        FrameCacheMisses,
+        FrameCacheEvictions,
+        MipCacheHits,
+        MipCacheMisses,
+        MipCacheEvictions,
+        FramesDecoded,
+        FramesComposed,
+        FramesConverted,
+        FramesScaled,
+        LzwTimeNs,
+        ComposeTimeNs,
+        ConvertTimeNs,
+        ScaleTimeNs,
+        ThreadCpuTimeNs,
+        COUNTER_COUNT
+    };
+    std::array<std::atomic<uint64_t>, COUNTER_COUNT> _counters{};  ///< Indexed by Counter
+    std::atomic<uint64_t> _rasterBytes{0};  ///< Rasters and color maps of the frames read
+
+    void Count(Counter counter, uint64_t amount = 1)
+    {
+        this->_counters[counter].fetch_add(amount, std::memory_order_relaxed);
+    }
+
+    uint64_t GetCounter(Counter counter) const
+    {
+        return this->_counters[counter].load(std::memory_order_relaxed);
+    }
+
+    // Time to first pixel of the current load (see GifDecoder::GetLoadTimings)
+    enum LoadStage : size_t
+    {
+        OpenStage,
+        HeaderStage,
+        SlurpStage,
+        DecodeStage,
+        ComposeStage,
+        ConvertStage,
+        ScaleStage,
+        LOAD_STAGE_COUNT
+    };
+    std::array<std::atomic<uint64_t>, LOAD_STAGE_COUNT> _loadTimings{};  ///< By LoadStage
+    std::chrono::steady_clock::time_point _loaderStarted;  ///< When the loader was spawned
+
+    void AddLoadTime(LoadStage stage, uint64_t durationNs)
+    {
+        this->_loadTimings[stage].fetch_add(durationNs, std::memory_order_relaxed);
+    }
+
+    /// \brief Times a scope into one of the *TimeNs counters and ThreadCpuTimeNs, and into a
+    /// load stage when the work is for frame 0.
+    ScopedWorkTimer TimeWork(Counter timeCounter, LoadStage stage, uint32_t frameIndex)
+    {
+        return ScopedWorkTimer(this->_counters[timeCounter], this->_counters[ThreadCpuTimeNs],
+                               frameIndex == 0 ? &this->_loadTimings[stage] : nullptr);
+    }
+
+    /// \brief Snapshots the counters and measures the memory held (see GifDecoder::GetStats).
+    DecoderStats GetStats();
+
+    // Playback quality (see GifDecoder::RecordFramePresented)
+    PlaybackStats _playback;
+    std::mutex _playbackMutex;  ///< Guards _playback; render threads and stats readers race
+    RequestTimings _lastRequest;  ///< Split of the most recent public frame request
+    std::mutex _lastRequestMutex;  ///< Guards _lastRequest
+
+    void RecordFramePresented(uint32_t frameIndex, uint64_t latenessNs, uint32_t droppedFrames);
+
+    /// \brief Snapshots _playback under its mutex.
+    PlaybackStats GetPlaybackStats()
+    {
+        std::lock_guard<std::mutex> lock(this->_playbackMutex);
+        return this->_playback;
+    }
 
     bool LoadGif(const std::string& filePath);
     bool LoadGifFromMemory(const uint8_t* data, size_t length);
-    bool LoadFromCurrentSource();
+    bool LoadGifFromUrl(const std::string& url);
+    /// \brief Reads the header of the current source and starts the background loader.
+    /// \param sourceOpenNs Time the caller spent opening the source, for the open stage.
+    bool LoadFromCurrentSource(uint64_t sourceOpenNs = 0);
     GifFileType* OpenGif(int& error, std::shared_ptr<void>& userDataHolder);
     void BackgroundSlurp();                        ///< Background thread function
-    void WaitForSlurp();                           ///< Wait for background slurp to complete
+    void WaitForSlurp();                           ///< Join the background loader thread
+    void StopLoading();                            ///< Cancel and join the background loader
+    void WaitForLoad();                            ///< Wait until every frame has been read
+    bool WaitForFrame(uint32_t frameIndex);        ///< Wait until a frame has been read
+
+    /// \brief Reads frame records like DGifSlurp, publishing each frame as it completes.
+    /// \return false if the stream ended early or was cancelled.
+    bool SlurpFrames(GifFileType* gif);
+
+    /// \brief Appends the image just read to gif->SavedImages and wakes frame waiters.
+    /// \param raster Pixel indices of the image (ownership passes to giflib on success).
+    bool PublishImage(GifFileType* gif, GifByteType* raster);
+
+    /// \brief Copies the SavedImage record of a frame that has been read.
+    /// \remarks SavedImages may be reallocated while loading, but the buffers a record
+    ///          points to stay put, so the copy remains valid until the GIF is closed.
+    SavedImage GetSavedImage(uint32_t frameIndex);
+
+    /// \brief Graphics control values of one frame.
+    struct FrameControl
+    {
+        uint32_t delayMs;           ///< Display duration, with the minimum delay applied
+        DisposalMethod disposal;    ///< Disposal method
+        int32_t transparentIndex;   ///< Transparent color index, or -1
+    };
+
+    /// \brief Gets the graphics control values parsed when the frame was read.
+    FrameControl GetFrameControl(uint32_t frameIndex);
     void EnsureFrameDecoded(uint32_t frameIndex);  ///< Decode frame on-demand
     void DecodeFrame(GifFileType* gif, uint32_t frameIndex);
-    void ApplyColorMap(const GifByteType* raster, const ColorMapObject* colorMap,
-                       std::vector<uint32_t>& pixels, int width, int height,
-                       int transparentIndex = -1);
-    void ComposeFrame(const GifFrame& frame, std::vector<uint32_t>& canvas);
+
+    /// \brief Composes the frame at the frontier and advances the frontier.
+    /// \param keep Whether to copy the result into _composedFrames for GetOrDecodeFrame.
+    /// \remarks Caller must hold _decodeMutex.
+    void ComposeNextFrame(bool keep);
+
+    /// \brief Moves a frame composed ahead into a cached frame, giving the ring the cached
+    /// frame's old buffer to reuse.
+    /// \return false if the frame is not held.
+    /// \remarks Caller must hold _decodeMutex.
+    bool TakeComposedFrame(uint32_t frameIndex, GifFrame& frame);
+
+    /// \brief Composes a frame's color-mapped pixels (frame.pixels is not used) onto canvas.
+    void ComposeFrame(const GifFrame& frame, const uint32_t* framePixels,
+                      std::vector<uint32_t>& canvas);
+
+    /// \brief Converts RGBA pixels to BGRA premultiplied, splitting large frames across
+    /// _threadPool instead of spawning threads.
+    /// \param alpha Classification of the source; Opaque and Binary pixels are only swizzled.
+    void ConvertFramePixels(uint32_t frameIndex, const uint8_t* source, uint8_t* dest,
+                            size_t pixelCount, FrameAlpha alpha);
+    void ConvertChunk(size_t chunk);  ///< Convert one chunk of _conversion
+
+    /// \brief Converts a frame to BGRA premultiplied, or maps it from the shared cache.
+    /// \param dest Destination of width * height packed pixels, or nullptr to convert into
+    ///             _bgraPremultipliedCache.
+    /// \return The converted pixels (dest, the cache or _sharedView), or nullptr on error.
+    const uint8_t* ConvertFrame(uint32_t index, uint8_t* dest);
+
+    /// \brief Builds the shared cache key of a converted frame.
+    /// \return false if no shared cache is set or the GIF has not been read completely.
+    bool GetSharedFrameKey(uint32_t index, SharedFrameKey& key);
+
+    /// \brief Scales a frame converted to BGRA premultiplied.
+    /// \param dest Destination of targetWidth * targetHeight packed pixels, or nullptr to scale
+    ///             into _scaledCache.
+    /// \return The scaled pixels (dest, the cache or a cached mip level of the target size), or
+    ///         nullptr on error.
+    const uint8_t* ScaleFrame(uint32_t index, uint32_t targetWidth, uint32_t targetHeight,
+                              uint32_t& outWidth, uint32_t& outHeight, ScalingFilter filter,
+                              uint8_t* dest);
 
     /// \brief Retrieve a frame from cache, loading if necessary.
     /// Uses LRU eviction to maintain memory bounds.
     GifFrame& GetOrDecodeFrame(uint32_t frameIndex);
 
+    /// \brief Looks up the mip chain of a frame, marking it most recently used.
+    /// \return The chain (level 0 = full resolution), or nullptr if not cached.
+    const std::vector<MipLevel>* FindMipChain(uint32_t frameIndex);
+
+    /// \brief Builds and caches the box-filtered mip chain of a frame.
+    /// \param baseBGRA Full-resolution BGRA32 premultiplied pixels (copied as level 0).
+    /// \param opaque Whether every base pixel is opaque, so levels skip the alpha channel.
+    const std::vector<MipLevel>& BuildMipChain(uint32_t frameIndex, const uint8_t* baseBGRA,
+                                               uint32_t width, uint32_t height, bool opaque);
+
+    /// \brief Forgets composition progress so frames are recomposed from frame 0.
+    /// \remarks Caller must hold _decodeMutex.
+    void ResetComposition();
+
+    /// \brief Releases rebuildable memory (see GifDecoder::TrimMemory).
+    size_t TrimMemory(TrimLevel level);
+
     // Async prefetching methods
     void StartPrefetching(uint32_t startFrame);  ///< Start background prefetch
     void StopPrefetching();                      ///< Stop background prefetch thread
@@ -154,10 +907,9 @@ class GifDecoder::Impl
         // Stop prefetch thread first
         this->StopPrefetching();
 
-        if (_backgroundLoader.joinable())
-        {
-            _backgroundLoader.join();
-        }
+        this->StopLoading();
+        // Drain pending opportunistic decodes before the GIF they read is closed
+        this->_threadPool.reset();
         if (this->_gif)
         {
             int error = 0;
@@ -170,9 +922,11 @@ class GifDecoder::Impl
 
 bool GifDecoder::Impl::LoadGif(const std::string& filePath)
 {
+    this->StopLoading();
     this->_sourceKind = SourceKind::File;
     this->_filePath = filePath;
     this->_memoryData.clear();
+    this->_stream.reset();
     return this->LoadFromCurrentSource();
 }
 
@@ -183,10 +937,31 @@ bool GifDecoder::Impl::LoadGifFromMemory(const uint8_t* data, size_t length)
         return false;
     }
 
+    this->StopLoading();
+    const auto openStart = std::chrono::steady_clock::now();
     this->_sourceKind = SourceKind::Memory;
     this->_filePath.clear();
     this->_memoryData.assign(data, data + length);
-    return this->LoadFromCurrentSource();
+    this->_stream.reset();
+    return this->LoadFromCurrentSource(GetElapsedNs(openStart));
+}
+
+bool GifDecoder::Impl::LoadGifFromUrl(const std::string& url)
+{
+    this->StopLoading();
+
+    const auto openStart = std::chrono::steady_clock::now();
+    std::shared_ptr<Net::StreamBuffer> stream = Net::OpenUrl(url);
+    if (!stream)
+    {
+        return false;
+    }
+
+    this->_sourceKind = SourceKind::Url;
+    this->_filePath.clear();
+    this->_memoryData.clear();
+    this->_stream = std::move(stream);
+    return this->LoadFromCurrentSource(GetElapsedNs(openStart));
 }
 
 GifFileType* GifDecoder::Impl::OpenGif(int& error, std::shared_ptr<void>& userDataHolder)
@@ -194,7 +969,27 @@ GifFileType* GifDecoder::Impl::OpenGif(int& error, std::shared_ptr<void>& userDa
     switch (this->_sourceKind)
     {
         case SourceKind::File:
-            return DGifOpenFileName(this->_filePath.c_str(), &error);
+        {
+            // Opened here rather than by DGifOpenFileName to time the open and the header apart
+            const auto openStart = std::chrono::steady_clock::now();
+#ifdef _WIN32
+            const int handle = _open(this->_filePath.c_str(), _O_RDONLY | _O_BINARY);
+#else
+            const int handle = open(this->_filePath.c_str(), O_RDONLY);
+#endif
+            this->AddLoadTime(OpenStage, GetElapsedNs(openStart));
+            if (handle == -1)
+            {
+                error = D_GIF_ERR_OPEN_FAILED;
+                return nullptr;
+            }
+
+            // giflib owns the handle from here, and closes it on failure
+            const auto headerStart = std::chrono::steady_clock::now();
+            GifFileType* gif = DGifOpenFileHandle(handle, &error);
+            this->AddLoadTime(HeaderStage, GetElapsedNs(headerStart));
+            return gif;
+        }
 
         case SourceKind::Memory:
         {
@@ -208,8 +1003,10 @@ GifFileType* GifDecoder::Impl::OpenGif(int& error, std::shared_ptr<void>& userDa
             context->length = this->_memoryData.size();
             context->offset = 0;
 
+            const auto headerStart = std::chrono::steady_clock::now();
             GifFileType* gif =
                 DGifOpen(static_cast<void*>(context.get()), &ReadFromMemory, &error);
+            this->AddLoadTime(HeaderStage, GetElapsedNs(headerStart));
             if (gif != nullptr)
             {
                 gif->UserData = context.get();
@@ -219,13 +1016,38 @@ GifFileType* GifDecoder::Impl::OpenGif(int& error, std::shared_ptr<void>& userDa
             return gif;
         }
 
-        default:
-            return nullptr;
-    }
-}
-
-bool GifDecoder::Impl::LoadFromCurrentSource()
-{
+        case SourceKind::Url:
+        {
+            if (!this->_stream)
+            {
+                return nullptr;
+            }
+
+            auto context = std::make_shared<StreamReadContext>();
+            context->stream = this->_stream;
+            context->cancel = &this->_cancelLoad;
+
+            // Blocks until the bytes of the header have arrived
+            const auto headerStart = std::chrono::steady_clock::now();
+            GifFileType* gif =
+                DGifOpen(static_cast<void*>(context.get()), &ReadFromStream, &error);
+            this->AddLoadTime(HeaderStage, GetElapsedNs(headerStart));
+            if (gif != nullptr)
+            {
+                gif->UserData = context.get();
+                userDataHolder = context;
+            }
+
+            return gif;
+        }
+
+        default:
+            return nullptr;
+    }
+}
+
+bool GifDecoder::Impl::LoadFromCurrentSource(uint64_t sourceOpenNs)
+{
     if (this->_sourceKind == SourceKind::None)
     {
         return false;
@@ -233,6 +1055,14 @@ bool GifDecoder::Impl::LoadFromCurrentSource()
 
     this->StopPrefetching();
     this->WaitForSlurp();
+    this->_threadPool.reset();
+
+    // Nothing works for the previous load any more
+    for (std::atomic<uint64_t>& stage : this->_loadTimings)
+    {
+        stage.store(0, std::memory_order_relaxed);
+    }
+    this->AddLoadTime(OpenStage, sourceOpenNs);
 
     if (this->_gif != nullptr)
     {
@@ -242,18 +1072,36 @@ bool GifDecoder::Impl::LoadFromCurrentSource()
     }
 
     this->_gifUserData.reset();
+    this->_rasterBytes = 0;
     this->_frameCache.clear();
-    this->_cachedFrameIndices.clear();
-    this->_frameDecoded.clear();
+    this->_frameCacheIndex.Clear();
+    {
+        std::lock_guard<std::mutex> lock(this->_decodeMutex);
+        this->ResetComposition();
+    }
     this->_canvas.clear();
     this->_bgraPremultipliedCache.clear();
+    this->_sharedView.Reset();
+    this->_contentHash = 0;
+    this->_mipCache.clear();
+    this->_mipCacheIndex.Clear();
+    this->_savedImageCapacity = 0;
+    this->_frameDelayCs.clear();
+    {
+        std::lock_guard<std::mutex> lock(this->_frameDelaysMutex);
+        this->_frameDelaysValid = false;
+    }
+    this->_frameDisposal.clear();
+    this->_frameTransparentIndex.clear();
     this->_looping = false;
     this->_frameCount = 0;
     this->_width = 0;
     this->_height = 0;
     this->_slurpComplete = false;
     this->_slurpFailed = false;
+    this->_loadInProgress = false;
 
+    // For URL sources this blocks until the first bytes of the body have arrived
     int error = 0;
     std::shared_ptr<void> headerUserData;
     GifFileType* tempGif = this->OpenGif(error, headerUserData);
@@ -280,9 +1128,17 @@ bool GifDecoder::Impl::LoadFromCurrentSource()
     DGifCloseFile(tempGif, &error);
     headerUserData.reset();
 
-    size_t numThreads = std::max(1u, std::thread::hardware_concurrency() - 1);
-    this->_threadPool = std::make_unique<ThreadPool>(numThreads);
+    this->_canvas.resize(static_cast<size_t>(this->_width) * this->_height, 0x00000000);
+    this->_canvasTransparentPixels = this->_canvas.size();
 
+    const TuningProfile tuning = Tuning::GetProfile();
+    this->_convertParallelMinPixels = tuning.convertParallelMinPixels;
+    this->_convertThreads = tuning.convertThreads;
+    this->_gpuScaleMinPixels = tuning.gpuScaleMinPixels;
+    this->_threadPool = std::make_unique<ThreadPool>(tuning.workerThreads);
+
+    this->_loadInProgress = true;
+    this->_loaderStarted = std::chrono::steady_clock::now();
     this->_backgroundLoader = std::thread(&Impl::BackgroundSlurp, this);
 
     return true;
@@ -290,57 +1146,269 @@ bool GifDecoder::Impl::LoadFromCurrentSource()
 
 void GifDecoder::Impl::BackgroundSlurp()
 {
+    GIFBOLT_TRACE_THREAD_NAME("GifBolt loader");
+    GIFBOLT_TRACE_SPAN("BackgroundSlurp", this->_decoderId, Trace::NO_FRAME);
+    GIFBOLT_PROBE2(load_start, this->_decoderId, static_cast<int>(this->_sourceKind));
+    this->AddLoadTime(SlurpStage, GetElapsedNs(this->_loaderStarted));  // Thread start-up
+    const auto loadStart = std::chrono::steady_clock::now();
+
+    // The loader thread works only for this decoder, so all of its CPU time is attributed
+    const uint64_t cpuStart = GetThreadCpuTimeNs();
     int error = 0;
     std::shared_ptr<void> userData;
     GifFileType* gif = this->OpenGif(error, userData);
 
-    if (gif == nullptr)
+    if (gif != nullptr)
     {
-        this->_slurpFailed = true;
-        return;
+        {
+            std::lock_guard<std::mutex> lock(this->_gifMutex);
+            this->_gif = gif;
+            this->_gifUserData = userData;
+        }
+
+        // Frames become available one by one; a truncated stream keeps the frames read so far
+        this->_slurpComplete = this->SlurpFrames(gif);
     }
 
-    // Do the heavy DGifSlurp in background thread
-    if (DGifSlurp(gif) == GIF_ERROR)
     {
-        DGifCloseFile(gif, &error);
-        this->_slurpFailed = true;
-        return;
+        std::lock_guard<std::mutex> lock(this->_gifMutex);
+        this->_slurpFailed = (this->_frameCount == 0);
+        this->_loadInProgress = false;
     }
+    this->Count(ThreadCpuTimeNs, GetThreadCpuTimeNs() - cpuStart);
+    GIFBOLT_PROBE4(load_done, this->_decoderId, this->_frameCount.load(),
+                   GetElapsedNs(loadStart), this->_slurpComplete ? 1 : 0);
+    this->_frameAvailable.notify_all();
+}
 
-    // Store results under mutex
+bool GifDecoder::Impl::SlurpFrames(GifFileType* gif)
+{
+    static constexpr int INTERLACED_OFFSETS[] = {0, 4, 2, 1};
+    static constexpr int INTERLACED_JUMPS[] = {8, 8, 4, 2};
+
+    const auto recordsStart = std::chrono::steady_clock::now();
+    GifRecordType recordType = UNDEFINED_RECORD_TYPE;
+    do
     {
-        std::lock_guard<std::mutex> lock(this->_gifMutex);
-        this->_gif = gif;
-        this->_gifUserData = userData;
-        this->_frameCount = gif->ImageCount;
+        if (this->_cancelLoad || DGifGetRecordType(gif, &recordType) == GIF_ERROR)
+        {
+            return false;
+        }
 
-        // Check for looping extension
-        for (int i = 0; i < gif->ImageCount && !this->_looping; ++i)
+        switch (recordType)
         {
-            SavedImage* image = &gif->SavedImages[i];
-            for (int j = 0; j < image->ExtensionBlockCount; ++j)
+            case IMAGE_DESC_RECORD_TYPE:
+            {
+                // Read the descriptor only; SavedImages grows under the lock in PublishImage
+                if (DGifGetImageHeader(gif) == GIF_ERROR)
+                {
+                    return false;
+                }
+
+                const int width = gif->Image.Width;
+                const int height = gif->Image.Height;
+                if (width <= 0 || height <= 0 || width > INT_MAX / height)
+                {
+                    return false;
+                }
+
+                // giflib releases RasterBits with free(), so allocate it with malloc()
+                auto* raster = static_cast<GifByteType*>(
+                    std::malloc(static_cast<size_t>(width) * static_cast<size_t>(height)));
+                if (raster == nullptr)
+                {
+                    return false;
+                }
+
+                // giflib decompresses LZW data as the lines are read
+                GIFBOLT_TRACE_SPAN("ReadRaster", this->_decoderId,
+                                   static_cast<uint32_t>(gif->ImageCount));
+                const bool firstFrame = gif->ImageCount == 0;
+                const auto readStart = std::chrono::steady_clock::now();
+                if (firstFrame)
+                {
+                    this->AddLoadTime(SlurpStage, GetElapsedNs(recordsStart));
+                }
+                bool rasterRead = true;
+                if (gif->Image.Interlace)
+                {
+                    for (int pass = 0; pass < 4 && rasterRead; ++pass)
+                    {
+                        for (int y = INTERLACED_OFFSETS[pass]; y < height && rasterRead;
+                             y += INTERLACED_JUMPS[pass])
+                        {
+                            rasterRead = DGifGetLine(gif, raster + static_cast<size_t>(y) * width,
+                                                     width) != GIF_ERROR;
+                        }
+                    }
+                }
+                else
+                {
+                    rasterRead = DGifGetLine(gif, raster, width * height) != GIF_ERROR;
+                }
+                const uint64_t readNs = GetElapsedNs(readStart);
+                this->Count(LzwTimeNs, readNs);
+                if (firstFrame)
+                {
+                    this->AddLoadTime(DecodeStage, readNs);
+                }
+
+                if (!rasterRead || !this->PublishImage(gif, raster))
+                {
+                    std::free(raster);
+                    return false;
+                }
+                this->Count(FramesDecoded);
+                break;
+            }
+
+            case EXTENSION_RECORD_TYPE:
             {
-                ExtensionBlock* ext = &image->ExtensionBlocks[j];
-                if (ext->Function == APPLICATION_EXT_FUNC_CODE)
+                // Collect blocks on the file; PublishImage hands them to the next image
+                int function = 0;
+                GifByteType* data = nullptr;
+                if (DGifGetExtension(gif, &function, &data) == GIF_ERROR)
+                {
+                    return false;
+                }
+                if (data != nullptr &&
+                    GifAddExtensionBlock(&gif->ExtensionBlockCount, &gif->ExtensionBlocks,
+                                         function, data[0], &data[1]) == GIF_ERROR)
                 {
-                    if (std::memcmp(ext->Bytes, "NETSCAPE2.0", 11) == 0)
+                    return false;
+                }
+                for (;;)
+                {
+                    if (DGifGetExtensionNext(gif, &data) == GIF_ERROR)
+                    {
+                        return false;
+                    }
+                    if (data == nullptr)
                     {
-                        this->_looping = true;
                         break;
                     }
+                    if (GifAddExtensionBlock(&gif->ExtensionBlockCount, &gif->ExtensionBlocks,
+                                             CONTINUE_EXT_FUNC_CODE, data[0],
+                                             &data[1]) == GIF_ERROR)
+                    {
+                        return false;
+                    }
                 }
+                break;
             }
+
+            default:
+                break;
         }
+    } while (recordType != TERMINATE_RECORD_TYPE);
+
+    return true;
+}
 
-        // Initialize frame storage: use LRU cache instead of storing all frames
-        this->_frameDecoded.resize(this->_frameCount, false);
-        this->_frameCache.clear();
-        this->_cachedFrameIndices.clear();
-        this->_canvas.resize(this->_width * this->_height, 0x00000000);
+bool GifDecoder::Impl::PublishImage(GifFileType* gif, GifByteType* raster)
+{
+    ColorMapObject* localColorMap = nullptr;
+    if (gif->Image.ColorMap != nullptr)
+    {
+        localColorMap =
+            GifMakeMapObject(gif->Image.ColorMap->ColorCount, gif->Image.ColorMap->Colors);
+        if (localColorMap == nullptr)
+        {
+            return false;
+        }
     }
 
-    this->_slurpComplete = true;
+    {
+        std::lock_guard<std::mutex> lock(this->_gifMutex);
+
+        // Same layout DGifSlurp builds, so DGifCloseFile releases everything as usual. The
+        // array grows geometrically so long animations are not copied once per frame.
+        const size_t newCount = static_cast<size_t>(gif->ImageCount) + 1;
+        if (newCount > this->_savedImageCapacity)
+        {
+            const size_t capacity = std::max<size_t>(16, this->_savedImageCapacity * 2);
+            auto* images = static_cast<SavedImage*>(
+                std::realloc(gif->SavedImages, capacity * sizeof(SavedImage)));
+            if (images == nullptr)
+            {
+                GifFreeMapObject(localColorMap);
+                return false;
+            }
+            gif->SavedImages = images;
+            this->_savedImageCapacity = capacity;
+        }
+
+        SavedImage& image = gif->SavedImages[gif->ImageCount];
+        image.ImageDesc = gif->Image;
+        image.ImageDesc.ColorMap = localColorMap;
+        image.RasterBits = raster;
+        image.ExtensionBlockCount = gif->ExtensionBlockCount;
+        image.ExtensionBlocks = gif->ExtensionBlocks;
+        gif->ExtensionBlockCount = 0;
+        gif->ExtensionBlocks = nullptr;
+        gif->ImageCount++;
+
+        // One pass over the frame's own blocks picks up its graphics control values and
+        // the looping extension
+        int32_t delayCs = -1;
+        DisposalMethod disposal = DisposalMethod::None;
+        int16_t transparentIndex = -1;
+        for (int i = 0; i < image.ExtensionBlockCount; ++i)
+        {
+            const ExtensionBlock& ext = image.ExtensionBlocks[i];
+            if (ext.Function == GRAPHICS_EXT_FUNC_CODE && ext.ByteCount >= 4 && delayCs < 0)
+            {
+                // Packed field: bits 2-4 = disposal method, bit 0 = transparent color flag
+                const uint8_t packed = ext.Bytes[0];
+                disposal = static_cast<DisposalMethod>((packed >> 2) & 0x07);
+                delayCs = (ext.Bytes[2] << 8) | ext.Bytes[1];
+                if (packed & 0x01)
+                {
+                    transparentIndex = ext.Bytes[3];
+                }
+            }
+            else if (ext.Function == APPLICATION_EXT_FUNC_CODE && ext.ByteCount >= 11 &&
+                     std::memcmp(ext.Bytes, "NETSCAPE2.0", 11) == 0)
+            {
+                this->_looping = true;
+            }
+        }
+        this->_frameDelayCs.push_back(delayCs);
+        this->_frameDisposal.push_back(disposal);
+        this->_frameTransparentIndex.push_back(transparentIndex);
+
+        this->_frameCount = static_cast<uint32_t>(gif->ImageCount);
+    }
+
+    size_t rasterBytes = static_cast<size_t>(gif->Image.Width) * gif->Image.Height;
+    if (localColorMap != nullptr)
+    {
+        rasterBytes += static_cast<size_t>(localColorMap->ColorCount) * sizeof(GifColorType);
+    }
+    this->_rasterBytes.fetch_add(rasterBytes, std::memory_order_relaxed);
+
+    this->_frameAvailable.notify_all();
+    return true;
+}
+
+SavedImage GifDecoder::Impl::GetSavedImage(uint32_t frameIndex)
+{
+    std::lock_guard<std::mutex> lock(this->_gifMutex);
+    return this->_gif->SavedImages[frameIndex];
+}
+
+GifDecoder::Impl::FrameControl GifDecoder::Impl::GetFrameControl(uint32_t frameIndex)
+{
+    std::lock_guard<std::mutex> lock(this->_gifMutex);
+    FrameControl control;
+    const int32_t delayCs = this->_frameDelayCs[frameIndex];
+    // Without a control block use 10ms (GIF standard minimum); otherwise apply the minimum
+    const uint32_t minDelayMs = this->_minFrameDelayMs.load();
+    control.delayMs =
+        (delayCs < 0) ? 10 : std::max(static_cast<uint32_t>(delayCs) * 10, minDelayMs);
+    control.disposal = this->_frameDisposal[frameIndex];
+    control.transparentIndex = this->_frameTransparentIndex[frameIndex];
+    return control;
 }
 
 void GifDecoder::Impl::WaitForSlurp()
@@ -351,104 +1419,247 @@ void GifDecoder::Impl::WaitForSlurp()
     }
 }
 
-void GifDecoder::Impl::EnsureFrameDecoded(uint32_t frameIndex)
+void GifDecoder::Impl::StopLoading()
 {
-    // Wait for background slurp to complete
+    // Unblock a loader waiting on network bytes, then join it
+    this->_cancelLoad = true;
+    if (this->_stream)
+    {
+        this->_stream->WakeReaders();
+    }
     this->WaitForSlurp();
+    this->_cancelLoad = false;
+}
+
+void GifDecoder::Impl::WaitForLoad()
+{
+    std::unique_lock<std::mutex> lock(this->_gifMutex);
+    this->_frameAvailable.wait(lock, [this]() { return !this->_loadInProgress; });
+}
+
+bool GifDecoder::Impl::WaitForFrame(uint32_t frameIndex)
+{
+    std::unique_lock<std::mutex> lock(this->_gifMutex);
+    this->_frameAvailable.wait(
+        lock, [this, frameIndex]()
+        { return frameIndex < this->_frameCount || !this->_loadInProgress; });
+    return frameIndex < this->_frameCount;
+}
 
-    if (this->_slurpFailed || !this->_gif)
+void GifDecoder::Impl::EnsureFrameDecoded(uint32_t frameIndex)
+{
+    // Wait until the frame's records have been read (progressive loads publish them one by one)
+    if (!this->WaitForFrame(frameIndex))
     {
         return;
     }
 
-    if (frameIndex >= this->_frameCount || this->_frameDecoded[frameIndex])
+    // Frames compose on top of each other, so they are decoded in order. Everything below
+    // the frontier has been composed; the canvas holds the frame just below it.
+    std::unique_lock<std::mutex> lock(this->_decodeMutex, std::defer_lock);
+    {
+        GIFBOLT_TRACE_SPAN("WaitDecodeMutex", this->_decoderId, frameIndex);
+        LockForRequest(lock);
+    }
+    if (frameIndex < this->_decodedFrontier)
     {
         return;
     }
 
-    // Decode frames in parallel batches
-    // We need to decode sequentially due to frame composition (each frame depends on previous)
-    // BUT we can decode multiple frames ahead in parallel once dependencies are met
-    std::lock_guard<std::mutex> lock(this->_decodeMutex);
+    // The canvas is released by TrimMemory(TrimLevel::Composition)
+    const size_t canvasPixels = static_cast<size_t>(this->_width) * this->_height;
+    if (this->_canvas.size() != canvasPixels)
+    {
+        this->_canvas.assign(canvasPixels, 0x00000000);
+    }
 
-    // Sequential decode up to requested frame (required for correct composition)
-    for (uint32_t i = 0; i <= frameIndex; ++i)
+    // Sequential decode up to requested frame (required for correct composition). Frames
+    // early in a long catch-up are not kept: they would only push the later ones out.
+    while (this->_decodedFrontier <= frameIndex)
     {
-        if (!this->_frameDecoded[i])
-        {
-            this->DecodeFrame(this->_gif, i);
-            this->_frameDecoded[i] = true;
-        }
+        this->ComposeNextFrame(frameIndex - this->_decodedFrontier < COMPOSED_FRAME_SLOTS);
     }
 
-    // Opportunistic background decode: submit next few frames to thread pool
+    // Opportunistic background decode of the next few frames
     // This only helps for sequential access patterns (common in GIF playback)
-    constexpr uint32_t OPPORTUNISTIC_AHEAD = 3;
-    for (uint32_t ahead = 1;
-         ahead <= OPPORTUNISTIC_AHEAD && (frameIndex + ahead) < this->_frameCount; ++ahead)
+    const uint32_t target = std::min(frameIndex + 1 + OPPORTUNISTIC_AHEAD,
+                                     static_cast<uint32_t>(this->_frameCount));
+    if (this->_threadPool && target > this->_decodedFrontier &&
+        target > this->_opportunisticTarget)
     {
-        uint32_t nextFrame = frameIndex + ahead;
-        if (!this->_frameDecoded[nextFrame] && this->_threadPool)
-        {
-            // Check if all previous frames are decoded (dependency check)
-            bool canDecode = true;
-            for (uint32_t dep = 0; dep < nextFrame; ++dep)
+        this->_opportunisticTarget = target;
+        const uint32_t generation = this->_compositionGeneration;
+        GIFBOLT_TRACE_INSTANT("QueueOpportunisticDecode", this->_decoderId, target - 1);
+        GIFBOLT_PROBE3(prefetch_issue, this->_decoderId, target - 1, 1);
+        this->_threadPool->Post(
+            [this, target, generation]()
             {
-                if (!this->_frameDecoded[dep])
+                // One frame per lock, so the owning thread never waits for the whole batch
+                for (;;)
                 {
-                    canDecode = false;
-                    break;
+                    std::unique_lock<std::mutex> decodeLock(this->_decodeMutex, std::defer_lock);
+                    {
+                        GIFBOLT_TRACE_SPAN("WaitDecodeMutex", this->_decoderId, Trace::NO_FRAME);
+                        decodeLock.lock();
+                    }
+                    // Composition may have been reset since this task was queued
+                    if (this->_compositionGeneration != generation ||
+                        this->_decodedFrontier >= target)
+                    {
+                        return;
+                    }
+                    this->ComposeNextFrame(true);
                 }
-            }
+            });
+    }
+}
 
-            if (canDecode)
-            {
-                // Submit to thread pool - will execute when worker is available
-                this->_threadPool->Enqueue(
-                    [this, nextFrame]()
-                    {
-                        std::lock_guard<std::mutex> decodeLock(this->_decodeMutex);
-                        if (!this->_frameDecoded[nextFrame])
-                        {
-                            this->DecodeFrame(this->_gif, nextFrame);
-                            this->_frameDecoded[nextFrame] = true;
-                        }
-                    });
-            }
+void GifDecoder::Impl::ComposeNextFrame(bool keep)
+{
+    const uint32_t frameIndex = this->_decodedFrontier;
+    this->DecodeFrame(this->_gif, frameIndex);
+    ++this->_decodedFrontier;
+    if (!keep)
+    {
+        return;
+    }
+
+    // With a pool, up to OPPORTUNISTIC_AHEAD frames are composed ahead of the one requested.
+    // The ring is sized for them at once, rather than whenever background work happens to
+    // get further ahead, so that warmed-up playback does not allocate.
+    const size_t bufferCapacity =
+        Memory::BufferPool<uint32_t>::GetAcquireCapacity(this->_canvas.size());
+    if (this->_composedFrames.empty())
+    {
+        this->_composedFrames.reserve(COMPOSED_FRAME_SLOTS);
+        this->_composedFrames.resize(this->_threadPool ? OPPORTUNISTIC_AHEAD + 2 : 1);
+        for (ComposedFrame& composed : this->_composedFrames)
+        {
+            composed.pixels.reserve(bufferCapacity);
+        }
+    }
+
+    // The next frame composes over the canvas, so the result is copied while it is current.
+    // Frames are composed in order: a full ring gives up its lowest frame, which playback
+    // has passed or skipped.
+    ComposedFrame* target = &this->_composedFrames.front();
+    for (ComposedFrame& composed : this->_composedFrames)
+    {
+        if (composed.frameIndex == LruIndex::NONE)
+        {
+            target = &composed;
+            break;
+        }
+        if (composed.frameIndex < target->frameIndex)
+        {
+            target = &composed;
         }
     }
+    if (target->frameIndex != LruIndex::NONE &&
+        this->_composedFrames.size() < COMPOSED_FRAME_SLOTS)
+    {
+        target = &this->_composedFrames.emplace_back();
+    }
+    if (target->pixels.capacity() < this->_canvas.size())
+    {
+        // Sized like _pixelPool buffers, which reach the pool through _frameCache
+        std::vector<uint32_t>().swap(target->pixels);
+        target->pixels.reserve(bufferCapacity);
+    }
+    target->frameIndex = frameIndex;
+    target->alpha =
+        this->_canvasTransparentPixels == 0 ? FrameAlpha::Opaque : FrameAlpha::Binary;
+    target->pixels.assign(this->_canvas.begin(), this->_canvas.end());
 }
 
-GifFrame& GifDecoder::Impl::GetOrDecodeFrame(uint32_t frameIndex)
+bool GifDecoder::Impl::TakeComposedFrame(uint32_t frameIndex, GifFrame& frame)
 {
-    // Check if frame is already in cache
-    for (size_t i = 0; i < this->_cachedFrameIndices.size(); ++i)
+    for (ComposedFrame& composed : this->_composedFrames)
     {
-        if (this->_cachedFrameIndices[i] == frameIndex)
+        if (composed.frameIndex == frameIndex)
         {
-            // Move to end (most recently used)
-            std::rotate(this->_cachedFrameIndices.begin() + i,
-                       this->_cachedFrameIndices.begin() + i + 1,
-                       this->_cachedFrameIndices.end());
-            std::rotate(this->_frameCache.begin() + i,
-                       this->_frameCache.begin() + i + 1,
-                       this->_frameCache.end());
-            return this->_frameCache.back();
+            frame.pixels.swap(composed.pixels);
+            frame.alpha = composed.alpha;
+            composed.frameIndex = LruIndex::NONE;
+            return true;
         }
     }
+    return false;
+}
+
+GifFrame& GifDecoder::Impl::GetOrDecodeFrame(uint32_t frameIndex)
+{
+    // Check if frame is already in cache (marks it most recently used)
+    const uint32_t cachedSlot = this->_frameCacheIndex.Find(frameIndex);
+    if (cachedSlot != LruIndex::NONE)
+    {
+        this->Count(FrameCacheHits);
+        GIFBOLT_PROBE3(cache_hit, this->_decoderId, 0, frameIndex);
+        return this->_frameCache[cachedSlot];
+    }
+    this->Count(FrameCacheMisses);
+    GIFBOLT_PROBE3(cache_miss, this->_decoderId, 0, frameIndex);
 
     // Frame not in cache - need to decode it
     // First ensure frame is decoded to get raw pixel data
     this->EnsureFrameDecoded(frameIndex);
 
-    // Create or get the frame from the full decode buffer
-    GifFrame newFrame;
-    if (frameIndex < this->_frameDecoded.size() && this->_frameDecoded[frameIndex])
+    // Drop surplus entries if the cache limit was lowered
+    while (this->_frameCacheIndex.GetSlotCount() > this->MAX_CACHED_FRAMES)
+    {
+        const uint32_t evictedFrame = this->_frameCacheIndex.RemoveLastSlot();
+        this->_pixelPool.Release(std::move(this->_frameCache.back().pixels));
+        this->_frameCache.pop_back();
+        if (evictedFrame != LruIndex::NONE)
+        {
+            this->Count(FrameCacheEvictions);
+            GIFBOLT_PROBE3(cache_evict, this->_decoderId, 0, evictedFrame);
+        }
+    }
+
+    // A full cache hands back its least recently used slot, whose pixel buffer is reused
+    // instead of freed and reallocated
+    uint32_t evictedFrame = LruIndex::NONE;
+    const uint32_t slot =
+        this->_frameCacheIndex.Insert(frameIndex, this->MAX_CACHED_FRAMES, &evictedFrame);
+    if (slot == this->_frameCache.size())
+    {
+        this->_frameCache.emplace_back();
+    }
+    else if (evictedFrame != LruIndex::NONE)
     {
-        // Frame was decoded - get it from the GIF structure
-        SavedImage* image = &this->_gif->SavedImages[frameIndex];
+        this->Count(FrameCacheEvictions);
+        GIFBOLT_PROBE3(cache_evict, this->_decoderId, 0, evictedFrame);
+    }
 
-        // Copy pixel data (assuming it was already set in EnsureFrameDecoded)
+    // Take the frame's pixels as they were when it was composed, here or in the background;
+    // the slot's old buffer goes to the ring for reuse
+    GifFrame& newFrame = this->_frameCache[slot];
+    const size_t canvasPixels = static_cast<size_t>(this->_width) * this->_height;
+    if (newFrame.pixels.capacity() < canvasPixels)
+    {
+        this->_pixelPool.Release(std::move(newFrame.pixels));
+        newFrame.pixels = this->_pixelPool.Acquire(canvasPixels);
+    }
+    bool decoded = false;
+    {
+        std::unique_lock<std::mutex> lock(this->_decodeMutex, std::defer_lock);
+        LockForRequest(lock);
+        decoded = this->TakeComposedFrame(frameIndex, newFrame);
+        if (!decoded && frameIndex < this->_decodedFrontier)
+        {
+            // Composed earlier and no longer held: only a new pass from frame 0 rebuilds it
+            this->_canvas.assign(canvasPixels, 0x00000000);
+            this->ResetComposition();
+            while (this->_decodedFrontier <= frameIndex)
+            {
+                this->ComposeNextFrame(this->_decodedFrontier == frameIndex);
+            }
+            decoded = this->TakeComposedFrame(frameIndex, newFrame);
+        }
+    }
+    if (decoded)
+    {
         newFrame.width = this->_width;      // Full canvas width for composed frame
         newFrame.height = this->_height;    // Full canvas height for composed frame
         newFrame.offsetX = 0;               // Composed frame is already on full canvas
@@ -456,160 +1667,500 @@ GifFrame& GifDecoder::Impl::GetOrDecodeFrame(uint32_t frameIndex)
         newFrame.transparentIndex = -1;
         newFrame.disposal = DisposalMethod::None;
 
-        // Get the actual frame delay from the GIF extension data
-        newFrame.delayMs = 10;  // Default fallback: 10ms (GIF standard minimum)
-        if (image->ExtensionBlockCount > 0)
+        // Frame delay parsed from the graphics control extension when the frame was read
+        newFrame.delayMs = this->GetFrameControl(frameIndex).delayMs;
+    }
+    else
+    {
+        this->_pixelPool.Release(std::move(newFrame.pixels));
+        newFrame = GifFrame();
+    }
+
+    return newFrame;
+}
+
+void GifDecoder::Impl::ConvertFramePixels(uint32_t frameIndex, const uint8_t* source,
+                                          uint8_t* dest, size_t pixelCount, FrameAlpha alpha)
+{
+    const bool swizzleOnly = alpha != FrameAlpha::Translucent;
+    const ScopedWorkTimer timer = this->TimeWork(ConvertTimeNs, ConvertStage, frameIndex);
+    this->Count(FramesConverted);
+
+    const size_t poolWorkers = this->_threadPool ? this->_threadPool->GetThreadCount() : 0;
+    const size_t workers =
+        std::min(poolWorkers, static_cast<size_t>(std::max(1u, this->_convertThreads) - 1));
+    if (pixelCount < this->_convertParallelMinPixels || workers == 0)
+    {
+        if (swizzleOnly)
         {
-            for (int i = 0; i < image->ExtensionBlockCount; ++i)
-            {
-                if (image->ExtensionBlocks[i].Function == GRAPHICS_EXT_FUNC_CODE &&
-                    image->ExtensionBlocks[i].ByteCount >= 4)
-                {
-                    int delay = (image->ExtensionBlocks[i].Bytes[2] << 8) | image->ExtensionBlocks[i].Bytes[1];
-                    newFrame.delayMs = std::max(delay * 10, static_cast<int>(this->_minFrameDelayMs));
-                    break;
-                }
-            }
+            Renderer::PixelFormats::SwizzleRGBAToBGRAChunk(source, dest, 0, pixelCount);
+        }
+        else
+        {
+            Renderer::PixelFormats::ConvertRGBAToBGRAPremultipliedChunk(source, dest, 0,
+                                                                        pixelCount);
         }
+        return;
+    }
 
-        // Deep copy the pixel data from _canvas to prevent stale data on loop
-        // _canvas is reused across frame compositions, so we must copy the data
-        newFrame.pixels = std::vector<uint32_t>(this->_canvas.begin(), this->_canvas.end());
+    // Pool workers convert chunks 1..N while this thread converts chunk 0
+    ConversionBatch& batch = this->_conversion;
+    {
+        std::lock_guard<std::mutex> lock(batch.mutex);
+        batch.source = source;
+        batch.dest = dest;
+        batch.pixelCount = pixelCount;
+        batch.chunkCount = workers + 1;
+        batch.swizzleOnly = swizzleOnly;
+        batch.pending = workers;
+    }
+    for (size_t chunk = 1; chunk <= workers; ++chunk)
+    {
+        if (!this->_threadPool->Post([this, chunk]() { this->ConvertChunk(chunk); }))
+        {
+            this->ConvertChunk(chunk);
+        }
     }
+    this->ConvertChunk(0);
 
-    // Add to cache
-    this->_frameCache.push_back(newFrame);
-    this->_cachedFrameIndices.push_back(frameIndex);
+    std::unique_lock<std::mutex> lock(batch.mutex);
+    batch.done.wait(lock, [&batch]() { return batch.pending == 0; });
+}
 
-    // Evict least recently used if cache is full
-    if (this->_cachedFrameIndices.size() > this->MAX_CACHED_FRAMES)
+void GifDecoder::Impl::ConvertChunk(size_t chunk)
+{
+    ConversionBatch& batch = this->_conversion;
+    const size_t startPixel = batch.pixelCount * chunk / batch.chunkCount;
+    const size_t endPixel = batch.pixelCount * (chunk + 1) / batch.chunkCount;
+    const auto convert = batch.swizzleOnly
+                             ? Renderer::PixelFormats::SwizzleRGBAToBGRAChunk
+                             : Renderer::PixelFormats::ConvertRGBAToBGRAPremultipliedChunk;
+    if (chunk == 0)
     {
-        this->_frameCache.erase(this->_frameCache.begin());
-        this->_cachedFrameIndices.erase(this->_cachedFrameIndices.begin());
+        // The calling thread's time is covered by ConvertFramePixels
+        convert(batch.source, batch.dest, startPixel, endPixel);
+        return;
     }
 
-    return this->_frameCache.back();
+    GIFBOLT_TRACE_SPAN("ConvertChunk", this->_decoderId, Trace::NO_FRAME);
+    const uint64_t cpuStart = GetThreadCpuTimeNs();
+    convert(batch.source, batch.dest, startPixel, endPixel);
+    this->Count(ThreadCpuTimeNs, GetThreadCpuTimeNs() - cpuStart);
+
+    std::lock_guard<std::mutex> lock(batch.mutex);
+    if (--batch.pending == 0)
+    {
+        batch.done.notify_one();
+    }
 }
 
-void GifDecoder::Impl::DecodeFrame(GifFileType* gif, uint32_t frameIndex)
+const std::vector<GifDecoder::Impl::MipLevel>* GifDecoder::Impl::FindMipChain(uint32_t frameIndex)
+{
+    const uint32_t slot = this->_mipCacheIndex.Find(frameIndex);
+    if (slot == LruIndex::NONE)
+    {
+        this->Count(MipCacheMisses);
+        GIFBOLT_PROBE3(cache_miss, this->_decoderId, 1, frameIndex);
+        return nullptr;
+    }
+    this->Count(MipCacheHits);
+    GIFBOLT_PROBE3(cache_hit, this->_decoderId, 1, frameIndex);
+    return &this->_mipCache[slot];
+}
+
+const std::vector<GifDecoder::Impl::MipLevel>& GifDecoder::Impl::BuildMipChain(
+    uint32_t frameIndex, const uint8_t* baseBGRA, uint32_t width, uint32_t height, bool opaque)
 {
-    SavedImage* image = &gif->SavedImages[frameIndex];
-    GifImageDesc* desc = &image->ImageDesc;
+    GIFBOLT_TRACE_SPAN("BuildMipChain", this->_decoderId, frameIndex);
+    const ScopedWorkTimer timer = this->TimeWork(ScaleTimeNs, ScaleStage, frameIndex);
 
-    GifFrame frame;
-    frame.width = desc->Width;
-    frame.height = desc->Height;
-    frame.offsetX = desc->Left;
-    frame.offsetY = desc->Top;
-    frame.delayMs = 10;  // Default delay: 10ms (GIF standard minimum)
-    frame.disposal = DisposalMethod::None;
-    frame.transparentIndex = -1;  // No transparency by default
+    // Bounded like the frame cache; drop surplus chains if the limit was lowered
+    while (this->_mipCacheIndex.GetSlotCount() > this->MAX_CACHED_FRAMES)
+    {
+        const uint32_t evictedFrame = this->_mipCacheIndex.RemoveLastSlot();
+        this->_spareMipChains.push_back(std::move(this->_mipCache.back()));
+        this->_mipCache.pop_back();
+        this->Count(MipCacheEvictions);
+        GIFBOLT_PROBE3(cache_evict, this->_decoderId, 1, evictedFrame);
+    }
 
-    // Get delay, disposal method, and transparency info from graphics control extension
-    for (int i = 0; i < image->ExtensionBlockCount; ++i)
+    // Rebuild into the evicted chain's storage, or a spare one, so that it does not allocate
+    uint32_t evictedFrame = LruIndex::NONE;
+    const uint32_t slot =
+        this->_mipCacheIndex.Insert(frameIndex, this->MAX_CACHED_FRAMES, &evictedFrame);
+    if (slot == this->_mipCache.size())
     {
-        ExtensionBlock* ext = &image->ExtensionBlocks[i];
-        if (ext->Function == GRAPHICS_EXT_FUNC_CODE && ext->ByteCount >= 4)
+        this->_mipCache.emplace_back();
+        if (!this->_spareMipChains.empty())
         {
-            // Packed field: bits 2-4 = disposal method, bit 0 = transparent color flag
-            uint8_t packed = ext->Bytes[0];
-            frame.disposal = static_cast<DisposalMethod>((packed >> 2) & 0x07);
+            this->_mipCache.back() = std::move(this->_spareMipChains.back());
+            this->_spareMipChains.pop_back();
+        }
+    }
+    else
+    {
+        this->Count(MipCacheEvictions);
+        GIFBOLT_PROBE3(cache_evict, this->_decoderId, 1, evictedFrame);
+    }
+    std::vector<MipLevel>& chain = this->_mipCache[slot];
 
-            int delay = (ext->Bytes[2] << 8) | ext->Bytes[1];
-            frame.delayMs =
-                std::max(delay * 10, static_cast<int>(_minFrameDelayMs));  // Minimum configurable
+    // Each level halves the previous one until a 1x1 level is reached (~1.33x total memory)
+    size_t levelCount = 0;
+    uint32_t levelWidth = width;
+    uint32_t levelHeight = height;
+    while (true)
+    {
+        if (chain.size() == levelCount)
+        {
+            chain.emplace_back();
+        }
+        MipLevel& level = chain[levelCount];
+        level.width = levelWidth;
+        level.height = levelHeight;
+        level.pixels.resize(static_cast<size_t>(levelWidth) * levelHeight * 4);
+        if (levelCount == 0)
+        {
+            std::copy(baseBGRA, baseBGRA + level.pixels.size(), level.pixels.begin());
+        }
+        else
+        {
+            const MipLevel& previous = chain[levelCount - 1];
+            Kernels::DownsampleBox2x(previous.pixels.data(), previous.width,
+                                     previous.height, level.pixels.data(), level.width,
+                                     level.height, opaque);
+        }
+        ++levelCount;
 
-            // Check transparency flag (bit 0 of packed field)
-            if (packed & 0x01)
-            {
-                frame.transparentIndex = ext->Bytes[3];
-            }
+        if (levelWidth == 1 && levelHeight == 1)
+        {
             break;
         }
+        levelWidth = std::max(1u, levelWidth / 2);
+        levelHeight = std::max(1u, levelHeight / 2);
     }
+    chain.resize(levelCount);
+    return chain;
+}
 
-    // Decode pixel data
-    ColorMapObject* colorMap = desc->ColorMap ? desc->ColorMap : gif->SColorMap;
-    const size_t pixelCount = desc->Width * desc->Height;
-    frame.pixels.reserve(pixelCount);  // Pre-allocate to avoid reallocation
-    frame.pixels.resize(pixelCount);
+void GifDecoder::Impl::ResetComposition()
+{
+    this->_previousDisposal = DisposalMethod::None;
+    this->_previousCanvas.clear();
+    // Composition restarts from a cleared canvas
+    this->_canvasTransparentPixels = static_cast<size_t>(this->_width) * this->_height;
+    this->_previousCanvasTransparentPixels = 0;
+    this->_prevFrameWidth = 0;
+    this->_prevFrameHeight = 0;
+    this->_prevFrameOffsetX = 0;
+    this->_prevFrameOffsetY = 0;
+    this->_decodedFrontier = 0;
+    this->_opportunisticTarget = 0;
+    ++this->_compositionGeneration;
+    // Frames composed ahead belong to the abandoned pass; their buffers are reused
+    for (ComposedFrame& composed : this->_composedFrames)
+    {
+        composed.frameIndex = LruIndex::NONE;
+    }
+}
 
-    ApplyColorMap(image->RasterBits, colorMap, frame.pixels, desc->Width, desc->Height,
-                  frame.transparentIndex);
+size_t GifDecoder::Impl::TrimMemory(TrimLevel level)
+{
+    size_t freed = ReleaseBuffer(this->_bgraPremultipliedCache) + ReleaseBuffer(this->_scaledCache);
+    this->_sharedView.Reset();
+    for (std::vector<MipLevel>& chain : this->_mipCache)
+    {
+        for (MipLevel& mip : chain)
+        {
+            freed += ReleaseBuffer(mip.pixels);
+        }
+    }
+    for (std::vector<MipLevel>& chain : this->_spareMipChains)
+    {
+        for (MipLevel& mip : chain)
+        {
+            freed += ReleaseBuffer(mip.pixels);
+        }
+    }
+    this->_mipCache.clear();
+    this->_mipCacheIndex.Clear();
+    this->_spareMipChains.clear();
 
-    // Compose frame onto canvas for this frame
-    ComposeFrame(frame, _canvas);
+    if (level >= TrimLevel::ColdFrames && !this->_frameCache.empty())
+    {
+        // Keep the most recently used frame: GetFrame() handed out a reference to it
+        const uint32_t keptSlot = (level >= TrimLevel::Composition)
+                                      ? LruIndex::NONE
+                                      : this->_frameCacheIndex.GetMostRecentSlot();
+        for (uint32_t slot = 0; slot < this->_frameCache.size(); ++slot)
+        {
+            if (slot != keptSlot)
+            {
+                freed += ReleaseBuffer(this->_frameCache[slot].pixels);
+            }
+        }
 
-    // Store the composed frame result as the final frame pixels
-    GifFrame composedFrame = frame;
-    composedFrame.width = _width;
-    composedFrame.height = _height;
-    composedFrame.offsetX = 0;
-    composedFrame.offsetY = 0;
-    // Move canvas to avoid copying millions of pixels
-    composedFrame.pixels = _canvas;  // Still copy here for composition continuity
+        if (keptSlot == LruIndex::NONE)
+        {
+            this->_frameCache.clear();
+            this->_frameCacheIndex.Clear();
+        }
+        else
+        {
+            // The kept frame stays in its slot, so the reference stays valid; the emptied
+            // slots are refilled before any frame is evicted
+            this->_frameCacheIndex.RetainOnly(keptSlot);
+        }
+    }
+    if (level >= TrimLevel::ColdFrames)
+    {
+        // Frames composed ahead are rebuilt on demand like cached ones
+        std::lock_guard<std::mutex> lock(this->_decodeMutex);
+        for (ComposedFrame& composed : this->_composedFrames)
+        {
+            freed += ReleaseBuffer(composed.pixels);
+        }
+        this->_composedFrames.clear();
+    }
 
-    // Note: We don't store in _frames anymore - that's handled by GetOrDecodeFrame in the cache
+    if (level >= TrimLevel::Composition)
+    {
+        std::lock_guard<std::mutex> lock(this->_decodeMutex);
+        // Without the canvases every frame has to be recomposed from frame 0
+        freed += ReleaseBuffer(this->_canvas) + ReleaseBuffer(this->_previousCanvas);
+        this->ResetComposition();
+    }
+
+    if (level >= TrimLevel::Complete)
+    {
+        freed += this->_framePool.Release();
+        freed += this->_pixelPool.Trim();
+        {
+            // Pool tasks and the prefetch thread decode into the arena under _decodeMutex only
+            std::lock_guard<std::mutex> lock(this->_decodeMutex);
+            freed += this->_tempArena.GetReservedBytes();
+            this->_tempArena.Reset();
+        }
+        freed += ReleaseBuffer(this->_frameCache) + this->_frameCacheIndex.Release();
+        freed += ReleaseBuffer(this->_mipCache) + this->_mipCacheIndex.Release();
+        freed += ReleaseBuffer(this->_spareMipChains);
+    }
+
+    return freed;
 }
 
-void GifDecoder::Impl::ApplyColorMap(const GifByteType* raster, const ColorMapObject* colorMap,
-                                     std::vector<uint32_t>& pixels, int width, int height,
-                                     int transparentIndex)
+DecoderStats GifDecoder::Impl::GetStats()
 {
-    for (int i = 0; i < width * height; ++i)
-    {
-        int colorIndex = raster[i];
+    // The byte counts walk caches that a frame-producing thread may be changing
+    std::lock_guard<std::mutex> frameLock(this->_frameMutex);
+    DecoderStats stats;
+    stats.frameCacheHits = this->GetCounter(FrameCacheHits);
+    stats.frameCacheMisses = this->GetCounter(FrameCacheMisses);
+    stats.frameCacheEvictions = this->GetCounter(FrameCacheEvictions);
+    stats.mipCacheHits = this->GetCounter(MipCacheHits);
+    stats.mipCacheMisses = this->GetCounter(MipCacheMisses);
+    stats.mipCacheEvictions = this->GetCounter(MipCacheEvictions);
+    stats.framesDecoded = this->GetCounter(FramesDecoded);
+    stats.framesComposed = this->GetCounter(FramesComposed);
+    stats.framesConverted = this->GetCounter(FramesConverted);
+    stats.framesScaled = this->GetCounter(FramesScaled);
+    stats.lzwTimeNs = this->GetCounter(LzwTimeNs);
+    stats.composeTimeNs = this->GetCounter(ComposeTimeNs);
+    stats.convertTimeNs = this->GetCounter(ConvertTimeNs);
+    stats.scaleTimeNs = this->GetCounter(ScaleTimeNs);
+    stats.threadCpuTimeNs = this->GetCounter(ThreadCpuTimeNs);
+    stats.rasterBytes = this->_rasterBytes.load(std::memory_order_relaxed);
 
-        // Check if this pixel is transparent
-        if (transparentIndex >= 0 && colorIndex == transparentIndex)
+    {
+        // Background decodes grow the canvases and the arena
+        std::lock_guard<std::mutex> lock(this->_decodeMutex);
+        stats.canvasBytes =
+            (this->_canvas.capacity() + this->_previousCanvas.capacity()) * sizeof(uint32_t);
+        stats.poolBytes = this->_tempArena.GetReservedBytes();
+        for (const ComposedFrame& composed : this->_composedFrames)
         {
-            pixels[i] = 0x00000000;  // Fully transparent
+            stats.canvasBytes += composed.pixels.capacity() * sizeof(uint32_t);
         }
-        else if (colorMap && colorIndex < colorMap->ColorCount)
+    }
+
+    stats.cacheBytes = this->_bgraPremultipliedCache.capacity() + this->_scaledCache.capacity();
+    for (const GifFrame& frame : this->_frameCache)
+    {
+        stats.frameCacheBytes += frame.pixels.capacity() * sizeof(uint32_t);
+    }
+    stats.cacheBytes += stats.frameCacheBytes;
+    for (const std::vector<MipLevel>& chain : this->_mipCache)
+    {
+        for (const MipLevel& level : chain)
         {
-            const GifColorType& color = colorMap->Colors[colorIndex];
-            // Convert to RGBA32 format: 0xAABBGGRR (little-endian ABGR in memory = RGBA)
-            pixels[i] = 0xFF000000 | (color.Blue << 16) | (color.Green << 8) | color.Red;
+            stats.cacheBytes += level.pixels.capacity();
         }
-        else
+    }
+
+    stats.poolBytes += this->_pixelPool.GetPooledBytes() + this->_framePool.GetCapacity();
+    for (const std::vector<MipLevel>& chain : this->_spareMipChains)
+    {
+        for (const MipLevel& level : chain)
         {
-            pixels[i] = 0xFF000000;  // Opaque black
+            stats.poolBytes += level.pixels.capacity();
         }
     }
+    return stats;
 }
 
-void GifDecoder::Impl::ComposeFrame(const GifFrame& frame, std::vector<uint32_t>& canvas)
+void GifDecoder::Impl::RecordFramePresented(uint32_t frameIndex, uint64_t latenessNs,
+                                            uint32_t droppedFrames)
 {
-    // Handle disposal method from previous frame BEFORE compositing new frame
-    if (_previousDisposal == DisposalMethod::RestoreBackground)
+    std::lock_guard<std::mutex> playbackLock(this->_playbackMutex);
+    PlaybackStats& playback = this->_playback;
+    ++playback.framesPresented;
+    playback.framesDropped += droppedFrames;
+    playback.totalLatenessNs += latenessNs;
+    playback.maxLatenessNs = std::max(playback.maxLatenessNs, latenessNs);
+    ++playback.latenessHistogram[GetLatenessBucket(latenessNs)];
+    if (droppedFrames > 0)
     {
-        // Clear only the area of the previous frame to TRANSPARENT to avoid color bleed
-        // (UI composes over app background; GIF logical background color can cause fringing)
-        for (uint32_t y = 0; y < _prevFrameHeight; ++y)
+        GIFBOLT_TRACE_INSTANT("DroppedFrames", this->_decoderId, frameIndex);
+    }
+    if (latenessNs <= LATE_FRAME_TOLERANCE_NS)
+    {
+        return;
+    }
+    ++playback.framesLate;
+
+    // Charge the frame to the largest part of its lateness. Whatever the request for the
+    // frame does not explain happened before it, while the tick was waiting to run.
+    LateFrameCause cause = LateFrameCause::Schedule;
+    RequestTimings request;
+    {
+        std::lock_guard<std::mutex> lock(this->_lastRequestMutex);
+        request = this->_lastRequest;
+    }
+    if (request.frameIndex == frameIndex)
+    {
+        const uint64_t requestNs = request.decodeNs + request.lockWaitNs + request.convertNs;
+        uint64_t largestNs = latenessNs > requestNs ? latenessNs - requestNs : 0;
+        const std::pair<uint64_t, LateFrameCause> parts[] = {
+            {request.decodeNs, LateFrameCause::DecodeNotReady},
+            {request.convertNs, LateFrameCause::Conversion},
+            {request.lockWaitNs, LateFrameCause::LockWait}};
+        for (const auto& part : parts)
         {
-            uint32_t canvasY = _prevFrameOffsetY + y;
-            if (canvasY >= _height)
+            if (part.first > largestNs)
             {
-                continue;
-            }
-            for (uint32_t x = 0; x < _prevFrameWidth; ++x)
-            {
-                uint32_t canvasX = _prevFrameOffsetX + x;
-                if (canvasX >= _width)
-                {
-                    continue;
-                }
-                uint32_t canvasIndex = canvasY * _width + canvasX;
-                canvas[canvasIndex] = 0x00000000;  // fully transparent
+                largestNs = part.first;
+                cause = part.second;
             }
         }
     }
+
+    const uint64_t nowNs = Trace::NowNs();
+    const uint64_t dueNs = nowNs > latenessNs ? nowNs - latenessNs : 0;
+    switch (cause)
+    {
+        case LateFrameCause::Schedule:
+            ++playback.lateSchedule;
+            GIFBOLT_TRACE_COMPLETE("LateFrame:Schedule", dueNs, nowNs, this->_decoderId,
+                                   frameIndex);
+            break;
+        case LateFrameCause::DecodeNotReady:
+            ++playback.lateDecodeNotReady;
+            GIFBOLT_TRACE_COMPLETE("LateFrame:DecodeNotReady", dueNs, nowNs, this->_decoderId,
+                                   frameIndex);
+            break;
+        case LateFrameCause::Conversion:
+            ++playback.lateConversion;
+            GIFBOLT_TRACE_COMPLETE("LateFrame:Conversion", dueNs, nowNs, this->_decoderId,
+                                   frameIndex);
+            break;
+        case LateFrameCause::LockWait:
+            ++playback.lateLockWait;
+            GIFBOLT_TRACE_COMPLETE("LateFrame:LockWait", dueNs, nowNs, this->_decoderId,
+                                   frameIndex);
+            break;
+    }
+    GIFBOLT_PROBE4(deadline_miss, this->_decoderId, frameIndex,
+                   frameIndex < this->_frameCount ? this->GetFrameControl(frameIndex).delayMs : 0,
+                   latenessNs);
+}
+
+void GifDecoder::Impl::DecodeFrame(GifFileType* gif, uint32_t frameIndex)
+{
+    GIFBOLT_TRACE_SPAN("DecodeFrame", this->_decoderId, frameIndex);
+    const auto wallStart = std::chrono::steady_clock::now();
+    const uint64_t cpuStart = GetThreadCpuTimeNs();
+
+    const SavedImage savedImage = this->GetSavedImage(frameIndex);
+    const SavedImage* image = &savedImage;
+    const GifImageDesc* desc = &image->ImageDesc;
+
+    // Delay, disposal method and transparency were parsed when the frame was read
+    const FrameControl control = this->GetFrameControl(frameIndex);
+
+    GifFrame frame;
+    frame.width = desc->Width;
+    frame.height = desc->Height;
+    frame.offsetX = desc->Left;
+    frame.offsetY = desc->Top;
+    frame.delayMs = control.delayMs;
+    frame.disposal = control.disposal;
+    frame.transparentIndex = control.transparentIndex;
+
+    // Decode pixel data into the arena; it is rewound once the frame has been composed
+    ColorMapObject* colorMap = desc->ColorMap ? desc->ColorMap : gif->SColorMap;
+    const size_t pixelCount = static_cast<size_t>(desc->Width) * desc->Height;
+    auto* framePixels = static_cast<uint32_t*>(
+        this->_tempArena.Allocate(pixelCount * sizeof(uint32_t), alignof(uint32_t)));
+
+    {
+        GIFBOLT_TRACE_SPAN("ApplyColorMap", this->_decoderId, frameIndex);
+        Kernels::ApplyColorMap(image->RasterBits,
+                               colorMap ? reinterpret_cast<const uint8_t*>(colorMap->Colors)
+                                        : nullptr,
+                               colorMap ? colorMap->ColorCount : 0, framePixels, pixelCount,
+                               frame.transparentIndex);
+    }
+
+    // Compose frame onto canvas for this frame
+    {
+        GIFBOLT_TRACE_SPAN("ComposeFrame", this->_decoderId, frameIndex);
+        ComposeFrame(frame, framePixels, _canvas);
+    }
+    this->_tempArena.Rewind();
+
+    // Timed by hand rather than with ScopedWorkTimer so the duration can go to the probe
+    const uint64_t durationNs = GetElapsedNs(wallStart);
+    this->Count(FramesComposed);
+    this->Count(ComposeTimeNs, durationNs);
+    if (frameIndex == 0)
+    {
+        this->AddLoadTime(ComposeStage, durationNs);
+    }
+    this->Count(ThreadCpuTimeNs, GetThreadCpuTimeNs() - cpuStart);
+    GIFBOLT_PROBE5(frame_decode, this->_decoderId, frameIndex, frame.width, frame.height,
+                   durationNs);
+
+    // Note: We don't store in _frames anymore - that's handled by GetOrDecodeFrame in the cache
+}
+
+void GifDecoder::Impl::ComposeFrame(const GifFrame& frame, const uint32_t* framePixels,
+                                    std::vector<uint32_t>& canvas)
+{
+    // Handle disposal method from previous frame BEFORE compositing new frame
+    if (_previousDisposal == DisposalMethod::RestoreBackground)
+    {
+        // Clear only the area of the previous frame to TRANSPARENT to avoid color bleed
+        // (UI composes over app background; GIF logical background color can cause fringing)
+        _canvasTransparentPixels +=
+            Kernels::ClearRect(canvas.data(), _width, _height, _prevFrameOffsetX,
+                               _prevFrameOffsetY, _prevFrameWidth, _prevFrameHeight);
+    }
     else if (_previousDisposal == DisposalMethod::RestorePrevious)
     {
         // Restore to previous state
         if (!_previousCanvas.empty())
         {
             canvas = _previousCanvas;
+            _canvasTransparentPixels = _previousCanvasTransparentPixels;
         }
     }
     // Note: DoNotDispose and None just leave canvas as-is
@@ -618,35 +2169,14 @@ void GifDecoder::Impl::ComposeFrame(const GifFrame& frame, std::vector<uint32_t>
     if (frame.disposal == DisposalMethod::RestorePrevious)
     {
         _previousCanvas = canvas;
+        _previousCanvasTransparentPixels = _canvasTransparentPixels;
     }
 
-    // Composite current frame onto canvas
-    for (uint32_t y = 0; y < frame.height; ++y)
-    {
-        for (uint32_t x = 0; x < frame.width; ++x)
-        {
-            uint32_t canvasX = frame.offsetX + x;
-            uint32_t canvasY = frame.offsetY + y;
-
-            if (canvasX >= _width || canvasY >= _height)
-            {
-                continue;
-            }
-
-            uint32_t srcPixel = frame.pixels[y * frame.width + x];
-            uint32_t alpha = (srcPixel >> 24) & 0xFF;
-
-            // Skip fully transparent pixels - don't overwrite canvas
-            if (alpha == 0)
-            {
-                continue;
-            }
-
-            // Write pixel to canvas
-            uint32_t canvasIndex = canvasY * _width + canvasX;
-            canvas[canvasIndex] = srcPixel;
-        }
-    }
+    // Composite current frame onto canvas, counting the transparent pixels it covers so the
+    // frame's alpha class is known without another pass
+    _canvasTransparentPixels -=
+        Kernels::BlitFrame(framePixels, frame.width, frame.height, frame.offsetX, frame.offsetY,
+                           canvas.data(), _width, _height);
 
     // Update disposal method for next iteration
     _previousDisposal = frame.disposal;
@@ -682,9 +2212,112 @@ GifDecoder::GifDecoder() : _pImpl(std::make_unique<Impl>())
         _pImpl->_deviceContext = nullptr;
     }
 #endif
+
+    DecoderRegistry& registry = GetDecoderRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.decoders.push_back(this);
+}
+
+GifDecoder::~GifDecoder()
+{
+    // Keep the counters in the process totals; the memory goes away with the decoder
+    DecoderStats retired = _pImpl->GetStats();
+    retired.rasterBytes = 0;
+    retired.canvasBytes = 0;
+    retired.cacheBytes = 0;
+    retired.poolBytes = 0;
+    retired.frameCacheBytes = 0;
+
+    DecoderRegistry& registry = GetDecoderRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    AddStats(registry.retired, retired);
+    AddPlaybackStats(registry.retiredPlayback, _pImpl->GetPlaybackStats());
+    registry.decoders.erase(
+        std::remove(registry.decoders.begin(), registry.decoders.end(), this),
+        registry.decoders.end());
+}
+
+size_t GifDecoder::TrimMemory(TrimLevel level)
+{
+    std::lock_guard<std::mutex> lock(_pImpl->_frameMutex);
+    return _pImpl->TrimMemory(level);
+}
+
+size_t GifDecoder::TrimAllMemory(TrimLevel level)
+{
+    DecoderRegistry& registry = GetDecoderRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    size_t freed = 0;
+    for (GifDecoder* decoder : registry.decoders)
+    {
+        freed += decoder->TrimMemory(level);
+    }
+    return freed;
+}
+
+DecoderStats GifDecoder::GetStats() const
+{
+    return _pImpl->GetStats();
+}
+
+LoadTimings GifDecoder::GetLoadTimings() const
+{
+    auto get = [this](Impl::LoadStage stage)
+    { return _pImpl->_loadTimings[stage].load(std::memory_order_relaxed); };
+
+    LoadTimings timings;
+    timings.openNs = get(Impl::OpenStage);
+    timings.headerNs = get(Impl::HeaderStage);
+    timings.slurpNs = get(Impl::SlurpStage);
+    timings.decodeNs = get(Impl::DecodeStage);
+    timings.composeNs = get(Impl::ComposeStage);
+    timings.convertNs = get(Impl::ConvertStage);
+    timings.scaleNs = get(Impl::ScaleStage);
+    return timings;
 }
 
-GifDecoder::~GifDecoder() = default;
+void GifDecoder::RecordFramePresented(uint32_t frameIndex, uint64_t latenessNs,
+                                      uint32_t droppedFrames)
+{
+    _pImpl->RecordFramePresented(frameIndex, latenessNs, droppedFrames);
+}
+
+PlaybackStats GifDecoder::GetPlaybackStats() const
+{
+    return _pImpl->GetPlaybackStats();
+}
+
+PlaybackStats GifDecoder::GetProcessPlaybackStats()
+{
+    DecoderRegistry& registry = GetDecoderRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    PlaybackStats total = registry.retiredPlayback;
+    for (GifDecoder* decoder : registry.decoders)
+    {
+        AddPlaybackStats(total, decoder->_pImpl->GetPlaybackStats());
+    }
+    return total;
+}
+
+uint32_t GifDecoder::GetDecoderId() const
+{
+    return _pImpl->_decoderId;
+}
+
+DecoderStats GifDecoder::GetProcessStats()
+{
+    DecoderRegistry& registry = GetDecoderRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    DecoderStats total = registry.retired;
+    for (GifDecoder* decoder : registry.decoders)
+    {
+        AddStats(total, decoder->GetStats());
+    }
+    return total;
+}
 
 bool GifDecoder::LoadFromFile(const std::string& filePath)
 {
@@ -698,22 +2331,46 @@ bool GifDecoder::LoadFromMemory(const uint8_t* data, size_t length)
 
 bool GifDecoder::LoadFromUrl(const std::string& url)
 {
-    (void)url;
-    // NOTE: URL loading with HTTP download will be implemented in a future release.
-    // For now, use LoadFromFile() with local file paths.
-    return false;
+    std::string filePath;
+    if (Net::FileUrlToPath(url, filePath))
+    {
+        return _pImpl->LoadGif(filePath);
+    }
+    return _pImpl->LoadGifFromUrl(url);
+}
+
+void GifDecoder::SetHttpCacheDirectory(const std::string& directory)
+{
+    Net::SetCacheDirectory(directory);
+}
+
+void GifDecoder::SetHttpConnectTimeoutMs(int timeoutMs)
+{
+    Net::SetConnectTimeoutMs(timeoutMs);
 }
 
 uint32_t GifDecoder::GetFrameCount() const
 {
-    // Wait for background slurp to complete
-    _pImpl->WaitForSlurp();
+    // Wait until every frame record has been read
+    _pImpl->WaitForLoad();
+    return _pImpl->_frameCount;
+}
+
+uint32_t GifDecoder::GetAvailableFrameCount() const
+{
     return _pImpl->_frameCount;
 }
 
+bool GifDecoder::IsLoadComplete() const
+{
+    return !_pImpl->_loadInProgress;
+}
+
 const GifFrame& GifDecoder::GetFrame(uint32_t index) const
 {
-    if (index >= _pImpl->_frameCount)
+    std::lock_guard<std::mutex> lock(_pImpl->_frameMutex);
+    const ScopedFrameRequest request(_pImpl->_lastRequest, _pImpl->_lastRequestMutex, index);
+    if (!_pImpl->WaitForFrame(index))
     {
         throw std::out_of_range("Frame index out of range");
     }
@@ -721,6 +2378,44 @@ const GifFrame& GifDecoder::GetFrame(uint32_t index) const
     return _pImpl->GetOrDecodeFrame(index);
 }
 
+uint32_t GifDecoder::GetFrameDelayMs(uint32_t index) const
+{
+    if (!_pImpl->WaitForFrame(index))
+    {
+        throw std::out_of_range("Frame index out of range");
+    }
+    // Parsed with the frame's records, so no decode and no wait for the frame lock
+    return _pImpl->GetFrameControl(index).delayMs;
+}
+
+FrameAlpha GifDecoder::GetFrameAlpha(uint32_t index)
+{
+    std::lock_guard<std::mutex> lock(_pImpl->_frameMutex);
+    const ScopedFrameRequest request(_pImpl->_lastRequest, _pImpl->_lastRequestMutex, index);
+    if (!_pImpl->WaitForFrame(index))
+    {
+        throw std::out_of_range("Frame index out of range");
+    }
+    return _pImpl->GetOrDecodeFrame(index).alpha;
+}
+
+const std::vector<uint32_t>& GifDecoder::GetFrameDelaysMs() const
+{
+    _pImpl->WaitForLoad();
+    std::lock_guard<std::mutex> lock(_pImpl->_frameDelaysMutex);
+    if (!_pImpl->_frameDelaysValid)
+    {
+        const uint32_t frameCount = _pImpl->_frameCount;
+        _pImpl->_frameDelaysMs.resize(frameCount);
+        for (uint32_t i = 0; i < frameCount; ++i)
+        {
+            _pImpl->_frameDelaysMs[i] = _pImpl->GetFrameControl(i).delayMs;
+        }
+        _pImpl->_frameDelaysValid = true;
+    }
+    return _pImpl->_frameDelaysMs;
+}
+
 uint32_t GifDecoder::GetWidth() const
 {
     return _pImpl->_width;
@@ -743,7 +2438,9 @@ uint32_t GifDecoder::GetBackgroundColor() const
 
 void GifBolt::GifDecoder::SetMinFrameDelayMs(uint32_t minDelayMs)
 {
+    std::lock_guard<std::mutex> lock(_pImpl->_frameDelaysMutex);
     _pImpl->_minFrameDelayMs = minDelayMs;
+    _pImpl->_frameDelaysValid = false;
 }
 
 uint32_t GifBolt::GifDecoder::GetMinFrameDelayMs() const
@@ -755,6 +2452,7 @@ void GifBolt::GifDecoder::SetMaxCachedFrames(uint32_t maxFrames)
 {
     if (maxFrames > 0)
     {
+        std::lock_guard<std::mutex> lock(_pImpl->_frameMutex);
         _pImpl->MAX_CACHED_FRAMES = maxFrames;
     }
 }
@@ -764,15 +2462,109 @@ uint32_t GifBolt::GifDecoder::GetMaxCachedFrames() const
     return _pImpl->MAX_CACHED_FRAMES;
 }
 
-const uint8_t* GifDecoder::GetFramePixelsBGRA32Premultiplied(uint32_t index)
+void GifBolt::GifDecoder::SetMipmapsEnabled(bool enabled)
+{
+    std::lock_guard<std::mutex> lock(_pImpl->_frameMutex);
+    _pImpl->_mipmapsEnabled = enabled;
+    if (!enabled)
+    {
+        _pImpl->_mipCache.clear();
+        _pImpl->_mipCacheIndex.Clear();
+    }
+}
+
+bool GifBolt::GifDecoder::GetMipmapsEnabled() const
+{
+    return _pImpl->_mipmapsEnabled;
+}
+
+void GifDecoder::SetSharedFrameCache(std::shared_ptr<SharedFrameCache> cache)
 {
-    if (index >= _pImpl->_frameCount)
+    std::lock_guard<std::mutex> lock(_pImpl->_frameMutex);
+    _pImpl->_sharedView.Reset();
+    _pImpl->_sharedCache = (cache && cache->IsOpen()) ? std::move(cache) : nullptr;
+}
+
+bool GifDecoder::Impl::GetSharedFrameKey(uint32_t index, SharedFrameKey& key)
+{
+    // Frames are keyed by content, which is only known once every frame has been read
+    if (!this->_sharedCache || !this->_slurpComplete)
+    {
+        return false;
+    }
+    if (this->_contentHash == 0)
+    {
+        // Everything composition depends on: sizes, color maps, rasters and disposal
+        std::lock_guard<std::mutex> lock(this->_gifMutex);
+        const uint32_t header[3] = {this->_width, this->_height, this->_frameCount.load()};
+        uint64_t hash = HashBytes(header, sizeof(header), 0);
+        if (this->_gif->SColorMap != nullptr)
+        {
+            hash = HashBytes(this->_gif->SColorMap->Colors,
+                             sizeof(GifColorType) * this->_gif->SColorMap->ColorCount, hash);
+        }
+        for (uint32_t frame = 0; frame < this->_frameCount; ++frame)
+        {
+            const SavedImage& image = this->_gif->SavedImages[frame];
+            const GifImageDesc& desc = image.ImageDesc;
+            const int32_t layout[7] = {desc.Left,
+                                       desc.Top,
+                                       desc.Width,
+                                       desc.Height,
+                                       desc.Interlace ? 1 : 0,
+                                       static_cast<int32_t>(this->_frameDisposal[frame]),
+                                       this->_frameTransparentIndex[frame]};
+            hash = HashBytes(layout, sizeof(layout), hash);
+            if (desc.ColorMap != nullptr)
+            {
+                hash = HashBytes(desc.ColorMap->Colors,
+                                 sizeof(GifColorType) * desc.ColorMap->ColorCount, hash);
+            }
+            hash = HashBytes(image.RasterBits,
+                             static_cast<size_t>(desc.Width) * desc.Height, hash);
+        }
+        this->_contentHash = hash != 0 ? hash : 1;
+    }
+    key.contentHash = this->_contentHash;
+    key.frameIndex = index;
+    key.format = static_cast<uint32_t>(SharedFrameFormat::Bgra32Premultiplied);
+    key.width = this->_width;
+    key.height = this->_height;
+    return true;
+}
+
+const uint8_t* GifDecoder::Impl::ConvertFrame(uint32_t index, uint8_t* dest)
+{
+    ScopedFrameRequest request(this->_lastRequest, this->_lastRequestMutex, index);
+    if (!this->WaitForFrame(index))
     {
         return nullptr;
     }
 
+    // Another process may already have converted this frame: map it instead of composing
+    SharedFrameKey sharedKey;
+    const bool shared = this->GetSharedFrameKey(index, sharedKey);
+    if (shared)
+    {
+        SharedFrameCache::View view = this->_sharedCache->Find(sharedKey);
+        if (view)
+        {
+            request.FrameReady();
+            if (dest != nullptr)
+            {
+                std::memcpy(dest, view.GetData(), view.GetSize());
+                return dest;
+            }
+            // The mapping outlives eviction, so the frame need not stay pinned until next time
+            view.Unpin();
+            this->_sharedView = std::move(view);
+            return this->_sharedView.GetData();
+        }
+    }
+
     // Get frame from LRU cache (lazy loading)
-    const GifFrame& frame = _pImpl->GetOrDecodeFrame(index);
+    const GifFrame& frame = this->GetOrDecodeFrame(index);
+    request.FrameReady();
 
     // Check if frame has pixel data
     if (frame.pixels.empty())
@@ -784,275 +2576,192 @@ const uint8_t* GifDecoder::GetFramePixelsBGRA32Premultiplied(uint32_t index)
     const size_t byteCount = pixelCount * 4;
 
     // Resize cache if needed
-    if (_pImpl->_bgraPremultipliedCache.size() != byteCount)
+    if (dest == nullptr && this->_bgraPremultipliedCache.size() != byteCount)
     {
-        _pImpl->_bgraPremultipliedCache.resize(byteCount);
+        this->_bgraPremultipliedCache.resize(byteCount);
     }
+    uint8_t* output = dest != nullptr ? dest : this->_bgraPremultipliedCache.data();
 
     // Convert RGBA to BGRA with premultiplied alpha in one pass
+    GIFBOLT_TRACE_SPAN("ConvertFrame", this->_decoderId, index);
     const uint8_t* sourceRGBA = reinterpret_cast<const uint8_t*>(frame.pixels.data());
-    Renderer::PixelFormats::ConvertRGBAToBGRAPremultiplied(
-        sourceRGBA, _pImpl->_bgraPremultipliedCache.data(), pixelCount);
+    this->ConvertFramePixels(index, sourceRGBA, output, pixelCount, frame.alpha);
+    if (shared)
+    {
+        this->_sharedCache->Insert(sharedKey, output, byteCount);
+    }
 
-    return _pImpl->_bgraPremultipliedCache.data();
+    return output;
 }
 
-const uint8_t* GifDecoder::GetFramePixelsBGRA32PremultipliedScaled(
-    uint32_t index, uint32_t targetWidth, uint32_t targetHeight, uint32_t& outWidth,
-    uint32_t& outHeight, ScalingFilter filter)
+const uint8_t* GifDecoder::Impl::ScaleFrame(uint32_t index, uint32_t targetWidth,
+                                            uint32_t targetHeight, uint32_t& outWidth,
+                                            uint32_t& outHeight, ScalingFilter filter,
+                                            uint8_t* dest)
 {
-    if (index >= _pImpl->_frameCount)
+    ScopedFrameRequest request(this->_lastRequest, this->_lastRequestMutex, index);
+    if (!this->WaitForFrame(index))
     {
         return nullptr;
     }
 
     // Get frame from LRU cache (lazy loading)
-    const GifFrame& frame = _pImpl->GetOrDecodeFrame(index);
-    const uint32_t sourceWidth = frame.width;
-    const uint32_t sourceHeight = frame.height;
+    const GifFrame& frame = this->GetOrDecodeFrame(index);
+    request.FrameReady();
+    uint32_t sourceWidth = frame.width;
+    uint32_t sourceHeight = frame.height;
+    const bool opaque = frame.alpha == FrameAlpha::Opaque;
 
     // If target size matches source, use non-scaled version
     if (targetWidth == sourceWidth && targetHeight == sourceHeight)
     {
         outWidth = sourceWidth;
         outHeight = sourceHeight;
-        return this->GetFramePixelsBGRA32Premultiplied(index);
+        return this->ConvertFrame(index, dest);
     }
 
     outWidth = targetWidth;
     outHeight = targetHeight;
-    const size_t outputPixelCount = targetWidth * targetHeight;
-    const size_t outputByteCount = outputPixelCount * 4;
 
-    // Resize cache if needed (separate from non-scaled cache)
-    static std::vector<uint8_t> scaledCache;
-    if (scaledCache.size() != outputByteCount)
+    const uint8_t* sourceBGRA = nullptr;
+    if (this->_mipmapsEnabled)
     {
-        scaledCache.resize(outputByteCount);
+        // Resample from the smallest mip level that still covers the target size
+        const std::vector<Impl::MipLevel>* chain = this->FindMipChain(index);
+        if (chain == nullptr)
+        {
+            const uint8_t* baseBGRA = this->ConvertFrame(index, nullptr);
+            if (!baseBGRA)
+            {
+                return nullptr;
+            }
+            chain = &this->BuildMipChain(index, baseBGRA, sourceWidth, sourceHeight, opaque);
+        }
+
+        const Impl::MipLevel* level = &chain->front();
+        for (const Impl::MipLevel& candidate : *chain)
+        {
+            if (candidate.width < targetWidth || candidate.height < targetHeight)
+            {
+                break;
+            }
+            level = &candidate;
+        }
+
+        if (level->width == targetWidth && level->height == targetHeight)
+        {
+            this->Count(Impl::FramesScaled);
+            return level->pixels.data();
+        }
+
+        sourceBGRA = level->pixels.data();
+        sourceWidth = level->width;
+        sourceHeight = level->height;
+    }
+    else
+    {
+        // Get BGRA premultiplied source (uses existing cache)
+        sourceBGRA = this->ConvertFrame(index, nullptr);
+        if (!sourceBGRA)
+        {
+            return nullptr;
+        }
     }
 
-    // First, get BGRA premultiplied source (uses existing cache)
-    const uint8_t* sourceBGRA = this->GetFramePixelsBGRA32Premultiplied(index);
-    if (!sourceBGRA)
+    GIFBOLT_TRACE_SPAN("ScaleFrame", this->_decoderId, index);
+    const ScopedWorkTimer timer = this->TimeWork(Impl::ScaleTimeNs, Impl::ScaleStage, index);
+    this->Count(Impl::FramesScaled);
+
+    // Resize output buffer if needed (separate from non-scaled cache)
+    const size_t outputByteCount = static_cast<size_t>(targetWidth) * targetHeight * 4;
+    std::vector<uint8_t>& scaledCache = this->_scaledCache;
+    if (dest == nullptr && scaledCache.size() != outputByteCount)
     {
-        return nullptr;
+        scaledCache.resize(outputByteCount);
     }
+    uint8_t* output = dest != nullptr ? dest : scaledCache.data();
 
-    // Try GPU scaling first if available
-    if (_pImpl->_deviceContext)
+    // Use the GPU from the source size at which it beats the CPU kernel (Tuning.h)
+    const uint64_t sourcePixels = static_cast<uint64_t>(sourceWidth) * sourceHeight;
+    if (this->_deviceContext && sourcePixels >= this->_gpuScaleMinPixels)
     {
-        bool gpuSuccess = _pImpl->_deviceContext->ScaleImageGPU(
-            sourceBGRA, sourceWidth, sourceHeight, scaledCache.data(), targetWidth, targetHeight,
+        bool gpuSuccess = this->_deviceContext->ScaleImageGPU(
+            sourceBGRA, sourceWidth, sourceHeight, output, targetWidth, targetHeight,
             static_cast<int>(filter));
 
         if (gpuSuccess)
         {
-            return scaledCache.data();
+            return output;
         }
         // If GPU fails, fall back to CPU
     }
 
-    // CPU scaling implementation based on filter type
-    const float xRatio = static_cast<float>(sourceWidth) / targetWidth;
-    const float yRatio = static_cast<float>(sourceHeight) / targetHeight;
-
-    switch (filter)
-    {
-        case ScalingFilter::Nearest:
-            // Nearest-neighbor (point sampling) - fastest
-            for (uint32_t y = 0; y < targetHeight; ++y)
-            {
-                for (uint32_t x = 0; x < targetWidth; ++x)
-                {
-                    const uint32_t srcX = static_cast<uint32_t>(x * xRatio);
-                    const uint32_t srcY = static_cast<uint32_t>(y * yRatio);
-                    const uint32_t srcIdx = (srcY * sourceWidth + srcX) * 4;
-                    const uint32_t dstIdx = (y * targetWidth + x) * 4;
-
-                    scaledCache[dstIdx + 0] = sourceBGRA[srcIdx + 0];
-                    scaledCache[dstIdx + 1] = sourceBGRA[srcIdx + 1];
-                    scaledCache[dstIdx + 2] = sourceBGRA[srcIdx + 2];
-                    scaledCache[dstIdx + 3] = sourceBGRA[srcIdx + 3];
-                }
-            }
-            break;
-
-        case ScalingFilter::Bilinear:
-        default:
-            // Bilinear interpolation - good balance
-            for (uint32_t y = 0; y < targetHeight; ++y)
-            {
-                for (uint32_t x = 0; x < targetWidth; ++x)
-                {
-                    const float srcX = x * xRatio;
-                    const float srcY = y * yRatio;
-
-                    const uint32_t x0 = static_cast<uint32_t>(srcX);
-                    const uint32_t y0 = static_cast<uint32_t>(srcY);
-                    const uint32_t x1 = (x0 + 1 < sourceWidth) ? (x0 + 1) : x0;
-                    const uint32_t y1 = (y0 + 1 < sourceHeight) ? (y0 + 1) : y0;
-
-                    const float fracX = srcX - x0;
-                    const float fracY = srcY - y0;
-
-                    const uint32_t idx00 = (y0 * sourceWidth + x0) * 4;
-                    const uint32_t idx10 = (y0 * sourceWidth + x1) * 4;
-                    const uint32_t idx01 = (y1 * sourceWidth + x0) * 4;
-                    const uint32_t idx11 = (y1 * sourceWidth + x1) * 4;
-
-                    for (int c = 0; c < 4; ++c)
-                    {
-                        const float v00 = sourceBGRA[idx00 + c];
-                        const float v10 = sourceBGRA[idx10 + c];
-                        const float v01 = sourceBGRA[idx01 + c];
-                        const float v11 = sourceBGRA[idx11 + c];
-
-                        const float vTop = v00 * (1.0f - fracX) + v10 * fracX;
-                        const float vBottom = v01 * (1.0f - fracX) + v11 * fracX;
-                        const float vFinal = vTop * (1.0f - fracY) + vBottom * fracY;
-
-                        scaledCache[(y * targetWidth + x) * 4 + c] =
-                            static_cast<uint8_t>(vFinal + 0.5f);
-                    }
-                }
-            }
-            break;
+    Kernels::ScaleBGRA(sourceBGRA, sourceWidth, sourceHeight, output, targetWidth, targetHeight,
+                       filter, opaque);
+    return output;
+}
 
-        case ScalingFilter::Bicubic:
-        {
-            // Bicubic (Catmull-Rom) interpolation - higher quality
-            auto cubicWeight = [](float x) -> float
-            {
-                const float a = -0.5f;  // Catmull-Rom parameter
-                const float absX = std::abs(x);
-                if (absX <= 1.0f)
-                {
-                    return ((a + 2.0f) * absX - (a + 3.0f)) * absX * absX + 1.0f;
-                }
-                else if (absX < 2.0f)
-                {
-                    return ((a * absX - 5.0f * a) * absX + 8.0f * a) * absX - 4.0f * a;
-                }
-                return 0.0f;
-            };
+const uint8_t* GifDecoder::GetFramePixelsBGRA32Premultiplied(uint32_t index)
+{
+    std::lock_guard<std::mutex> lock(_pImpl->_frameMutex);
+    return _pImpl->ConvertFrame(index, nullptr);
+}
 
-            for (uint32_t y = 0; y < targetHeight; ++y)
-            {
-                for (uint32_t x = 0; x < targetWidth; ++x)
-                {
-                    const float srcX = x * xRatio;
-                    const float srcY = y * yRatio;
-                    const int x0 = static_cast<int>(srcX);
-                    const int y0 = static_cast<int>(srcY);
-                    const float dx = srcX - x0;
-                    const float dy = srcY - y0;
-
-                    float result[4] = {0.0f, 0.0f, 0.0f, 0.0f};
-                    float weightSum = 0.0f;
-
-                    // Sample 4x4 neighborhood
-                    for (int j = -1; j <= 2; ++j)
-                    {
-                        for (int i = -1; i <= 2; ++i)
-                        {
-                            const int sx =
-                                std::min(std::max(x0 + i, 0), static_cast<int>(sourceWidth) - 1);
-                            const int sy =
-                                std::min(std::max(y0 + j, 0), static_cast<int>(sourceHeight) - 1);
-                            const float wx = cubicWeight(i - dx);
-                            const float wy = cubicWeight(j - dy);
-                            const float weight = wx * wy;
-
-                            const uint32_t srcIdx = (sy * sourceWidth + sx) * 4;
-                            for (int c = 0; c < 4; ++c)
-                            {
-                                result[c] += sourceBGRA[srcIdx + c] * weight;
-                            }
-                            weightSum += weight;
-                        }
-                    }
+const uint8_t* GifDecoder::GetFramePixelsBGRA32PremultipliedScaled(
+    uint32_t index, uint32_t targetWidth, uint32_t targetHeight, uint32_t& outWidth,
+    uint32_t& outHeight, ScalingFilter filter)
+{
+    std::lock_guard<std::mutex> lock(_pImpl->_frameMutex);
+    return _pImpl->ScaleFrame(index, targetWidth, targetHeight, outWidth, outHeight, filter,
+                              nullptr);
+}
 
-                    const uint32_t dstIdx = (y * targetWidth + x) * 4;
-                    if (weightSum > 0.0f)
-                    {
-                        for (int c = 0; c < 4; ++c)
-                        {
-                            scaledCache[dstIdx + c] = static_cast<uint8_t>(
-                                std::min(std::max(result[c] / weightSum, 0.0f), 255.0f));
-                        }
-                    }
-                }
-            }
-            break;
-        }
+bool GifDecoder::CopyFramePixelsBGRA32Premultiplied(uint32_t index, uint8_t* dest,
+                                                    size_t destStride, size_t destSize)
+{
+    const size_t rowBytes = static_cast<size_t>(_pImpl->_width) * 4;
+    if (!FitsStridedBuffer(rowBytes, _pImpl->_height, dest, destStride, destSize))
+    {
+        return false;
+    }
 
-        case ScalingFilter::Lanczos:
-        {
-            // Lanczos-3 resampling - highest quality
-            const float a = 3.0f;
-            auto lanczosWeight = [](float x, float a) -> float
-            {
-                if (std::abs(x) < 0.001f)
-                    return 1.0f;
-                if (std::abs(x) >= a)
-                    return 0.0f;
-                const float pi = 3.14159265359f;
-                const float piX = pi * x;
-                return a * std::sin(piX) * std::sin(piX / a) / (piX * piX);
-            };
-
-            for (uint32_t y = 0; y < targetHeight; ++y)
-            {
-                for (uint32_t x = 0; x < targetWidth; ++x)
-                {
-                    const float srcX = x * xRatio;
-                    const float srcY = y * yRatio;
-                    const int x0 = static_cast<int>(srcX);
-                    const int y0 = static_cast<int>(srcY);
-                    const float dx = srcX - x0;
-                    const float dy = srcY - y0;
-
-                    float result[4] = {0.0f, 0.0f, 0.0f, 0.0f};
-                    float weightSum = 0.0f;
-
-                    const int radius = static_cast<int>(std::ceil(a));
-                    for (int j = -radius; j <= radius; ++j)
-                    {
-                        for (int i = -radius; i <= radius; ++i)
-                        {
-                            const int sx =
-                                std::min(std::max(x0 + i, 0), static_cast<int>(sourceWidth) - 1);
-                            const int sy =
-                                std::min(std::max(y0 + j, 0), static_cast<int>(sourceHeight) - 1);
-                            const float wx = lanczosWeight(i - dx, a);
-                            const float wy = lanczosWeight(j - dy, a);
-                            const float weight = wx * wy;
-
-                            const uint32_t srcIdx = (sy * sourceWidth + sx) * 4;
-                            for (int c = 0; c < 4; ++c)
-                            {
-                                result[c] += sourceBGRA[srcIdx + c] * weight;
-                            }
-                            weightSum += weight;
-                        }
-                    }
+    // Rows that are packed back to back are converted in place
+    const bool packed = destStride == rowBytes;
+    std::lock_guard<std::mutex> lock(_pImpl->_frameMutex);
+    const uint8_t* pixels = _pImpl->ConvertFrame(index, packed ? dest : nullptr);
+    if (pixels == nullptr)
+    {
+        return false;
+    }
+    CopyRows(pixels, rowBytes, _pImpl->_height, dest, destStride);
+    return true;
+}
 
-                    const uint32_t dstIdx = (y * targetWidth + x) * 4;
-                    if (weightSum > 0.0f)
-                    {
-                        for (int c = 0; c < 4; ++c)
-                        {
-                            scaledCache[dstIdx + c] = static_cast<uint8_t>(
-                                std::min(std::max(result[c] / weightSum, 0.0f), 255.0f));
-                        }
-                    }
-                }
-            }
-            break;
-        }
+bool GifDecoder::CopyFramePixelsBGRA32PremultipliedScaled(uint32_t index, uint32_t targetWidth,
+                                                          uint32_t targetHeight, uint8_t* dest,
+                                                          size_t destStride, size_t destSize,
+                                                          ScalingFilter filter)
+{
+    const size_t rowBytes = static_cast<size_t>(targetWidth) * 4;
+    if (targetWidth == 0 ||
+        !FitsStridedBuffer(rowBytes, targetHeight, dest, destStride, destSize))
+    {
+        return false;
     }
 
-    return scaledCache.data();
+    // Packed rows are scaled in place; a cached mip level of the exact size is copied
+    const bool packed = destStride == rowBytes;
+    std::lock_guard<std::mutex> lock(_pImpl->_frameMutex);
+    uint32_t outWidth = 0;
+    uint32_t outHeight = 0;
+    const uint8_t* pixels = _pImpl->ScaleFrame(index, targetWidth, targetHeight, outWidth,
+                                               outHeight, filter, packed ? dest : nullptr);
+    if (pixels == nullptr)
+    {
+        return false;
+    }
+    CopyRows(pixels, rowBytes, targetHeight, dest, destStride);
+    return true;
 }
 
 // Async prefetching implementations
@@ -1079,21 +2788,30 @@ void GifDecoder::Impl::StopPrefetching()
 
 void GifDecoder::Impl::PrefetchLoop()
 {
+    GIFBOLT_TRACE_THREAD_NAME("GifBolt prefetch");
     while (_prefetchThreadRunning)
     {
         uint32_t currentFrame = _currentPlaybackFrame.load();
+        const uint32_t frameCount = _frameCount;
 
-        // Prefetch next N frames
-        for (uint32_t ahead = 1; ahead <= PREFETCH_AHEAD && _prefetchThreadRunning; ++ahead)
+        // Prefetch next N frames (only wrap around once the whole GIF has been read)
+        for (uint32_t ahead = 1;
+             ahead <= PREFETCH_AHEAD && _prefetchThreadRunning && frameCount > 0; ++ahead)
         {
-            uint32_t targetFrame = (currentFrame + ahead) % _frameCount;
-
-            // Check if already decoded
-            if (!_frameDecoded[targetFrame])
+            uint32_t targetFrame = currentFrame + ahead;
+            if (targetFrame >= frameCount)
             {
-                // Decode frame in background
-                EnsureFrameDecoded(targetFrame);
+                if (_loadInProgress)
+                {
+                    break;
+                }
+                targetFrame %= frameCount;
             }
+
+            // Decode frame in background (no-op if already decoded)
+            GIFBOLT_TRACE_SPAN("Prefetch", this->_decoderId, targetFrame);
+            GIFBOLT_PROBE3(prefetch_issue, this->_decoderId, targetFrame, 0);
+            EnsureFrameDecoded(targetFrame);
         }
 
         // Sleep briefly to avoid busy loop
@@ -1130,6 +2848,7 @@ void GifDecoder::ResetCanvas()
 {
     if (this->_pImpl)
     {
+        std::lock_guard<std::mutex> frameLock(this->_pImpl->_frameMutex);
         std::lock_guard<std::mutex> lock(this->_pImpl->_decodeMutex);
 
         // Clear canvas to transparent (0x00000000)
@@ -1138,19 +2857,53 @@ void GifDecoder::ResetCanvas()
         std::fill(this->_pImpl->_canvas.begin(), this->_pImpl->_canvas.end(), 0x00000000);
 
         // Reset disposal state
-        this->_pImpl->_previousDisposal = DisposalMethod::None;
-        this->_pImpl->_previousCanvas.clear();
-        this->_pImpl->_prevFrameWidth = 0;
-        this->_pImpl->_prevFrameHeight = 0;
-        this->_pImpl->_prevFrameOffsetX = 0;
-        this->_pImpl->_prevFrameOffsetY = 0;
-
-        // Clear ALL caches to force complete re-composition from clean canvas
+        this->_pImpl->ResetComposition();
+
+        // Clear ALL caches to force complete re-composition from clean canvas. Buffers are
+        // kept for reuse so looping playback does not reallocate them every cycle.
+        for (GifFrame& frame : this->_pImpl->_frameCache)
+        {
+            this->_pImpl->_pixelPool.Release(std::move(frame.pixels));
+        }
         this->_pImpl->_frameCache.clear();
-        this->_pImpl->_cachedFrameIndices.clear();
+        this->_pImpl->_frameCacheIndex.Clear();
         this->_pImpl->_bgraPremultipliedCache.clear();
-        std::fill(this->_pImpl->_frameDecoded.begin(), this->_pImpl->_frameDecoded.end(), false);
+        for (std::vector<Impl::MipLevel>& chain : this->_pImpl->_mipCache)
+        {
+            this->_pImpl->_spareMipChains.push_back(std::move(chain));
+        }
+        this->_pImpl->_mipCache.clear();
+        this->_pImpl->_mipCacheIndex.Clear();
+    }
+}
+
+bool GifDecoder::VisitComposedFrames(
+    const std::function<bool(uint32_t, const uint32_t*, FrameAlpha)>& visit)
+{
+    _pImpl->WaitForLoad();
+    std::lock_guard<std::mutex> frameLock(_pImpl->_frameMutex);
+    std::lock_guard<std::mutex> lock(_pImpl->_decodeMutex);
+    if (_pImpl->_gif == nullptr || _pImpl->_frameCount == 0)
+    {
+        return false;
+    }
+
+    // Start from a cleared canvas, which TrimMemory may also have released
+    _pImpl->_canvas.assign(static_cast<size_t>(_pImpl->_width) * _pImpl->_height, 0x00000000);
+    _pImpl->ResetComposition();
+    while (_pImpl->_decodedFrontier < _pImpl->_frameCount)
+    {
+        const uint32_t frameIndex = _pImpl->_decodedFrontier;
+        _pImpl->DecodeFrame(_pImpl->_gif, frameIndex);
+        ++_pImpl->_decodedFrontier;
+        const FrameAlpha alpha =
+            _pImpl->_canvasTransparentPixels == 0 ? FrameAlpha::Opaque : FrameAlpha::Binary;
+        if (!visit(frameIndex, _pImpl->_canvas.data(), alpha))
+        {
+            return false;
+        }
     }
+    return true;
 }
 
 }  // namespace GifBolt
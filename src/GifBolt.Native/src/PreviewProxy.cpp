@@ -0,0 +1,612 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#include "PreviewProxy.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include "FrameKernels.h"
+#include "GifDecoder.h"
+#include "PixelConversion.h"
+#include "Trace.h"
+
+namespace GifBolt
+{
+
+namespace
+{
+// File layout, integers little-endian: MAGIC, u32 FORMAT_VERSION, u32 width, u32 height,
+// u32 frame count, u8 storage, u8 looping, u16 palette size, the palette's colors as u32,
+// u32 delay and u32 source frame per frame, then the frames' pixels back to back.
+const char MAGIC[4] = {'G', 'B', 'P', 'V'};
+constexpr uint32_t FORMAT_VERSION = 1;
+constexpr size_t PALETTE_SIZE = 256;
+constexpr uint32_t MAX_SIDE = 65535;  ///< Largest proxy side accepted from a file
+
+void PutU16(std::vector<uint8_t>& out, uint16_t value)
+{
+    out.push_back(static_cast<uint8_t>(value));
+    out.push_back(static_cast<uint8_t>(value >> 8));
+}
+
+void PutU32(std::vector<uint8_t>& out, uint32_t value)
+{
+    for (int byte = 0; byte < 4; ++byte)
+    {
+        out.push_back(static_cast<uint8_t>(value >> (byte * 8)));
+    }
+}
+
+/// \brief Bounds-checked little-endian reads over a proxy file.
+class Reader
+{
+   public:
+    Reader(const uint8_t* data, size_t size) : _data(data), _size(size)
+    {
+    }
+
+    bool U8(uint8_t& value)
+    {
+        if (this->_offset + 1 > this->_size)
+        {
+            return false;
+        }
+        value = this->_data[this->_offset++];
+        return true;
+    }
+
+    bool U16(uint16_t& value)
+    {
+        uint8_t low = 0;
+        uint8_t high = 0;
+        if (!this->U8(low) || !this->U8(high))
+        {
+            return false;
+        }
+        value = static_cast<uint16_t>(low | (high << 8));
+        return true;
+    }
+
+    bool U32(uint32_t& value)
+    {
+        if (this->_offset + 4 > this->_size)
+        {
+            return false;
+        }
+        value = 0;
+        for (int byte = 0; byte < 4; ++byte)
+        {
+            value |= static_cast<uint32_t>(this->_data[this->_offset++]) << (byte * 8);
+        }
+        return true;
+    }
+
+    bool Bytes(size_t length, const uint8_t*& data)
+    {
+        if (length > this->_size - this->_offset)
+        {
+            return false;
+        }
+        data = this->_data + this->_offset;
+        this->_offset += length;
+        return true;
+    }
+
+    size_t GetRemaining() const
+    {
+        return this->_size - this->_offset;
+    }
+
+   private:
+    const uint8_t* _data;
+    size_t _size;
+    size_t _offset = 0;
+};
+
+/// \brief Brings packed BGRA pixels down to the target size: box-halves while the image is at
+/// least twice the target, so that no source pixel is skipped, then resamples bilinearly.
+/// \return The scaled pixels: source itself, one of the scratch buffers, or output.
+const uint8_t* Downscale(const uint8_t* source, uint32_t width, uint32_t height,
+                         uint32_t targetWidth, uint32_t targetHeight, bool opaque,
+                         std::vector<uint8_t> (&scratch)[2], std::vector<uint8_t>& output)
+{
+    const uint8_t* current = source;
+    size_t next = 0;
+    while (width / 2 >= targetWidth && height / 2 >= targetHeight)
+    {
+        const uint32_t halfWidth = std::max(1u, width / 2);
+        const uint32_t halfHeight = std::max(1u, height / 2);
+        scratch[next].resize(static_cast<size_t>(halfWidth) * halfHeight * 4);
+        Kernels::DownsampleBox2x(current, width, height, scratch[next].data(), halfWidth,
+                                 halfHeight, opaque);
+        current = scratch[next].data();
+        next ^= 1;
+        width = halfWidth;
+        height = halfHeight;
+    }
+    if (width == targetWidth && height == targetHeight)
+    {
+        return current;
+    }
+
+    output.resize(static_cast<size_t>(targetWidth) * targetHeight * 4);
+    Kernels::ScaleBGRA(current, width, height, output.data(), targetWidth, targetHeight,
+                       ScalingFilter::Bilinear, opaque);
+    return output.data();
+}
+
+/// \brief Colors that median cut turns into one palette entry.
+struct ColorBox
+{
+    size_t begin = 0;  ///< First of the box's colors in the color list
+    size_t end = 0;
+    int channel = 0;      ///< Channel the colors spread widest over
+    uint32_t spread = 0;  ///< Width of that spread; 0 when the box cannot be split
+};
+
+uint32_t GetChannel(uint32_t color, int channel)
+{
+    return (color >> (channel * 8)) & 0xFF;
+}
+
+ColorBox MakeColorBox(const std::vector<std::pair<uint32_t, uint32_t>>& colors, size_t begin,
+                      size_t end)
+{
+    ColorBox box;
+    box.begin = begin;
+    box.end = end;
+    for (int channel = 0; channel < 4; ++channel)
+    {
+        uint32_t low = 255;
+        uint32_t high = 0;
+        for (size_t i = begin; i < end; ++i)
+        {
+            low = std::min(low, GetChannel(colors[i].first, channel));
+            high = std::max(high, GetChannel(colors[i].first, channel));
+        }
+        if (high > low && high - low > box.spread)
+        {
+            box.channel = channel;
+            box.spread = high - low;
+        }
+    }
+    return box;
+}
+
+/// \brief Builds a palette for premultiplied colors by median cut.
+/// \param histogram Pixel count of each color; each count is replaced by the palette index
+///                  of its color.
+/// \return At most PALETTE_SIZE colors. Fully transparent pixels keep an exact entry.
+std::vector<uint32_t> BuildPalette(std::unordered_map<uint32_t, uint32_t>& histogram)
+{
+    std::vector<uint32_t> palette;
+    const bool transparent = histogram.erase(0) > 0;
+    if (transparent)
+    {
+        palette.push_back(0);
+    }
+
+    // Split the box with the widest spread at the median of its pixels until the palette is
+    // full; averages of premultiplied colors are valid premultiplied colors
+    std::vector<std::pair<uint32_t, uint32_t>> colors(histogram.begin(), histogram.end());
+    std::vector<ColorBox> boxes;
+    if (!colors.empty())
+    {
+        boxes.push_back(MakeColorBox(colors, 0, colors.size()));
+    }
+    while (!boxes.empty() && palette.size() + boxes.size() < PALETTE_SIZE)
+    {
+        const auto widest = std::max_element(boxes.begin(), boxes.end(),
+                                             [](const ColorBox& left, const ColorBox& right)
+                                             { return left.spread < right.spread; });
+        if (widest->spread == 0)
+        {
+            break;
+        }
+        const ColorBox box = *widest;
+        const int channel = box.channel;
+        std::sort(colors.begin() + box.begin, colors.begin() + box.end,
+                  [channel](const std::pair<uint32_t, uint32_t>& left,
+                            const std::pair<uint32_t, uint32_t>& right)
+                  { return GetChannel(left.first, channel) < GetChannel(right.first, channel); });
+        uint64_t total = 0;
+        for (size_t i = box.begin; i < box.end; ++i)
+        {
+            total += colors[i].second;
+        }
+        size_t split = box.begin + 1;
+        uint64_t below = colors[box.begin].second;
+        while (split < box.end - 1 && below * 2 < total)
+        {
+            below += colors[split++].second;
+        }
+        *widest = MakeColorBox(colors, box.begin, split);
+        boxes.push_back(MakeColorBox(colors, split, box.end));
+    }
+
+    for (const ColorBox& box : boxes)
+    {
+        uint64_t sums[4] = {};
+        uint64_t total = 0;
+        for (size_t i = box.begin; i < box.end; ++i)
+        {
+            for (int channel = 0; channel < 4; ++channel)
+            {
+                sums[channel] += GetChannel(colors[i].first, channel) * uint64_t{colors[i].second};
+            }
+            total += colors[i].second;
+        }
+        uint32_t color = 0;
+        for (int channel = 0; channel < 4; ++channel)
+        {
+            color |= static_cast<uint32_t>((sums[channel] + total / 2) / total) << (channel * 8);
+        }
+        for (size_t i = box.begin; i < box.end; ++i)
+        {
+            histogram[colors[i].first] = static_cast<uint32_t>(palette.size());
+        }
+        palette.push_back(color);
+    }
+    if (transparent)
+    {
+        histogram[0] = 0;
+    }
+    return palette;
+}
+
+}  // namespace
+
+bool PreviewProxy::Generate(GifDecoder& source, const PreviewOptions& options)
+{
+    GIFBOLT_TRACE_SPAN("GeneratePreview", Trace::NO_DECODER, Trace::NO_FRAME);
+    *this = PreviewProxy();
+    const uint32_t frameCount = source.GetFrameCount();
+    const uint32_t sourceWidth = source.GetWidth();
+    const uint32_t sourceHeight = source.GetHeight();
+    if (frameCount == 0 || sourceWidth == 0 || sourceHeight == 0 || options.maxWidth == 0 ||
+        options.maxHeight == 0)
+    {
+        return false;
+    }
+
+    // Fit the box without changing the aspect ratio, and never upscale
+    const double scale =
+        std::min({1.0, static_cast<double>(options.maxWidth) / sourceWidth,
+                  static_cast<double>(options.maxHeight) / sourceHeight});
+    const uint32_t width = std::min(
+        options.maxWidth, std::max(1u, static_cast<uint32_t>(sourceWidth * scale + 0.5)));
+    const uint32_t height = std::min(
+        options.maxHeight, std::max(1u, static_cast<uint32_t>(sourceHeight * scale + 0.5)));
+    this->_width = width;
+    this->_height = height;
+    this->_looping = source.IsLooping();
+
+    // A frame is kept when it starts at or after the next tick of the target frame rate;
+    // ticks are counted from the start so that rounding does not drift over long GIFs
+    const uint64_t intervalUs = options.maxFps > 0 ? 1000000ull / options.maxFps : 0;
+    const size_t pixelCount = static_cast<size_t>(sourceWidth) * sourceHeight;
+    uint64_t startUs = 0;
+    uint64_t nextTickUs = 0;
+    std::unordered_map<uint32_t, uint8_t> colors;
+    std::vector<uint8_t> converted(pixelCount * 4);
+    std::vector<uint8_t> scratch[2];
+    std::vector<uint8_t> scaled;
+    const bool visited = source.VisitComposedFrames(
+        [&](uint32_t index, const uint32_t* canvas, FrameAlpha alpha)
+        {
+            const uint32_t delayMs = source.GetFrameDelayMs(index);
+            if (startUs >= nextTickUs)
+            {
+                // Only kept frames are converted; the others were just composed
+                const auto* rgba = reinterpret_cast<const uint8_t*>(canvas);
+                const bool opaque = alpha == FrameAlpha::Opaque;
+                if (alpha != FrameAlpha::Translucent)
+                {
+                    Renderer::PixelFormats::SwizzleRGBAToBGRAChunk(rgba, converted.data(), 0,
+                                                                   pixelCount);
+                }
+                else
+                {
+                    Renderer::PixelFormats::ConvertRGBAToBGRAPremultipliedChunk(
+                        rgba, converted.data(), 0, pixelCount);
+                }
+                this->AppendFrame(Downscale(converted.data(), sourceWidth, sourceHeight, width,
+                                            height, opaque, scratch, scaled),
+                                  colors);
+                this->_frameDelaysMs.push_back(0);
+                this->_sourceFrames.push_back(index);
+                if (intervalUs > 0)
+                {
+                    nextTickUs += ((startUs - nextTickUs) / intervalUs + 1) * intervalUs;
+                }
+            }
+            this->_frameDelaysMs.back() += delayMs;
+            startUs += static_cast<uint64_t>(delayMs) * 1000;
+            return true;
+        });
+    if (!visited)
+    {
+        *this = PreviewProxy();
+        return false;
+    }
+    if (this->_storage == PreviewStorage::Bgra32 && !options.exactColors)
+    {
+        this->Quantize();
+    }
+    return true;
+}
+
+void PreviewProxy::AppendFrame(const uint8_t* bgra, std::unordered_map<uint32_t, uint8_t>& colors)
+{
+    const size_t pixelCount = static_cast<size_t>(this->_width) * this->_height;
+    if (this->_storage == PreviewStorage::Indexed8)
+    {
+        const size_t offset = this->_pixels.size();
+        this->_pixels.resize(offset + pixelCount);
+        size_t i = 0;
+        for (; i < pixelCount; ++i)
+        {
+            uint32_t color;
+            std::memcpy(&color, bgra + i * 4, sizeof(color));
+            auto it = colors.find(color);
+            if (it == colors.end())
+            {
+                if (this->_palette.size() == PALETTE_SIZE)
+                {
+                    break;
+                }
+                it = colors.emplace(color, static_cast<uint8_t>(this->_palette.size())).first;
+                this->_palette.push_back(color);
+            }
+            this->_pixels[offset + i] = it->second;
+        }
+        if (i == pixelCount)
+        {
+            return;
+        }
+
+        // Too many colors: expand the frames stored so far and keep the rest as they are
+        std::vector<uint8_t> expanded(offset * 4);
+        for (size_t pixel = 0; pixel < offset; ++pixel)
+        {
+            std::memcpy(&expanded[pixel * 4], &this->_palette[this->_pixels[pixel]],
+                        sizeof(uint32_t));
+        }
+        this->_pixels = std::move(expanded);
+        this->_palette = std::vector<uint32_t>();
+        colors.clear();
+        this->_storage = PreviewStorage::Bgra32;
+    }
+    this->_pixels.insert(this->_pixels.end(), bgra, bgra + pixelCount * 4);
+}
+
+void PreviewProxy::Quantize()
+{
+    GIFBOLT_TRACE_SPAN("QuantizePreview", Trace::NO_DECODER, Trace::NO_FRAME);
+    const size_t pixelCount = this->_pixels.size() / 4;
+    std::unordered_map<uint32_t, uint32_t> histogram;
+    for (size_t i = 0; i < pixelCount; ++i)
+    {
+        uint32_t color;
+        std::memcpy(&color, &this->_pixels[i * 4], sizeof(color));
+        ++histogram[color];
+    }
+    this->_palette = BuildPalette(histogram);
+
+    std::vector<uint8_t> indexed(pixelCount);
+    for (size_t i = 0; i < pixelCount; ++i)
+    {
+        uint32_t color;
+        std::memcpy(&color, &this->_pixels[i * 4], sizeof(color));
+        indexed[i] = static_cast<uint8_t>(histogram.find(color)->second);
+    }
+    this->_pixels = std::move(indexed);
+    this->_storage = PreviewStorage::Indexed8;
+}
+
+bool PreviewProxy::LoadFromFile(const std::string& path)
+{
+    *this = PreviewProxy();
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr)
+    {
+        return false;
+    }
+    std::vector<uint8_t> bytes;
+    uint8_t chunk[64 * 1024];
+    size_t read = 0;
+    while ((read = std::fread(chunk, 1, sizeof(chunk), file)) > 0)
+    {
+        bytes.insert(bytes.end(), chunk, chunk + read);
+    }
+    std::fclose(file);
+
+    Reader reader(bytes.data(), bytes.size());
+    const uint8_t* magic = nullptr;
+    uint32_t version = 0;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint32_t frameCount = 0;
+    uint8_t storage = 0;
+    uint8_t looping = 0;
+    uint16_t paletteSize = 0;
+    if (!reader.Bytes(sizeof(MAGIC), magic) || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0 ||
+        !reader.U32(version) || version != FORMAT_VERSION || !reader.U32(width) ||
+        !reader.U32(height) || !reader.U32(frameCount) || !reader.U8(storage) ||
+        !reader.U8(looping) || !reader.U16(paletteSize))
+    {
+        return false;
+    }
+    const bool indexed = storage == static_cast<uint8_t>(PreviewStorage::Indexed8);
+    if (width == 0 || height == 0 || width > MAX_SIDE || height > MAX_SIDE || frameCount == 0 ||
+        (!indexed && storage != static_cast<uint8_t>(PreviewStorage::Bgra32)) ||
+        paletteSize > PALETTE_SIZE || (indexed && paletteSize == 0) ||
+        (!indexed && paletteSize != 0))
+    {
+        return false;
+    }
+
+    PreviewProxy proxy;
+    proxy._palette.resize(paletteSize);
+    for (uint32_t& color : proxy._palette)
+    {
+        if (!reader.U32(color))
+        {
+            return false;
+        }
+    }
+
+    // Every frame takes at least 9 bytes, which bounds the allocations below by the file size
+    if (frameCount > reader.GetRemaining() / 9)
+    {
+        return false;
+    }
+    proxy._frameDelaysMs.resize(frameCount);
+    proxy._sourceFrames.resize(frameCount);
+    for (uint32_t index = 0; index < frameCount; ++index)
+    {
+        if (!reader.U32(proxy._frameDelaysMs[index]) || !reader.U32(proxy._sourceFrames[index]))
+        {
+            return false;
+        }
+    }
+
+    const size_t bytesPerPixel = indexed ? 1 : 4;
+    const size_t pixelBytes =
+        static_cast<size_t>(width) * height * frameCount * bytesPerPixel;
+    const uint8_t* pixels = nullptr;
+    if (pixelBytes / frameCount / bytesPerPixel != static_cast<size_t>(width) * height ||
+        reader.GetRemaining() != pixelBytes || !reader.Bytes(pixelBytes, pixels))
+    {
+        return false;
+    }
+    if (indexed && std::any_of(pixels, pixels + pixelBytes,
+                               [paletteSize](uint8_t entry) { return entry >= paletteSize; }))
+    {
+        return false;
+    }
+    proxy._pixels.assign(pixels, pixels + pixelBytes);
+    proxy._width = width;
+    proxy._height = height;
+    proxy._looping = looping != 0;
+    proxy._storage = static_cast<PreviewStorage>(storage);
+    *this = std::move(proxy);
+    return true;
+}
+
+bool PreviewProxy::SaveToFile(const std::string& path) const
+{
+    if (this->_frameDelaysMs.empty())
+    {
+        return false;
+    }
+
+    std::vector<uint8_t> header(MAGIC, MAGIC + sizeof(MAGIC));
+    PutU32(header, FORMAT_VERSION);
+    PutU32(header, this->_width);
+    PutU32(header, this->_height);
+    PutU32(header, this->GetFrameCount());
+    header.push_back(static_cast<uint8_t>(this->_storage));
+    header.push_back(this->_looping ? 1 : 0);
+    PutU16(header, static_cast<uint16_t>(this->_palette.size()));
+    for (uint32_t color : this->_palette)
+    {
+        PutU32(header, color);
+    }
+    for (size_t index = 0; index < this->_frameDelaysMs.size(); ++index)
+    {
+        PutU32(header, this->_frameDelaysMs[index]);
+        PutU32(header, this->_sourceFrames[index]);
+    }
+
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (file == nullptr)
+    {
+        return false;
+    }
+    const bool written =
+        std::fwrite(header.data(), 1, header.size(), file) == header.size() &&
+        std::fwrite(this->_pixels.data(), 1, this->_pixels.size(), file) == this->_pixels.size();
+    return std::fclose(file) == 0 && written;
+}
+
+uint32_t PreviewProxy::GetWidth() const
+{
+    return this->_width;
+}
+
+uint32_t PreviewProxy::GetHeight() const
+{
+    return this->_height;
+}
+
+uint32_t PreviewProxy::GetFrameCount() const
+{
+    return static_cast<uint32_t>(this->_frameDelaysMs.size());
+}
+
+bool PreviewProxy::IsLooping() const
+{
+    return this->_looping;
+}
+
+PreviewStorage PreviewProxy::GetStorage() const
+{
+    return this->_storage;
+}
+
+const std::vector<uint32_t>& PreviewProxy::GetFrameDelaysMs() const
+{
+    return this->_frameDelaysMs;
+}
+
+const std::vector<uint32_t>& PreviewProxy::GetSourceFrames() const
+{
+    return this->_sourceFrames;
+}
+
+bool PreviewProxy::CopyFramePixelsBGRA32Premultiplied(uint32_t index, uint8_t* dest,
+                                                      size_t destStride, size_t destSize) const
+{
+    const size_t rowBytes = static_cast<size_t>(this->_width) * 4;
+    if (index >= this->GetFrameCount() || dest == nullptr || rowBytes == 0 ||
+        destStride < rowBytes || destStride * (this->_height - 1) + rowBytes > destSize)
+    {
+        return false;
+    }
+
+    const size_t pixelCount = static_cast<size_t>(this->_width) * this->_height;
+    if (this->_storage == PreviewStorage::Bgra32)
+    {
+        const uint8_t* frame = this->_pixels.data() + index * pixelCount * 4;
+        for (uint32_t row = 0; row < this->_height; ++row)
+        {
+            std::memcpy(dest + row * destStride, frame + row * rowBytes, rowBytes);
+        }
+        return true;
+    }
+
+    const uint8_t* frame = this->_pixels.data() + index * pixelCount;
+    for (uint32_t row = 0; row < this->_height; ++row)
+    {
+        const uint8_t* entries = frame + static_cast<size_t>(row) * this->_width;
+        uint8_t* out = dest + row * destStride;
+        for (uint32_t x = 0; x < this->_width; ++x)
+        {
+            std::memcpy(out + x * 4, &this->_palette[entries[x]], sizeof(uint32_t));
+        }
+    }
+    return true;
+}
+
+size_t PreviewProxy::GetMemoryBytes() const
+{
+    return this->_pixels.capacity() +
+           (this->_palette.capacity() + this->_frameDelaysMs.capacity() +
+            this->_sourceFrames.capacity()) *
+               sizeof(uint32_t);
+}
+
+}  // namespace GifBolt
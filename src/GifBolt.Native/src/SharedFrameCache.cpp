@@ -0,0 +1,732 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#include "SharedFrameCache.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <thread>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace GifBolt
+{
+
+namespace
+{
+constexpr uint32_t MAGIC = 0x43464247;  ///< "GBFC"
+constexpr uint32_t LAYOUT_VERSION = 2;
+constexpr uint32_t MIN_SLOTS = 16;
+constexpr uint32_t MAX_SLOTS = 1u << 20;
+constexpr uint32_t PROBE_LENGTH = 16;  ///< Slots a key may occupy, starting at its hash
+constexpr uint32_t NO_SLOT = std::numeric_limits<uint32_t>::max();
+constexpr size_t MAX_NAME_LENGTH = 16;  ///< Keeps object names within macOS's 31 characters
+
+// Slot control word: state in the low two bits; above them, the pin count of a READY slot or
+// the id of the process WRITING it
+constexpr uint32_t STATE_MASK = 3;
+constexpr uint32_t EMPTY = 0;     ///< Free
+constexpr uint32_t WRITING = 1;   ///< Claimed by a process publishing a frame
+constexpr uint32_t READY = 2;     ///< Published; readers pin it by adding PIN
+constexpr uint32_t EVICTING = 3;  ///< Being freed by the process that evicted it
+constexpr uint32_t OWNER_SHIFT = 2;
+constexpr uint32_t PIN = 1u << OWNER_SHIFT;
+
+/// \brief Gets the id recorded with this process's pins and write claims.
+/// \return The process id, or 0 if it does not fit a control word (never reclaimed).
+uint32_t GetOwnerId()
+{
+#ifdef _WIN32
+    return 0;
+#else
+    const pid_t processId = getpid();
+    return processId > 0 && processId < (1 << (32 - OWNER_SHIFT))
+               ? static_cast<uint32_t>(processId)
+               : 0;
+#endif
+}
+
+/// \brief Determines whether a process recorded by GetOwnerId may still be running.
+bool IsOwnerAlive(uint32_t owner)
+{
+#ifdef _WIN32
+    (void)owner;
+    return true;
+#else
+    return owner == 0 || kill(static_cast<pid_t>(owner), 0) == 0 || errno != ESRCH;
+#endif
+}
+
+bool IsValidName(const std::string& name)
+{
+    if (name.empty() || name.size() > MAX_NAME_LENGTH)
+    {
+        return false;
+    }
+    return std::all_of(name.begin(), name.end(),
+                       [](char c)
+                       {
+                           return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+                                  (c >= '0' && c <= '9') || c == '_' || c == '-';
+                       });
+}
+
+std::string GetIndexObjectName(const std::string& name)
+{
+    return "/gb." + name;
+}
+
+uint64_t HashKey(const SharedFrameKey& key)
+{
+    // splitmix64 finalizer over the fields
+    uint64_t hash = key.contentHash ^ (static_cast<uint64_t>(key.frameIndex) << 32 | key.format);
+    hash ^= static_cast<uint64_t>(key.width) << 40 ^ static_cast<uint64_t>(key.height) << 8;
+    hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ull;
+    hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBull;
+    return hash ^ (hash >> 31);
+}
+
+/// \brief Creates a shared memory object holding a copy of data.
+bool CreateFrameObject(const std::string& name, const uint8_t* data, size_t size)
+{
+#ifdef _WIN32
+    (void)name;
+    (void)data;
+    (void)size;
+    return false;
+#else
+    // A process that crashed while publishing may have left an object behind
+    shm_unlink(name.c_str());
+    const int handle = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (handle < 0)
+    {
+        return false;
+    }
+    void* mapping = MAP_FAILED;
+    if (ftruncate(handle, static_cast<off_t>(size)) == 0)
+    {
+        mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, handle, 0);
+    }
+    close(handle);
+    if (mapping == MAP_FAILED)
+    {
+        shm_unlink(name.c_str());
+        return false;
+    }
+    std::memcpy(mapping, data, size);
+    munmap(mapping, size);
+    return true;
+#endif
+}
+
+/// \brief Maps a frame object read-only.
+/// \return The mapping, or nullptr on error.
+void* MapFrameObject(const std::string& name, size_t size)
+{
+#ifdef _WIN32
+    (void)name;
+    (void)size;
+    return nullptr;
+#else
+    const int handle = shm_open(name.c_str(), O_RDONLY, 0);
+    if (handle < 0)
+    {
+        return nullptr;
+    }
+    void* mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, handle, 0);
+    close(handle);
+    return mapping == MAP_FAILED ? nullptr : mapping;
+#endif
+}
+
+void Unmap(void* mapping, size_t size)
+{
+#ifndef _WIN32
+    munmap(mapping, size);
+#else
+    (void)mapping;
+    (void)size;
+#endif
+}
+
+void RemoveObject(const std::string& name)
+{
+#ifndef _WIN32
+    shm_unlink(name.c_str());
+#else
+    (void)name;
+#endif
+}
+
+}  // namespace
+
+/// Start of the index segment. Written once by the process that creates the cache; the
+/// counters are then only changed atomically.
+/// The slots follow it, then as many pin records: 0 when free, else the pinning process's id
+/// in the high half and the pinned slot plus one in the low half.
+struct SharedFrameCache::Header
+{
+    std::atomic<uint32_t> magic;  ///< Set last, once the segment is initialized
+    uint32_t version;
+    uint32_t slotCount;  ///< Power of two
+    uint32_t reserved;
+    uint64_t budgetBytes;
+    std::atomic<uint64_t> usedBytes;  ///< Bytes of published frames, plus reservations
+    std::atomic<uint64_t> entries;    ///< Published frames
+    std::atomic<uint64_t> clock;      ///< Ticks on every publish and hit, for LRU eviction
+};
+
+/// One frame of the index. key and size are written by the process that claimed the slot
+/// (WRITING) and only read while it is published and pinned or being evicted or reclaimed.
+struct SharedFrameCache::Slot
+{
+    std::atomic<uint32_t> control;  ///< State and pin count
+    uint32_t reserved;
+    std::atomic<uint64_t> lastUse;  ///< Header::clock at the last publish or hit
+    SharedFrameKey key;
+    uint64_t size;
+};
+
+// Processes share these words, so they must not fall back to process-local locks
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "lock-free 32-bit atomics required");
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "lock-free 64-bit atomics required");
+
+SharedFrameCache::View::~View()
+{
+    this->Reset();
+}
+
+SharedFrameCache::View::View(View&& other) noexcept
+    : _cache(other._cache), _pin(other._pin), _mapping(other._mapping), _size(other._size)
+{
+    other._cache = nullptr;
+    other._mapping = nullptr;
+    other._size = 0;
+}
+
+SharedFrameCache::View& SharedFrameCache::View::operator=(View&& other) noexcept
+{
+    if (this != &other)
+    {
+        this->Reset();
+        this->_cache = other._cache;
+        this->_pin = other._pin;
+        this->_mapping = other._mapping;
+        this->_size = other._size;
+        other._cache = nullptr;
+        other._mapping = nullptr;
+        other._size = 0;
+    }
+    return *this;
+}
+
+const uint8_t* SharedFrameCache::View::GetData() const
+{
+    return static_cast<const uint8_t*>(this->_mapping);
+}
+
+size_t SharedFrameCache::View::GetSize() const
+{
+    return this->_size;
+}
+
+SharedFrameCache::View::operator bool() const
+{
+    return this->_mapping != nullptr;
+}
+
+void SharedFrameCache::View::Unpin()
+{
+    if (this->_cache != nullptr)
+    {
+        this->_cache->Release(this->_pin);
+        this->_cache = nullptr;
+    }
+}
+
+void SharedFrameCache::View::Reset()
+{
+    this->Unpin();
+    if (this->_mapping != nullptr)
+    {
+        Unmap(this->_mapping, this->_size);
+    }
+    this->_mapping = nullptr;
+    this->_size = 0;
+}
+
+SharedFrameCache::~SharedFrameCache()
+{
+    this->Close();
+}
+
+bool SharedFrameCache::IsSupported()
+{
+#ifdef _WIN32
+    return false;
+#else
+    return true;
+#endif
+}
+
+bool SharedFrameCache::Open(const std::string& name, uint64_t budgetBytes, uint32_t slotCount)
+{
+    this->Close();
+    if (!IsValidName(name) || budgetBytes == 0)
+    {
+        return false;
+    }
+#ifdef _WIN32
+    (void)slotCount;
+    return false;
+#else
+    const std::string indexName = GetIndexObjectName(name);
+    int handle = shm_open(indexName.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    const bool created = handle >= 0;
+    if (!created)
+    {
+        handle = shm_open(indexName.c_str(), O_RDWR, 0);
+        if (handle < 0)
+        {
+            return false;
+        }
+    }
+
+    uint32_t slots = MIN_SLOTS;
+    if (created)
+    {
+        while (slots < std::min(slotCount, MAX_SLOTS))
+        {
+            slots *= 2;
+        }
+        const size_t size = sizeof(Header) + (sizeof(Slot) + sizeof(uint64_t)) * slots;
+        if (ftruncate(handle, static_cast<off_t>(size)) != 0)
+        {
+            close(handle);
+            shm_unlink(indexName.c_str());
+            return false;
+        }
+    }
+    else
+    {
+        // The creator may still be sizing and initializing the segment
+        const Header* header = nullptr;
+        for (int attempt = 0; attempt < 100; ++attempt)
+        {
+            struct stat status;
+            if (fstat(handle, &status) == 0 &&
+                static_cast<size_t>(status.st_size) >= sizeof(Header))
+            {
+                void* mapping = mmap(nullptr, sizeof(Header), PROT_READ, MAP_SHARED, handle, 0);
+                if (mapping != MAP_FAILED)
+                {
+                    header = static_cast<const Header*>(mapping);
+                    if (header->magic.load(std::memory_order_acquire) == MAGIC)
+                    {
+                        break;
+                    }
+                    munmap(mapping, sizeof(Header));
+                    header = nullptr;
+                }
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        if (header == nullptr)
+        {
+            close(handle);
+            return false;
+        }
+        const bool compatible = header->version == LAYOUT_VERSION &&
+                                header->slotCount >= MIN_SLOTS &&
+                                header->slotCount <= MAX_SLOTS &&
+                                (header->slotCount & (header->slotCount - 1)) == 0;
+        slots = header->slotCount;
+        munmap(const_cast<Header*>(header), sizeof(Header));
+        if (!compatible)
+        {
+            close(handle);
+            return false;
+        }
+    }
+
+    const size_t size = sizeof(Header) + (sizeof(Slot) + sizeof(uint64_t)) * slots;
+    void* mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, handle, 0);
+    close(handle);
+    if (mapping == MAP_FAILED)
+    {
+        if (created)
+        {
+            shm_unlink(indexName.c_str());
+        }
+        return false;
+    }
+
+    this->_name = name;
+    this->_mappingSize = size;
+    this->_header = static_cast<Header*>(mapping);
+    this->_slots = reinterpret_cast<Slot*>(static_cast<uint8_t*>(mapping) + sizeof(Header));
+    this->_pins = reinterpret_cast<std::atomic<uint64_t>*>(this->_slots + slots);
+    if (created)
+    {
+        // The segment is zero-filled; construct the atomics before publishing it
+        new (this->_header) Header();
+        this->_header->version = LAYOUT_VERSION;
+        this->_header->slotCount = slots;
+        this->_header->budgetBytes = budgetBytes;
+        for (uint32_t slot = 0; slot < slots; ++slot)
+        {
+            new (&this->_slots[slot]) Slot();
+            new (&this->_pins[slot]) std::atomic<uint64_t>(0);
+        }
+        this->_header->magic.store(MAGIC, std::memory_order_release);
+    }
+    return true;
+#endif
+}
+
+void SharedFrameCache::Close()
+{
+    if (this->_header != nullptr)
+    {
+        Unmap(this->_header, this->_mappingSize);
+    }
+    this->_header = nullptr;
+    this->_slots = nullptr;
+    this->_pins = nullptr;
+    this->_mappingSize = 0;
+    this->_name.clear();
+}
+
+bool SharedFrameCache::IsOpen() const
+{
+    return this->_header != nullptr;
+}
+
+SharedFrameCache::View SharedFrameCache::Find(const SharedFrameKey& key)
+{
+    View view;
+    if (!this->IsOpen())
+    {
+        return view;
+    }
+
+    const uint32_t mask = this->_header->slotCount - 1;
+    const uint32_t start = static_cast<uint32_t>(HashKey(key)) & mask;
+    for (uint32_t probe = 0; probe < PROBE_LENGTH; ++probe)
+    {
+        const uint32_t slot = (start + probe) & mask;
+        Slot& entry = this->_slots[slot];
+
+        // The key can only be read once the slot is pinned
+        const uint32_t pin = this->Pin(slot);
+        if (pin == NO_SLOT)
+        {
+            continue;
+        }
+        if (!(entry.key == key))
+        {
+            this->Release(pin);
+            continue;
+        }
+
+        void* mapping = MapFrameObject(this->GetFrameObjectName(slot), entry.size);
+        if (mapping == nullptr)
+        {
+            this->Release(pin);
+            break;
+        }
+        entry.lastUse.store(this->_header->clock.fetch_add(1, std::memory_order_relaxed) + 1,
+                            std::memory_order_relaxed);
+        view._cache = this;
+        view._pin = pin;
+        view._mapping = mapping;
+        view._size = entry.size;
+        this->_hits.fetch_add(1, std::memory_order_relaxed);
+        return view;
+    }
+    this->_misses.fetch_add(1, std::memory_order_relaxed);
+    return view;
+}
+
+bool SharedFrameCache::Insert(const SharedFrameKey& key, const uint8_t* data, size_t size)
+{
+    if (!this->IsOpen() || data == nullptr || size == 0 || size > this->_header->budgetBytes)
+    {
+        return false;
+    }
+
+    // Reserve the bytes first, evicting unpinned frames until they fit the budget
+    uint64_t used = this->_header->usedBytes.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        if (used + size <= this->_header->budgetBytes)
+        {
+            if (this->_header->usedBytes.compare_exchange_weak(used, used + size,
+                                                               std::memory_order_relaxed))
+            {
+                break;
+            }
+            continue;
+        }
+        if (!this->EvictOne())
+        {
+            return false;
+        }
+        used = this->_header->usedBytes.load(std::memory_order_relaxed);
+    }
+
+    // Claim a free slot near the key's hash, or free the least recently used one there
+    const uint32_t mask = this->_header->slotCount - 1;
+    const uint32_t start = static_cast<uint32_t>(HashKey(key)) & mask;
+    const uint32_t writing = WRITING | GetOwnerId() << OWNER_SHIFT;
+    uint32_t claimed = NO_SLOT;
+    for (int attempt = 0; attempt < 2 && claimed == NO_SLOT; ++attempt)
+    {
+        uint32_t oldest = NO_SLOT;
+        uint64_t oldestUse = std::numeric_limits<uint64_t>::max();
+        for (uint32_t probe = 0; probe < PROBE_LENGTH; ++probe)
+        {
+            const uint32_t slot = (start + probe) & mask;
+            Slot& entry = this->_slots[slot];
+            uint32_t control = EMPTY;
+            if (entry.control.compare_exchange_strong(control, writing,
+                                                      std::memory_order_acquire))
+            {
+                // Recorded first, for ReclaimDeadOwners to give the bytes back if we die
+                entry.size = size;
+                claimed = slot;
+                break;
+            }
+            const uint32_t pin = this->Pin(slot);
+            if (pin != NO_SLOT)
+            {
+                // Another process may have published this frame meanwhile
+                const bool duplicate = entry.key == key;
+                this->Release(pin);
+                if (duplicate)
+                {
+                    this->_header->usedBytes.fetch_sub(size, std::memory_order_relaxed);
+                    return false;
+                }
+                const uint64_t lastUse = entry.lastUse.load(std::memory_order_relaxed);
+                if (lastUse < oldestUse)
+                {
+                    oldest = slot;
+                    oldestUse = lastUse;
+                }
+            }
+        }
+        if (claimed == NO_SLOT && (oldest == NO_SLOT || !this->EvictSlot(oldest)) &&
+            !this->ReclaimDeadOwners())
+        {
+            break;
+        }
+    }
+    if (claimed == NO_SLOT)
+    {
+        this->_header->usedBytes.fetch_sub(size, std::memory_order_relaxed);
+        return false;
+    }
+
+    Slot& entry = this->_slots[claimed];
+    entry.key = key;
+    if (!CreateFrameObject(this->GetFrameObjectName(claimed), data, size))
+    {
+        entry.control.store(EMPTY, std::memory_order_release);
+        this->_header->usedBytes.fetch_sub(size, std::memory_order_relaxed);
+        return false;
+    }
+    entry.lastUse.store(this->_header->clock.fetch_add(1, std::memory_order_relaxed) + 1,
+                        std::memory_order_relaxed);
+    this->_header->entries.fetch_add(1, std::memory_order_relaxed);
+    entry.control.store(READY, std::memory_order_release);
+    this->_inserts.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+SharedCacheStats SharedFrameCache::GetStats() const
+{
+    SharedCacheStats stats;
+    stats.hits = this->_hits.load(std::memory_order_relaxed);
+    stats.misses = this->_misses.load(std::memory_order_relaxed);
+    stats.inserts = this->_inserts.load(std::memory_order_relaxed);
+    stats.evictions = this->_evictions.load(std::memory_order_relaxed);
+    if (this->IsOpen())
+    {
+        stats.entries = this->_header->entries.load(std::memory_order_relaxed);
+        stats.usedBytes = this->_header->usedBytes.load(std::memory_order_relaxed);
+        stats.budgetBytes = this->_header->budgetBytes;
+    }
+    return stats;
+}
+
+void SharedFrameCache::Remove(const std::string& name)
+{
+    if (!IsValidName(name))
+    {
+        return;
+    }
+
+    // Frame objects are named after their slots, so the index tells how many there can be
+    SharedFrameCache cache;
+    if (cache.Open(name, 1))
+    {
+        const uint32_t slots = cache._header->slotCount;
+        for (uint32_t slot = 0; slot < slots; ++slot)
+        {
+            RemoveObject(cache.GetFrameObjectName(slot));
+        }
+    }
+    RemoveObject(GetIndexObjectName(name));
+}
+
+bool SharedFrameCache::EvictOne()
+{
+    // Retry when another process takes the chosen frame first
+    for (int attempt = 0; attempt < 4; ++attempt)
+    {
+        uint32_t oldest = NO_SLOT;
+        uint64_t oldestUse = std::numeric_limits<uint64_t>::max();
+        for (uint32_t slot = 0; slot < this->_header->slotCount; ++slot)
+        {
+            const Slot& entry = this->_slots[slot];
+            if (entry.control.load(std::memory_order_relaxed) == READY)
+            {
+                const uint64_t lastUse = entry.lastUse.load(std::memory_order_relaxed);
+                if (lastUse < oldestUse)
+                {
+                    oldest = slot;
+                    oldestUse = lastUse;
+                }
+            }
+        }
+        if (oldest == NO_SLOT)
+        {
+            // Every frame is pinned or being written; some may be held by processes that died
+            return this->ReclaimDeadOwners();
+        }
+        if (this->EvictSlot(oldest))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool SharedFrameCache::EvictSlot(uint32_t slot)
+{
+    // Only a published, unpinned frame can be taken; readers that mapped it keep their copy
+    Slot& entry = this->_slots[slot];
+    uint32_t control = READY;
+    if (!entry.control.compare_exchange_strong(control, EVICTING, std::memory_order_acquire))
+    {
+        return false;
+    }
+    RemoveObject(this->GetFrameObjectName(slot));
+    this->_header->usedBytes.fetch_sub(entry.size, std::memory_order_relaxed);
+    this->_header->entries.fetch_sub(1, std::memory_order_relaxed);
+    entry.control.store(EMPTY, std::memory_order_release);
+    this->_evictions.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool SharedFrameCache::ReclaimDeadOwners()
+{
+    const uint32_t self = GetOwnerId();
+    const uint32_t slots = this->_header->slotCount;
+    bool reclaimed = false;
+
+    // A record is only taken once the pin is counted, so undoing it never underflows
+    for (uint32_t pin = 0; pin < slots; ++pin)
+    {
+        uint64_t record = this->_pins[pin].load(std::memory_order_relaxed);
+        const uint32_t owner = static_cast<uint32_t>(record >> 32);
+        if (record == 0 || owner == self || IsOwnerAlive(owner))
+        {
+            continue;
+        }
+        if (this->_pins[pin].compare_exchange_strong(record, 0, std::memory_order_relaxed))
+        {
+            const uint32_t slot = static_cast<uint32_t>(record) - 1;
+            this->_slots[slot].control.fetch_sub(PIN, std::memory_order_release);
+            reclaimed = true;
+        }
+    }
+
+    // A frame left half-written gives back the bytes its writer reserved
+    for (uint32_t slot = 0; slot < slots; ++slot)
+    {
+        Slot& entry = this->_slots[slot];
+        uint32_t control = entry.control.load(std::memory_order_acquire);
+        const uint32_t owner = control >> OWNER_SHIFT;
+        if ((control & STATE_MASK) != WRITING || owner == self || IsOwnerAlive(owner))
+        {
+            continue;
+        }
+        if (entry.control.compare_exchange_strong(control, EVICTING, std::memory_order_acquire))
+        {
+            RemoveObject(this->GetFrameObjectName(slot));
+            this->_header->usedBytes.fetch_sub(entry.size, std::memory_order_relaxed);
+            entry.control.store(EMPTY, std::memory_order_release);
+            reclaimed = true;
+        }
+    }
+    return reclaimed;
+}
+
+uint32_t SharedFrameCache::Pin(uint32_t slot)
+{
+    std::atomic<uint32_t>& control = this->_slots[slot].control;
+    uint32_t value = control.load(std::memory_order_acquire);
+    for (;;)
+    {
+        if ((value & STATE_MASK) != READY)
+        {
+            return NO_SLOT;
+        }
+        if (control.compare_exchange_weak(value, value + PIN, std::memory_order_acquire))
+        {
+            break;
+        }
+    }
+
+    // Record the pin under this process's id, starting next to the slot's own record
+    const uint64_t record = static_cast<uint64_t>(GetOwnerId()) << 32 | (slot + 1);
+    const uint32_t mask = this->_header->slotCount - 1;
+    for (uint32_t probe = 0; probe <= mask; ++probe)
+    {
+        const uint32_t pin = (slot + probe) & mask;
+        uint64_t free = 0;
+        if (this->_pins[pin].compare_exchange_strong(free, record, std::memory_order_relaxed))
+        {
+            return pin;
+        }
+    }
+    control.fetch_sub(PIN, std::memory_order_release);
+    return NO_SLOT;
+}
+
+void SharedFrameCache::Release(uint32_t pin)
+{
+    // Dying between the two steps then leaks the pin rather than letting it be undone twice
+    const uint64_t record = this->_pins[pin].exchange(0, std::memory_order_relaxed);
+    const uint32_t slot = static_cast<uint32_t>(record) - 1;
+    this->_slots[slot].control.fetch_sub(PIN, std::memory_order_release);
+}
+
+std::string SharedFrameCache::GetFrameObjectName(uint32_t slot) const
+{
+    return GetIndexObjectName(this->_name) + "." + std::to_string(slot);
+}
+
+}  // namespace GifBolt
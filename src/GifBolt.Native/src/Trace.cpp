@@ -0,0 +1,246 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#include "Trace.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace GifBolt
+{
+namespace Trace
+{
+
+namespace Detail
+{
+std::atomic<bool> g_enabled{false};
+}  // namespace Detail
+
+namespace
+{
+constexpr size_t RING_CAPACITY = 8192;  ///< Events kept per thread; older ones are overwritten
+
+struct Event
+{
+    const char* name;
+    uint64_t startNs;
+    uint64_t durationNs;  ///< UINT64_MAX for instant events
+    uint32_t decoderId;
+    uint32_t frameIndex;
+};
+
+/// \brief Events of one thread. Only the owning thread writes; the mutex is uncontended
+/// except while a dump is copying the ring.
+struct ThreadRing
+{
+    std::mutex mutex;
+    std::vector<Event> events;  ///< RING_CAPACITY slots
+    uint64_t written = 0;       ///< Events recorded since the session started
+    uint64_t session = 0;       ///< Session the events belong to
+    uint32_t threadId = 0;      ///< Stable id shown as the trace tid
+    const char* threadName = nullptr;
+};
+
+struct TraceRegistry
+{
+    std::mutex mutex;
+    std::vector<std::shared_ptr<ThreadRing>> rings;  ///< Rings of live and exited threads
+    std::atomic<uint64_t> session{0};                ///< Bumped by Start
+    uint32_t nextThreadId = 1;
+};
+
+TraceRegistry& GetRegistry()
+{
+    static TraceRegistry registry;
+    return registry;
+}
+
+thread_local std::shared_ptr<ThreadRing> t_ring;  ///< Created on the first event
+thread_local const char* t_threadName = nullptr;  ///< Set by SetThreadName
+
+ThreadRing& GetThreadRing()
+{
+    if (!t_ring)
+    {
+        auto ring = std::make_shared<ThreadRing>();
+        ring->events.resize(RING_CAPACITY);
+        ring->threadName = t_threadName;
+
+        TraceRegistry& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        ring->threadId = registry.nextThreadId++;
+        ring->session = registry.session;
+        registry.rings.push_back(ring);
+        t_ring = std::move(ring);
+    }
+    return *t_ring;
+}
+
+void Record(const Event& event)
+{
+    ThreadRing& ring = GetThreadRing();
+    const uint64_t session = GetRegistry().session.load(std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(ring.mutex);
+    if (ring.session != session)
+    {
+        // First event of a new session: drop what the previous one left behind
+        ring.session = session;
+        ring.written = 0;
+    }
+    ring.events[ring.written % RING_CAPACITY] = event;
+    ++ring.written;
+}
+}  // namespace
+
+bool Start()
+{
+#if GIFBOLT_TRACING
+    TraceRegistry& registry = GetRegistry();
+    {
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        ++registry.session;
+        // Rings only referenced here belong to threads that have exited
+        std::vector<std::shared_ptr<ThreadRing>> live;
+        for (std::shared_ptr<ThreadRing>& ring : registry.rings)
+        {
+            if (ring.use_count() > 1)
+            {
+                live.push_back(std::move(ring));
+            }
+        }
+        registry.rings.swap(live);
+    }
+    Detail::g_enabled.store(true, std::memory_order_relaxed);
+    return true;
+#else
+    return false;
+#endif
+}
+
+void Stop()
+{
+    Detail::g_enabled.store(false, std::memory_order_relaxed);
+}
+
+uint64_t NowNs()
+{
+    static const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now() - epoch)
+                                     .count());
+}
+
+void SetThreadName(const char* name)
+{
+    t_threadName = name;
+    if (t_ring)
+    {
+        std::lock_guard<std::mutex> lock(t_ring->mutex);
+        t_ring->threadName = name;
+    }
+}
+
+void RecordSpan(const char* name, uint64_t startNs, uint64_t endNs, uint32_t decoderId,
+                uint32_t frameIndex)
+{
+    Record(Event{name, startNs, endNs - startNs, decoderId, frameIndex});
+}
+
+void RecordInstant(const char* name, uint32_t decoderId, uint32_t frameIndex)
+{
+    Record(Event{name, NowNs(), UINT64_MAX, decoderId, frameIndex});
+}
+
+bool Dump(const std::string& path)
+{
+    std::vector<std::shared_ptr<ThreadRing>> rings;
+    uint64_t session = 0;
+    {
+        TraceRegistry& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        rings = registry.rings;
+        session = registry.session;
+    }
+
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (file == nullptr)
+    {
+        return false;
+    }
+
+    // Chrome trace-event format: timestamps in microseconds, one complete ("X") or
+    // instant ("i") event per record, plus thread-name metadata
+    std::fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n", file);
+    bool first = true;
+    std::vector<Event> events;
+    for (const std::shared_ptr<ThreadRing>& ring : rings)
+    {
+        uint32_t threadId = 0;
+        const char* threadName = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(ring->mutex);
+            threadId = ring->threadId;
+            threadName = ring->threadName;
+            events.clear();
+            if (ring->session == session)
+            {
+                const uint64_t count = std::min<uint64_t>(ring->written, RING_CAPACITY);
+                for (uint64_t i = ring->written - count; i < ring->written; ++i)
+                {
+                    events.push_back(ring->events[i % RING_CAPACITY]);
+                }
+            }
+        }
+
+        if (threadName != nullptr)
+        {
+            std::fprintf(file,
+                         "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%" PRIu32
+                         ",\"args\":{\"name\":\"%s\"}}",
+                         first ? "" : ",\n", threadId, threadName);
+            first = false;
+        }
+
+        for (const Event& event : events)
+        {
+            std::fprintf(file, "%s{\"name\":\"%s\",\"cat\":\"gifbolt\",\"pid\":1,\"tid\":%" PRIu32,
+                         first ? "" : ",\n", event.name, threadId);
+            first = false;
+            if (event.durationNs == UINT64_MAX)
+            {
+                std::fprintf(file, ",\"ph\":\"i\",\"s\":\"t\",\"ts\":%.3f",
+                             static_cast<double>(event.startNs) / 1000.0);
+            }
+            else
+            {
+                std::fprintf(file, ",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f",
+                             static_cast<double>(event.startNs) / 1000.0,
+                             static_cast<double>(event.durationNs) / 1000.0);
+            }
+
+            std::fputs(",\"args\":{", file);
+            bool firstArg = true;
+            if (event.decoderId != NO_DECODER)
+            {
+                std::fprintf(file, "\"decoder\":%" PRIu32, event.decoderId);
+                firstArg = false;
+            }
+            if (event.frameIndex != NO_FRAME)
+            {
+                std::fprintf(file, "%s\"frame\":%" PRIu32, firstArg ? "" : ",", event.frameIndex);
+            }
+            std::fputs("}}", file);
+        }
+    }
+    std::fputs("\n]}\n", file);
+
+    return std::fclose(file) == 0;
+}
+
+}  // namespace Trace
+}  // namespace GifBolt
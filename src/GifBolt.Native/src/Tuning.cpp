@@ -0,0 +1,462 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#include "Tuning.h"
+
+#include "FrameKernels.h"
+#include "IDeviceCommandContext.h"
+#include "PixelConversion.h"
+#include "ThreadPool.h"
+#if defined(__APPLE__)
+#include "MetalDeviceCommandContext.h"
+#endif
+#ifdef _WIN32
+#include "D3D11DeviceCommandContext.h"
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace GifBolt
+{
+namespace Tuning
+{
+
+namespace
+{
+constexpr uint32_t PROFILE_VERSION = 1;
+/// A split conversion must beat the serial one by this factor at a size and every larger one
+constexpr double PARALLEL_MARGIN = 0.9;
+/// Fewer threads are chosen when they come within this factor of the fastest count
+constexpr double THREAD_COUNT_SLACK = 1.05;
+/// Conversion sizes timed for the crossover: 2^12 (64x64) to 2^21 (about 1448x1448) pixels
+constexpr uint32_t MIN_CONVERT_SIZE_LOG2 = 12;
+constexpr uint32_t MAX_CONVERT_SIZE_LOG2 = 21;
+/// Square source sides timed for the GPU scaling crossover
+constexpr uint32_t GPU_SCALE_SIDES[] = {64, 128, 256, 512, 1024, 2048};
+/// Each timed batch repeats the kernel for at least this long
+constexpr uint64_t MIN_BATCH_NS = 200000;
+constexpr int BATCHES = 5;
+
+struct ProfileState
+{
+    std::mutex mutex;
+    TuningProfile profile;
+    bool environmentChecked = false;
+};
+
+ProfileState& GetState()
+{
+    static ProfileState state;
+    return state;
+}
+
+uint32_t GetHardwareThreads()
+{
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+uint64_t NowNs()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+}
+
+/// \brief Times a kernel: the best per-call time over BATCHES batches, after a warm-up call.
+template <typename Kernel>
+uint64_t MeasureNs(Kernel&& kernel)
+{
+    uint64_t start = NowNs();
+    kernel();
+    const uint64_t warmUpNs = std::max<uint64_t>(NowNs() - start, 1);
+    const uint64_t calls = std::max<uint64_t>(1, MIN_BATCH_NS / warmUpNs);
+
+    uint64_t best = UINT64_MAX;
+    for (int batch = 0; batch < BATCHES; ++batch)
+    {
+        start = NowNs();
+        for (uint64_t call = 0; call < calls; ++call)
+        {
+            kernel();
+        }
+        best = std::min(best, (NowNs() - start) / calls);
+    }
+    return best;
+}
+
+/// \brief Splits a conversion across a pool the way the decoder does: pool workers take
+/// chunks 1..N-1 while the calling thread converts chunk 0.
+class ParallelConverter
+{
+   public:
+    explicit ParallelConverter(uint32_t workers) : _pool(workers)
+    {
+    }
+
+    void Convert(const uint8_t* source, uint8_t* dest, size_t pixelCount, uint32_t threads)
+    {
+        {
+            std::lock_guard<std::mutex> lock(this->_mutex);
+            this->_pending = threads - 1;
+        }
+        for (uint32_t chunk = 1; chunk < threads; ++chunk)
+        {
+            const size_t start = pixelCount * chunk / threads;
+            const size_t end = pixelCount * (chunk + 1) / threads;
+            this->_pool.Post(
+                [this, source, dest, start, end]()
+                {
+                    Renderer::PixelFormats::ConvertRGBAToBGRAPremultipliedChunk(source, dest,
+                                                                                start, end);
+                    std::lock_guard<std::mutex> lock(this->_mutex);
+                    if (--this->_pending == 0)
+                    {
+                        this->_done.notify_one();
+                    }
+                });
+        }
+        Renderer::PixelFormats::ConvertRGBAToBGRAPremultipliedChunk(source, dest, 0,
+                                                                    pixelCount / threads);
+        std::unique_lock<std::mutex> lock(this->_mutex);
+        this->_done.wait(lock, [this]() { return this->_pending == 0; });
+    }
+
+   private:
+    ThreadPool _pool;
+    std::mutex _mutex;
+    std::condition_variable _done;
+    uint32_t _pending = 0;
+};
+
+/// \brief Finds the smallest size from which the faster alternative wins at every larger size.
+/// \param wins wins[i] is true when the alternative won at the i-th (increasing) size.
+/// \return The index of that size, or wins.size() if the alternative does not win at the
+///         largest size.
+size_t FindCrossover(const std::vector<bool>& wins)
+{
+    size_t crossover = wins.size();
+    for (size_t i = wins.size(); i > 0 && wins[i - 1]; --i)
+    {
+        crossover = i - 1;
+    }
+    return crossover;
+}
+
+void MeasureConversion(TuningProfile& profile)
+{
+    const uint32_t hardwareThreads = profile.hardwareThreads;
+    const size_t maxPixels = size_t{1} << MAX_CONVERT_SIZE_LOG2;
+    std::vector<uint32_t> source(maxPixels);
+    std::mt19937 random(0x74756E65);
+    for (uint32_t& pixel : source)
+    {
+        // A realistic alpha mix: mostly opaque, some transparent, a few translucent pixels
+        const uint32_t kind = random() % 8;
+        const uint32_t alpha = kind == 0 ? 0 : (kind == 1 ? random() & 0xFF : 0xFF);
+        pixel = (alpha << 24) | (random() & 0x00FFFFFF);
+    }
+    std::vector<uint8_t> dest(maxPixels * 4);
+    const auto* sourceBytes = reinterpret_cast<const uint8_t*>(source.data());
+
+    if (hardwareThreads < 2)
+    {
+        profile.convertThreads = 1;
+        profile.workerThreads = 1;
+        profile.convertParallelMinPixels = UINT64_MAX;
+        return;
+    }
+
+    // Thread count: conversion is memory-bound, so the gain flattens out before the core count
+    ParallelConverter converter(hardwareThreads - 1);
+    std::vector<uint32_t> counts;
+    for (uint32_t threads = 1; threads < hardwareThreads; threads *= 2)
+    {
+        counts.push_back(threads);
+    }
+    counts.push_back(hardwareThreads);
+    std::vector<uint64_t> times;
+    for (const uint32_t threads : counts)
+    {
+        times.push_back(MeasureNs([&]
+                                  {
+                                      converter.Convert(sourceBytes, dest.data(), maxPixels,
+                                                        threads);
+                                  }));
+    }
+    const uint64_t fastest = *std::min_element(times.begin(), times.end());
+    uint32_t chosen = counts.back();
+    for (size_t i = 0; i < counts.size(); ++i)
+    {
+        if (static_cast<double>(times[i]) <= static_cast<double>(fastest) * THREAD_COUNT_SLACK)
+        {
+            chosen = counts[i];
+            break;
+        }
+    }
+    profile.convertThreads = chosen;
+    profile.workerThreads = std::max(1u, chosen - 1);
+    if (chosen == 1)
+    {
+        profile.convertParallelMinPixels = UINT64_MAX;
+        return;
+    }
+
+    // Crossover: the smallest size from which splitting wins, including the fork/join cost
+    std::vector<bool> wins;
+    for (uint32_t log2 = MIN_CONVERT_SIZE_LOG2; log2 <= MAX_CONVERT_SIZE_LOG2; ++log2)
+    {
+        const size_t pixels = size_t{1} << log2;
+        const uint64_t serialNs = MeasureNs(
+            [&]
+            {
+                Renderer::PixelFormats::ConvertRGBAToBGRAPremultipliedChunk(
+                    sourceBytes, dest.data(), 0, pixels);
+            });
+        const uint64_t parallelNs = MeasureNs(
+            [&] { converter.Convert(sourceBytes, dest.data(), pixels, chosen); });
+        wins.push_back(static_cast<double>(parallelNs) <
+                       static_cast<double>(serialNs) * PARALLEL_MARGIN);
+    }
+    const size_t crossover = FindCrossover(wins);
+    profile.convertParallelMinPixels =
+        crossover < wins.size() ? uint64_t{1} << (MIN_CONVERT_SIZE_LOG2 + crossover) : UINT64_MAX;
+}
+
+void MeasureGpuScaling(TuningProfile& profile, Renderer::IDeviceCommandContext* gpu)
+{
+    std::shared_ptr<Renderer::IDeviceCommandContext> created;
+    if (gpu == nullptr)
+    {
+        try
+        {
+#if defined(__APPLE__)
+            created = std::make_shared<Renderer::MetalDeviceCommandContext>();
+#elif defined(_WIN32)
+            created = std::make_shared<Renderer::D3D11DeviceCommandContext>();
+#endif
+        }
+        catch (...)
+        {
+            created = nullptr;
+        }
+        gpu = created.get();
+    }
+    if (gpu == nullptr)
+    {
+        return;  // No GPU path to choose; the default never applies
+    }
+
+    const uint32_t maxSide = GPU_SCALE_SIDES[std::size(GPU_SCALE_SIDES) - 1];
+    std::vector<uint8_t> source(static_cast<size_t>(maxSide) * maxSide * 4, 0x80);
+    std::vector<uint8_t> dest(source.size());
+    std::vector<bool> wins;
+    for (const uint32_t side : GPU_SCALE_SIDES)
+    {
+        const uint32_t target = std::max(1u, side * 3 / 5);
+        bool gpuWorked = true;
+        const uint64_t gpuNs = MeasureNs(
+            [&]
+            {
+                gpuWorked = gpuWorked && gpu->ScaleImageGPU(source.data(), side, side,
+                                                            dest.data(), target, target,
+                                                            static_cast<int>(
+                                                                ScalingFilter::Bilinear));
+            });
+        if (!gpuWorked)
+        {
+            profile.gpuScaleMinPixels = UINT64_MAX;
+            return;
+        }
+        const uint64_t cpuNs = MeasureNs(
+            [&]
+            {
+                Kernels::ScaleBGRA(source.data(), side, side, dest.data(), target, target,
+                                   ScalingFilter::Bilinear);
+            });
+        wins.push_back(gpuNs < cpuNs);
+    }
+    const size_t crossover = FindCrossover(wins);
+    profile.gpuScaleMinPixels =
+        crossover < wins.size()
+            ? static_cast<uint64_t>(GPU_SCALE_SIDES[crossover]) * GPU_SCALE_SIDES[crossover]
+            : UINT64_MAX;
+}
+
+/// \brief Fills in the hardware-dependent defaults of a profile.
+TuningProfile Resolve(TuningProfile profile)
+{
+    const uint32_t hardwareThreads = GetHardwareThreads();
+    if (profile.workerThreads == 0)
+    {
+        profile.workerThreads = std::max(1u, hardwareThreads - 1);
+    }
+    if (profile.convertThreads == 0)
+    {
+        profile.convertThreads = profile.workerThreads + 1;
+    }
+    if (profile.hardwareThreads == 0)
+    {
+        profile.hardwareThreads = hardwareThreads;
+    }
+    return profile;
+}
+}  // namespace
+
+TuningProfile GetProfile()
+{
+    ProfileState& state = GetState();
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        if (state.environmentChecked)
+        {
+            return Resolve(state.profile);
+        }
+        state.environmentChecked = true;
+    }
+
+    // First use: calibrate if asked to. Concurrent first callers get the defaults meanwhile.
+    const char* path = std::getenv("GIFBOLT_CALIBRATE");
+    if (path != nullptr && path[0] != '\0')
+    {
+        return CalibrateOrLoad(std::strcmp(path, "1") == 0 ? std::string() : std::string(path));
+    }
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return Resolve(state.profile);
+}
+
+void SetProfile(const TuningProfile& profile)
+{
+    ProfileState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.profile = profile;
+    state.environmentChecked = true;  // The host's choice wins over GIFBOLT_CALIBRATE
+}
+
+void ResetProfile()
+{
+    SetProfile(TuningProfile());
+}
+
+TuningProfile Calibrate(Renderer::IDeviceCommandContext* gpu)
+{
+    TuningProfile profile;
+    profile.hardwareThreads = GetHardwareThreads();
+    profile.source = TuningSource::Calibrated;
+    MeasureConversion(profile);
+    MeasureGpuScaling(profile, gpu);
+    return profile;
+}
+
+bool SaveProfile(const TuningProfile& profile, const std::string& path)
+{
+    const TuningProfile resolved = Resolve(profile);
+    std::ofstream file(path, std::ios::trunc);
+    file << "# GifBolt tuning profile; delete to recalibrate\n"
+         << "version=" << PROFILE_VERSION << "\n"
+         << "hardwareThreads=" << resolved.hardwareThreads << "\n"
+         << "convertParallelMinPixels=" << resolved.convertParallelMinPixels << "\n"
+         << "convertThreads=" << resolved.convertThreads << "\n"
+         << "workerThreads=" << resolved.workerThreads << "\n"
+         << "gpuScaleMinPixels=" << resolved.gpuScaleMinPixels << "\n";
+    file.close();
+    return static_cast<bool>(file);
+}
+
+bool LoadProfile(const std::string& path, TuningProfile& profile)
+{
+    std::ifstream file(path);
+    if (!file)
+    {
+        return false;
+    }
+
+    TuningProfile loaded;
+    uint64_t version = 0;
+    uint32_t found = 0;
+    std::string line;
+    while (std::getline(file, line))
+    {
+        const size_t equals = line.find('=');
+        if (line.empty() || line[0] == '#' || equals == std::string::npos)
+        {
+            continue;
+        }
+        const std::string key = line.substr(0, equals);
+        char* end = nullptr;
+        const char* text = line.c_str() + equals + 1;
+        const unsigned long long value = std::strtoull(text, &end, 10);
+        if (end == text)
+        {
+            return false;
+        }
+        if (key == "version")
+        {
+            version = value;
+        }
+        else if (key == "hardwareThreads")
+        {
+            loaded.hardwareThreads = static_cast<uint32_t>(value);
+        }
+        else if (key == "convertParallelMinPixels")
+        {
+            loaded.convertParallelMinPixels = value;
+        }
+        else if (key == "convertThreads")
+        {
+            loaded.convertThreads = static_cast<uint32_t>(value);
+        }
+        else if (key == "workerThreads")
+        {
+            loaded.workerThreads = static_cast<uint32_t>(value);
+        }
+        else if (key == "gpuScaleMinPixels")
+        {
+            loaded.gpuScaleMinPixels = value;
+        }
+        else
+        {
+            continue;
+        }
+        ++found;
+    }
+
+    // A profile measured on a differently sized host would pick the wrong thread counts
+    if (version != PROFILE_VERSION || found != 6 ||
+        loaded.hardwareThreads != GetHardwareThreads() || loaded.convertThreads == 0 ||
+        loaded.workerThreads == 0)
+    {
+        return false;
+    }
+    loaded.source = TuningSource::Loaded;
+    profile = loaded;
+    return true;
+}
+
+TuningProfile CalibrateOrLoad(const std::string& path)
+{
+    TuningProfile profile;
+    if (path.empty() || !LoadProfile(path, profile))
+    {
+        profile = Calibrate();
+        if (!path.empty())
+        {
+            SaveProfile(profile, path);
+        }
+    }
+    SetProfile(profile);
+    return Resolve(profile);
+}
+
+}  // namespace Tuning
+}  // namespace GifBolt
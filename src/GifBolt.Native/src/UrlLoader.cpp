@@ -0,0 +1,1179 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#include "UrlLoader.h"
+
+#include "gifbolt_version.h"
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <fcntl.h>
+#include <netdb.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include <cerrno>
+#endif
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+
+namespace GifBolt
+{
+namespace Net
+{
+
+namespace
+{
+#ifdef _WIN32
+using SocketHandle = SOCKET;
+const SocketHandle INVALID_SOCKET_HANDLE = INVALID_SOCKET;
+#else
+using SocketHandle = int;
+const SocketHandle INVALID_SOCKET_HANDLE = -1;
+#endif
+
+constexpr int RECEIVE_TIMEOUT_MS = 200;         ///< Poll interval while waiting for bytes
+constexpr int IDLE_TIMEOUT_MS = 30000;          ///< Give up when a server stalls this long
+constexpr int CONNECT_TIMEOUT_MS = 10000;       ///< Default connect wait per address
+constexpr int MAX_REDIRECTS = 5;                ///< Redirect hops followed per request
+constexpr size_t MAX_HEADER_BYTES = 64 * 1024;  ///< Upper bound for a response head
+constexpr size_t RECEIVE_CHUNK_BYTES = 16 * 1024;
+
+void CloseSocket(SocketHandle socketHandle)
+{
+#ifdef _WIN32
+    closesocket(socketHandle);
+#else
+    close(socketHandle);
+#endif
+}
+
+/// \brief Connect wait per address (see SetConnectTimeoutMs).
+std::atomic<int>& GetConnectTimeoutSetting()
+{
+    static std::atomic<int> timeoutMs{CONNECT_TIMEOUT_MS};
+    return timeoutMs;
+}
+
+bool SetBlocking(SocketHandle socketHandle, bool blocking)
+{
+#ifdef _WIN32
+    u_long nonBlocking = blocking ? 0 : 1;
+    return ioctlsocket(socketHandle, FIONBIO, &nonBlocking) == 0;
+#else
+    const int flags = fcntl(socketHandle, F_GETFL, 0);
+    if (flags < 0)
+    {
+        return false;
+    }
+    const int updated = blocking ? (flags & ~O_NONBLOCK) : (flags | O_NONBLOCK);
+    return fcntl(socketHandle, F_SETFL, updated) == 0;
+#endif
+}
+
+/// \brief Connects without blocking longer than timeoutMs, so that an unreachable host
+///        fails the load instead of stalling it for the system's connect timeout.
+bool ConnectWithTimeout(SocketHandle socketHandle, const addrinfo& address, int timeoutMs)
+{
+    if (!SetBlocking(socketHandle, false))
+    {
+        return false;
+    }
+    if (connect(socketHandle, address.ai_addr, static_cast<int>(address.ai_addrlen)) != 0)
+    {
+#ifdef _WIN32
+        const bool pending = WSAGetLastError() == WSAEWOULDBLOCK;
+        WSAPOLLFD poller{};
+        poller.fd = socketHandle;
+        poller.events = POLLOUT;
+        if (!pending || WSAPoll(&poller, 1, timeoutMs) != 1)
+        {
+            return false;
+        }
+#else
+        const bool pending = errno == EINPROGRESS;
+        pollfd poller{};
+        poller.fd = socketHandle;
+        poller.events = POLLOUT;
+        int ready = -1;
+        if (pending)
+        {
+            do
+            {
+                ready = poll(&poller, 1, timeoutMs);
+            } while (ready < 0 && errno == EINTR);
+        }
+        if (ready != 1)
+        {
+            return false;
+        }
+#endif
+        // Writable means the attempt ended; SO_ERROR tells whether it succeeded
+        int error = 0;
+        socklen_t length = sizeof(error);
+        if (getsockopt(socketHandle, SOL_SOCKET, SO_ERROR, reinterpret_cast<char*>(&error),
+                       &length) != 0 ||
+            error != 0)
+        {
+            return false;
+        }
+    }
+    return SetBlocking(socketHandle, true);
+}
+
+bool InitializeSockets()
+{
+#ifdef _WIN32
+    static const bool initialized = []()
+    {
+        WSADATA data;
+        return WSAStartup(MAKEWORD(2, 2), &data) == 0;
+    }();
+    return initialized;
+#else
+    return true;
+#endif
+}
+
+std::string ToLower(std::string text)
+{
+    std::transform(text.begin(), text.end(), text.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return text;
+}
+
+std::string Trim(const std::string& text)
+{
+    const size_t first = text.find_first_not_of(" \t");
+    if (first == std::string::npos)
+    {
+        return std::string();
+    }
+    const size_t last = text.find_last_not_of(" \t");
+    return text.substr(first, last - first + 1);
+}
+
+bool StartsWithNoCase(const std::string& text, const std::string& prefix)
+{
+    return text.size() >= prefix.size() && ToLower(text.substr(0, prefix.size())) == prefix;
+}
+
+int64_t NowSeconds()
+{
+    return std::chrono::duration_cast<std::chrono::seconds>(
+               std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+/// \brief Components of an http:// URL.
+struct HttpUrl
+{
+    std::string host;          ///< Host name or address (without IPv6 brackets)
+    std::string port = "80";   ///< Service port
+    std::string target = "/";  ///< Request target (path and query)
+};
+
+bool ParseHttpUrl(const std::string& url, HttpUrl& parsed)
+{
+    const std::string scheme = "http://";
+    if (!StartsWithNoCase(url, scheme))
+    {
+        return false;
+    }
+
+    std::string rest = url.substr(scheme.size());
+    const size_t fragment = rest.find('#');
+    if (fragment != std::string::npos)
+    {
+        rest.erase(fragment);
+    }
+
+    const size_t targetStart = rest.find_first_of("/?");
+    std::string authority = rest.substr(0, targetStart);
+    parsed.target = (targetStart == std::string::npos) ? "/" : rest.substr(targetStart);
+    if (parsed.target[0] == '?')
+    {
+        parsed.target.insert(0, "/");
+    }
+
+    const size_t userInfoEnd = authority.rfind('@');
+    if (userInfoEnd != std::string::npos)
+    {
+        authority.erase(0, userInfoEnd + 1);
+    }
+
+    std::string port;
+    if (!authority.empty() && authority[0] == '[')
+    {
+        const size_t close = authority.find(']');
+        if (close == std::string::npos)
+        {
+            return false;
+        }
+        parsed.host = authority.substr(1, close - 1);
+        if (close + 1 < authority.size())
+        {
+            if (authority[close + 1] != ':')
+            {
+                return false;
+            }
+            port = authority.substr(close + 2);
+        }
+    }
+    else
+    {
+        const size_t colon = authority.rfind(':');
+        parsed.host = authority.substr(0, colon);
+        if (colon != std::string::npos)
+        {
+            port = authority.substr(colon + 1);
+        }
+    }
+
+    parsed.port = port.empty() ? "80" : port;
+    const bool numericPort =
+        std::all_of(parsed.port.begin(), parsed.port.end(),
+                    [](unsigned char c) { return std::isdigit(c) != 0; });
+    return !parsed.host.empty() && numericPort;
+}
+
+std::string HostHeader(const HttpUrl& url)
+{
+    std::string host =
+        (url.host.find(':') != std::string::npos) ? "[" + url.host + "]" : url.host;
+    if (url.port != "80")
+    {
+        host += ":" + url.port;
+    }
+    return host;
+}
+
+/// \brief Resolves a Location header against the URL that produced the redirect.
+std::string ResolveLocation(const HttpUrl& base, const std::string& location)
+{
+    if (StartsWithNoCase(location, "http://") || StartsWithNoCase(location, "https://"))
+    {
+        return location;
+    }
+    if (location.compare(0, 2, "//") == 0)
+    {
+        return "http:" + location;
+    }
+
+    const std::string origin = "http://" + HostHeader(base);
+    if (!location.empty() && location[0] == '/')
+    {
+        return origin + location;
+    }
+
+    const std::string path = base.target.substr(0, base.target.find('?'));
+    return origin + path.substr(0, path.rfind('/') + 1) + location;
+}
+
+/// \class Connection
+/// \brief Blocking TCP connection with a short receive timeout.
+class Connection
+{
+   public:
+    Connection() = default;
+    Connection(const Connection&) = delete;
+    Connection& operator=(const Connection&) = delete;
+
+    ~Connection()
+    {
+        if (this->_socket != INVALID_SOCKET_HANDLE)
+        {
+            CloseSocket(this->_socket);
+        }
+    }
+
+    bool Open(const HttpUrl& url)
+    {
+        addrinfo hints{};
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+
+        addrinfo* results = nullptr;
+        if (getaddrinfo(url.host.c_str(), url.port.c_str(), &hints, &results) != 0)
+        {
+            return false;
+        }
+
+        for (addrinfo* address = results;
+             address != nullptr && this->_socket == INVALID_SOCKET_HANDLE;
+             address = address->ai_next)
+        {
+            SocketHandle candidate =
+                socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+            if (candidate == INVALID_SOCKET_HANDLE)
+            {
+                continue;
+            }
+            if (ConnectWithTimeout(candidate, *address, GetConnectTimeoutSetting().load()))
+            {
+                this->_socket = candidate;
+            }
+            else
+            {
+                CloseSocket(candidate);
+            }
+        }
+        freeaddrinfo(results);
+
+        if (this->_socket == INVALID_SOCKET_HANDLE)
+        {
+            return false;
+        }
+
+        // A short receive timeout lets a stalled transfer notice that it was abandoned
+#ifdef _WIN32
+        const DWORD timeout = RECEIVE_TIMEOUT_MS;
+        setsockopt(this->_socket, SOL_SOCKET, SO_RCVTIMEO,
+                   reinterpret_cast<const char*>(&timeout), sizeof(timeout));
+#else
+        timeval timeout{};
+        timeout.tv_usec = RECEIVE_TIMEOUT_MS * 1000;
+        setsockopt(this->_socket, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+#endif
+#ifdef SO_NOSIGPIPE
+        const int noSigPipe = 1;
+        setsockopt(this->_socket, SOL_SOCKET, SO_NOSIGPIPE, &noSigPipe, sizeof(noSigPipe));
+#endif
+        return true;
+    }
+
+    bool SendAll(const std::string& data)
+    {
+#ifdef MSG_NOSIGNAL
+        const int flags = MSG_NOSIGNAL;
+#else
+        const int flags = 0;
+#endif
+        size_t sent = 0;
+        while (sent < data.size())
+        {
+            const auto result = send(this->_socket, data.data() + sent,
+                                     static_cast<int>(data.size() - sent), flags);
+            if (result <= 0)
+            {
+                return false;
+            }
+            sent += static_cast<size_t>(result);
+        }
+        return true;
+    }
+
+    /// \brief Receives bytes from the peer.
+    /// \param timedOut Set to true when no bytes arrived within the receive timeout.
+    /// \return Bytes received, 0 when the peer closed the connection, or -1 on error/timeout.
+    int Receive(uint8_t* buffer, size_t length, bool& timedOut)
+    {
+        timedOut = false;
+        const auto result =
+            recv(this->_socket, reinterpret_cast<char*>(buffer), static_cast<int>(length), 0);
+        if (result >= 0)
+        {
+            return static_cast<int>(result);
+        }
+#ifdef _WIN32
+        timedOut = WSAGetLastError() == WSAETIMEDOUT;
+#else
+        timedOut = (errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR);
+#endif
+        return -1;
+    }
+
+   private:
+    SocketHandle _socket = INVALID_SOCKET_HANDLE;
+};
+
+/// \class ResponseReader
+/// \brief Buffered reader over a response that gives up on stalls or when asked to stop.
+class ResponseReader
+{
+   public:
+    ResponseReader(Connection& connection, std::function<bool()> shouldStop)
+        : _connection(connection), _shouldStop(std::move(shouldStop))
+    {
+    }
+
+    /// \brief Receives more bytes from the connection.
+    /// \return false when the connection closed, failed, stalled or was abandoned.
+    bool Fill()
+    {
+        uint8_t chunk[RECEIVE_CHUNK_BYTES];
+        int idleMs = 0;
+        for (;;)
+        {
+            if (this->_shouldStop())
+            {
+                return false;
+            }
+
+            bool timedOut = false;
+            const int received = this->_connection.Receive(chunk, sizeof(chunk), timedOut);
+            if (received > 0)
+            {
+                if (this->_position == this->_pending.size())
+                {
+                    this->_pending.clear();
+                    this->_position = 0;
+                }
+                this->_pending.insert(this->_pending.end(), chunk, chunk + received);
+                return true;
+            }
+            if (received == 0)
+            {
+                this->_closedByPeer = true;
+                return false;
+            }
+
+            idleMs += RECEIVE_TIMEOUT_MS;
+            if (!timedOut || idleMs >= IDLE_TIMEOUT_MS)
+            {
+                return false;
+            }
+        }
+    }
+
+    size_t Available() const
+    {
+        return this->_pending.size() - this->_position;
+    }
+
+    const uint8_t* Data() const
+    {
+        return this->_pending.data() + this->_position;
+    }
+
+    void Consume(size_t count)
+    {
+        this->_position += count;
+    }
+
+    /// \brief Reads one CRLF (or LF) terminated line, without the terminator.
+    bool ReadLine(std::string& line)
+    {
+        for (;;)
+        {
+            const auto begin =
+                this->_pending.begin() + static_cast<std::ptrdiff_t>(this->_position);
+            const auto newline = std::find(begin, this->_pending.end(), '\n');
+            if (newline != this->_pending.end())
+            {
+                line.assign(begin, newline);
+                if (!line.empty() && line.back() == '\r')
+                {
+                    line.pop_back();
+                }
+                this->_position = static_cast<size_t>(newline - this->_pending.begin()) + 1;
+                return true;
+            }
+            if (this->Available() > MAX_HEADER_BYTES || !this->Fill())
+            {
+                return false;
+            }
+        }
+    }
+
+    bool ClosedByPeer() const
+    {
+        return this->_closedByPeer;
+    }
+
+   private:
+    Connection& _connection;
+    std::function<bool()> _shouldStop;
+    std::vector<uint8_t> _pending;  ///< Received but not yet consumed bytes
+    size_t _position = 0;           ///< Read position within _pending
+    bool _closedByPeer = false;
+};
+
+/// \brief Status line and header fields of a response (names lower-cased).
+struct ResponseHead
+{
+    int status = 0;
+    std::map<std::string, std::string> headers;
+
+    std::string Header(const char* name) const
+    {
+        const auto found = this->headers.find(name);
+        return (found != this->headers.end()) ? found->second : std::string();
+    }
+};
+
+bool ReadResponseHead(ResponseReader& reader, ResponseHead& head)
+{
+    std::string line;
+    if (!reader.ReadLine(line) || line.compare(0, 5, "HTTP/") != 0)
+    {
+        return false;
+    }
+
+    const size_t space = line.find(' ');
+    if (space == std::string::npos)
+    {
+        return false;
+    }
+    head.status = std::atoi(line.c_str() + space + 1);
+
+    size_t headerBytes = 0;
+    while (reader.ReadLine(line))
+    {
+        if (line.empty())
+        {
+            return true;
+        }
+
+        headerBytes += line.size();
+        if (headerBytes > MAX_HEADER_BYTES)
+        {
+            return false;
+        }
+
+        const size_t colon = line.find(':');
+        if (colon != std::string::npos)
+        {
+            head.headers[ToLower(Trim(line.substr(0, colon)))] = Trim(line.substr(colon + 1));
+        }
+    }
+    return false;
+}
+
+using BodySink = std::function<void(const uint8_t*, size_t)>;
+
+bool ReadFixedBody(ResponseReader& reader, uint64_t length, const BodySink& sink)
+{
+    while (length > 0)
+    {
+        if (reader.Available() == 0 && !reader.Fill())
+        {
+            return false;
+        }
+        const size_t count = static_cast<size_t>(std::min<uint64_t>(length, reader.Available()));
+        sink(reader.Data(), count);
+        reader.Consume(count);
+        length -= count;
+    }
+    return true;
+}
+
+bool ReadChunkedBody(ResponseReader& reader, const BodySink& sink)
+{
+    std::string line;
+    for (;;)
+    {
+        if (!reader.ReadLine(line))
+        {
+            return false;
+        }
+
+        char* end = nullptr;
+        const unsigned long long chunkSize = std::strtoull(line.c_str(), &end, 16);
+        if (end == line.c_str())
+        {
+            return false;
+        }
+
+        if (chunkSize == 0)
+        {
+            // Skip trailer fields; a server that closes right after the last chunk is fine
+            while (reader.ReadLine(line) && !line.empty())
+            {
+            }
+            return true;
+        }
+
+        if (!ReadFixedBody(reader, chunkSize, sink) || !reader.ReadLine(line))
+        {
+            return false;
+        }
+    }
+}
+
+bool ReadBodyUntilClose(ResponseReader& reader, const BodySink& sink)
+{
+    for (;;)
+    {
+        if (reader.Available() > 0)
+        {
+            sink(reader.Data(), reader.Available());
+            reader.Consume(reader.Available());
+        }
+        if (!reader.Fill())
+        {
+            return reader.ClosedByPeer();
+        }
+    }
+}
+
+/// \brief Process-wide cache settings (intentionally leaked: detached downloads may
+///        still read them during static destruction).
+struct CacheSettings
+{
+    std::mutex mutex;
+    std::string directory;
+};
+
+CacheSettings& GetCacheSettings()
+{
+    static auto* settings = new CacheSettings();
+    return *settings;
+}
+
+/// \brief Validators and freshness of a cached response.
+struct CacheEntry
+{
+    std::string etag;          ///< ETag validator, if any
+    std::string lastModified;  ///< Last-Modified validator, if any
+    int64_t expiresAt = 0;     ///< Unix time the entry stays fresh until (0 = revalidate)
+    std::filesystem::path bodyPath;
+};
+
+std::filesystem::path CacheFilePath(const std::string& directory, const std::string& url,
+                                    const char* extension)
+{
+    // FNV-1a keeps file names short and file-system safe
+    uint64_t hash = 1469598103934665603ULL;
+    for (unsigned char c : url)
+    {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+
+    char name[17];
+    std::snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(hash));
+    return std::filesystem::path(directory) / (std::string(name) + extension);
+}
+
+/// \brief Gets a file name no other writer uses, for a cache file being written. Processes
+///        sharing the cache directory may store the same URL at once, so each writes its own
+///        file and renames it into place once complete.
+std::filesystem::path PartialCacheFilePath(const std::string& directory, const std::string& url)
+{
+#ifdef _WIN32
+    const unsigned long processId = GetCurrentProcessId();
+#else
+    const unsigned long processId = static_cast<unsigned long>(getpid());
+#endif
+    static std::atomic<uint32_t> sequence{std::random_device()()};
+
+    char extension[40];
+    std::snprintf(extension, sizeof(extension), ".%lu.%08x.part", processId,
+                  static_cast<unsigned>(sequence.fetch_add(1, std::memory_order_relaxed)));
+    return CacheFilePath(directory, url, extension);
+}
+
+bool LoadCacheEntry(const std::string& directory, const std::string& url, CacheEntry& entry)
+{
+    if (directory.empty())
+    {
+        return false;
+    }
+
+    std::ifstream meta(CacheFilePath(directory, url, ".meta"));
+    if (!meta)
+    {
+        return false;
+    }
+
+    std::string line;
+    std::string cachedUrl;
+    while (std::getline(meta, line))
+    {
+        const size_t space = line.find(' ');
+        const std::string key = line.substr(0, space);
+        const std::string value = (space == std::string::npos) ? "" : line.substr(space + 1);
+        if (key == "url")
+        {
+            cachedUrl = value;
+        }
+        else if (key == "etag")
+        {
+            entry.etag = value;
+        }
+        else if (key == "last-modified")
+        {
+            entry.lastModified = value;
+        }
+        else if (key == "expires")
+        {
+            entry.expiresAt = std::strtoll(value.c_str(), nullptr, 10);
+        }
+    }
+
+    entry.bodyPath = CacheFilePath(directory, url, ".body");
+    std::error_code error;
+    return cachedUrl == url && std::filesystem::is_regular_file(entry.bodyPath, error);
+}
+
+void StoreCacheEntry(const std::string& directory, const std::string& url,
+                     const CacheEntry& entry)
+{
+    // Written aside and renamed, so that readers never see half an entry
+    const std::filesystem::path partialPath = PartialCacheFilePath(directory, url);
+    std::ofstream meta(partialPath, std::ios::trunc);
+    meta << "url " << url << '\n'
+         << "etag " << entry.etag << '\n'
+         << "last-modified " << entry.lastModified << '\n'
+         << "expires " << entry.expiresAt << '\n';
+    meta.close();
+
+    std::error_code error;
+    if (!meta.fail())
+    {
+        std::filesystem::rename(partialPath, CacheFilePath(directory, url, ".meta"), error);
+    }
+    if (meta.fail() || error)
+    {
+        std::filesystem::remove(partialPath, error);
+    }
+}
+
+/// \brief Computes how long a response stays fresh from its Cache-Control header.
+/// \param store Set to false when the response must not be written to disk.
+/// \return Unix time the response stays fresh until, or 0 if it must be revalidated.
+int64_t GetFreshUntil(const ResponseHead& head, bool& store)
+{
+    store = true;
+    bool noCache = false;
+    int64_t maxAge = 0;
+
+    std::stringstream directives(ToLower(head.Header("cache-control")));
+    std::string directive;
+    while (std::getline(directives, directive, ','))
+    {
+        directive = Trim(directive);
+        if (directive == "no-store")
+        {
+            store = false;
+        }
+        else if (directive == "no-cache")
+        {
+            noCache = true;
+        }
+        else if (directive.compare(0, 8, "max-age=") == 0)
+        {
+            maxAge = std::strtoll(directive.c_str() + 8, nullptr, 10);
+        }
+    }
+
+    return (!noCache && maxAge > 0) ? NowSeconds() + maxAge : 0;
+}
+
+bool AppendFile(StreamBuffer& stream, const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+        return false;
+    }
+
+    std::vector<uint8_t> chunk(64 * 1024);
+    while (file)
+    {
+        file.read(reinterpret_cast<char*>(chunk.data()),
+                  static_cast<std::streamsize>(chunk.size()));
+        stream.Append(chunk.data(), static_cast<size_t>(file.gcount()));
+    }
+    return file.eof();
+}
+
+bool IsRedirect(int status)
+{
+    return status == 301 || status == 302 || status == 303 || status == 307 || status == 308;
+}
+
+/// \brief Performs the HTTP exchange for url, following redirects, and fills stream.
+bool Download(const std::string& url, StreamBuffer& stream,
+              const std::function<bool()>& shouldStop)
+{
+    const std::string cacheDirectory = GetCacheDirectory();
+    CacheEntry cached;
+    const bool haveCached = LoadCacheEntry(cacheDirectory, url, cached);
+
+    std::string currentUrl = url;
+    for (int redirect = 0; redirect <= MAX_REDIRECTS; ++redirect)
+    {
+        HttpUrl target;
+        Connection connection;
+        if (!ParseHttpUrl(currentUrl, target) || !connection.Open(target))
+        {
+            return false;
+        }
+
+        std::string request = "GET " + target.target + " HTTP/1.1\r\n";
+        request += "Host: " + HostHeader(target) + "\r\n";
+        request += "User-Agent: GifBolt/" GIFBOLT_VERSION_STRING "\r\n";
+        request += "Accept: image/gif, */*\r\n";
+        request += "Accept-Encoding: identity\r\n";
+        request += "Connection: close\r\n";
+        // Validators belong to the URL the cache entry was stored under
+        if (haveCached && redirect == 0)
+        {
+            if (!cached.etag.empty())
+            {
+                request += "If-None-Match: " + cached.etag + "\r\n";
+            }
+            if (!cached.lastModified.empty())
+            {
+                request += "If-Modified-Since: " + cached.lastModified + "\r\n";
+            }
+        }
+        request += "\r\n";
+
+        if (!connection.SendAll(request))
+        {
+            return false;
+        }
+
+        ResponseReader reader(connection, shouldStop);
+        ResponseHead head;
+        do
+        {
+            head = ResponseHead();
+            if (!ReadResponseHead(reader, head))
+            {
+                return false;
+            }
+        } while (head.status >= 100 && head.status < 200);
+
+        if (head.status == 304 && haveCached && redirect == 0)
+        {
+            // Not modified: extend freshness and serve the body from disk
+            bool store = true;
+            cached.expiresAt = GetFreshUntil(head, store);
+            StoreCacheEntry(cacheDirectory, url, cached);
+            return AppendFile(stream, cached.bodyPath);
+        }
+
+        if (IsRedirect(head.status))
+        {
+            const std::string location = head.Header("location");
+            if (location.empty())
+            {
+                return false;
+            }
+            currentUrl = ResolveLocation(target, location);
+            continue;
+        }
+
+        if (head.status != 200)
+        {
+            return false;
+        }
+
+        // Stream the body to readers and, when it can be revalidated later, to the cache
+        CacheEntry fresh;
+        bool store = true;
+        fresh.etag = head.Header("etag");
+        fresh.lastModified = head.Header("last-modified");
+        fresh.expiresAt = GetFreshUntil(head, store);
+        const bool cacheable = !cacheDirectory.empty() && store &&
+                               (fresh.expiresAt > 0 || !fresh.etag.empty() ||
+                                !fresh.lastModified.empty());
+
+        std::error_code fileError;
+        std::filesystem::path partialPath;
+        std::ofstream cacheFile;
+        if (cacheable)
+        {
+            std::filesystem::create_directories(cacheDirectory, fileError);
+            partialPath = PartialCacheFilePath(cacheDirectory, url);
+            cacheFile.open(partialPath, std::ios::binary | std::ios::trunc);
+        }
+
+        const BodySink sink = [&stream, &cacheFile](const uint8_t* data, size_t length)
+        {
+            stream.Append(data, length);
+            if (cacheFile.is_open())
+            {
+                cacheFile.write(reinterpret_cast<const char*>(data),
+                                static_cast<std::streamsize>(length));
+            }
+        };
+
+        bool complete = false;
+        const std::string contentLength = head.Header("content-length");
+        if (ToLower(head.Header("transfer-encoding")).find("chunked") != std::string::npos)
+        {
+            complete = ReadChunkedBody(reader, sink);
+        }
+        else if (!contentLength.empty())
+        {
+            complete =
+                ReadFixedBody(reader, std::strtoull(contentLength.c_str(), nullptr, 10), sink);
+        }
+        else
+        {
+            complete = ReadBodyUntilClose(reader, sink);
+        }
+
+        if (cacheFile.is_open())
+        {
+            cacheFile.close();
+            if (complete && !cacheFile.fail())
+            {
+                // Drop the old validators first so they never describe the new body
+                std::filesystem::remove(CacheFilePath(cacheDirectory, url, ".meta"), fileError);
+                std::filesystem::rename(partialPath, CacheFilePath(cacheDirectory, url, ".body"),
+                                        fileError);
+                if (!fileError)
+                {
+                    StoreCacheEntry(cacheDirectory, url, fresh);
+                }
+            }
+            if (!complete || cacheFile.fail() || fileError)
+            {
+                std::filesystem::remove(partialPath, fileError);
+            }
+        }
+        return complete;
+    }
+    return false;
+}
+
+/// \brief Downloads in flight keyed by URL, so concurrent requests share one transfer
+///        (intentionally leaked, like CacheSettings).
+struct DownloadRegistry
+{
+    std::mutex mutex;
+    std::unordered_map<std::string, std::weak_ptr<StreamBuffer>> inFlight;
+};
+
+DownloadRegistry& GetRegistry()
+{
+    static auto* registry = new DownloadRegistry();
+    return *registry;
+}
+}  // namespace
+
+void StreamBuffer::Append(const uint8_t* data, size_t length)
+{
+    if (length == 0)
+    {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(this->_mutex);
+        this->_data.insert(this->_data.end(), data, data + length);
+    }
+    this->_dataAvailable.notify_all();
+}
+
+void StreamBuffer::Finish(bool succeeded)
+{
+    {
+        std::lock_guard<std::mutex> lock(this->_mutex);
+        this->_complete = true;
+        this->_succeeded = succeeded;
+    }
+    this->_dataAvailable.notify_all();
+}
+
+size_t StreamBuffer::Read(size_t offset, uint8_t* destination, size_t length,
+                          const std::atomic<bool>& cancel)
+{
+    std::unique_lock<std::mutex> lock(this->_mutex);
+    this->_dataAvailable.wait(lock,
+                              [&]()
+                              {
+                                  return this->_complete || cancel ||
+                                         this->_data.size() >= offset + length;
+                              });
+
+    if (offset >= this->_data.size())
+    {
+        return 0;
+    }
+
+    const size_t count = std::min(length, this->_data.size() - offset);
+    std::memcpy(destination, this->_data.data() + offset, count);
+    return count;
+}
+
+void StreamBuffer::WakeReaders()
+{
+    {
+        // Taking the lock orders the caller's cancel flag store before the wake-up
+        std::lock_guard<std::mutex> lock(this->_mutex);
+    }
+    this->_dataAvailable.notify_all();
+}
+
+bool StreamBuffer::IsComplete() const
+{
+    std::lock_guard<std::mutex> lock(this->_mutex);
+    return this->_complete;
+}
+
+bool StreamBuffer::Succeeded() const
+{
+    std::lock_guard<std::mutex> lock(this->_mutex);
+    return this->_succeeded;
+}
+
+size_t StreamBuffer::GetSize() const
+{
+    std::lock_guard<std::mutex> lock(this->_mutex);
+    return this->_data.size();
+}
+
+std::shared_ptr<StreamBuffer> OpenUrl(const std::string& url)
+{
+    HttpUrl parsed;
+    if (!ParseHttpUrl(url, parsed) || !InitializeSockets())
+    {
+        return nullptr;
+    }
+
+    // Fresh cache entries are served without touching the network. Bodies are read outside
+    // the registry lock, which every URL open in the process shares.
+    CacheEntry cached;
+    if (LoadCacheEntry(GetCacheDirectory(), url, cached) && cached.expiresAt > NowSeconds())
+    {
+        auto stream = std::make_shared<StreamBuffer>();
+        if (AppendFile(*stream, cached.bodyPath))
+        {
+            stream->Finish(true);
+            return stream;
+        }
+    }
+
+    DownloadRegistry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    // Join a transfer already in flight for the same URL
+    const auto found = registry.inFlight.find(url);
+    if (found != registry.inFlight.end())
+    {
+        if (std::shared_ptr<StreamBuffer> existing = found->second.lock())
+        {
+            return existing;
+        }
+        registry.inFlight.erase(found);
+    }
+
+    auto stream = std::make_shared<StreamBuffer>();
+    registry.inFlight[url] = stream;
+    std::thread(
+        [url, stream]()
+        {
+            // Stop early once every reader has released the stream
+            const auto abandoned = [&stream]() { return stream.use_count() <= 1; };
+
+            bool succeeded = false;
+            try
+            {
+                succeeded = Download(url, *stream, abandoned);
+            }
+            catch (...)
+            {
+                succeeded = false;
+            }
+
+            {
+                DownloadRegistry& downloads = GetRegistry();
+                std::lock_guard<std::mutex> registryLock(downloads.mutex);
+                const auto entry = downloads.inFlight.find(url);
+                if (entry != downloads.inFlight.end() && entry->second.lock() == stream)
+                {
+                    downloads.inFlight.erase(entry);
+                }
+            }
+            stream->Finish(succeeded);
+        })
+        .detach();
+
+    return stream;
+}
+
+bool FileUrlToPath(const std::string& url, std::string& path)
+{
+    const std::string scheme = "file://";
+    if (!StartsWithNoCase(url, scheme))
+    {
+        return false;
+    }
+
+    std::string rest = url.substr(scheme.size());
+    // file://localhost/dir/a.gif names the same file as file:///dir/a.gif
+    if (StartsWithNoCase(rest, "localhost/"))
+    {
+        rest.erase(0, 9);
+    }
+
+    std::string decoded;
+    decoded.reserve(rest.size());
+    for (size_t i = 0; i < rest.size(); ++i)
+    {
+        if (rest[i] == '%' && i + 2 < rest.size() &&
+            std::isxdigit(static_cast<unsigned char>(rest[i + 1])) &&
+            std::isxdigit(static_cast<unsigned char>(rest[i + 2])))
+        {
+            decoded += static_cast<char>(std::stoi(rest.substr(i + 1, 2), nullptr, 16));
+            i += 2;
+        }
+        else
+        {
+            decoded += rest[i];
+        }
+    }
+
+#ifdef _WIN32
+    // file:///C:/dir/a.gif names C:/dir/a.gif
+    if (decoded.size() >= 3 && decoded[0] == '/' &&
+        std::isalpha(static_cast<unsigned char>(decoded[1])) && decoded[2] == ':')
+    {
+        decoded.erase(0, 1);
+    }
+#endif
+
+    path = decoded;
+    return !path.empty();
+}
+
+void SetConnectTimeoutMs(int timeoutMs)
+{
+    GetConnectTimeoutSetting().store(timeoutMs > 0 ? timeoutMs : CONNECT_TIMEOUT_MS);
+}
+
+int GetConnectTimeoutMs()
+{
+    return GetConnectTimeoutSetting().load();
+}
+
+void SetCacheDirectory(const std::string& directory)
+{
+    CacheSettings& settings = GetCacheSettings();
+    std::lock_guard<std::mutex> lock(settings.mutex);
+    settings.directory = directory;
+}
+
+std::string GetCacheDirectory()
+{
+    CacheSettings& settings = GetCacheSettings();
+    std::lock_guard<std::mutex> lock(settings.mutex);
+    return settings.directory;
+}
+
+}  // namespace Net
+}  // namespace GifBolt
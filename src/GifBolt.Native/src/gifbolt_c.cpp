@@ -1,18 +1,97 @@
 // SPDX-License-Identifier: MIT
 #include "gifbolt_c.h"
 
+#include <algorithm>
+#include <climits>
 #include <cstdint>
 #include <new>
+#include <vector>
 
+#include "CallRecorder.h"
 #include "GifBoltRenderer.h"
 #include "GifDecoder.h"
+#include "PreviewProxy.h"
+#include "SharedFrameCache.h"
+#include "Trace.h"
+#include "Tuning.h"
 
 using namespace GifBolt;
+using CallRecorder::CallId;
+using CallRecorder::ScopedCall;
+
+namespace
+{
+TrimLevel ClampTrimLevel(int level)
+{
+    if (level <= 0)
+    {
+        return TrimLevel::Caches;
+    }
+    if (level >= static_cast<int>(TrimLevel::Complete))
+    {
+        return TrimLevel::Complete;
+    }
+    return static_cast<TrimLevel>(level);
+}
+
+void CopyStats(const DecoderStats& source, gb_decoder_stats_t* dest)
+{
+    dest->frame_cache_hits = source.frameCacheHits;
+    dest->frame_cache_misses = source.frameCacheMisses;
+    dest->frame_cache_evictions = source.frameCacheEvictions;
+    dest->mip_cache_hits = source.mipCacheHits;
+    dest->mip_cache_misses = source.mipCacheMisses;
+    dest->mip_cache_evictions = source.mipCacheEvictions;
+    dest->frames_decoded = source.framesDecoded;
+    dest->frames_composed = source.framesComposed;
+    dest->frames_converted = source.framesConverted;
+    dest->frames_scaled = source.framesScaled;
+    dest->lzw_time_ns = source.lzwTimeNs;
+    dest->compose_time_ns = source.composeTimeNs;
+    dest->convert_time_ns = source.convertTimeNs;
+    dest->scale_time_ns = source.scaleTimeNs;
+    dest->thread_cpu_time_ns = source.threadCpuTimeNs;
+    dest->raster_bytes = source.rasterBytes;
+    dest->canvas_bytes = source.canvasBytes;
+    dest->cache_bytes = source.cacheBytes;
+    dest->pool_bytes = source.poolBytes;
+}
+
+void CopyPlaybackStats(const PlaybackStats& source, gb_playback_stats_t* dest)
+{
+    static_assert(GB_LATENESS_BUCKET_COUNT == LATENESS_BUCKET_COUNT,
+                  "gb_playback_stats_t must have one histogram bucket per PlaybackStats bucket");
+    dest->frames_presented = source.framesPresented;
+    dest->frames_late = source.framesLate;
+    dest->frames_dropped = source.framesDropped;
+    dest->late_schedule = source.lateSchedule;
+    dest->late_decode_not_ready = source.lateDecodeNotReady;
+    dest->late_conversion = source.lateConversion;
+    dest->late_lock_wait = source.lateLockWait;
+    dest->total_lateness_ns = source.totalLatenessNs;
+    dest->max_lateness_ns = source.maxLatenessNs;
+    for (uint32_t bucket = 0; bucket < LATENESS_BUCKET_COUNT; ++bucket)
+    {
+        dest->lateness_histogram[bucket] = source.latenessHistogram[bucket];
+    }
+}
+
+void CopyTuningProfile(const TuningProfile& source, gb_tuning_profile_t* dest)
+{
+    dest->convert_parallel_min_pixels = source.convertParallelMinPixels;
+    dest->convert_threads = source.convertThreads;
+    dest->worker_threads = source.workerThreads;
+    dest->gpu_scale_min_pixels = source.gpuScaleMinPixels;
+    dest->hardware_threads = source.hardwareThreads;
+    dest->source = static_cast<uint32_t>(source.source);
+}
+}  // namespace
 
 extern "C"
 {
     GB_API void gb_decoder_set_min_frame_delay_ms(gb_decoder_t decoder, int minDelayMs)
     {
+        ScopedCall call(CallId::SetMinFrameDelayMs, decoder, {minDelayMs});
         if (decoder == nullptr)
         {
             return;
@@ -33,6 +112,7 @@ extern "C"
 
     GB_API void gb_decoder_set_max_cached_frames(gb_decoder_t decoder, unsigned int maxFrames)
     {
+        ScopedCall call(CallId::SetMaxCachedFrames, decoder, {maxFrames});
         if (decoder == nullptr)
         {
             return;
@@ -51,11 +131,234 @@ extern "C"
         return static_cast<unsigned int>(ptr->GetMaxCachedFrames());
     }
 
+    GB_API void gb_decoder_set_mipmaps_enabled(gb_decoder_t decoder, int enabled)
+    {
+        ScopedCall call(CallId::SetMipmapsEnabled, decoder, {enabled});
+        if (decoder == nullptr)
+        {
+            return;
+        }
+        auto* ptr = reinterpret_cast<GifDecoder*>(decoder);
+        ptr->SetMipmapsEnabled(enabled != 0);
+    }
+
+    GB_API int gb_decoder_get_mipmaps_enabled(gb_decoder_t decoder)
+    {
+        if (decoder == nullptr)
+        {
+            return 0;
+        }
+        auto* ptr = reinterpret_cast<GifDecoder*>(decoder);
+        return ptr->GetMipmapsEnabled() ? 1 : 0;
+    }
+
+    GB_API int64_t gb_decoder_trim_memory(gb_decoder_t decoder, int level)
+    {
+        ScopedCall call(CallId::TrimMemory, decoder, {level});
+        if (decoder == nullptr)
+        {
+            return 0;
+        }
+        auto* ptr = reinterpret_cast<GifDecoder*>(decoder);
+        return call.Result(static_cast<int64_t>(ptr->TrimMemory(ClampTrimLevel(level))));
+    }
+
+    GB_API int64_t gb_trim_memory(int level)
+    {
+        ScopedCall call(CallId::TrimAllMemory, nullptr, {level});
+        return call.Result(static_cast<int64_t>(GifDecoder::TrimAllMemory(ClampTrimLevel(level))));
+    }
+
+    GB_API int gb_decoder_get_stats(gb_decoder_t decoder, gb_decoder_stats_t* stats)
+    {
+        if (decoder == nullptr || stats == nullptr)
+        {
+            return 0;
+        }
+        auto* ptr = reinterpret_cast<GifDecoder*>(decoder);
+        CopyStats(ptr->GetStats(), stats);
+        return 1;
+    }
+
+    GB_API int gb_get_process_stats(gb_decoder_stats_t* stats)
+    {
+        if (stats == nullptr)
+        {
+            return 0;
+        }
+        CopyStats(GifDecoder::GetProcessStats(), stats);
+        return 1;
+    }
+
+    GB_API void gb_decoder_record_frame_presented(gb_decoder_t decoder, int index,
+                                                  int64_t latenessNs, int droppedFrames)
+    {
+        ScopedCall call(CallId::RecordFramePresented, decoder, {index, latenessNs, droppedFrames});
+        if (decoder == nullptr || index < 0)
+        {
+            return;
+        }
+        auto* ptr = reinterpret_cast<GifDecoder*>(decoder);
+        ptr->RecordFramePresented(static_cast<uint32_t>(index),
+                                  latenessNs > 0 ? static_cast<uint64_t>(latenessNs) : 0,
+                                  droppedFrames > 0 ? static_cast<uint32_t>(droppedFrames) : 0);
+    }
+
+    GB_API int gb_decoder_present_frame(gb_decoder_t decoder, int index, int64_t latenessNs,
+                                        int droppedFrames, gb_frame_status_t* status)
+    {
+        ScopedCall call(CallId::PresentFrame, decoder, {index, latenessNs, droppedFrames});
+        if (decoder == nullptr || index < 0)
+        {
+            return 0;
+        }
+        auto* ptr = reinterpret_cast<GifDecoder*>(decoder);
+        const auto frameIndex = static_cast<uint32_t>(index);
+        ptr->SetCurrentFrame(frameIndex);
+        ptr->RecordFramePresented(frameIndex,
+                                  latenessNs > 0 ? static_cast<uint64_t>(latenessNs) : 0,
+                                  droppedFrames > 0 ? static_cast<uint32_t>(droppedFrames) : 0);
+        if (status != nullptr)
+        {
+            // A frame that was shown has been read, so its delay is available without waiting
+            const bool available = frameIndex < ptr->GetAvailableFrameCount();
+            status->frame_delay_ms =
+                available ? static_cast<int32_t>(ptr->GetFrameDelayMs(frameIndex)) : 0;
+            status->available_frame_count = static_cast<int32_t>(ptr->GetAvailableFrameCount());
+            status->load_complete = ptr->IsLoadComplete() ? 1 : 0;
+        }
+        return call.Result(1);
+    }
+
+    GB_API int gb_decoder_get_playback_stats(gb_decoder_t decoder, gb_playback_stats_t* stats)
+    {
+        if (decoder == nullptr || stats == nullptr)
+        {
+            return 0;
+        }
+        auto* ptr = reinterpret_cast<GifDecoder*>(decoder);
+        CopyPlaybackStats(ptr->GetPlaybackStats(), stats);
+        return 1;
+    }
+
+    GB_API int gb_get_process_playback_stats(gb_playback_stats_t* stats)
+    {
+        if (stats == nullptr)
+        {
+            return 0;
+        }
+        CopyPlaybackStats(GifDecoder::GetProcessPlaybackStats(), stats);
+        return 1;
+    }
+
+    GB_API int gb_trace_start(void)
+    {
+        return Trace::Start() ? 1 : 0;
+    }
+
+    GB_API void gb_trace_stop(void)
+    {
+        Trace::Stop();
+    }
+
+    GB_API int gb_trace_dump(const char* path)
+    {
+        if (path == nullptr)
+        {
+            return 0;
+        }
+        try
+        {
+            return Trace::Dump(path) ? 1 : 0;
+        }
+        catch (...)
+        {
+            return 0;
+        }
+    }
+
+    GB_API int gb_record_start(const char* path, int flags)
+    {
+        if (path == nullptr)
+        {
+            return 0;
+        }
+        try
+        {
+            return CallRecorder::Start(path, (flags & GB_RECORD_EMBED_BUFFERS) != 0) ? 1 : 0;
+        }
+        catch (...)
+        {
+            return 0;
+        }
+    }
+
+    GB_API void gb_record_stop(void)
+    {
+        CallRecorder::Stop();
+    }
+
+    GB_API int gb_calibrate(const char* profilePath, gb_tuning_profile_t* profile)
+    {
+        try
+        {
+            const TuningProfile calibrated =
+                Tuning::CalibrateOrLoad(profilePath != nullptr ? profilePath : "");
+            if (profile != nullptr)
+            {
+                CopyTuningProfile(calibrated, profile);
+            }
+            return 1;
+        }
+        catch (...)
+        {
+            return 0;
+        }
+    }
+
+    GB_API int gb_get_tuning_profile(gb_tuning_profile_t* profile)
+    {
+        if (profile == nullptr)
+        {
+            return 0;
+        }
+        try
+        {
+            CopyTuningProfile(Tuning::GetProfile(), profile);
+            return 1;
+        }
+        catch (...)
+        {
+            return 0;
+        }
+    }
+
+    GB_API int gb_set_tuning_profile(const gb_tuning_profile_t* profile)
+    {
+        if (profile == nullptr)
+        {
+            Tuning::ResetProfile();
+            return 1;
+        }
+        TuningProfile tuning;
+        tuning.convertParallelMinPixels = profile->convert_parallel_min_pixels;
+        tuning.convertThreads = profile->convert_threads;
+        tuning.workerThreads = profile->worker_threads;
+        tuning.gpuScaleMinPixels = profile->gpu_scale_min_pixels;
+        tuning.hardwareThreads = profile->hardware_threads;
+        tuning.source = TuningSource::Host;
+        Tuning::SetProfile(tuning);
+        return 1;
+    }
+
     GB_API gb_decoder_t gb_decoder_create(void)
     {
+        ScopedCall call(CallId::DecoderCreate, nullptr);
         try
         {
-            return reinterpret_cast<gb_decoder_t>(new GifDecoder());
+            auto* decoder = new GifDecoder();
+            call.SetCreatedHandle(decoder);
+            return reinterpret_cast<gb_decoder_t>(decoder);
         }
         catch (...)
         {
@@ -65,6 +368,7 @@ extern "C"
 
     GB_API void gb_decoder_destroy(gb_decoder_t decoder)
     {
+        ScopedCall call(CallId::DecoderDestroy, decoder);
         if (decoder == nullptr)
         {
             return;
@@ -75,69 +379,126 @@ extern "C"
 
     GB_API int gb_decoder_load_from_path(gb_decoder_t decoder, const char* path)
     {
+        ScopedCall call(CallId::LoadFromPath, decoder);
+        call.SetText(path);
         if ((decoder == nullptr) || (path == nullptr))
         {
             return 0;
         }
         auto* ptr = reinterpret_cast<GifDecoder*>(decoder);
-        return ptr->LoadFromFile(path) ? 1 : 0;
+        return call.Result(ptr->LoadFromFile(path) ? 1 : 0);
     }
 
     GB_API int gb_decoder_load_from_memory(gb_decoder_t decoder, const void* data, int length)
     {
+        ScopedCall call(CallId::LoadFromMemory, decoder, {length});
         if ((decoder == nullptr) || (data == nullptr) || (length <= 0))
         {
             return 0;
         }
 
+        call.SetContent(data, static_cast<size_t>(length));
         auto* ptr = reinterpret_cast<GifDecoder*>(decoder);
         const auto* bytes = reinterpret_cast<const uint8_t*>(data);
-        return ptr->LoadFromMemory(bytes, static_cast<size_t>(length)) ? 1 : 0;
+        return call.Result(ptr->LoadFromMemory(bytes, static_cast<size_t>(length)) ? 1 : 0);
+    }
+
+    GB_API int gb_decoder_load_from_url(gb_decoder_t decoder, const char* url)
+    {
+        ScopedCall call(CallId::LoadFromUrl, decoder);
+        call.SetText(url);
+        if ((decoder == nullptr) || (url == nullptr))
+        {
+            return 0;
+        }
+        try
+        {
+            auto* ptr = reinterpret_cast<GifDecoder*>(decoder);
+            return call.Result(ptr->LoadFromUrl(url) ? 1 : 0);
+        }
+        catch (...)
+        {
+            return 0;
+        }
+    }
+
+    GB_API int gb_decoder_get_available_frame_count(gb_decoder_t decoder)
+    {
+        ScopedCall call(CallId::GetAvailableFrameCount, decoder);
+        if (decoder == nullptr)
+        {
+            return 0;
+        }
+        auto* ptr = reinterpret_cast<GifDecoder*>(decoder);
+        return call.Result(static_cast<int>(ptr->GetAvailableFrameCount()));
+    }
+
+    GB_API int gb_decoder_is_load_complete(gb_decoder_t decoder)
+    {
+        ScopedCall call(CallId::IsLoadComplete, decoder);
+        if (decoder == nullptr)
+        {
+            return 1;
+        }
+        auto* ptr = reinterpret_cast<GifDecoder*>(decoder);
+        return call.Result(ptr->IsLoadComplete() ? 1 : 0);
+    }
+
+    GB_API void gb_set_http_cache_directory(const char* directory)
+    {
+        ScopedCall call(CallId::SetHttpCacheDirectory, nullptr);
+        call.SetText(directory);
+        GifDecoder::SetHttpCacheDirectory((directory != nullptr) ? directory : "");
     }
 
     GB_API int gb_decoder_get_frame_count(gb_decoder_t decoder)
     {
+        ScopedCall call(CallId::GetFrameCount, decoder);
         if (decoder == nullptr)
         {
             return 0;
         }
         auto* ptr = reinterpret_cast<GifDecoder*>(decoder);
-        return static_cast<int>(ptr->GetFrameCount());
+        return call.Result(static_cast<int>(ptr->GetFrameCount()));
     }
 
     GB_API int gb_decoder_get_width(gb_decoder_t decoder)
     {
+        ScopedCall call(CallId::GetWidth, decoder);
         if (decoder == nullptr)
         {
             return 0;
         }
         auto* ptr = reinterpret_cast<GifDecoder*>(decoder);
-        return static_cast<int>(ptr->GetWidth());
+        return call.Result(static_cast<int>(ptr->GetWidth()));
     }
 
     GB_API int gb_decoder_get_height(gb_decoder_t decoder)
     {
+        ScopedCall call(CallId::GetHeight, decoder);
         if (decoder == nullptr)
         {
             return 0;
         }
         auto* ptr = reinterpret_cast<GifDecoder*>(decoder);
-        return static_cast<int>(ptr->GetHeight());
+        return call.Result(static_cast<int>(ptr->GetHeight()));
     }
 
     GB_API int gb_decoder_get_loop_count(gb_decoder_t decoder)
     {
+        ScopedCall call(CallId::GetLoopCount, decoder);
         if (decoder == nullptr)
         {
             return 0;
         }
         auto* ptr = reinterpret_cast<GifDecoder*>(decoder);
         // We currently only know if it's looping; not the exact count.
-        return ptr->IsLooping() ? -1 : 0;
+        return call.Result(ptr->IsLooping() ? -1 : 0);
     }
 
     GB_API int gb_decoder_get_frame_delay_ms(gb_decoder_t decoder, int index)
     {
+        ScopedCall call(CallId::GetFrameDelayMs, decoder, {index});
         if (decoder == nullptr)
         {
             return 0;
@@ -149,8 +510,34 @@ extern "C"
         }
         try
         {
-            const GifFrame& f = ptr->GetFrame(static_cast<uint32_t>(index));
-            return static_cast<int>(f.delayMs);
+            return call.Result(
+                static_cast<int>(ptr->GetFrameDelayMs(static_cast<uint32_t>(index))));
+        }
+        catch (...)
+        {
+            return 0;
+        }
+    }
+
+    GB_API int gb_decoder_get_info(gb_decoder_t decoder, gb_decoder_info_t* info)
+    {
+        ScopedCall call(CallId::GetInfo, decoder);
+        if (decoder == nullptr || info == nullptr)
+        {
+            return 0;
+        }
+        auto* ptr = reinterpret_cast<GifDecoder*>(decoder);
+        try
+        {
+            const std::vector<uint32_t>& delays = ptr->GetFrameDelaysMs();
+            info->width = static_cast<int32_t>(ptr->GetWidth());
+            info->height = static_cast<int32_t>(ptr->GetHeight());
+            info->frame_count = static_cast<int32_t>(delays.size());
+            info->loop_count = ptr->IsLooping() ? -1 : 0;
+            info->background_color = ptr->GetBackgroundColor();
+            info->min_frame_delay_ms = static_cast<int32_t>(ptr->GetMinFrameDelayMs());
+            info->frame_delays_ms = delays.data();
+            return call.Result(1);
         }
         catch (...)
         {
@@ -161,6 +548,7 @@ extern "C"
     GB_API const void* gb_decoder_get_frame_pixels_rgba32(gb_decoder_t decoder, int index,
                                                           int* byteCount)
     {
+        ScopedCall call(CallId::GetFramePixelsRGBA32, decoder, {index});
         if (byteCount != nullptr)
         {
             *byteCount = 0;
@@ -182,7 +570,7 @@ extern "C"
                 // f.pixels.size() is in uint32_t units (RGBA32)
                 *byteCount = static_cast<int>(f.pixels.size() * sizeof(uint32_t));
             }
-            return reinterpret_cast<const void*>(f.pixels.data());
+            return call.Result(reinterpret_cast<const void*>(f.pixels.data()));
         }
         catch (...)
         {
@@ -193,6 +581,7 @@ extern "C"
     GB_API const void* gb_decoder_get_frame_pixels_bgra32_premultiplied(gb_decoder_t decoder,
                                                                         int index, int* byteCount)
     {
+        ScopedCall call(CallId::GetFramePixelsBGRA32, decoder, {index});
         if (byteCount != nullptr)
         {
             *byteCount = 0;
@@ -221,7 +610,7 @@ extern "C"
                 const GifFrame& f = ptr->GetFrame(static_cast<uint32_t>(index));
                 *byteCount = static_cast<int>(f.pixels.size() * sizeof(uint32_t));
             }
-            return reinterpret_cast<const void*>(bgraPixels);
+            return call.Result(reinterpret_cast<const void*>(bgraPixels));
         }
         catch (...)
         {
@@ -229,10 +618,31 @@ extern "C"
         }
     }
 
+    GB_API int gb_decoder_get_frame_alpha(gb_decoder_t decoder, int index)
+    {
+        ScopedCall call(CallId::GetFrameAlpha, decoder, {index});
+        if (decoder == nullptr || index < 0)
+        {
+            return -1;
+        }
+        auto* ptr = reinterpret_cast<GifDecoder*>(decoder);
+        try
+        {
+            return call.Result(
+                static_cast<int>(ptr->GetFrameAlpha(static_cast<uint32_t>(index))));
+        }
+        catch (...)
+        {
+            return -1;
+        }
+    }
+
     GB_API const void* gb_decoder_get_frame_pixels_bgra32_premultiplied_scaled(
         gb_decoder_t decoder, int index, int targetWidth, int targetHeight, int* outWidth,
         int* outHeight, int* byteCount, int filterType)
     {
+        ScopedCall call(CallId::GetFramePixelsBGRA32Scaled, decoder,
+                        {index, targetWidth, targetHeight, filterType});
         if (byteCount != nullptr)
         {
             *byteCount = 0;
@@ -281,7 +691,7 @@ extern "C"
                 *byteCount = static_cast<int>(actualWidth * actualHeight * 4);
             }
 
-            return reinterpret_cast<const void*>(bgraPixels);
+            return call.Result(reinterpret_cast<const void*>(bgraPixels));
         }
         catch (...)
         {
@@ -289,18 +699,75 @@ extern "C"
         }
     }
 
+    GB_API int gb_decoder_copy_frame_pixels_bgra32_premultiplied(gb_decoder_t decoder, int index,
+                                                                 void* dest, int destStride,
+                                                                 int destByteCount)
+    {
+        ScopedCall call(CallId::CopyFramePixelsBGRA32, decoder, {index, destStride});
+        if (decoder == nullptr || dest == nullptr || index < 0 || destStride <= 0 ||
+            destByteCount <= 0)
+        {
+            return 0;
+        }
+        auto* ptr = reinterpret_cast<GifDecoder*>(decoder);
+        try
+        {
+            return call.Result(ptr->CopyFramePixelsBGRA32Premultiplied(
+                                   static_cast<uint32_t>(index), static_cast<uint8_t*>(dest),
+                                   static_cast<size_t>(destStride),
+                                   static_cast<size_t>(destByteCount))
+                                   ? 1
+                                   : 0);
+        }
+        catch (...)
+        {
+            return 0;
+        }
+    }
+
+    GB_API int gb_decoder_copy_frame_pixels_bgra32_premultiplied_scaled(
+        gb_decoder_t decoder, int index, int targetWidth, int targetHeight, int filterType,
+        void* dest, int destStride, int destByteCount)
+    {
+        ScopedCall call(CallId::CopyFramePixelsBGRA32Scaled, decoder,
+                        {index, targetWidth, targetHeight, filterType});
+        if (decoder == nullptr || dest == nullptr || index < 0 || targetWidth <= 0 ||
+            targetHeight <= 0 || destStride <= 0 || destByteCount <= 0)
+        {
+            return 0;
+        }
+        auto* ptr = reinterpret_cast<GifDecoder*>(decoder);
+        try
+        {
+            return call.Result(ptr->CopyFramePixelsBGRA32PremultipliedScaled(
+                                   static_cast<uint32_t>(index), static_cast<uint32_t>(targetWidth),
+                                   static_cast<uint32_t>(targetHeight), static_cast<uint8_t*>(dest),
+                                   static_cast<size_t>(destStride),
+                                   static_cast<size_t>(destByteCount),
+                                   static_cast<ScalingFilter>(filterType))
+                                   ? 1
+                                   : 0);
+        }
+        catch (...)
+        {
+            return 0;
+        }
+    }
+
     GB_API unsigned int gb_decoder_get_background_color(gb_decoder_t decoder)
     {
+        ScopedCall call(CallId::GetBackgroundColor, decoder);
         if (decoder == nullptr)
         {
             return 0xFF000000;
         }
         auto* ptr = reinterpret_cast<GifDecoder*>(decoder);
-        return ptr->GetBackgroundColor();
+        return call.Result(ptr->GetBackgroundColor());
     }
 
     GB_API void gb_decoder_start_prefetching(gb_decoder_t decoder, int startFrame)
     {
+        ScopedCall call(CallId::StartPrefetching, decoder, {startFrame});
         if ((decoder == nullptr) || startFrame < 0)
         {
             return;
@@ -311,6 +778,7 @@ extern "C"
 
     GB_API void gb_decoder_stop_prefetching(gb_decoder_t decoder)
     {
+        ScopedCall call(CallId::StopPrefetching, decoder);
         if (decoder == nullptr)
         {
             return;
@@ -321,6 +789,7 @@ extern "C"
 
     GB_API void gb_decoder_set_current_frame(gb_decoder_t decoder, int currentFrame)
     {
+        ScopedCall call(CallId::SetCurrentFrame, decoder, {currentFrame});
         if ((decoder == nullptr) || currentFrame < 0)
         {
             return;
@@ -331,6 +800,7 @@ extern "C"
 
     GB_API void gb_decoder_reset_canvas(gb_decoder_t decoder)
     {
+        ScopedCall call(CallId::ResetCanvas, decoder);
         if (decoder == nullptr)
         {
             return;
@@ -342,9 +812,12 @@ extern "C"
     // Renderer C API
     GB_API gb_renderer_t GifBolt_Create(void)
     {
+        ScopedCall call(CallId::RendererCreate, nullptr);
         try
         {
-            return reinterpret_cast<gb_renderer_t>(new GifBolt::GifBoltRenderer());
+            auto* renderer = new GifBolt::GifBoltRenderer();
+            call.SetCreatedHandle(renderer);
+            return reinterpret_cast<gb_renderer_t>(renderer);
         }
         catch (...)
         {
@@ -354,6 +827,7 @@ extern "C"
 
     GB_API void GifBolt_Destroy(gb_renderer_t renderer)
     {
+        ScopedCall call(CallId::RendererDestroy, renderer);
         if (renderer == nullptr)
         {
             return;
@@ -364,38 +838,44 @@ extern "C"
 
     GB_API int GifBolt_Initialize(gb_renderer_t renderer, unsigned int width, unsigned int height)
     {
+        ScopedCall call(CallId::RendererInitialize, renderer, {width, height});
         if (renderer == nullptr)
         {
             return 0;
         }
         auto* r = reinterpret_cast<GifBolt::GifBoltRenderer*>(renderer);
-        return r->Initialize(width, height) ? 1 : 0;
+        return call.Result(r->Initialize(width, height) ? 1 : 0);
     }
 
     GB_API int GifBolt_LoadGif(gb_renderer_t renderer, const char* path)
     {
+        ScopedCall call(CallId::RendererLoadGif, renderer);
+        call.SetText(path);
         if ((renderer == nullptr) || (path == nullptr))
         {
             return 0;
         }
         auto* r = reinterpret_cast<GifBolt::GifBoltRenderer*>(renderer);
-        return r->LoadGif(path) ? 1 : 0;
+        return call.Result(r->LoadGif(path) ? 1 : 0);
     }
 
     GB_API int GifBolt_LoadGifFromMemory(gb_renderer_t renderer, const void* data, int length)
     {
+        ScopedCall call(CallId::RendererLoadGifFromMemory, renderer, {length});
         if ((renderer == nullptr) || (data == nullptr) || (length <= 0))
         {
             return 0;
         }
 
+        call.SetContent(data, static_cast<size_t>(length));
         auto* r = reinterpret_cast<GifBolt::GifBoltRenderer*>(renderer);
         const auto* bytes = reinterpret_cast<const uint8_t*>(data);
-        return r->LoadGifFromMemory(bytes, static_cast<std::size_t>(length)) ? 1 : 0;
+        return call.Result(r->LoadGifFromMemory(bytes, static_cast<std::size_t>(length)) ? 1 : 0);
     }
 
     GB_API void GifBolt_Play(gb_renderer_t renderer)
     {
+        ScopedCall call(CallId::RendererPlay, renderer);
         if (renderer == nullptr)
         {
             return;
@@ -406,6 +886,7 @@ extern "C"
 
     GB_API void GifBolt_Pause(gb_renderer_t renderer)
     {
+        ScopedCall call(CallId::RendererPause, renderer);
         if (renderer == nullptr)
         {
             return;
@@ -416,6 +897,7 @@ extern "C"
 
     GB_API void GifBolt_Stop(gb_renderer_t renderer)
     {
+        ScopedCall call(CallId::RendererStop, renderer);
         if (renderer == nullptr)
         {
             return;
@@ -426,6 +908,7 @@ extern "C"
 
     GB_API void GifBolt_SetLooping(gb_renderer_t renderer, int loop)
     {
+        ScopedCall call(CallId::RendererSetLooping, renderer, {loop});
         if (renderer == nullptr)
         {
             return;
@@ -436,12 +919,197 @@ extern "C"
 
     GB_API int GifBolt_Render(gb_renderer_t renderer)
     {
+        ScopedCall call(CallId::RendererRender, renderer);
         if (renderer == nullptr)
         {
             return 0;
         }
         auto* r = reinterpret_cast<GifBolt::GifBoltRenderer*>(renderer);
-        return r->Render() ? 1 : 0;
+        return call.Result(r->Render() ? 1 : 0);
+    }
+
+    // Preview proxy C API
+    GB_API gb_preview_t gb_preview_create(gb_decoder_t decoder, int maxWidth, int maxHeight,
+                                          int maxFps)
+    {
+        ScopedCall call(CallId::CreatePreview, decoder, {maxWidth, maxHeight, maxFps});
+        if (decoder == nullptr || maxWidth <= 0 || maxHeight <= 0 || maxFps < 0)
+        {
+            return nullptr;
+        }
+        try
+        {
+            PreviewOptions options;
+            options.maxWidth = static_cast<uint32_t>(maxWidth);
+            options.maxHeight = static_cast<uint32_t>(maxHeight);
+            options.maxFps = static_cast<uint32_t>(maxFps);
+            auto* preview = new PreviewProxy();
+            if (!preview->Generate(*reinterpret_cast<GifDecoder*>(decoder), options))
+            {
+                delete preview;
+                return nullptr;
+            }
+            call.Result(static_cast<const void*>(preview));
+            return reinterpret_cast<gb_preview_t>(preview);
+        }
+        catch (...)
+        {
+            return nullptr;
+        }
+    }
+
+    GB_API gb_preview_t gb_preview_load(const char* path)
+    {
+        if (path == nullptr)
+        {
+            return nullptr;
+        }
+        try
+        {
+            auto* preview = new PreviewProxy();
+            if (!preview->LoadFromFile(path))
+            {
+                delete preview;
+                return nullptr;
+            }
+            return reinterpret_cast<gb_preview_t>(preview);
+        }
+        catch (...)
+        {
+            return nullptr;
+        }
+    }
+
+    GB_API int gb_preview_save(gb_preview_t preview, const char* path)
+    {
+        if (preview == nullptr || path == nullptr)
+        {
+            return 0;
+        }
+        try
+        {
+            return reinterpret_cast<PreviewProxy*>(preview)->SaveToFile(path) ? 1 : 0;
+        }
+        catch (...)
+        {
+            return 0;
+        }
+    }
+
+    GB_API void gb_preview_destroy(gb_preview_t preview)
+    {
+        delete reinterpret_cast<PreviewProxy*>(preview);
+    }
+
+    GB_API int gb_preview_get_info(gb_preview_t preview, gb_preview_info_t* info)
+    {
+        if (preview == nullptr || info == nullptr)
+        {
+            return 0;
+        }
+        const auto* ptr = reinterpret_cast<const PreviewProxy*>(preview);
+        info->width = static_cast<int32_t>(ptr->GetWidth());
+        info->height = static_cast<int32_t>(ptr->GetHeight());
+        info->frame_count = static_cast<int32_t>(ptr->GetFrameCount());
+        info->loop_count = ptr->IsLooping() ? -1 : 0;
+        info->indexed = ptr->GetStorage() == PreviewStorage::Indexed8 ? 1 : 0;
+        info->memory_bytes = static_cast<int32_t>(
+            std::min<size_t>(ptr->GetMemoryBytes(), static_cast<size_t>(INT32_MAX)));
+        info->frame_delays_ms = ptr->GetFrameDelaysMs().data();
+        info->source_frames = ptr->GetSourceFrames().data();
+        return 1;
+    }
+
+    GB_API int gb_preview_copy_frame_pixels_bgra32_premultiplied(gb_preview_t preview, int index,
+                                                                 void* dest, int destStride,
+                                                                 int destByteCount)
+    {
+        if (preview == nullptr || dest == nullptr || index < 0 || destStride <= 0 ||
+            destByteCount <= 0)
+        {
+            return 0;
+        }
+        const auto* ptr = reinterpret_cast<const PreviewProxy*>(preview);
+        return ptr->CopyFramePixelsBGRA32Premultiplied(
+                   static_cast<uint32_t>(index), static_cast<uint8_t*>(dest),
+                   static_cast<size_t>(destStride), static_cast<size_t>(destByteCount))
+                   ? 1
+                   : 0;
+    }
+
+    // Shared frame cache C API. Handles own a reference, so decoders outlive closed handles.
+    GB_API gb_shared_cache_t gb_shared_cache_open(const char* name, int64_t budgetBytes)
+    {
+        if (name == nullptr || budgetBytes <= 0)
+        {
+            return nullptr;
+        }
+        try
+        {
+            auto cache = std::make_shared<SharedFrameCache>();
+            if (!cache->Open(name, static_cast<uint64_t>(budgetBytes)))
+            {
+                return nullptr;
+            }
+            return reinterpret_cast<gb_shared_cache_t>(
+                new std::shared_ptr<SharedFrameCache>(std::move(cache)));
+        }
+        catch (...)
+        {
+            return nullptr;
+        }
+    }
+
+    GB_API void gb_shared_cache_close(gb_shared_cache_t cache)
+    {
+        delete reinterpret_cast<std::shared_ptr<SharedFrameCache>*>(cache);
+    }
+
+    GB_API int gb_shared_cache_get_stats(gb_shared_cache_t cache, gb_shared_cache_stats_t* stats)
+    {
+        if (cache == nullptr || stats == nullptr)
+        {
+            return 0;
+        }
+        const SharedCacheStats source =
+            (*reinterpret_cast<std::shared_ptr<SharedFrameCache>*>(cache))->GetStats();
+        stats->hits = source.hits;
+        stats->misses = source.misses;
+        stats->inserts = source.inserts;
+        stats->evictions = source.evictions;
+        stats->entries = source.entries;
+        stats->used_bytes = source.usedBytes;
+        stats->budget_bytes = source.budgetBytes;
+        return 1;
+    }
+
+    GB_API void gb_shared_cache_remove(const char* name)
+    {
+        if (name == nullptr)
+        {
+            return;
+        }
+        try
+        {
+            SharedFrameCache::Remove(name);
+        }
+        catch (...)
+        {
+            // Best effort: objects left behind are reused by the next cache of that name
+        }
+    }
+
+    GB_API int gb_decoder_set_shared_cache(gb_decoder_t decoder, gb_shared_cache_t cache)
+    {
+        if (decoder == nullptr)
+        {
+            return 0;
+        }
+        auto* ptr = reinterpret_cast<GifDecoder*>(decoder);
+        ptr->SetSharedFrameCache(
+            cache != nullptr ? *reinterpret_cast<std::shared_ptr<SharedFrameCache>*>(cache)
+                             : nullptr);
+        return 1;
     }
 
 }  // extern "C"
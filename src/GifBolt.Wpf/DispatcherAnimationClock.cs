@@ -0,0 +1,55 @@
+// <copyright file="DispatcherAnimationClock.cs" company="GifBolt Contributors">
+// Copyright (c) 2026 GifBolt Contributors. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the project root for full license information.
+// </copyright>
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+using System;
+using System.Runtime.CompilerServices;
+using System.Windows.Threading;
+
+namespace GifBolt.Wpf
+{
+    /// <summary>
+    /// Provides the <see cref="AnimationClock"/> shared by every animation on a dispatcher.
+    /// </summary>
+    internal static class DispatcherAnimationClock
+    {
+        private static readonly ConditionalWeakTable<Dispatcher, AnimationClock> _clocks =
+            new ConditionalWeakTable<Dispatcher, AnimationClock>();
+
+        /// <summary>
+        /// Gets the clock of a dispatcher, creating it on first use.
+        /// </summary>
+        /// <param name="dispatcher">The dispatcher whose thread the animations render on.</param>
+        /// <returns>The clock; use it from the dispatcher's thread only.</returns>
+        public static AnimationClock For(Dispatcher dispatcher)
+        {
+            return _clocks.GetValue(dispatcher, Create);
+        }
+
+        private static AnimationClock Create(Dispatcher dispatcher)
+        {
+            // One timer per dispatcher, armed for the earliest deadline of all its animations
+            var timer = new DispatcherTimer(DispatcherPriority.Render, dispatcher);
+            var clock = new AnimationClock(delay =>
+            {
+                timer.Stop();
+                if (delay.HasValue)
+                {
+                    timer.Interval = delay.Value;
+                    timer.Start();
+                }
+            });
+
+            timer.Tick += (sender, e) =>
+            {
+                timer.Stop();
+                clock.Tick();
+            };
+
+            return clock;
+        }
+    }
+}
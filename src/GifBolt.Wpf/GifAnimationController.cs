@@ -7,6 +7,7 @@
 
 using System;
 using System.Runtime.InteropServices;
+using System.Threading.Tasks;
 using System.Windows;
 using System.Windows.Controls;
 using System.Windows.Media;
@@ -16,9 +17,9 @@ using System.Windows.Threading;
 namespace GifBolt.Wpf
 {
     /// <summary>
-    /// WPF-specific GIF animation controller using CompositionTarget.Rendering for frame timing.
+    /// WPF-specific GIF animation controller driven by the dispatcher's shared animation clock.
     /// </summary>
-    internal sealed class GifAnimationController : GifAnimationControllerBase
+    internal sealed class GifAnimationController : GifAnimationControllerBase, IAnimationClockTarget
     {
         // Static DLL import for explicit loading
         [DllImport("kernel32.dll", SetLastError = true, CharSet = CharSet.Unicode)]
@@ -68,15 +69,39 @@ namespace GifBolt.Wpf
             }
         }
 
+        /// <summary>
+        /// Clears a locked bitmap's back buffer to transparent.
+        /// </summary>
+        /// <param name="backBuffer">The back buffer of a bitmap locked by the caller.</param>
+        /// <param name="stride">Bytes from the start of one row to the next.</param>
+        /// <param name="width">Width of the bitmap in pixels.</param>
+        /// <param name="height">Height of the bitmap in pixels.</param>
+        /// <remarks>Takes the buffer rather than the bitmap so that it can run off the UI thread.</remarks>
+        private static unsafe void ClearBackBuffer(IntPtr backBuffer, int stride, int width, int height)
+        {
+            byte* row = (byte*)backBuffer;
+            for (int y = 0; y < height; y++, row += stride)
+            {
+                uint* pixels = (uint*)row;
+                for (int x = 0; x < width; x++)
+                {
+                    pixels[x] = 0;
+                }
+            }
+        }
+
         private readonly Image _image;
         private readonly string? _sourcePath;
         private readonly byte[]? _sourceBytes;
         private WriteableBitmap? _writeableBitmap;
-        private DispatcherTimer? _renderTimer;
+        private WriteableBitmap? _backBitmap;
+        private Task<bool>? _preparation;
+        private int _preparedFrame = -1;
+        private AnimationClock? _clock;
         private bool _isDisposed;
         private int _generationId;
         private string? _pendingRepeatBehavior;
-        private DateTime _frameStartTime;
+        private TimeSpan _frameStartTime;
         private bool _wasPlayingBeforeHidden;
         private ScalingFilter _scalingFilter = ScalingFilter.None;
 
@@ -171,8 +196,7 @@ namespace GifBolt.Wpf
                         if (this.Player.TryGetFramePixelsBgra32Premultiplied(0, out byte[] bgraPixels) &&
                             bgraPixels.Length > 0)
                         {
-                            initialPixels = new byte[bgraPixels.Length];
-                            System.Buffer.BlockCopy(bgraPixels, 0, initialPixels, 0, bgraPixels.Length);
+                            initialPixels = bgraPixels;
                         }
                     }
                     else
@@ -200,8 +224,7 @@ namespace GifBolt.Wpf
                             filter: this._scalingFilter) &&
                             bgraPixels.Length > 0)
                         {
-                            initialPixels = new byte[bgraPixels.Length];
-                            System.Buffer.BlockCopy(bgraPixels, 0, initialPixels, 0, bgraPixels.Length);
+                            initialPixels = bgraPixels;
                             scaledWidth = outWidth;
                             scaledHeight = outHeight;
                         }
@@ -236,9 +259,17 @@ namespace GifBolt.Wpf
                             this._writeableBitmap = wb;
                             this._image.Source = this._writeableBitmap;
 
-                            this._renderTimer = new DispatcherTimer(DispatcherPriority.Render);
-                            this._renderTimer.Interval = TimeSpan.FromMilliseconds(FrameTimingHelper.MinRenderIntervalMs);
-                            this._renderTimer.Tick += this.OnRenderTick;
+                            // Second bitmap of the same size: the next frame is prepared into it
+                            // off the UI thread, then the two are swapped at the frame's deadline
+                            this._backBitmap = new WriteableBitmap(
+                                scaledWidth,
+                                scaledHeight,
+                                96,
+                                96,
+                                PixelFormats.Bgra32,
+                                null);
+
+                            this._clock = DispatcherAnimationClock.For(this._image.Dispatcher);
 
                             // Apply pending repeat behavior BEFORE calling onLoaded (which starts playback)
                             if (!string.IsNullOrWhiteSpace(this._pendingRepeatBehavior))
@@ -282,19 +313,18 @@ namespace GifBolt.Wpf
 
             this.Player.Play();
             this.IsPlaying = true;
-            this._frameStartTime = DateTime.UtcNow;
+            this._frameStartTime = AnimationClock.Now;
 
             if (this._writeableBitmap != null && !this._isDisposed)
             {
                 this.RenderFrame(this.Player.CurrentFrame);
+                this.BeginPreparingNextFrame();
             }
 
-            if (this._renderTimer != null && !this._isDisposed)
+            if (this._clock != null && !this._isDisposed)
             {
-                // Use a fixed, fast timer (16ms = 60 FPS) for smooth rendering
-                // Frame advancement is calculated based on actual elapsed time, not timer interval
-                this._renderTimer.Interval = TimeSpan.FromMilliseconds(FrameTimingHelper.MinRenderIntervalMs);
-                this._renderTimer.Start();
+                // The clock wakes only when this or another animation on the dispatcher is due
+                this._clock.Schedule(this, this.GetFrameDeadline());
             }
         }
 
@@ -310,7 +340,7 @@ namespace GifBolt.Wpf
 
             this.Player.Pause();
             this.IsPlaying = false;
-            this._renderTimer?.Stop();
+            this._clock?.Unschedule(this);
         }
 
         /// <summary>
@@ -325,7 +355,7 @@ namespace GifBolt.Wpf
 
             this.Player.Stop();
             this.IsPlaying = false;
-            this._renderTimer?.Stop();
+            this._clock?.Unschedule(this);
         }
 
         /// <summary>
@@ -382,123 +412,252 @@ namespace GifBolt.Wpf
                 return;
             }
 
+            WriteableBitmap bitmap = this._writeableBitmap;
+            bitmap.Lock();
             try
             {
-                byte[] bgraPixels;
-                int outWidth;
-                int outHeight;
+                // Write straight into the back buffer: no managed buffers, and the whole update
+                // is presented at once on Unlock
+                IntPtr backBuffer = bitmap.BackBuffer;
+                int stride = bitmap.BackBufferStride;
+                int byteCount = stride * bitmap.PixelHeight;
                 bool success;
 
                 // Check if scaling is disabled or enabled
                 if (this._scalingFilter == ScalingFilter.None)
                 {
-                    // Use native resolution without scaling
-                    success = this.Player.TryGetFramePixelsBgra32Premultiplied(frameIndex, out bgraPixels);
-                    // For unscaled frames, use the actual GIF dimensions (not bitmap size)
-                    outWidth = this.Player.Width;
-                    outHeight = this.Player.Height;
+                    // Native resolution; clear the rest of a bitmap sized for an earlier filter
+                    if (bitmap.PixelWidth > this.Player.Width || bitmap.PixelHeight > this.Player.Height)
+                    {
+                        ClearBackBuffer(backBuffer, stride, bitmap.PixelWidth, bitmap.PixelHeight);
+                    }
+
+                    success = this.Player.TryCopyFramePixelsBgra32Premultiplied(frameIndex, backBuffer, stride, byteCount);
                 }
                 else
                 {
                     // Scale to display size with selected filter
-                    int displayWidth = this._writeableBitmap.PixelWidth;
-                    int displayHeight = this._writeableBitmap.PixelHeight;
-
-                    success = this.Player.TryGetFramePixelsBgra32PremultipliedScaled(
+                    success = this.Player.TryCopyFramePixelsBgra32PremultipliedScaled(
                         frameIndex,
-                        displayWidth,
-                        displayHeight,
-                        out bgraPixels,
-                        out outWidth,
-                        out outHeight,
+                        bitmap.PixelWidth,
+                        bitmap.PixelHeight,
+                        backBuffer,
+                        stride,
+                        byteCount,
                         filter: this._scalingFilter);
                 }
 
-                if (success && bgraPixels.Length > 0 && !this._isDisposed)
+                if (success && !this._isDisposed)
                 {
-                    // If bitmap is larger than frame, fill it with transparent first
-                    if (this._writeableBitmap.PixelWidth > outWidth || this._writeableBitmap.PixelHeight > outHeight)
-                    {
-                        // Create transparent fill (BGRA 0x00000000)
-                        int fillWidth = this._writeableBitmap.PixelWidth;
-                        int fillHeight = this._writeableBitmap.PixelHeight;
-                        byte[] transparentFill = new byte[fillWidth * fillHeight * 4];
-                        // transparentFill is already zero-initialized (transparent black)
-
-                        // Fill entire bitmap with transparent
-                        this._writeableBitmap.WritePixels(
-                            new Int32Rect(0, 0, fillWidth, fillHeight),
-                            transparentFill,
-                            fillWidth * 4,
-                            0);
-                    }
-
-                    // Now write the frame pixels atomically
-                    this._writeableBitmap.WritePixels(
-                        new Int32Rect(0, 0, outWidth, outHeight),
-                        bgraPixels,
-                        outWidth * 4,
-                        0);
+                    bitmap.AddDirtyRect(new Int32Rect(0, 0, bitmap.PixelWidth, bitmap.PixelHeight));
                 }
             }
             catch
             {
                 // Swallow render errors
             }
+            finally
+            {
+                bitmap.Unlock();
+            }
         }
 
-        private void OnRenderTick(object? sender, EventArgs e)
+        /// <summary>
+        /// Advances to the next frame once the current one has been shown for its delay.
+        /// </summary>
+        /// <param name="now">The clock time of the batch.</param>
+        /// <returns>The deadline of the frame shown next, or <c>null</c> once playback ends.</returns>
+        TimeSpan? IAnimationClockTarget.OnClockDue(TimeSpan now)
         {
             // Early exit if disposed or invalid
-            if (this._isDisposed || this.Player == null || !this.IsPlaying || this._writeableBitmap == null || this._renderTimer == null)
+            if (this._isDisposed || this.Player == null || !this.IsPlaying || this._writeableBitmap == null)
             {
-                return;
+                return null;
             }
 
             try
             {
-                // Get the frame delay for the current frame and clamp to minimum
-                int rawFrameDelayMs = this.Player.GetFrameDelayMs(this.Player.CurrentFrame);
-                long elapsedMs = (long)(DateTime.UtcNow - this._frameStartTime).TotalMilliseconds;
+                TimeSpan dueTime = this.GetFrameDeadline();
+
+                var advanceResult = FrameAdvanceHelper.AdvanceFrame(
+                    this.Player.CurrentFrame,
+                    this.Player.FrameCount,
+                    this.RepeatCount);
 
-                // Only advance frame if enough time has elapsed for the current frame (multiplied by debug factor)
-                if (elapsedMs >= rawFrameDelayMs)
+                if (advanceResult.IsComplete)
                 {
-                    // Advance to next frame and reset the frame start time
-                    var advanceResult = FrameAdvanceHelper.AdvanceFrame(
-                        this.Player.CurrentFrame,
-                        this.Player.FrameCount,
-                        this.RepeatCount);
+                    this.Stop();
+                    return null;
+                }
 
-                    if (advanceResult.IsComplete)
-                    {
-                        this.Stop();
-                        return;
-                    }
+                // A frame still being prepared is looked at again with the next batch rather
+                // than waited for on the UI thread
+                if (this._preparation != null && !this._preparation.IsCompleted)
+                {
+                    return now + TimeSpan.FromMilliseconds(FrameTimingHelper.MinRenderIntervalMs);
+                }
 
-                    // Reset canvas state when looping back to frame 0
-                    if (advanceResult.NextFrame == 0 && this.Player != null)
+                int nextFrame = advanceResult.NextFrame;
+                if (!this.PresentPreparedFrame(nextFrame))
+                {
+                    // Nothing prepared for this frame: render it here. Reset canvas state when
+                    // looping back to frame 0.
+                    if (nextFrame == 0)
                     {
                         this.Player.ResetCanvas();
-                        this.Player.CurrentFrame = 0;
-                        this.RenderFrame(0);
-                        this._frameStartTime = DateTime.UtcNow;
-                        return; // Exit early after rendering frame 0
                     }
 
-                    // Update the current frame and repeat count
-                    this.Player.CurrentFrame = advanceResult.NextFrame;
-                    this.RepeatCount = advanceResult.UpdatedRepeatCount;
-                    this._frameStartTime = DateTime.UtcNow;
+                    this.RenderFrame(nextFrame);
+                }
 
-                    // Render only when frame actually changes
-                    this.RenderFrame(this.Player.CurrentFrame);
+                // Looping back to frame 0 keeps the repeat count, as it always has here
+                if (nextFrame != 0)
+                {
+                    this.RepeatCount = advanceResult.UpdatedRepeatCount;
                 }
+
+                // Make the frame current and record it as shown in one native call. A new frame
+                // is late by the time from its due time until it is on screen.
+                this._frameStartTime = AnimationClock.Now;
+                this.Player.PresentFrame(nextFrame, (this._frameStartTime - dueTime).TotalMilliseconds);
+
+                this.BeginPreparingNextFrame();
+                return this.GetFrameDeadline();
             }
             catch
             {
-                // Swallow render errors
+                // Swallow render errors and try again with the next batch
+                return now + TimeSpan.FromMilliseconds(FrameTimingHelper.MinRenderIntervalMs);
+            }
+        }
+
+        /// <summary>
+        /// Starts writing the frame that follows the current one into the back bitmap on a
+        /// background thread.
+        /// </summary>
+        /// <remarks>
+        /// The back bitmap stays locked until the frame is presented or discarded, which is how
+        /// WPF lets another thread write its back buffer.
+        /// </remarks>
+        private void BeginPreparingNextFrame()
+        {
+            if (this._isDisposed || this.Player == null || this._backBitmap == null)
+            {
+                return;
+            }
+
+            var advanceResult = FrameAdvanceHelper.AdvanceFrame(
+                this.Player.CurrentFrame,
+                this.Player.FrameCount,
+                this.RepeatCount);
+
+            if (advanceResult.IsComplete)
+            {
+                return;
+            }
+
+            int frameIndex = advanceResult.NextFrame;
+            if (this._preparation != null)
+            {
+                // Keep a preparation of the right frame, or one that is still writing
+                if (this._preparedFrame == frameIndex || !this._preparation.IsCompleted)
+                {
+                    return;
+                }
+
+                this._preparation = null;
+                this._backBitmap.Unlock();
+            }
+
+            // Everything the background thread needs is read here: bitmaps are UI-thread objects
+            GifPlayer player = this.Player;
+            WriteableBitmap bitmap = this._backBitmap;
+            ScalingFilter filter = this._scalingFilter;
+            bitmap.Lock();
+            IntPtr backBuffer = bitmap.BackBuffer;
+            int stride = bitmap.BackBufferStride;
+            int width = bitmap.PixelWidth;
+            int height = bitmap.PixelHeight;
+            int byteCount = stride * height;
+            bool clear = filter == ScalingFilter.None && (width > player.Width || height > player.Height);
+
+            this._preparedFrame = frameIndex;
+            this._preparation = Task.Run(() =>
+            {
+                try
+                {
+                    // Frame 0 of the next loop is composed from a clean canvas
+                    if (frameIndex == 0)
+                    {
+                        player.ResetCanvas();
+                    }
+
+                    if (filter == ScalingFilter.None)
+                    {
+                        if (clear)
+                        {
+                            ClearBackBuffer(backBuffer, stride, width, height);
+                        }
+
+                        return player.TryCopyFramePixelsBgra32Premultiplied(frameIndex, backBuffer, stride, byteCount);
+                    }
+
+                    return player.TryCopyFramePixelsBgra32PremultipliedScaled(
+                        frameIndex, width, height, backBuffer, stride, byteCount, filter);
+                }
+                finally
+                {
+                    // The back buffer belongs to the bitmap: it must outlive the copy, even once
+                    // the controller has let go of it
+                    GC.KeepAlive(bitmap);
+                }
+            });
+        }
+
+        /// <summary>
+        /// Shows the frame prepared in the back bitmap by swapping the two bitmaps.
+        /// </summary>
+        /// <param name="frameIndex">The frame due now.</param>
+        /// <returns>true if the prepared frame was shown; false if there was none for this frame.</returns>
+        /// <remarks>The preparation must have completed.</remarks>
+        private bool PresentPreparedFrame(int frameIndex)
+        {
+            Task<bool>? preparation = this._preparation;
+            WriteableBitmap? back = this._backBitmap;
+            if (preparation == null || back == null)
+            {
+                return false;
+            }
+
+            this._preparation = null;
+            bool ready = preparation.Status == TaskStatus.RanToCompletion && preparation.Result &&
+                this._preparedFrame == frameIndex;
+            if (ready)
+            {
+                back.AddDirtyRect(new Int32Rect(0, 0, back.PixelWidth, back.PixelHeight));
+            }
+
+            back.Unlock();
+            if (!ready)
+            {
+                return false;
             }
+
+            // The bitmap shown so far receives the frame after this one
+            this._backBitmap = this._writeableBitmap;
+            this._writeableBitmap = back;
+            this._image.Source = back;
+            return true;
+        }
+
+        /// <summary>
+        /// Gets the clock time at which the current frame has been shown for its delay.
+        /// </summary>
+        /// <returns>The deadline of the current frame.</returns>
+        private TimeSpan GetFrameDeadline()
+        {
+            int frameDelayMs = this.Player?.GetFrameDelayMs(this.Player.CurrentFrame) ?? 0;
+            return this._frameStartTime + TimeSpan.FromMilliseconds(Math.Max(0, frameDelayMs));
         }
 
         /// <summary>
@@ -543,13 +702,15 @@ namespace GifBolt.Wpf
             // Unsubscribe from visibility changes
             this._image.IsVisibleChanged -= this.OnImageVisibilityChanged;
 
-            // Stop and fully release the render timer
-            if (this._renderTimer != null)
+            // Leave the shared clock; off the UI thread the clock drops this controller itself
+            // at its next deadline, since a disposed controller returns no further deadline
+            if (this._clock != null && this._image.Dispatcher.CheckAccess())
             {
-                this._renderTimer.Stop();
-                this._renderTimer = null;
+                this._clock.Unschedule(this);
             }
 
+            this._clock = null;
+
             // Dispose player and stop prefetching thread
             if (this.Player != null)
             {
@@ -566,8 +727,31 @@ namespace GifBolt.Wpf
             // Call base Dispose to clean up player
             base.Dispose();
 
+            // A back bitmap still being written is unlocked on its own thread once the copy ends
+            Task<bool>? preparation = this._preparation;
+            WriteableBitmap? back = this._backBitmap;
+            if (preparation != null && back != null)
+            {
+                Dispatcher dispatcher = back.Dispatcher;
+                preparation.ContinueWith(
+                    _ => dispatcher.BeginInvoke(() =>
+                    {
+                        try
+                        {
+                            back.Unlock();
+                        }
+                        catch
+                        {
+                            // Swallow errors if the dispatcher has shut down
+                        }
+                    }),
+                    TaskScheduler.Default);
+            }
+
             // Release bitmap data
             this._writeableBitmap = null;
+            this._backBitmap = null;
+            this._preparation = null;
 
             // Clear the image source on the UI thread to break references
             if (!this._image.Dispatcher.CheckAccess())
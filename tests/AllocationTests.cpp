@@ -0,0 +1,56 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "AllocationHooks.h"
+#include "GifDecoder.h"
+
+using namespace GifBolt;
+
+namespace
+{
+/// \brief Plays every frame once the way a renderer does, then rewinds for the next loop.
+bool PlayLoop(GifDecoder& decoder, uint32_t frameCount)
+{
+    bool ok = true;
+    uint32_t outWidth = 0;
+    uint32_t outHeight = 0;
+    for (uint32_t i = 0; i < frameCount; ++i)
+    {
+        decoder.SetCurrentFrame(i);
+        ok = ok && decoder.GetFramePixelsBGRA32Premultiplied(i) != nullptr;
+        ok = ok && decoder.GetFramePixelsBGRA32PremultipliedScaled(
+                       i, decoder.GetWidth() / 2, decoder.GetHeight() / 2, outWidth,
+                       outHeight) != nullptr;
+    }
+    decoder.ResetCanvas();
+    return ok;
+}
+}  // namespace
+
+TEST_CASE("Looping playback does not allocate after warm-up", "[GifDecoder][Memory]")
+{
+    GifDecoder decoder;
+    decoder.SetMipmapsEnabled(true);
+    REQUIRE(decoder.LoadFromFile("assets/sample.gif"));
+    const uint32_t frameCount = decoder.GetFrameCount();
+    REQUIRE(frameCount > 2);
+
+    // A cache smaller than the animation forces evictions and re-decodes every loop
+    decoder.SetMaxCachedFrames(frameCount / 2);
+    REQUIRE(PlayLoop(decoder, frameCount));
+    REQUIRE(PlayLoop(decoder, frameCount));
+
+    Bench::GetAllocationCount(true);
+    Bench::SetAllocationCounting(true);
+    bool ok = true;
+    for (int loop = 0; loop < 3; ++loop)
+    {
+        ok = PlayLoop(decoder, frameCount) && ok;
+    }
+    Bench::SetAllocationCounting(false);
+
+    REQUIRE(ok);
+    REQUIRE(Bench::GetAllocationCount() == 0);
+}
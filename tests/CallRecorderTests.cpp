@@ -0,0 +1,125 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "CallRecorder.h"
+#include "CallReplay.h"
+#include "gifbolt_c.h"
+
+using namespace GifBolt;
+
+namespace
+{
+std::vector<uint8_t> ReadBinaryFile(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(file),
+                                std::istreambuf_iterator<char>());
+}
+}  // namespace
+
+TEST_CASE("C ABI calls are recorded and replayed", "[CallRecorder]")
+{
+    const std::filesystem::path recordingPath =
+        std::filesystem::temp_directory_path() / "gifbolt-calls-test.gbrc";
+    const std::vector<uint8_t> gif = ReadBinaryFile("assets/sample.gif");
+    REQUIRE(!gif.empty());
+
+    // A decoder created before the recording is known only by its later calls
+    gb_decoder_t earlier = gb_decoder_create();
+    REQUIRE(gb_record_start(recordingPath.string().c_str(), GB_RECORD_EMBED_BUFFERS) == 1);
+    gb_decoder_t decoder = gb_decoder_create();
+    REQUIRE(gb_decoder_load_from_memory(decoder, gif.data(), static_cast<int>(gif.size())) == 1);
+    REQUIRE(gb_decoder_load_from_path(decoder, "assets/sample.gif") == 1);
+    const int frameCount = gb_decoder_get_frame_count(decoder);
+    int byteCount = 0;
+    int width = 0;
+    int height = 0;
+    for (int frame = 0; frame < 3; ++frame)
+    {
+        REQUIRE(gb_decoder_get_frame_pixels_bgra32_premultiplied(decoder, frame, &byteCount));
+        REQUIRE(gb_decoder_get_frame_pixels_bgra32_premultiplied_scaled(
+            decoder, frame, 64, 64, &width, &height, &byteCount, 1));
+    }
+    gb_decoder_start_prefetching(decoder, 3);
+    gb_decoder_stop_prefetching(decoder);
+    gb_decoder_get_width(earlier);
+    gb_decoder_destroy(decoder);
+    gb_record_stop();
+    gb_decoder_get_width(earlier);  // Not recorded
+    gb_decoder_destroy(earlier);
+
+    CallRecorder::Recording recording;
+    REQUIRE(CallRecorder::Read(recordingPath.string(), recording));
+    REQUIRE(recording.calls.size() == 14);
+    REQUIRE(recording.buffers.size() == 1);
+    const uint64_t hash = CallRecorder::HashContent(gif.data(), gif.size());
+    REQUIRE(recording.buffers.at(hash) == gif);
+
+    const CallRecorder::RecordedCall& create = recording.calls[0];
+    REQUIRE(create.id == CallRecorder::CallId::DecoderCreate);
+    REQUIRE(create.handle != CallRecorder::NO_HANDLE);
+    const CallRecorder::RecordedCall& load = recording.calls[1];
+    REQUIRE(load.id == CallRecorder::CallId::LoadFromMemory);
+    REQUIRE(load.handle == create.handle);
+    REQUIRE(load.contentHash == hash);
+    REQUIRE(load.args[0] == static_cast<int64_t>(gif.size()));
+    REQUIRE(load.result == 1);
+    REQUIRE(recording.calls[2].text == "assets/sample.gif");
+    REQUIRE(recording.calls[3].result == frameCount);
+    const CallRecorder::RecordedCall& scaled = recording.calls[5];
+    REQUIRE(scaled.id == CallRecorder::CallId::GetFramePixelsBGRA32Scaled);
+    REQUIRE(scaled.argCount == 4);
+    REQUIRE(scaled.args[1] == 64);
+    REQUIRE(scaled.args[3] == 1);
+    REQUIRE(scaled.durationNs > 0);
+    REQUIRE(recording.calls[12].handle != create.handle);
+    for (size_t i = 1; i < recording.calls.size(); ++i)
+    {
+        REQUIRE(recording.calls[i].startNs >= recording.calls[i - 1].startNs);
+        REQUIRE(recording.calls[i].threadId == create.threadId);
+    }
+
+    Bench::ReplayOptions options;
+    options.pacing = Bench::ReplayPacing::AsFastAsPossible;
+    const Bench::ReplayReport report = Bench::ReplayCalls(recording, options);
+    REQUIRE(report.callsReplayed == 13);
+    REQUIRE(report.callsSkipped == 1);  // The call on the earlier decoder
+    REQUIRE(report.resultMismatches == 0);
+    REQUIRE(report.problems.size() == 1);
+    bool sawScaled = false;
+    for (const Bench::CallLatency& latency : report.calls)
+    {
+        if (latency.name == "gb_decoder_get_frame_pixels_bgra32_premultiplied_scaled")
+        {
+            sawScaled = true;
+            REQUIRE(latency.calls == 3);
+            REQUIRE(latency.replayedMs.max > 0.0);
+        }
+    }
+    REQUIRE(sawScaled);
+    REQUIRE(Bench::ReplayReportJson(report).find("\"resultMismatches\":0") != std::string::npos);
+
+    // A recording cut short is read up to its last complete call; other files are rejected
+    const std::vector<uint8_t> bytes = ReadBinaryFile(recordingPath.string());
+    {
+        std::ofstream truncated(recordingPath, std::ios::binary | std::ios::trunc);
+        truncated.write(reinterpret_cast<const char*>(bytes.data()),
+                        static_cast<std::streamsize>(bytes.size() - 3));
+    }
+    REQUIRE(CallRecorder::Read(recordingPath.string(), recording));
+    REQUIRE(recording.calls.size() == 13);
+    {
+        std::ofstream other(recordingPath, std::ios::binary | std::ios::trunc);
+        other << "GIF89a";
+    }
+    REQUIRE_FALSE(CallRecorder::Read(recordingPath.string(), recording));
+
+    std::filesystem::remove(recordingPath);
+}
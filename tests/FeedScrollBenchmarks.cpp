@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#include <catch2/catch_test_macros.hpp>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "FeedSimulation.h"
+#include "GifCorpus.h"
+#include "GifDecoder.h"
+
+using namespace GifBolt;
+
+TEST_CASE("Benchmark feed scrolling over the synthetic corpus", "[Benchmark][Feed]")
+{
+    std::vector<std::vector<uint8_t>> gifs;
+    for (const Corpus::GifSpec& spec :
+         Corpus::GetCorpus(Corpus::GetCorpusSizeFromEnvironment()))
+    {
+        gifs.push_back(Corpus::Generate(spec));
+    }
+
+    // Unpaced, so the 10 virtual seconds run as fast as the work allows
+    Bench::FeedConfig config;
+    config.durationSeconds = 10.0;
+    config.paced = false;
+    const Bench::FeedResult feed = Bench::SimulateFeed(gifs, config);
+
+    std::cout << "\n========== FEED SCROLL (" << config.durationSeconds
+              << " virtual seconds) ==========\n";
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "Decoders created:     " << feed.decodersCreated << " (peak live "
+              << feed.peakLiveDecoders << ", peak playing " << feed.peakPlaying << ")\n";
+    std::cout << "Frames presented:     " << feed.framesPresented << ", missed "
+              << feed.framesMissed << " (" << feed.jankyTicks << " of " << feed.ticks
+              << " ticks overran)\n";
+    std::cout << "Tick work ms:         p50 " << feed.tickMs.p50 << ", p99 " << feed.tickMs.p99
+              << ", max " << feed.tickMs.max << "\n";
+    std::cout << "Frame request ms:     p50 " << feed.frameMs.p50 << ", p99 "
+              << feed.frameMs.p99 << "\n";
+    std::cout << "Teardown ms:          p50 " << feed.teardownMs.p50 << ", p99 "
+              << feed.teardownMs.p99 << ", max " << feed.teardownMs.max << "\n";
+    std::cout << "Threads:              peak " << feed.peakThreads << ", mean "
+              << feed.meanThreads << "\n";
+    std::cout << "Peak decoder memory:  " << feed.peakDecoderBytes / 1024 << " KB (peak RSS "
+              << feed.peakRssBytes / (1024 * 1024) << " MB)\n";
+    std::cout << "CPU per second:       " << feed.cpuMsPerSecond << " ms\n";
+    std::cout << "==================================================\n\n";
+
+    REQUIRE(feed.ticks == 600);
+    REQUIRE(feed.decodersCreated > 0);
+    REQUIRE(feed.framesPresented + feed.framesMissed > 0);
+    REQUIRE(feed.peakPlaying > 0);
+    // Every decoder the feed created has been destroyed
+    REQUIRE(GifDecoder::GetProcessStats().canvasBytes == 0);
+}
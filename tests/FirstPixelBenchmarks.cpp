@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "FirstPixel.h"
+#include "GifCorpus.h"
+
+using namespace GifBolt;
+
+namespace
+{
+/// Loads per file and cache state; percentiles come from these
+constexpr int ITERATIONS = 9;
+
+void PrintRow(const std::string& name, const char* variant,
+              const Bench::FirstPixelSummary& summary)
+{
+    std::cout << std::left << std::setw(30) << name << std::setw(6) << variant << std::right
+              << std::setw(9) << summary.totalMs.p50 << std::setw(9) << summary.totalMs.p90
+              << std::setw(9) << summary.totalMs.p99 << " |" << std::setw(8)
+              << summary.openMs.p50 << std::setw(8) << summary.headerMs.p50 << std::setw(8)
+              << summary.slurpMs.p50 << std::setw(8) << summary.decodeMs.p50 << std::setw(8)
+              << summary.composeMs.p50 << std::setw(8) << summary.convertMs.p50
+              << std::setw(8) << summary.scaleMs.p50 << "\n";
+}
+}  // namespace
+
+TEST_CASE("Benchmark time to first pixel over the synthetic corpus", "[Benchmark][Startup]")
+{
+    // Loads go through files so that opening and the page cache are part of the path
+    const std::filesystem::path directory =
+        std::filesystem::temp_directory_path() / "gifbolt-first-pixel";
+    std::filesystem::create_directories(directory);
+
+    std::cout << "\n========== TIME TO FIRST PIXEL (ms, frame 0 fit in 360x360) ==========\n";
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << std::left << std::setw(30) << "GIF" << std::setw(6) << "Cache" << std::right
+              << std::setw(9) << "p50" << std::setw(9) << "p90" << std::setw(9) << "p99"
+              << " |" << std::setw(8) << "open" << std::setw(8) << "header" << std::setw(8)
+              << "slurp" << std::setw(8) << "decode" << std::setw(8) << "compose"
+              << std::setw(8) << "convert" << std::setw(8) << "scale" << "  (stage p50)\n";
+
+    bool coldSupported = true;
+    for (const Corpus::GifSpec& spec :
+         Corpus::GetCorpus(Corpus::GetCorpusSizeFromEnvironment()))
+    {
+        const std::vector<uint8_t> gif = Corpus::Generate(spec);
+        const std::string path = (directory / (spec.name + ".gif")).string();
+        {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char*>(gif.data()),
+                       static_cast<std::streamsize>(gif.size()));
+            REQUIRE(file.good());
+        }
+
+        for (const bool cold : {true, false})
+        {
+            std::vector<Bench::FirstPixelSample> samples(ITERATIONS);
+            for (Bench::FirstPixelSample& sample : samples)
+            {
+                REQUIRE(Bench::MeasureFirstPixel(path, 360, 360, cold, sample));
+                REQUIRE(sample.loadCallMs <= sample.totalMs);
+                // A file source always reads its header, and frame 0 is always converted
+                REQUIRE(sample.stages.headerNs > 0);
+                REQUIRE(sample.stages.decodeNs > 0);
+                REQUIRE(sample.stages.convertNs > 0);
+            }
+            const Bench::FirstPixelSummary summary = Bench::SummarizeFirstPixel(samples);
+            coldSupported = coldSupported && (!cold || summary.coldSamples == summary.samples);
+            PrintRow(spec.name, cold ? "cold" : "warm", summary);
+        }
+        std::filesystem::remove(path);
+    }
+    if (!coldSupported)
+    {
+        std::cout << "(The page cache could not be dropped here; cold rows ran warm.)\n";
+    }
+    std::cout << "======================================================================\n\n";
+    std::filesystem::remove(directory);
+}
@@ -0,0 +1,138 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "GifDecoder.h"
+
+using namespace GifBolt;
+using namespace std::chrono;
+
+namespace
+{
+constexpr uint16_t FRAME_SIZE = 8;
+
+void AppendUInt16(std::vector<uint8_t>& bytes, uint16_t value)
+{
+    bytes.push_back(static_cast<uint8_t>(value & 0xFF));
+    bytes.push_back(static_cast<uint8_t>(value >> 8));
+}
+
+/// \brief Builds a looping GIF of 8x8 frames over a 4-color palette.
+/// \details Each pixel is emitted as a clear code followed by a literal, so the LZW stream
+///          stays at 3-bit codes without needing a real encoder.
+std::vector<uint8_t> MakeLongGif(uint32_t frameCount)
+{
+    std::vector<uint8_t> gif = {'G', 'I', 'F', '8', '9', 'a'};
+    AppendUInt16(gif, FRAME_SIZE);
+    AppendUInt16(gif, FRAME_SIZE);
+    gif.insert(gif.end(), {0xF1, 0x00, 0x00});  // 4-color global table
+    gif.insert(gif.end(), {0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+                           0xFF});
+    gif.insert(gif.end(), {0x21, 0xFF, 0x0B});
+    gif.insert(gif.end(), {'N', 'E', 'T', 'S', 'C', 'A', 'P', 'E', '2', '.', '0'});
+    gif.insert(gif.end(), {0x03, 0x01, 0x00, 0x00, 0x00});
+
+    for (uint32_t frame = 0; frame < frameCount; ++frame)
+    {
+        // Graphics control: do not dispose, 20ms delay
+        gif.insert(gif.end(), {0x21, 0xF9, 0x04, 0x04, 0x02, 0x00, 0x00, 0x00});
+
+        gif.push_back(0x2C);
+        AppendUInt16(gif, 0);
+        AppendUInt16(gif, 0);
+        AppendUInt16(gif, FRAME_SIZE);
+        AppendUInt16(gif, FRAME_SIZE);
+        gif.push_back(0x00);
+
+        std::vector<uint8_t> data;
+        uint32_t bitBuffer = 0;
+        int bitCount = 0;
+        auto emit = [&](uint32_t code)
+        {
+            bitBuffer |= code << bitCount;
+            bitCount += 3;
+            while (bitCount >= 8)
+            {
+                data.push_back(static_cast<uint8_t>(bitBuffer & 0xFF));
+                bitBuffer >>= 8;
+                bitCount -= 8;
+            }
+        };
+        for (uint32_t pixel = 0; pixel < FRAME_SIZE * FRAME_SIZE; ++pixel)
+        {
+            emit(4);                        // Clear code
+            emit((frame + pixel) % 4);      // Literal color index
+        }
+        emit(5);  // End of information
+        if (bitCount > 0)
+        {
+            data.push_back(static_cast<uint8_t>(bitBuffer & 0xFF));
+        }
+
+        gif.push_back(0x02);  // LZW minimum code size
+        gif.push_back(static_cast<uint8_t>(data.size()));
+        gif.insert(gif.end(), data.begin(), data.end());
+        gif.push_back(0x00);
+    }
+
+    gif.push_back(0x3B);
+    return gif;
+}
+
+/// \brief Plays frames [first, last) and returns the average cost per frame in microseconds.
+double PlayWindowUs(GifDecoder& decoder, uint32_t first, uint32_t last)
+{
+    const auto start = high_resolution_clock::now();
+    for (uint32_t i = first; i < last; ++i)
+    {
+        decoder.SetCurrentFrame(i);
+        if (decoder.GetFramePixelsBGRA32Premultiplied(i) == nullptr)
+        {
+            return -1.0;
+        }
+    }
+    const auto end = high_resolution_clock::now();
+    return duration_cast<nanoseconds>(end - start).count() / 1000.0 / (last - first);
+}
+}  // namespace
+
+TEST_CASE("Benchmark per-frame cost across long animations", "[Benchmark][FrameCount]")
+{
+    std::cout << "\n========== LONG ANIMATION BOOKKEEPING BENCHMARK ==========\n";
+    std::cout << std::fixed << std::setprecision(2);
+
+    constexpr uint32_t WINDOW = 2000;
+    for (const uint32_t frameCount : {10000u, 50000u})
+    {
+        const std::vector<uint8_t> gif = MakeLongGif(frameCount);
+
+        GifDecoder decoder;
+        const auto loadStart = high_resolution_clock::now();
+        REQUIRE(decoder.LoadFromMemory(gif.data(), gif.size()));
+        REQUIRE(decoder.GetFrameCount() == frameCount);
+        const double loadMs =
+            duration_cast<microseconds>(high_resolution_clock::now() - loadStart).count() / 1000.0;
+        REQUIRE(decoder.IsLooping());
+
+        // Play straight through, timing a window at the start and one at the end
+        const double earlyUs = PlayWindowUs(decoder, 0, WINDOW);
+        REQUIRE(PlayWindowUs(decoder, WINDOW, frameCount - WINDOW) >= 0.0);
+        const double lateUs = PlayWindowUs(decoder, frameCount - WINDOW, frameCount);
+        REQUIRE(earlyUs >= 0.0);
+        REQUIRE(lateUs >= 0.0);
+
+        std::cout << std::setw(6) << frameCount << " frames: load " << std::setw(8) << loadMs
+                  << " ms, first " << WINDOW << " frames " << std::setw(6) << earlyUs
+                  << " us/frame, last " << WINDOW << " frames " << std::setw(6) << lateUs
+                  << " us/frame\n";
+
+        // Bookkeeping must not grow with the playback position
+        REQUIRE(lateUs < earlyUs * 4.0 + 5.0);
+    }
+}
@@ -1,5 +1,6 @@
 // SPDX-License-Identifier: MIT
 using System;
+using System.Collections.Generic;
 using System.Diagnostics;
 using System.IO;
 
@@ -16,6 +17,7 @@ namespace GifBolt.Tests
 
             TestPlayerCreation();
             TestInvalidFile();
+            TestAnimationClockBatches();
 
             Debug.WriteLine("\n=== All tests completed ===");
         }
@@ -59,5 +61,56 @@ namespace GifBolt.Tests
                 Debug.WriteLine($"✗ FAIL: {ex.Message}");
             }
         }
+
+        private static void TestAnimationClockBatches()
+        {
+            Debug.Write("Test: Animation clock batches due animations... ");
+            try
+            {
+                var armed = new List<TimeSpan?>();
+                var clock = new AnimationClock(delay => armed.Add(delay));
+                TimeSpan past = AnimationClock.Now - TimeSpan.FromSeconds(1);
+                var due = new CountingTarget(null);
+                var repeating = new CountingTarget(TimeSpan.FromHours(1));
+                var later = new CountingTarget(null);
+
+                clock.Schedule(due, past);
+                clock.Schedule(repeating, past);
+                clock.Schedule(later, past + TimeSpan.FromHours(2));
+                clock.Tick();
+
+                // Both due animations ran in one tick; the timer is armed for the repeat only
+                bool pass = due.Calls == 1 && repeating.Calls == 1 && later.Calls == 0 &&
+                    clock.Count == 2 && armed.Count > 0 && armed[armed.Count - 1] > TimeSpan.FromMinutes(59);
+
+                clock.Unschedule(repeating);
+                clock.Unschedule(later);
+                pass = pass && clock.Count == 0 && armed[armed.Count - 1] == null;
+
+                Debug.WriteLine(pass ? "✓ PASS" : "✗ FAIL: Unexpected batch or arming");
+            }
+            catch (Exception ex)
+            {
+                Debug.WriteLine($"✗ FAIL: {ex.Message}");
+            }
+        }
+
+        private sealed class CountingTarget : IAnimationClockTarget
+        {
+            private readonly TimeSpan? _period;
+
+            public CountingTarget(TimeSpan? period)
+            {
+                this._period = period;
+            }
+
+            public int Calls { get; private set; }
+
+            public TimeSpan? OnClockDue(TimeSpan now)
+            {
+                this.Calls++;
+                return now + this._period;
+            }
+        }
     }
 }
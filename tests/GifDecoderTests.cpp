@@ -2,8 +2,15 @@
 // SPDX-FileCopyrightText: 2026 GifBolt Contributors
 
 #include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
 
+#include "FrameKernels.h"
 #include "GifDecoder.h"
+#include "PixelConversion.h"
+#include "gifbolt_c.h"
 
 using namespace GifBolt;
 
@@ -23,6 +30,43 @@ TEST_CASE("GifDecoder applies minFrameDelayMs to all frames in sample.gif", "[Gi
     }
 }
 
+TEST_CASE("GifDecoder rebuilds frame delays in place when the minimum changes",
+          "[GifDecoder][Timing]")
+{
+    GifDecoder decoder;
+    REQUIRE(decoder.LoadFromFile("assets/sample.gif"));
+    const uint32_t* delays = decoder.GetFrameDelaysMs().data();
+    const size_t frameCount = decoder.GetFrameDelaysMs().size();
+
+    std::atomic<bool> running{true};
+    std::thread reader(
+        [&]()
+        {
+            while (running)
+            {
+                const std::vector<uint32_t>& current = decoder.GetFrameDelaysMs();
+                if (current.data() != delays || current.size() != frameCount)
+                {
+                    running = false;
+                }
+            }
+        });
+    for (uint32_t iteration = 0; iteration < 200 && running; ++iteration)
+    {
+        decoder.SetMinFrameDelayMs((iteration % 2 == 0) ? 500 : 20);
+        decoder.GetFrameDelaysMs();
+    }
+    const bool stable = running.exchange(false);
+    reader.join();
+    REQUIRE(stable);
+
+    decoder.SetMinFrameDelayMs(500);
+    for (uint32_t delay : decoder.GetFrameDelaysMs())
+    {
+        REQUIRE(delay >= 500);
+    }
+}
+
 TEST_CASE("GifDecoder can be created", "[GifDecoder]")
 {
     GifDecoder decoder;
@@ -56,3 +100,428 @@ TEST_CASE("GifDecoder correctly handles disposal methods", "[GifDecoder]")
     GifDecoder decoder;
     REQUIRE(decoder.GetFrameCount() == 0);
 }
+
+TEST_CASE("GifDecoder serves scaled frames from mip levels", "[GifDecoder][Scaling]")
+{
+    GifDecoder decoder;
+    decoder.SetMipmapsEnabled(true);
+    REQUIRE(decoder.GetMipmapsEnabled());
+    REQUIRE(decoder.LoadFromFile("assets/sample.gif"));
+    REQUIRE(decoder.GetFrameCount() > 0);
+
+    const uint32_t width = decoder.GetWidth();
+    const uint32_t height = decoder.GetHeight();
+    const uint8_t* full = decoder.GetFramePixelsBGRA32Premultiplied(0);
+    REQUIRE(full != nullptr);
+    const std::vector<uint8_t> reference(full, full + static_cast<size_t>(width) * height * 4);
+
+    // A request matching a level size is served straight from the 2x2 box-filtered level
+    uint32_t outWidth = 0;
+    uint32_t outHeight = 0;
+    const uint8_t* half = decoder.GetFramePixelsBGRA32PremultipliedScaled(
+        0, width / 2, height / 2, outWidth, outHeight, ScalingFilter::Bilinear);
+    REQUIRE(half != nullptr);
+    REQUIRE(outWidth == width / 2);
+    REQUIRE(outHeight == height / 2);
+
+    const uint32_t x = outWidth / 2;
+    const uint32_t y = outHeight / 2;
+    for (uint32_t c = 0; c < 4; ++c)
+    {
+        const uint32_t sum = reference[((2 * y) * width + 2 * x) * 4 + c] +
+                             reference[((2 * y) * width + 2 * x + 1) * 4 + c] +
+                             reference[((2 * y + 1) * width + 2 * x) * 4 + c] +
+                             reference[((2 * y + 1) * width + 2 * x + 1) * 4 + c];
+        REQUIRE(half[(y * outWidth + x) * 4 + c] == (sum + 2) / 4);
+    }
+
+    // Other sizes are resampled from the nearest larger level
+    const uint8_t* tile = decoder.GetFramePixelsBGRA32PremultipliedScaled(
+        0, width / 3, height / 3, outWidth, outHeight, ScalingFilter::Bilinear);
+    REQUIRE(tile != nullptr);
+    REQUIRE(outWidth == width / 3);
+    REQUIRE(outHeight == height / 3);
+}
+
+TEST_CASE("GifDecoder writes frames into caller buffers", "[GifDecoder][Scaling]")
+{
+    GifDecoder decoder;
+    REQUIRE(decoder.LoadFromFile("assets/sample.gif"));
+    const uint32_t width = decoder.GetWidth();
+    const uint32_t height = decoder.GetHeight();
+    const size_t rowBytes = static_cast<size_t>(width) * 4;
+    const uint8_t* full = decoder.GetFramePixelsBGRA32Premultiplied(0);
+    REQUIRE(full != nullptr);
+    const std::vector<uint8_t> reference(full, full + rowBytes * height);
+
+    // Packed rows, converted in place
+    std::vector<uint8_t> packed(rowBytes * height);
+    REQUIRE(decoder.CopyFramePixelsBGRA32Premultiplied(0, packed.data(), rowBytes,
+                                                       packed.size()));
+    REQUIRE(packed == reference);
+
+    // Padded rows, as bitmaps with aligned strides have; the padding is left alone
+    const size_t stride = rowBytes + 12;
+    std::vector<uint8_t> padded(stride * height, 0xCD);
+    REQUIRE(decoder.CopyFramePixelsBGRA32Premultiplied(0, padded.data(), stride, padded.size()));
+    for (uint32_t row = 0; row < height; ++row)
+    {
+        REQUIRE(std::equal(reference.begin() + row * rowBytes,
+                           reference.begin() + (row + 1) * rowBytes,
+                           padded.begin() + row * stride));
+        REQUIRE(padded[row * stride + rowBytes] == 0xCD);
+    }
+    REQUIRE_FALSE(decoder.CopyFramePixelsBGRA32Premultiplied(0, padded.data(), stride,
+                                                             padded.size() - 13));
+    REQUIRE_FALSE(decoder.CopyFramePixelsBGRA32Premultiplied(0, padded.data(), rowBytes - 4,
+                                                             padded.size()));
+
+    // Scaled frames match the scaled getter, packed or padded
+    uint32_t outWidth = 0;
+    uint32_t outHeight = 0;
+    const uint32_t targetWidth = width / 3;
+    const uint32_t targetHeight = height / 3;
+    const uint8_t* scaled = decoder.GetFramePixelsBGRA32PremultipliedScaled(
+        0, targetWidth, targetHeight, outWidth, outHeight, ScalingFilter::Bilinear);
+    REQUIRE(scaled != nullptr);
+    const size_t scaledRowBytes = static_cast<size_t>(targetWidth) * 4;
+    const std::vector<uint8_t> scaledReference(scaled, scaled + scaledRowBytes * targetHeight);
+    std::vector<uint8_t> scaledPacked(scaledReference.size());
+    REQUIRE(decoder.CopyFramePixelsBGRA32PremultipliedScaled(
+        0, targetWidth, targetHeight, scaledPacked.data(), scaledRowBytes, scaledPacked.size(),
+        ScalingFilter::Bilinear));
+    REQUIRE(scaledPacked == scaledReference);
+    const size_t scaledStride = scaledRowBytes + 64;
+    std::vector<uint8_t> scaledPadded(scaledStride * targetHeight);
+    REQUIRE(decoder.CopyFramePixelsBGRA32PremultipliedScaled(
+        0, targetWidth, targetHeight, scaledPadded.data(), scaledStride, scaledPadded.size(),
+        ScalingFilter::Bilinear));
+    const size_t lastRow = targetHeight - 1;
+    REQUIRE(std::equal(scaledReference.end() - scaledRowBytes, scaledReference.end(),
+                       scaledPadded.begin() + lastRow * scaledStride));
+}
+
+TEST_CASE("GifDecoder trims rebuildable memory", "[GifDecoder][Memory]")
+{
+    GifDecoder decoder;
+    decoder.SetMipmapsEnabled(true);
+    REQUIRE(decoder.LoadFromFile("assets/sample.gif"));
+    const uint32_t lastFrame = decoder.GetFrameCount() - 1;
+    const std::vector<uint32_t> reference = decoder.GetFrame(lastFrame).pixels;
+
+    uint32_t outWidth = 0;
+    uint32_t outHeight = 0;
+    REQUIRE(decoder.GetFramePixelsBGRA32PremultipliedScaled(
+                0, decoder.GetWidth() / 2, decoder.GetHeight() / 2, outWidth, outHeight) !=
+            nullptr);
+    REQUIRE(decoder.TrimMemory(TrimLevel::Caches) > 0);
+    REQUIRE(decoder.TrimMemory(TrimLevel::Caches) == 0);
+
+    // Dropping the canvases frees more than the (already empty) caches
+    REQUIRE(decoder.GetFramePixelsBGRA32Premultiplied(0) != nullptr);
+    REQUIRE(decoder.TrimMemory(TrimLevel::Composition) > 0);
+
+    // Frames are recomposed from frame 0 on the next request
+    REQUIRE(decoder.GetFrame(lastFrame).pixels == reference);
+    REQUIRE(decoder.GetFramePixelsBGRA32Premultiplied(lastFrame) != nullptr);
+
+    REQUIRE(GifDecoder::TrimAllMemory(TrimLevel::Complete) > 0);
+    REQUIRE(decoder.GetFrame(lastFrame).pixels == reference);
+}
+
+TEST_CASE("GifDecoder keeps the last frame returned when trimming cold frames",
+          "[GifDecoder][Memory]")
+{
+    GifDecoder decoder;
+    REQUIRE(decoder.LoadFromFile("assets/sample.gif"));
+    REQUIRE(decoder.GetFrameCount() >= 3);
+    const std::vector<uint32_t> first = decoder.GetFrame(0).pixels;
+    decoder.GetFrame(1);
+
+    // The frame is in the third cache slot, not the first
+    const GifFrame& kept = decoder.GetFrame(2);
+    const std::vector<uint32_t> keptPixels = kept.pixels;
+    REQUIRE(decoder.TrimMemory(TrimLevel::ColdFrames) > 0);
+    REQUIRE(kept.pixels == keptPixels);
+    REQUIRE(&decoder.GetFrame(2) == &kept);
+
+    // Dropped frames come back in the freed slots
+    REQUIRE(decoder.GetFrame(0).pixels == first);
+    REQUIRE(decoder.GetFrame(1).pixels.size() == first.size());
+    REQUIRE(decoder.GetFrame(2).pixels == keptPixels);
+    REQUIRE(decoder.GetStats().frameCacheEvictions == 0);
+}
+
+TEST_CASE("GifDecoder reports work counters and memory", "[GifDecoder][Stats]")
+{
+    GifDecoder decoder;
+    decoder.SetMipmapsEnabled(true);
+    REQUIRE(decoder.LoadFromFile("assets/sample.gif"));
+    const uint32_t frameCount = decoder.GetFrameCount();
+
+    DecoderStats stats = decoder.GetStats();
+    REQUIRE(stats.framesDecoded == frameCount);
+    REQUIRE(stats.rasterBytes >= static_cast<uint64_t>(decoder.GetWidth()) * decoder.GetHeight());
+    REQUIRE(stats.frameCacheHits == 0);
+
+    decoder.GetFrame(0);
+    decoder.GetFrame(0);
+    REQUIRE(decoder.GetFramePixelsBGRA32Premultiplied(0) != nullptr);
+    uint32_t outWidth = 0;
+    uint32_t outHeight = 0;
+    for (int request = 0; request < 2; ++request)
+    {
+        REQUIRE(decoder.GetFramePixelsBGRA32PremultipliedScaled(
+                    0, decoder.GetWidth() / 3, decoder.GetHeight() / 3, outWidth, outHeight) !=
+                nullptr);
+    }
+
+    stats = decoder.GetStats();
+    REQUIRE(stats.frameCacheMisses == 1);
+    REQUIRE(stats.frameCacheHits >= 2);
+    REQUIRE(stats.mipCacheMisses == 1);
+    REQUIRE(stats.mipCacheHits == 1);
+    REQUIRE(stats.framesComposed >= 1);
+    REQUIRE(stats.framesConverted >= 2);
+    REQUIRE(stats.framesScaled == 2);
+    REQUIRE(stats.composeTimeNs > 0);
+    REQUIRE(stats.convertTimeNs > 0);
+    REQUIRE(stats.scaleTimeNs > 0);
+    REQUIRE(stats.canvasBytes > 0);
+    REQUIRE(stats.cacheBytes > 0);
+
+    // Counters of destroyed decoders stay in the process totals
+    const uint64_t processDecoded = GifDecoder::GetProcessStats().framesDecoded;
+    REQUIRE(processDecoded >= stats.framesDecoded);
+    {
+        GifDecoder shortLived;
+        REQUIRE(shortLived.LoadFromFile("assets/sample.gif"));
+        REQUIRE(shortLived.GetFrameCount() == frameCount);
+    }
+    REQUIRE(GifDecoder::GetProcessStats().framesDecoded == processDecoded + frameCount);
+}
+
+TEST_CASE("GifDecoder records presentation lateness and drops", "[GifDecoder][Stats]")
+{
+    GifDecoder decoder;
+    REQUIRE(decoder.LoadFromFile("assets/sample.gif"));
+    REQUIRE(decoder.GetFrameCount() > 2);
+    const PlaybackStats processBefore = GifDecoder::GetProcessPlaybackStats();
+
+    REQUIRE(decoder.GetFramePixelsBGRA32Premultiplied(1) != nullptr);
+    decoder.RecordFramePresented(1, 0);
+    // Far later than any request takes, so the lateness is charged to the schedule
+    decoder.RecordFramePresented(1, 5000000000ull);
+    decoder.RecordFramePresented(2, LATE_FRAME_TOLERANCE_NS / 2, 3);
+
+    const PlaybackStats stats = decoder.GetPlaybackStats();
+    REQUIRE(stats.framesPresented == 3);
+    REQUIRE(stats.framesLate == 1);
+    REQUIRE(stats.framesDropped == 3);
+    REQUIRE(stats.lateSchedule == 1);
+    REQUIRE(stats.lateDecodeNotReady + stats.lateConversion + stats.lateLockWait == 0);
+    REQUIRE(stats.maxLatenessNs == 5000000000ull);
+    REQUIRE(stats.totalLatenessNs == 5000000000ull + LATE_FRAME_TOLERANCE_NS / 2);
+    REQUIRE(stats.latenessHistogram[0] == 1);
+    REQUIRE(stats.latenessHistogram[LATENESS_BUCKET_COUNT - 1] == 1);
+
+    const PlaybackStats processAfter = GifDecoder::GetProcessPlaybackStats();
+    REQUIRE(processAfter.framesPresented >= processBefore.framesPresented + 3);
+    REQUIRE(processAfter.framesDropped >= processBefore.framesDropped + 3);
+}
+
+TEST_CASE("C ABI reads a GIF's description and presents a frame in one call each",
+          "[GifDecoder][Interop]")
+{
+    gb_decoder_t decoder = gb_decoder_create();
+    REQUIRE(gb_decoder_load_from_path(decoder, "assets/sample.gif") == 1);
+    gb_decoder_set_min_frame_delay_ms(decoder, 50);
+
+    gb_decoder_info_t info;
+    REQUIRE(gb_decoder_get_info(decoder, &info) == 1);
+    REQUIRE(info.width == gb_decoder_get_width(decoder));
+    REQUIRE(info.height == gb_decoder_get_height(decoder));
+    REQUIRE(info.frame_count == gb_decoder_get_frame_count(decoder));
+    REQUIRE(info.loop_count == gb_decoder_get_loop_count(decoder));
+    REQUIRE(info.min_frame_delay_ms == 50);
+    REQUIRE(info.frame_delays_ms != nullptr);
+    int wrongDelays = 0;
+    for (int i = 0; i < info.frame_count; ++i)
+    {
+        wrongDelays += static_cast<int>(info.frame_delays_ms[i]) !=
+                       gb_decoder_get_frame_delay_ms(decoder, i);
+    }
+    REQUIRE(wrongDelays == 0);
+
+    // A new minimum invalidates the array; the next call rebuilds it
+    gb_decoder_set_min_frame_delay_ms(decoder, 500);
+    REQUIRE(gb_decoder_get_info(decoder, &info) == 1);
+    REQUIRE(info.frame_delays_ms[0] == 500);
+
+    gb_frame_status_t status;
+    REQUIRE(gb_decoder_present_frame(decoder, 1, 0, 2, &status) == 1);
+    REQUIRE(status.frame_delay_ms == gb_decoder_get_frame_delay_ms(decoder, 1));
+    REQUIRE(status.available_frame_count == info.frame_count);
+    REQUIRE(status.load_complete == 1);
+    REQUIRE(gb_decoder_present_frame(decoder, 2, 0, 0, nullptr) == 1);
+    REQUIRE(gb_decoder_present_frame(decoder, -1, 0, 0, &status) == 0);
+    REQUIRE(gb_decoder_get_info(nullptr, &info) == 0);
+
+    gb_playback_stats_t stats;
+    REQUIRE(gb_decoder_get_playback_stats(decoder, &stats) == 1);
+    REQUIRE(stats.frames_presented == 2);
+    REQUIRE(stats.frames_dropped == 2);
+    gb_decoder_destroy(decoder);
+}
+
+TEST_CASE("GifDecoder classifies frame alpha while composing", "[GifDecoder][Alpha]")
+{
+    // The kernels report how many transparent pixels they fill or clear
+    std::vector<uint32_t> canvas(16, 0x00000000);
+    const std::vector<uint32_t> square(4, 0xFF00FF00);
+    REQUIRE(Kernels::BlitFrame(square.data(), 2, 2, 1, 1, canvas.data(), 4, 4) == 4);
+    REQUIRE(Kernels::BlitFrame(square.data(), 2, 2, 2, 2, canvas.data(), 4, 4) == 3);
+    REQUIRE(Kernels::ClearRect(canvas.data(), 4, 4, 0, 0, 2, 2) == 1);
+
+    GifDecoder decoder;
+    REQUIRE(decoder.LoadFromFile("assets/sample.gif"));
+    const uint32_t frameCount = decoder.GetFrameCount();
+    int wrongClass = 0;
+    int wrongPixels = 0;
+    for (uint32_t index = 0; index < frameCount; ++index)
+    {
+        const GifFrame& frame = decoder.GetFrame(index);
+        const bool opaque = std::all_of(frame.pixels.begin(), frame.pixels.end(),
+                                        [](uint32_t pixel) { return (pixel >> 24) == 0xFF; });
+        const FrameAlpha alpha = decoder.GetFrameAlpha(index);
+        wrongClass += alpha != (opaque ? FrameAlpha::Opaque : FrameAlpha::Binary);
+
+        // The swizzle-only conversion used for classified frames matches the premultiplying one
+        std::vector<uint8_t> expected(frame.pixels.size() * 4);
+        Renderer::PixelFormats::ConvertRGBAToBGRAPremultipliedChunk(
+            reinterpret_cast<const uint8_t*>(frame.pixels.data()), expected.data(), 0,
+            frame.pixels.size());
+        const uint8_t* converted = decoder.GetFramePixelsBGRA32Premultiplied(index);
+        REQUIRE(converted != nullptr);
+        wrongPixels += !std::equal(expected.begin(), expected.end(), converted);
+    }
+    REQUIRE(wrongClass == 0);
+    REQUIRE(wrongPixels == 0);
+    REQUIRE_THROWS(decoder.GetFrameAlpha(frameCount));
+
+    gb_decoder_t handle = gb_decoder_create();
+    REQUIRE(gb_decoder_load_from_path(handle, "assets/sample.gif") == 1);
+    REQUIRE(gb_decoder_get_frame_alpha(handle, 0) ==
+            static_cast<int>(decoder.GetFrameAlpha(0)));
+    REQUIRE(gb_decoder_get_frame_alpha(handle, -1) == -1);
+    REQUIRE(gb_decoder_get_frame_alpha(nullptr, 0) == -1);
+    gb_decoder_destroy(handle);
+}
+
+namespace
+{
+/// \brief Whether opaque-path output has the four-channel colors and alpha exactly 255.
+/// Filtering alpha in floats can truncate 255 to 254, which the opaque path avoids.
+bool MatchesOpaque(const std::vector<uint8_t>& full, const std::vector<uint8_t>& opaque)
+{
+    for (size_t i = 0; i < full.size(); ++i)
+    {
+        if (i % 4 == 3 ? opaque[i] != 255 : opaque[i] != full[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+}  // namespace
+
+TEST_CASE("Opaque scaling kernels match the four-channel ones on opaque pixels",
+          "[Kernels][Alpha]")
+{
+    const uint32_t width = 13;
+    const uint32_t height = 9;
+    std::vector<uint8_t> source(static_cast<size_t>(width) * height * 4);
+    for (size_t i = 0; i < source.size(); ++i)
+    {
+        source[i] = (i % 4 == 3) ? 255 : static_cast<uint8_t>(i * 37);
+    }
+
+    const ScalingFilter filters[] = {ScalingFilter::Nearest, ScalingFilter::Bilinear,
+                                     ScalingFilter::Bicubic, ScalingFilter::Lanczos};
+    for (ScalingFilter filter : filters)
+    {
+        std::vector<uint8_t> full(7 * 5 * 4);
+        std::vector<uint8_t> opaque(full.size());
+        Kernels::ScaleBGRA(source.data(), width, height, full.data(), 7, 5, filter);
+        Kernels::ScaleBGRA(source.data(), width, height, opaque.data(), 7, 5, filter, true);
+        REQUIRE(MatchesOpaque(full, opaque));
+    }
+
+    std::vector<uint8_t> full(6 * 4 * 4);
+    std::vector<uint8_t> opaque(full.size());
+    Kernels::DownsampleBox2x(source.data(), width, height, full.data(), 6, 4);
+    Kernels::DownsampleBox2x(source.data(), width, height, opaque.data(), 6, 4, true);
+    REQUIRE(full == opaque);
+    REQUIRE(MatchesOpaque(full, opaque));
+}
+
+TEST_CASE("GifDecoder produces frames on one thread while another drives it",
+          "[GifDecoder][Threading]")
+{
+    GifDecoder decoder;
+    REQUIRE(decoder.LoadFromFile("assets/sample.gif"));
+    const uint32_t frameCount = decoder.GetFrameCount();
+    REQUIRE(frameCount > 1);
+    std::vector<uint32_t> delays(frameCount);
+    for (uint32_t index = 0; index < frameCount; ++index)
+    {
+        // The delay is read from the frame's records and agrees with the decoded frame
+        delays[index] = decoder.GetFrameDelayMs(index);
+        REQUIRE(delays[index] == decoder.GetFrame(index).delayMs);
+    }
+    REQUIRE_THROWS(decoder.GetFrameDelayMs(frameCount));
+
+    // A preparation thread fills two back buffers, as the controllers do, while this thread
+    // keeps reading delays, moving the playback position and looping
+    const size_t stride = static_cast<size_t>(decoder.GetWidth()) * 4 + 16;
+    const size_t byteCount = stride * decoder.GetHeight();
+    std::atomic<uint32_t> copied{0};
+    std::atomic<uint32_t> failed{0};
+    std::thread preparer(
+        [&]()
+        {
+            std::vector<uint8_t> buffers[2] = {std::vector<uint8_t>(byteCount),
+                                               std::vector<uint8_t>(byteCount)};
+            for (uint32_t round = 0; round < 3 * frameCount; ++round)
+            {
+                std::vector<uint8_t>& back = buffers[round % 2];
+                const bool ok =
+                    (round % 3 == 2)
+                        ? decoder.CopyFramePixelsBGRA32PremultipliedScaled(
+                              round % frameCount, decoder.GetWidth() / 2,
+                              decoder.GetHeight() / 2, back.data(), stride, byteCount)
+                        : decoder.CopyFramePixelsBGRA32Premultiplied(round % frameCount,
+                                                                     back.data(), stride,
+                                                                     byteCount);
+                (ok ? copied : failed)++;
+            }
+        });
+
+    uint32_t position = 0;
+    uint32_t wrongDelays = 0;
+    while (copied + failed < 3 * frameCount)
+    {
+        wrongDelays += decoder.GetFrameDelayMs(position) != delays[position] ? 1 : 0;
+        decoder.SetCurrentFrame(position);
+        position = (position + 1) % frameCount;
+        if (position == 0)
+        {
+            decoder.ResetCanvas();
+            decoder.GetStats();
+        }
+    }
+    preparer.join();
+    REQUIRE(wrongDelays == 0);
+    REQUIRE(copied == 3 * frameCount);
+    REQUIRE(failed == 0);
+}
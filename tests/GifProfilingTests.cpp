@@ -6,6 +6,7 @@
 #include <iomanip>
 #include <iostream>
 
+#include "GifCorpus.h"
 #include "GifDecoder.h"
 
 using namespace GifBolt;
@@ -215,3 +216,41 @@ TEST_CASE("Measure LoadFromFile breakdown components", "[Profiling]")
               << (estimatedIOTime / firstLoad * 100) << "%\n";
     std::cout << "===================================================\n\n";
 }
+
+TEST_CASE("Profile loading and conversion across the synthetic corpus", "[Profiling][Corpus]")
+{
+    std::cout << "\n========== CORPUS LOAD + CONVERSION PROFILE ==========\n";
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << std::left << std::setw(32) << "GIF" << std::right << std::setw(10) << "KB"
+              << std::setw(12) << "load ms" << std::setw(14) << "ms/frame" << "\n";
+
+    for (const Corpus::GifSpec& spec :
+         Corpus::GetCorpus(Corpus::GetCorpusSizeFromEnvironment()))
+    {
+        const std::vector<uint8_t> bytes = Corpus::Generate(spec);
+
+        GifDecoder decoder;
+        const double loadTime = MeasureMs(
+            [&]()
+            {
+                REQUIRE(decoder.LoadFromMemory(bytes.data(), bytes.size()));
+                REQUIRE(decoder.GetFrameCount() == spec.frameCount);
+            });
+        REQUIRE(decoder.GetWidth() == spec.width);
+        REQUIRE(decoder.GetHeight() == spec.height);
+
+        const double convertTime = MeasureMs(
+            [&]()
+            {
+                for (uint32_t i = 0; i < spec.frameCount; ++i)
+                {
+                    REQUIRE(decoder.GetFramePixelsBGRA32Premultiplied(i) != nullptr);
+                }
+            });
+
+        std::cout << std::left << std::setw(32) << spec.name << std::right << std::setw(10)
+                  << bytes.size() / 1024 << std::setw(12) << loadTime << std::setw(14)
+                  << convertTime / spec.frameCount << "\n";
+    }
+    std::cout << "======================================================\n\n";
+}
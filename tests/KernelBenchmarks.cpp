@@ -0,0 +1,259 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "FrameKernels.h"
+#include "GifCorpus.h"
+#include "PerfCounters.h"
+#include "PixelConversion.h"
+
+using namespace GifBolt;
+
+namespace
+{
+/// Each sample repeats the kernel for at least this long, so small sizes are not all overhead
+constexpr uint64_t MIN_SAMPLE_NS = 20000000;
+/// Samples per kernel and size; the one with the fewest cycles (or shortest time) is reported
+constexpr int SAMPLES = 3;
+/// Scaled kernels produce this fraction of the source size, a typical thumbnail ratio
+constexpr double SCALE_RATIO = 0.6;
+
+/// \brief Times a kernel with the counters, best of SAMPLES after a warm-up call.
+template <typename Kernel>
+Bench::PerfSample MeasureKernel(Bench::PerfCounters& counters, uint64_t& calls, Kernel&& kernel)
+{
+    counters.Start();
+    kernel();  // Warm-up: faults the buffers in and fills the caches
+    const uint64_t warmUpNs = std::max<uint64_t>(counters.Stop().wallNs, 1);
+    calls = std::max<uint64_t>(1, MIN_SAMPLE_NS / warmUpNs);
+
+    Bench::PerfSample best;
+    for (int sample = 0; sample < SAMPLES; ++sample)
+    {
+        counters.Start();
+        for (uint64_t call = 0; call < calls; ++call)
+        {
+            kernel();
+        }
+        const Bench::PerfSample current = counters.Stop();
+        const bool better = current.hasCycles ? current.cycles < best.cycles
+                                              : current.wallNs < best.wallNs;
+        if (sample == 0 || better)
+        {
+            best = current;
+        }
+    }
+    return best;
+}
+
+std::string Ratio(bool available, double numerator, double denominator, int precision)
+{
+    if (!available || denominator <= 0.0)
+    {
+        return "-";
+    }
+    std::ostringstream text;
+    text << std::fixed << std::setprecision(precision) << numerator / denominator;
+    return text.str();
+}
+
+/// \brief Prints one kernel at one size.
+/// \param pixels Pixels produced by one call.
+/// \param bytes Bytes read and written by one call.
+void PrintRow(const char* kernel, uint32_t size, const Bench::PerfSample& sample,
+              uint64_t calls, uint64_t pixels, uint64_t bytes)
+{
+    const double totalPixels = static_cast<double>(pixels) * calls;
+    const double totalBytes = static_cast<double>(bytes) * calls;
+    const double cycles = static_cast<double>(sample.cycles);
+    std::cout << std::left << std::setw(26) << kernel << std::right << std::setw(6) << size
+              << std::setw(9) << Ratio(true, sample.wallNs, totalPixels, 2) << std::setw(9)
+              << Ratio(sample.hasCycles, cycles, totalPixels, 2) << std::setw(7)
+              << Ratio(sample.hasCycles && sample.hasInstructions,
+                       static_cast<double>(sample.instructions), cycles, 2)
+              << std::setw(8) << Ratio(sample.hasCycles, totalBytes, cycles, 2) << std::setw(8)
+              << Ratio(true, totalBytes, sample.wallNs, 2) << std::setw(10)
+              << Ratio(sample.hasCacheMisses, sample.cacheMisses * 1000.0, totalPixels, 3)
+              << std::setw(10)
+              << Ratio(sample.hasBranchMisses, sample.branchMisses * 1000.0, totalPixels, 3)
+              << "\n";
+}
+
+/// \brief Fills RGBA pixels with random colors and an alpha mix of 1/4 transparent, 1/4
+/// translucent and 1/2 opaque, so that the branches of the kernels are not predictable.
+void FillPixels(std::vector<uint32_t>& pixels, std::mt19937& random)
+{
+    for (uint32_t& pixel : pixels)
+    {
+        const uint32_t color = random() & 0x00FFFFFF;
+        const uint32_t kind = random() & 3;
+        const uint32_t alpha = kind == 0 ? 0 : (kind == 1 ? (random() & 0xFE) + 1 : 0xFF);
+        pixel = (alpha << 24) | color;
+    }
+}
+}  // namespace
+
+TEST_CASE("Benchmark pixel kernels with hardware counters", "[Benchmark][Kernels]")
+{
+    Bench::PerfCounters counters;
+    std::vector<uint32_t> sizes = {64, 256, 1024, 2048};
+    if (Corpus::GetCorpusSizeFromEnvironment() == Corpus::CorpusSize::Full)
+    {
+        sizes.push_back(4096);
+    }
+
+    std::cout << "\n========== PIXEL KERNELS (single thread, NxN source) ==========\n";
+    if (!counters.IsAvailable() || !counters.GetUnavailableReason().empty())
+    {
+        std::cout << "Hardware counters missing (" << counters.GetUnavailableReason()
+                  << "); their columns show '-'\n";
+    }
+    std::cout << std::left << std::setw(26) << "Kernel" << std::right << std::setw(6) << "N"
+              << std::setw(9) << "ns/px" << std::setw(9) << "cyc/px" << std::setw(7) << "IPC"
+              << std::setw(8) << "B/cyc" << std::setw(8) << "GB/s" << std::setw(10)
+              << "LLCm/kpx" << std::setw(10) << "BRm/kpx" << "\n";
+
+    std::mt19937 random(0x6B65726E);
+    std::vector<uint8_t> palette(256 * 3);
+    for (uint8_t& component : palette)
+    {
+        component = static_cast<uint8_t>(random());
+    }
+
+    for (const uint32_t size : sizes)
+    {
+        const uint64_t pixels = static_cast<uint64_t>(size) * size;
+        std::vector<uint8_t> raster(pixels);
+        for (uint8_t& index : raster)
+        {
+            index = static_cast<uint8_t>(random());
+        }
+        std::vector<uint32_t> frame(pixels);
+        FillPixels(frame, random);
+        std::vector<uint32_t> opaqueFrame(frame);
+        for (uint32_t& pixel : opaqueFrame)
+        {
+            pixel |= 0xFF000000;
+        }
+        std::vector<uint32_t> canvas(pixels, 0xFF000000);
+        std::vector<uint32_t> savedCanvas(canvas);
+        std::vector<uint8_t> bgra(pixels * 4);
+
+        const auto* frameBytes = reinterpret_cast<const uint8_t*>(frame.data());
+        uint64_t calls = 0;
+        Bench::PerfSample sample;
+
+        // Decoding: palette lookup, with index 7 transparent
+        sample = MeasureKernel(counters, calls,
+                               [&]
+                               {
+                                   Kernels::ApplyColorMap(raster.data(), palette.data(), 256,
+                                                          canvas.data(), pixels, 7);
+                               });
+        PrintRow("ApplyColorMap", size, sample, calls, pixels, pixels * 5);
+
+        // Composition, one row per disposal path
+        sample = MeasureKernel(counters, calls,
+                               [&]
+                               {
+                                   Kernels::BlitFrame(opaqueFrame.data(), size, size, 0, 0,
+                                                      canvas.data(), size, size);
+                               });
+        PrintRow("Compose opaque", size, sample, calls, pixels, pixels * 8);
+        REQUIRE(canvas == opaqueFrame);
+
+        sample = MeasureKernel(counters, calls,
+                               [&]
+                               {
+                                   Kernels::BlitFrame(frame.data(), size, size, 0, 0,
+                                                      canvas.data(), size, size);
+                               });
+        PrintRow("Compose transparent mix", size, sample, calls, pixels, pixels * 8);
+
+        sample = MeasureKernel(counters, calls,
+                               [&]
+                               {
+                                   Kernels::BlitFrame(frame.data(), size, size, size / 2,
+                                                      size / 2, canvas.data(), size, size);
+                               });
+        PrintRow("Compose clipped subrect", size, sample, calls, pixels / 4, pixels * 2);
+
+        sample = MeasureKernel(
+            counters, calls,
+            [&] { Kernels::ClearRect(canvas.data(), size, size, 0, 0, size, size); });
+        PrintRow("Dispose background", size, sample, calls, pixels, pixels * 4);
+        REQUIRE(std::all_of(canvas.begin(), canvas.end(), [](uint32_t p) { return p == 0; }));
+
+        sample = MeasureKernel(counters, calls,
+                               [&] { std::copy(savedCanvas.begin(), savedCanvas.end(),
+                                               canvas.begin()); });
+        PrintRow("Dispose previous", size, sample, calls, pixels, pixels * 8);
+
+        // Conversion, as the chunk each worker runs
+        sample = MeasureKernel(counters, calls,
+                               [&]
+                               {
+                                   Renderer::PixelFormats::ConvertRGBAToBGRAPremultipliedChunk(
+                                       frameBytes, bgra.data(), 0, pixels);
+                               });
+        PrintRow("RGBAToBGRAPremultiplied", size, sample, calls, pixels, pixels * 8);
+
+        sample = MeasureKernel(counters, calls,
+                               [&]
+                               {
+                                   Renderer::PixelFormats::PremultiplyAlphaBGRAChunk(
+                                       bgra.data(), 0, pixels);
+                               });
+        PrintRow("PremultiplyAlphaBGRA", size, sample, calls, pixels, pixels * 8);
+
+        // Scaling; pixels and bytes count the destination, plus the source for bytes
+        const uint32_t scaled = std::max(1u, static_cast<uint32_t>(size * SCALE_RATIO));
+        const uint64_t scaledPixels = static_cast<uint64_t>(scaled) * scaled;
+        std::vector<uint8_t> scaledBgra(scaledPixels * 4);
+        const std::pair<ScalingFilter, const char*> filters[] = {
+            {ScalingFilter::Nearest, "Scale Nearest"},
+            {ScalingFilter::Bilinear, "Scale Bilinear"},
+            {ScalingFilter::Bicubic, "Scale Bicubic"},
+            {ScalingFilter::Lanczos, "Scale Lanczos"}};
+        for (const auto& filter : filters)
+        {
+            sample = MeasureKernel(counters, calls,
+                                   [&]
+                                   {
+                                       Kernels::ScaleBGRA(bgra.data(), size, size,
+                                                          scaledBgra.data(), scaled, scaled,
+                                                          filter.first);
+                                   });
+            PrintRow(filter.second, size, sample, calls, scaledPixels,
+                     (pixels + scaledPixels) * 4);
+        }
+
+        const uint32_t half = std::max(1u, size / 2);
+        sample = MeasureKernel(counters, calls,
+                               [&]
+                               {
+                                   Kernels::DownsampleBox2x(bgra.data(), size, size,
+                                                            scaledBgra.data(), half, half);
+                               });
+        PrintRow("Mip Box2x", size, sample, calls, static_cast<uint64_t>(half) * half,
+                 (pixels + static_cast<uint64_t>(half) * half) * 4);
+
+        REQUIRE(sample.wallNs > 0);
+        if (counters.IsAvailable())
+        {
+            REQUIRE(sample.hasCycles);
+            REQUIRE(sample.instructions > 0);
+        }
+    }
+    std::cout << "==============================================================\n";
+    std::cout << "B/cyc and GB/s count the bytes a kernel must read and write, not cache "
+                 "traffic\n\n";
+}
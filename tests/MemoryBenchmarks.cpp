@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#include <catch2/catch_test_macros.hpp>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "AllocationHooks.h"
+#include "GifCorpus.h"
+#include "GifDecoder.h"
+#include "MemoryFootprint.h"
+
+using namespace GifBolt;
+
+namespace
+{
+uint64_t ToKb(uint64_t bytes)
+{
+    return (bytes + 512) / 1024;
+}
+
+int64_t ToKb(int64_t bytes)
+{
+    return bytes / 1024;
+}
+}  // namespace
+
+TEST_CASE("Benchmark per-decoder memory over the synthetic corpus", "[Benchmark][Memory]")
+{
+    REQUIRE(Bench::IsHeapTracked());
+    const std::vector<Bench::MemoryConfig> configs = Bench::GetMemoryConfigs();
+
+    std::cout << "\n========== MEMORY PER DECODER (KB) ==========\n";
+    std::cout << std::left << std::setw(30) << "GIF" << std::setw(26) << "Settings" << std::right
+              << std::setw(7) << "Fixed" << std::setw(9) << "Heap" << std::setw(9) << "Peak"
+              << std::setw(9) << "RSS" << std::setw(9) << "PeakRSS" << std::setw(9) << "Raster"
+              << std::setw(9) << "Canvas" << std::setw(9) << "Frames" << std::setw(9)
+              << "Convert" << std::setw(8) << "Pool" << std::setw(8) << "Other" << "\n";
+
+    for (const Corpus::GifSpec& spec :
+         Corpus::GetCorpus(Corpus::GetCorpusSizeFromEnvironment()))
+    {
+        const std::vector<uint8_t> gif = Corpus::Generate(spec);
+        const uint64_t canvasSize = static_cast<uint64_t>(spec.width) * spec.height * 4;
+
+        for (const Bench::MemoryConfig& config : configs)
+        {
+            const Bench::MemoryFootprint footprint = Bench::MeasureFootprint(gif, config);
+            std::cout << std::left << std::setw(30) << spec.name << std::setw(26) << config.name
+                      << std::right << std::setw(7) << ToKb(footprint.fixedHeapBytes)
+                      << std::setw(9) << ToKb(footprint.steadyHeapBytes) << std::setw(9)
+                      << ToKb(footprint.peakHeapBytes) << std::setw(9)
+                      << ToKb(footprint.steadyRssBytes) << std::setw(9)
+                      << ToKb(footprint.peakRssBytes) << std::setw(9)
+                      << ToKb(footprint.rasterBytes) << std::setw(9)
+                      << ToKb(footprint.canvasBytes) << std::setw(9)
+                      << ToKb(footprint.frameCacheBytes) << std::setw(9)
+                      << ToKb(footprint.conversionCacheBytes) << std::setw(8)
+                      << ToKb(footprint.poolBytes) << std::setw(8)
+                      << ToKb(footprint.otherHeapBytes) << "\n";
+
+            // Every decoder composes onto a full-size canvas, and the cache never holds more
+            // frames than it is allowed (pooled buffers round up by at most 25%)
+            REQUIRE(footprint.canvasBytes >= canvasSize);
+            REQUIRE(footprint.frameCacheBytes <= canvasSize * config.maxCachedFrames * 5 / 4);
+            REQUIRE(footprint.rasterBytes > 0);
+            REQUIRE(footprint.fixedHeapBytes > 0);
+            REQUIRE(footprint.steadyHeapBytes >= footprint.canvasBytes);
+            REQUIRE(footprint.peakHeapBytes >= footprint.steadyHeapBytes);
+        }
+    }
+    std::cout << "==============================================\n\n";
+
+    // Every decoder the suite created has been destroyed
+    REQUIRE(GifDecoder::GetProcessStats().canvasBytes == 0);
+}
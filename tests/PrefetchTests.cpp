@@ -3,8 +3,12 @@
 
 #include <catch2/catch_test_macros.hpp>
 #include <chrono>
+#include <iomanip>
 #include <iostream>
+#include <thread>
+#include <vector>
 
+#include "GifCorpus.h"
 #include "GifDecoder.h"
 
 using namespace GifBolt;
@@ -58,3 +62,89 @@ TEST_CASE("Async prefetching reduces random access latency", "[Prefetch]")
     std::cout << "  - Configurable lookahead (currently 5 frames)\n";
     std::cout << "==================================================\n\n";
 }
+
+TEST_CASE("Frames composed ahead are served as composed", "[Prefetch]")
+{
+    // Reference frames, composed in one pass
+    GifDecoder reference;
+    REQUIRE(reference.LoadFromFile("assets/sample.gif"));
+    std::vector<std::vector<uint32_t>> expected;
+    std::vector<FrameAlpha> expectedAlpha;
+    REQUIRE(reference.VisitComposedFrames(
+        [&](uint32_t, const uint32_t* pixels, FrameAlpha alpha)
+        {
+            expected.emplace_back(pixels, pixels + reference.GetWidth() * reference.GetHeight());
+            expectedAlpha.push_back(alpha);
+            return true;
+        }));
+    const uint32_t frameCount = static_cast<uint32_t>(expected.size());
+    REQUIRE(frameCount > 1);
+
+    // A frame the visit composed over is recomposed rather than read off the canvas
+    REQUIRE(reference.GetFrame(0).pixels == expected[0]);
+
+    // Prefetching composes ahead of the frame shown; those frames are used, not recomposed
+    GifDecoder decoder;
+    REQUIRE(decoder.LoadFromFile("assets/sample.gif"));
+    REQUIRE(decoder.GetFrame(0).pixels == expected[0]);
+    decoder.StartPrefetching(0);
+    const uint32_t ahead = std::min(frameCount, 6u);
+    const auto deadline = steady_clock::now() + seconds(5);
+    while (decoder.GetStats().framesComposed < ahead && steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(milliseconds(1));
+    }
+    decoder.StopPrefetching();
+    REQUIRE(decoder.GetStats().framesComposed >= ahead);
+
+    int wrongFrames = 0;
+    for (uint32_t index = 1; index < ahead; ++index)
+    {
+        const GifFrame& frame = decoder.GetFrame(index);
+        wrongFrames += frame.pixels != expected[index] || frame.alpha != expectedAlpha[index];
+    }
+    REQUIRE(wrongFrames == 0);
+    REQUIRE(decoder.GetStats().framesComposed <= frameCount);
+}
+
+TEST_CASE("Prefetching across the synthetic corpus", "[Prefetch][Corpus]")
+{
+    std::cout << "\n========== CORPUS PREFETCH (BGRA ms/frame) ==========\n";
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << std::left << std::setw(32) << "GIF" << std::right << std::setw(12)
+              << "on demand" << std::setw(12) << "prefetched" << "\n";
+
+    for (const Corpus::GifSpec& spec :
+         Corpus::GetCorpus(Corpus::GetCorpusSizeFromEnvironment()))
+    {
+        const std::vector<uint8_t> bytes = Corpus::Generate(spec);
+        const uint32_t frames = std::min(spec.frameCount, 60u);
+        double timeMs[2] = {};
+
+        for (int prefetch = 0; prefetch < 2; ++prefetch)
+        {
+            GifDecoder decoder;
+            REQUIRE(decoder.LoadFromMemory(bytes.data(), bytes.size()));
+            if (prefetch != 0)
+            {
+                decoder.StartPrefetching(0);
+                std::this_thread::sleep_for(milliseconds(20));
+            }
+
+            const auto start = high_resolution_clock::now();
+            for (uint32_t i = 0; i < frames; ++i)
+            {
+                decoder.SetCurrentFrame(i);
+                REQUIRE(decoder.GetFramePixelsBGRA32Premultiplied(i) != nullptr);
+            }
+            timeMs[prefetch] =
+                duration_cast<microseconds>(high_resolution_clock::now() - start).count() /
+                1000.0;
+            decoder.StopPrefetching();
+        }
+
+        std::cout << std::left << std::setw(32) << spec.name << std::right << std::setw(12)
+                  << timeMs[0] / frames << std::setw(12) << timeMs[1] / frames << "\n";
+    }
+    std::cout << "=====================================================\n\n";
+}
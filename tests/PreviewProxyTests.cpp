@@ -0,0 +1,185 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "GifDecoder.h"
+#include "PixelConversion.h"
+#include "PreviewProxy.h"
+#include "gifbolt_c.h"
+
+using namespace GifBolt;
+
+TEST_CASE("Preview proxies downscale, decimate and round-trip through files", "[Preview]")
+{
+    GifDecoder decoder;
+    REQUIRE(decoder.LoadFromFile("assets/sample.gif"));
+    const uint32_t frameCount = decoder.GetFrameCount();
+    const std::vector<uint32_t> sourceDelays = decoder.GetFrameDelaysMs();
+    const uint64_t loopMs = std::accumulate(sourceDelays.begin(), sourceDelays.end(), 0ull);
+
+    // A box at least as large as the source and no frame rate limit keeps every frame as is
+    PreviewOptions full;
+    full.maxWidth = decoder.GetWidth() * 2;
+    full.maxHeight = decoder.GetHeight() * 2;
+    full.maxFps = 0;
+    PreviewProxy same;
+    REQUIRE(same.Generate(decoder, full));
+    REQUIRE(same.GetWidth() == decoder.GetWidth());
+    REQUIRE(same.GetHeight() == decoder.GetHeight());
+    REQUIRE(same.GetFrameCount() == frameCount);
+    REQUIRE(same.GetFrameDelaysMs() == sourceDelays);
+    const size_t rowBytes = static_cast<size_t>(same.GetWidth()) * 4;
+    std::vector<uint8_t> proxyPixels(rowBytes * same.GetHeight());
+    std::vector<uint8_t> expected(proxyPixels.size());
+    int wrongFrames = 0;
+    REQUIRE(decoder.VisitComposedFrames(
+        [&](uint32_t index, const uint32_t* canvas, FrameAlpha)
+        {
+            Renderer::PixelFormats::ConvertRGBAToBGRAPremultipliedChunk(
+                reinterpret_cast<const uint8_t*>(canvas), expected.data(), 0,
+                expected.size() / 4);
+            wrongFrames += !same.CopyFramePixelsBGRA32Premultiplied(
+                index, proxyPixels.data(), rowBytes, proxyPixels.size());
+            wrongFrames += proxyPixels != expected;
+            return true;
+        }));
+    REQUIRE(wrongFrames == 0);
+    int visits = 0;
+    REQUIRE_FALSE(decoder.VisitComposedFrames([&](uint32_t, const uint32_t*, FrameAlpha)
+                                              { return ++visits < 2; }));
+    REQUIRE(visits == 2);
+
+    // A tile keeps the aspect ratio, fewer frames, and the length of a loop
+    PreviewOptions tile;
+    tile.maxWidth = 64;
+    tile.maxHeight = 64;
+    tile.maxFps = 4;
+    PreviewProxy preview;
+    REQUIRE(preview.Generate(decoder, tile));
+    REQUIRE(preview.GetWidth() == 64);
+    REQUIRE(preview.GetHeight() ==
+            static_cast<uint32_t>(decoder.GetHeight() * 64.0 / decoder.GetWidth() + 0.5));
+    REQUIRE(preview.GetFrameCount() >= 1);
+    REQUIRE(preview.GetFrameCount() <= loopMs * tile.maxFps / 1000 + 1);
+    const std::vector<uint32_t>& delays = preview.GetFrameDelaysMs();
+    REQUIRE(std::accumulate(delays.begin(), delays.end(), 0ull) == loopMs);
+    const std::vector<uint32_t>& sourceFrames = preview.GetSourceFrames();
+    REQUIRE(sourceFrames.front() == 0);
+    REQUIRE(std::is_sorted(sourceFrames.begin(), sourceFrames.end()));
+    REQUIRE(sourceFrames.back() < frameCount);
+    REQUIRE(preview.IsLooping() == decoder.IsLooping());
+    const size_t frameBytes = static_cast<size_t>(preview.GetWidth()) * preview.GetHeight() * 4;
+    REQUIRE(preview.GetStorage() == PreviewStorage::Indexed8);
+    REQUIRE(preview.GetMemoryBytes() < preview.GetFrameCount() * frameBytes / 2);
+
+    // Frames with more than 256 colors are quantized close to their exact colors
+    PreviewOptions exactTile = tile;
+    exactTile.exactColors = true;
+    PreviewProxy exact;
+    REQUIRE(exact.Generate(decoder, exactTile));
+    REQUIRE(exact.GetStorage() == PreviewStorage::Bgra32);
+    REQUIRE(exact.GetFrameCount() == preview.GetFrameCount());
+    std::vector<uint8_t> quantized(frameBytes);
+    std::vector<uint8_t> unquantized(frameBytes);
+    uint64_t totalError = 0;
+    for (uint32_t index = 0; index < preview.GetFrameCount(); ++index)
+    {
+        REQUIRE(preview.CopyFramePixelsBGRA32Premultiplied(index, quantized.data(),
+                                                           preview.GetWidth() * 4, frameBytes));
+        REQUIRE(exact.CopyFramePixelsBGRA32Premultiplied(index, unquantized.data(),
+                                                         exact.GetWidth() * 4, frameBytes));
+        for (size_t byte = 0; byte < frameBytes; ++byte)
+        {
+            totalError += static_cast<uint64_t>(std::abs(quantized[byte] - unquantized[byte]));
+        }
+    }
+    REQUIRE(totalError < preview.GetFrameCount() * frameBytes * 4);
+
+    // Written frames read back identically; truncated files are rejected
+    const std::filesystem::path path =
+        std::filesystem::temp_directory_path() / "gifbolt-preview-test.gbpv";
+    REQUIRE(preview.SaveToFile(path.string()));
+    PreviewProxy loaded;
+    REQUIRE(loaded.LoadFromFile(path.string()));
+    REQUIRE(loaded.GetWidth() == preview.GetWidth());
+    REQUIRE(loaded.GetStorage() == preview.GetStorage());
+    REQUIRE(loaded.GetFrameDelaysMs() == preview.GetFrameDelaysMs());
+    REQUIRE(loaded.GetSourceFrames() == preview.GetSourceFrames());
+    std::vector<uint8_t> written(frameBytes);
+    std::vector<uint8_t> read(frameBytes);
+    const size_t stride = static_cast<size_t>(preview.GetWidth()) * 4;
+    wrongFrames = 0;
+    for (uint32_t index = 0; index < preview.GetFrameCount(); ++index)
+    {
+        REQUIRE(preview.CopyFramePixelsBGRA32Premultiplied(index, written.data(), stride,
+                                                           written.size()));
+        REQUIRE(loaded.CopyFramePixelsBGRA32Premultiplied(index, read.data(), stride,
+                                                          read.size()));
+        wrongFrames += written != read;
+    }
+    REQUIRE(wrongFrames == 0);
+    REQUIRE_FALSE(loaded.CopyFramePixelsBGRA32Premultiplied(loaded.GetFrameCount(), read.data(),
+                                                            stride, read.size()));
+    REQUIRE_FALSE(loaded.CopyFramePixelsBGRA32Premultiplied(0, read.data(), stride,
+                                                            read.size() - 1));
+
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+    REQUIRE_FALSE(loaded.LoadFromFile(path.string()));
+    REQUIRE(loaded.GetFrameCount() == 0);
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("C ABI builds and plays a preview proxy without its decoder", "[Preview][Interop]")
+{
+    gb_decoder_t decoder = gb_decoder_create();
+    REQUIRE(gb_decoder_load_from_path(decoder, "assets/sample.gif") == 1);
+    gb_preview_t preview = gb_preview_create(decoder, 48, 48, 8);
+    REQUIRE(preview != nullptr);
+    REQUIRE(gb_preview_create(decoder, 0, 48, 8) == nullptr);
+    REQUIRE(gb_preview_create(nullptr, 48, 48, 8) == nullptr);
+    gb_decoder_destroy(decoder);
+
+    gb_preview_info_t info;
+    REQUIRE(gb_preview_get_info(preview, &info) == 1);
+    REQUIRE(info.width == 48);
+    REQUIRE(info.height <= 48);
+    REQUIRE(info.frame_count >= 1);
+    REQUIRE(info.frame_delays_ms != nullptr);
+    REQUIRE(info.source_frames[0] == 0);
+    REQUIRE(info.memory_bytes > 0);
+    REQUIRE(gb_preview_get_info(nullptr, &info) == 0);
+
+    const int stride = info.width * 4 + 8;
+    std::vector<uint8_t> pixels(static_cast<size_t>(stride) * info.height);
+    for (int index = 0; index < info.frame_count; ++index)
+    {
+        REQUIRE(gb_preview_copy_frame_pixels_bgra32_premultiplied(
+                    preview, index, pixels.data(), stride, static_cast<int>(pixels.size())) ==
+                1);
+    }
+    REQUIRE(gb_preview_copy_frame_pixels_bgra32_premultiplied(
+                preview, -1, pixels.data(), stride, static_cast<int>(pixels.size())) == 0);
+
+    const std::string path =
+        (std::filesystem::temp_directory_path() / "gifbolt-preview-abi.gbpv").string();
+    REQUIRE(gb_preview_save(preview, path.c_str()) == 1);
+    gb_preview_t loaded = gb_preview_load(path.c_str());
+    REQUIRE(loaded != nullptr);
+    gb_preview_info_t loadedInfo;
+    REQUIRE(gb_preview_get_info(loaded, &loadedInfo) == 1);
+    REQUIRE(loadedInfo.frame_count == info.frame_count);
+    REQUIRE(loadedInfo.indexed == info.indexed);
+    REQUIRE(gb_preview_load("assets/sample.gif") == nullptr);
+    gb_preview_destroy(loaded);
+    gb_preview_destroy(preview);
+    gb_preview_destroy(nullptr);
+    std::remove(path.c_str());
+}
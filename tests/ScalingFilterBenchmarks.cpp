@@ -8,6 +8,7 @@
 #include <thread>
 #include <vector>
 
+#include "GifCorpus.h"
 #include "GifDecoder.h"
 #include "ScalingFilter.h"
 
@@ -220,3 +221,52 @@ TEST_CASE("Benchmark prefetch impact on sequential access", "[Benchmark][Prefetc
 
     std::cout << "\nNote: Prefetch benefits increase with sequential playback patterns\n";
 }
+
+TEST_CASE("Benchmark scaling filters across the synthetic corpus", "[Benchmark][Scaling][Corpus]")
+{
+    const std::vector<std::pair<ScalingFilter, const char*>> filters = {
+        {ScalingFilter::Nearest, "Nearest"},
+        {ScalingFilter::Bilinear, "Bilinear"},
+        {ScalingFilter::Bicubic, "Bicubic"},
+        {ScalingFilter::Lanczos, "Lanczos"}};
+
+    std::cout << "\n========== CORPUS SCALING BENCHMARK (2x downscale, ms/frame) ==========\n";
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << std::left << std::setw(32) << "GIF" << std::right;
+    for (const auto& filter : filters)
+    {
+        std::cout << std::setw(10) << filter.second;
+    }
+    std::cout << "\n";
+
+    for (const Corpus::GifSpec& spec :
+         Corpus::GetCorpus(Corpus::GetCorpusSizeFromEnvironment()))
+    {
+        const std::vector<uint8_t> bytes = Corpus::Generate(spec);
+        const uint32_t targetWidth = std::max(1, spec.width / 2);
+        const uint32_t targetHeight = std::max(1, spec.height / 2);
+        const uint32_t frames = std::min(spec.frameCount, 50u);
+
+        std::cout << std::left << std::setw(32) << spec.name << std::right;
+        for (const auto& filter : filters)
+        {
+            // A fresh decoder per filter so that no filter is served from another's caches
+            GifDecoder decoder;
+            REQUIRE(decoder.LoadFromMemory(bytes.data(), bytes.size()));
+            const double time = MeasureMs(
+                [&]()
+                {
+                    for (uint32_t frame = 0; frame < frames; ++frame)
+                    {
+                        uint32_t outWidth = 0, outHeight = 0;
+                        REQUIRE(decoder.GetFramePixelsBGRA32PremultipliedScaled(
+                                    frame, targetWidth, targetHeight, outWidth, outHeight,
+                                    filter.first) != nullptr);
+                    }
+                });
+            std::cout << std::setw(10) << time / frames;
+        }
+        std::cout << "\n";
+    }
+    std::cout << "=======================================================================\n\n";
+}
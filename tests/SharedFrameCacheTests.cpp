@@ -0,0 +1,274 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "GifDecoder.h"
+#include "SharedFrameCache.h"
+#include "gifbolt_c.h"
+
+#ifndef _WIN32
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace GifBolt;
+
+namespace
+{
+/// \brief A cache name no other test run uses, so that runs in parallel do not meet.
+std::string UniqueCacheName(const char* prefix)
+{
+    const auto ticks = std::chrono::steady_clock::now().time_since_epoch().count();
+    return prefix + std::to_string(static_cast<uint64_t>(ticks) % 1000000000ull);
+}
+
+SharedFrameKey MakeKey(uint32_t frameIndex)
+{
+    SharedFrameKey key;
+    key.contentHash = 0x1234567890ABCDEFull;
+    key.frameIndex = frameIndex;
+    key.format = static_cast<uint32_t>(SharedFrameFormat::Bgra32Premultiplied);
+    key.width = 16;
+    key.height = 16;
+    return key;
+}
+}  // namespace
+
+TEST_CASE("Shared frame caches publish, pin and evict frames across handles", "[SharedCache]")
+{
+    if (!SharedFrameCache::IsSupported())
+    {
+        return;
+    }
+
+    // Two handles map the cache separately, as two processes would
+    const std::string name = UniqueCacheName("t");
+    constexpr size_t FRAME_BYTES = 16 * 16 * 4;
+    SharedFrameCache writer;
+    SharedFrameCache reader;
+    REQUIRE(writer.Open(name, FRAME_BYTES * 3, 64));
+    REQUIRE(reader.Open(name, FRAME_BYTES * 100));
+    REQUIRE(reader.GetStats().budgetBytes == FRAME_BYTES * 3);
+    REQUIRE_FALSE(reader.Open("not a valid name", FRAME_BYTES));
+    REQUIRE(reader.Open(name, FRAME_BYTES));
+
+    std::vector<std::vector<uint8_t>> frames;
+    for (uint32_t index = 0; index < 5; ++index)
+    {
+        frames.emplace_back(FRAME_BYTES, static_cast<uint8_t>(0x10 * (index + 1)));
+    }
+    REQUIRE(writer.Insert(MakeKey(0), frames[0].data(), FRAME_BYTES));
+    REQUIRE_FALSE(writer.Insert(MakeKey(0), frames[0].data(), FRAME_BYTES));
+    REQUIRE_FALSE(writer.Insert(MakeKey(9), frames[0].data(), FRAME_BYTES * 4));
+
+    SharedFrameCache::View pinned = reader.Find(MakeKey(0));
+    REQUIRE(pinned);
+    REQUIRE(pinned.GetSize() == FRAME_BYTES);
+    REQUIRE(std::vector<uint8_t>(pinned.GetData(), pinned.GetData() + FRAME_BYTES) == frames[0]);
+    REQUIRE_FALSE(reader.Find(MakeKey(1)));
+    REQUIRE(reader.GetStats().hits == 1);
+    REQUIRE(reader.GetStats().misses == 1);
+
+    // Filling the budget evicts the least recently used frame that is not pinned
+    REQUIRE(writer.Insert(MakeKey(1), frames[1].data(), FRAME_BYTES));
+    REQUIRE(writer.Insert(MakeKey(2), frames[2].data(), FRAME_BYTES));
+    REQUIRE(writer.Insert(MakeKey(3), frames[3].data(), FRAME_BYTES));
+    REQUIRE(writer.GetStats().evictions == 1);
+    REQUIRE_FALSE(reader.Find(MakeKey(1)));
+    REQUIRE(reader.Find(MakeKey(0)));
+    REQUIRE(reader.GetStats().entries == 3);
+    REQUIRE(reader.GetStats().usedBytes == FRAME_BYTES * 3);
+
+    // An evicted frame stays readable through a view that mapped it
+    pinned.Reset();
+    SharedFrameCache::View early = reader.Find(MakeKey(2));
+    REQUIRE(early);
+    REQUIRE(writer.Insert(MakeKey(4), frames[4].data(), FRAME_BYTES));
+    REQUIRE(std::vector<uint8_t>(early.GetData(), early.GetData() + FRAME_BYTES) == frames[2]);
+    early.Reset();
+    REQUIRE(writer.GetStats().inserts == 5);
+    REQUIRE(reader.GetStats().entries == 3);
+
+    reader.Close();
+    writer.Close();
+    SharedFrameCache::Remove(name);
+}
+
+#ifndef _WIN32
+TEST_CASE("Shared frame caches reclaim frames held by processes that died", "[SharedCache]")
+{
+    const std::string name = UniqueCacheName("r");
+    constexpr size_t FRAME_BYTES = 16 * 16 * 4;
+    const std::vector<uint8_t> frame(FRAME_BYTES, 0x40);
+    SharedFrameCache cache;
+    REQUIRE(cache.Open(name, FRAME_BYTES * 2));
+    REQUIRE(cache.Insert(MakeKey(0), frame.data(), FRAME_BYTES));
+    REQUIRE(cache.Insert(MakeKey(1), frame.data(), FRAME_BYTES));
+
+    // A process pins every frame and exits without unpinning them
+    const pid_t reader = fork();
+    REQUIRE(reader >= 0);
+    if (reader == 0)
+    {
+        SharedFrameCache child;
+        const bool opened = child.Open(name, 1);
+        SharedFrameCache::View first = child.Find(MakeKey(0));
+        SharedFrameCache::View second = child.Find(MakeKey(1));
+        _exit(opened && first && second ? 0 : 1);
+    }
+    int status = 0;
+    REQUIRE(waitpid(reader, &status, 0) == reader);
+    REQUIRE((WIFEXITED(status) && WEXITSTATUS(status) == 0));
+    REQUIRE(cache.Insert(MakeKey(2), frame.data(), FRAME_BYTES));
+    REQUIRE(cache.GetStats().evictions == 1);
+    REQUIRE_FALSE(cache.Find(MakeKey(0)));
+
+    // A process crashes while publishing, with the slot claimed and the bytes reserved
+    void* unreadable =
+        mmap(nullptr, FRAME_BYTES, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    REQUIRE(unreadable != MAP_FAILED);
+    const pid_t writer = fork();
+    REQUIRE(writer >= 0);
+    if (writer == 0)
+    {
+        signal(SIGSEGV, SIG_DFL);
+        SharedFrameCache child;
+        if (child.Open(name, 1))
+        {
+            child.Insert(MakeKey(3), static_cast<const uint8_t*>(unreadable), FRAME_BYTES);
+        }
+        _exit(0);
+    }
+    REQUIRE(waitpid(writer, &status, 0) == writer);
+    REQUIRE(WIFSIGNALED(status));
+    munmap(unreadable, FRAME_BYTES);
+    REQUIRE(cache.GetStats().entries == 1);
+    REQUIRE(cache.GetStats().usedBytes == FRAME_BYTES * 2);
+
+    // With the remaining frame pinned, only the dead writer's reservation can make room
+    SharedFrameCache::View pinned = cache.Find(MakeKey(2));
+    REQUIRE(pinned);
+    REQUIRE(cache.Insert(MakeKey(4), frame.data(), FRAME_BYTES));
+    REQUIRE_FALSE(cache.Find(MakeKey(3)));
+    REQUIRE(cache.GetStats().entries == 2);
+    REQUIRE(cache.GetStats().usedBytes == FRAME_BYTES * 2);
+
+    // An unpinned view stays readable after its frame is evicted
+    pinned.Unpin();
+    REQUIRE(cache.Insert(MakeKey(5), frame.data(), FRAME_BYTES));
+    REQUIRE_FALSE(cache.Find(MakeKey(2)));
+    REQUIRE(std::vector<uint8_t>(pinned.GetData(), pinned.GetData() + FRAME_BYTES) == frame);
+    pinned.Reset();
+
+    cache.Close();
+    SharedFrameCache::Remove(name);
+}
+#endif
+
+TEST_CASE("Decoders map frames another decoder published to a shared cache",
+          "[SharedCache][GifDecoder]")
+{
+    if (!SharedFrameCache::IsSupported())
+    {
+        return;
+    }
+
+    const std::string name = UniqueCacheName("d");
+    auto firstCache = std::make_shared<SharedFrameCache>();
+    auto secondCache = std::make_shared<SharedFrameCache>();
+    REQUIRE(firstCache->Open(name, 64ull << 20));
+    REQUIRE(secondCache->Open(name, 64ull << 20));
+
+    // The first decoder converts every frame and publishes it
+    GifDecoder first;
+    first.SetSharedFrameCache(firstCache);
+    REQUIRE(first.LoadFromFile("assets/sample.gif"));
+    const uint32_t frameCount = first.GetFrameCount();
+    const size_t frameBytes = static_cast<size_t>(first.GetWidth()) * first.GetHeight() * 4;
+    std::vector<std::vector<uint8_t>> expected;
+    for (uint32_t index = 0; index < frameCount; ++index)
+    {
+        const uint8_t* pixels = first.GetFramePixelsBGRA32Premultiplied(index);
+        REQUIRE(pixels != nullptr);
+        expected.emplace_back(pixels, pixels + frameBytes);
+    }
+    REQUIRE(firstCache->GetStats().inserts == frameCount);
+
+    // The second loads the same bytes from memory, in any order, without composing
+    std::ifstream file("assets/sample.gif", std::ios::binary);
+    const std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(file)),
+                                     std::istreambuf_iterator<char>());
+    GifDecoder second;
+    second.SetSharedFrameCache(secondCache);
+    REQUIRE(second.LoadFromMemory(bytes.data(), bytes.size()));
+    REQUIRE(second.GetFrameCount() == frameCount);
+    const size_t stride = static_cast<size_t>(second.GetWidth()) * 4 + 16;
+    std::vector<uint8_t> strided(stride * second.GetHeight());
+    int wrongFrames = 0;
+    for (uint32_t index = frameCount; index-- > 0;)
+    {
+        const uint8_t* pixels = second.GetFramePixelsBGRA32Premultiplied(index);
+        REQUIRE(pixels != nullptr);
+        wrongFrames += !std::equal(pixels, pixels + frameBytes, expected[index].begin());
+        REQUIRE(second.CopyFramePixelsBGRA32Premultiplied(index, strided.data(), stride,
+                                                          strided.size()));
+        wrongFrames += !std::equal(strided.begin(), strided.begin() + second.GetWidth() * 4,
+                                   expected[index].begin());
+    }
+    REQUIRE(wrongFrames == 0);
+    REQUIRE(secondCache->GetStats().hits == frameCount * 2);
+    REQUIRE(secondCache->GetStats().inserts == 0);
+    REQUIRE(second.GetStats().framesComposed == 0);
+
+    first.SetSharedFrameCache(nullptr);
+    second.SetSharedFrameCache(nullptr);
+    firstCache->Close();
+    secondCache->Close();
+    SharedFrameCache::Remove(name);
+}
+
+TEST_CASE("C ABI opens shared caches and sets them on decoders", "[SharedCache][Interop]")
+{
+    REQUIRE(gb_shared_cache_open("bad/name", 1 << 20) == nullptr);
+    REQUIRE(gb_shared_cache_open("c", 0) == nullptr);
+    if (!SharedFrameCache::IsSupported())
+    {
+        return;
+    }
+
+    const std::string name = UniqueCacheName("c");
+    gb_shared_cache_t cache = gb_shared_cache_open(name.c_str(), 32 << 20);
+    REQUIRE(cache != nullptr);
+    gb_decoder_t decoder = gb_decoder_create();
+    REQUIRE(gb_decoder_set_shared_cache(decoder, cache) == 1);
+    REQUIRE(gb_decoder_set_shared_cache(nullptr, cache) == 0);
+
+    // The decoder keeps the cache after the handle is closed
+    gb_shared_cache_close(cache);
+    REQUIRE(gb_decoder_load_from_path(decoder, "assets/sample.gif") == 1);
+    REQUIRE(gb_decoder_get_frame_count(decoder) > 0);  // Frames are shared once all are read
+    int byteCount = 0;
+    REQUIRE(gb_decoder_get_frame_pixels_bgra32_premultiplied(decoder, 0, &byteCount) != nullptr);
+    gb_decoder_destroy(decoder);
+
+    gb_shared_cache_t reopened = gb_shared_cache_open(name.c_str(), 1);
+    REQUIRE(reopened != nullptr);
+    gb_shared_cache_stats_t stats;
+    REQUIRE(gb_shared_cache_get_stats(reopened, &stats) == 1);
+    REQUIRE(stats.entries == 1);
+    REQUIRE(stats.used_bytes == static_cast<uint64_t>(byteCount));
+    REQUIRE(stats.budget_bytes == 32u << 20);
+    REQUIRE(gb_shared_cache_get_stats(nullptr, &stats) == 0);
+    gb_shared_cache_close(reopened);
+    gb_shared_cache_close(nullptr);
+    gb_shared_cache_remove(name.c_str());
+}
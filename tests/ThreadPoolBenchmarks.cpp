@@ -5,7 +5,9 @@
 #include <chrono>
 #include <iomanip>
 #include <iostream>
+#include <vector>
 
+#include "GifCorpus.h"
 #include "GifDecoder.h"
 
 using namespace GifBolt;
@@ -183,3 +185,55 @@ TEST_CASE("Benchmark thread pool vs baseline", "[Benchmark][ThreadPool][Comparis
     std::cout << "\nNote: Thread pool provides background decoding ahead of current frame\n";
     std::cout << "Expected gain: 20-40% for sequential access, minimal for random access\n";
 }
+
+TEST_CASE("Benchmark sequential and random decode across the synthetic corpus",
+          "[Benchmark][ThreadPool][Corpus]")
+{
+    std::cout << "\n========== CORPUS DECODE BENCHMARK (ms/frame) ==========\n";
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << std::left << std::setw(32) << "GIF" << std::right << std::setw(12)
+              << "sequential" << std::setw(12) << "random" << "\n";
+
+    for (const Corpus::GifSpec& spec :
+         Corpus::GetCorpus(Corpus::GetCorpusSizeFromEnvironment()))
+    {
+        const std::vector<uint8_t> bytes = Corpus::Generate(spec);
+
+        // Sequential: playback order, where opportunistic decode runs ahead on the pool
+        GifDecoder sequential;
+        REQUIRE(sequential.LoadFromMemory(bytes.data(), bytes.size()));
+        const uint32_t frameCount = sequential.GetFrameCount();
+        const double sequentialTime = MeasureMs(
+            [&]()
+            {
+                for (uint32_t i = 0; i < frameCount; ++i)
+                {
+                    REQUIRE(sequential.GetFrame(i).pixels.size() > 0);
+                }
+            });
+
+        // Random: scrubbing, where every backward jump recomposes from an earlier frame
+        GifDecoder random;
+        REQUIRE(random.LoadFromMemory(bytes.data(), bytes.size()));
+        std::vector<uint32_t> indices(std::min(frameCount, 100u));
+        uint32_t state = spec.seed;
+        for (uint32_t& index : indices)
+        {
+            state = state * 1664525u + 1013904223u;
+            index = (state >> 8) % frameCount;
+        }
+        const double randomTime = MeasureMs(
+            [&]()
+            {
+                for (uint32_t index : indices)
+                {
+                    REQUIRE(random.GetFrame(index).pixels.size() > 0);
+                }
+            });
+
+        std::cout << std::left << std::setw(32) << spec.name << std::right << std::setw(12)
+                  << sequentialTime / frameCount << std::setw(12)
+                  << randomTime / indices.size() << "\n";
+    }
+    std::cout << "========================================================\n\n";
+}
@@ -0,0 +1,66 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#include "Trace.h"
+
+#if GIFBOLT_TRACING
+
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include "GifDecoder.h"
+
+using namespace GifBolt;
+
+namespace
+{
+std::string ReadTextFile(const std::filesystem::path& path)
+{
+    std::ifstream file(path);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+}  // namespace
+
+TEST_CASE("Trace spans are dumped as Chrome trace-event JSON", "[Trace]")
+{
+    const std::filesystem::path tracePath =
+        std::filesystem::temp_directory_path() / "gifbolt-trace-test.json";
+
+    REQUIRE(Trace::Start());
+    {
+        GifDecoder decoder;
+        REQUIRE(decoder.LoadFromFile("assets/sample.gif"));
+        const uint32_t lastFrame = decoder.GetFrameCount() - 1;
+        REQUIRE(decoder.GetFramePixelsBGRA32Premultiplied(lastFrame) != nullptr);
+    }
+    Trace::Stop();
+    REQUIRE(Trace::Dump(tracePath.string()));
+
+    const std::string json = ReadTextFile(tracePath);
+    REQUIRE(json.rfind("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", 0) == 0);
+    REQUIRE(json.find("\"name\":\"BackgroundSlurp\"") != std::string::npos);
+    REQUIRE(json.find("\"name\":\"ReadRaster\"") != std::string::npos);
+    REQUIRE(json.find("\"name\":\"DecodeFrame\"") != std::string::npos);
+    REQUIRE(json.find("\"name\":\"ComposeFrame\"") != std::string::npos);
+    REQUIRE(json.find("\"name\":\"ConvertFrame\"") != std::string::npos);
+    REQUIRE(json.find("\"args\":{\"name\":\"GifBolt loader\"}") != std::string::npos);
+    REQUIRE(json.find("\"frame\":0}") != std::string::npos);
+
+    // Nothing is recorded while tracing is stopped, and Start discards the old session
+    {
+        GifDecoder decoder;
+        REQUIRE(decoder.LoadFromFile("assets/sample.gif"));
+        REQUIRE(decoder.GetFramePixelsBGRA32Premultiplied(0) != nullptr);
+    }
+    REQUIRE(Trace::Start());
+    Trace::Stop();
+    REQUIRE(Trace::Dump(tracePath.string()));
+    REQUIRE(ReadTextFile(tracePath).find("\"ph\":\"X\"") == std::string::npos);
+
+    std::filesystem::remove(tracePath);
+}
+
+#endif  // GIFBOLT_TRACING
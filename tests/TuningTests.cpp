@@ -0,0 +1,113 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "GifDecoder.h"
+#include "PixelConversion.h"
+#include "Tuning.h"
+#include "gifbolt_c.h"
+
+using namespace GifBolt;
+
+
+TEST_CASE("Tuning profile defaults, calibration and profile files", "[Tuning]")
+{
+    Tuning::ResetProfile();
+    const uint32_t hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+    const TuningProfile defaults = Tuning::GetProfile();
+    REQUIRE(defaults.source == TuningSource::Defaults);
+    REQUIRE(defaults.convertParallelMinPixels == 100000);
+    REQUIRE(defaults.workerThreads == std::max(1u, hardwareThreads - 1));
+    REQUIRE(defaults.convertThreads == defaults.workerThreads + 1);
+    REQUIRE(defaults.hardwareThreads == hardwareThreads);
+
+    // Calibration measures without putting its result into effect
+    const TuningProfile calibrated = Tuning::Calibrate();
+    REQUIRE(calibrated.source == TuningSource::Calibrated);
+    REQUIRE(calibrated.hardwareThreads == hardwareThreads);
+    REQUIRE(calibrated.convertThreads >= 1);
+    REQUIRE(calibrated.convertThreads <= hardwareThreads);
+    REQUIRE(calibrated.workerThreads >= 1);
+    REQUIRE(calibrated.convertParallelMinPixels > 0);
+    if (calibrated.convertThreads == 1)
+    {
+        REQUIRE(calibrated.convertParallelMinPixels == UINT64_MAX);
+    }
+    REQUIRE(Tuning::GetProfile().source == TuningSource::Defaults);
+
+    const std::filesystem::path path =
+        std::filesystem::temp_directory_path() / "gifbolt-tuning-test.txt";
+    REQUIRE(Tuning::SaveProfile(calibrated, path.string()));
+    TuningProfile loaded;
+    REQUIRE(Tuning::LoadProfile(path.string(), loaded));
+    REQUIRE(loaded.source == TuningSource::Loaded);
+    REQUIRE(loaded.convertParallelMinPixels == calibrated.convertParallelMinPixels);
+    REQUIRE(loaded.convertThreads == calibrated.convertThreads);
+    REQUIRE(loaded.workerThreads == calibrated.workerThreads);
+    REQUIRE(loaded.gpuScaleMinPixels == calibrated.gpuScaleMinPixels);
+
+    // CalibrateOrLoad reads a current file instead of measuring again
+    gb_tuning_profile_t current;
+    REQUIRE(gb_calibrate(path.string().c_str(), &current) == 1);
+    REQUIRE(current.source == static_cast<uint32_t>(TuningSource::Loaded));
+    REQUIRE(current.convert_parallel_min_pixels == calibrated.convertParallelMinPixels);
+    REQUIRE(Tuning::GetProfile().source == TuningSource::Loaded);
+
+    // A profile from a host with a different number of hardware threads is stale
+    {
+        std::ofstream file(path, std::ios::trunc);
+        file << "version=1\nhardwareThreads=" << hardwareThreads + 1
+             << "\nconvertParallelMinPixels=1\nconvertThreads=2\nworkerThreads=1\n"
+                "gpuScaleMinPixels=0\n";
+    }
+    REQUIRE_FALSE(Tuning::LoadProfile(path.string(), loaded));
+    {
+        std::ofstream file(path, std::ios::trunc);
+        file << "not a profile\n";
+    }
+    REQUIRE_FALSE(Tuning::LoadProfile(path.string(), loaded));
+    std::filesystem::remove(path);
+
+    REQUIRE(gb_set_tuning_profile(nullptr) == 1);
+    REQUIRE(gb_get_tuning_profile(&current) == 1);
+    REQUIRE(current.source == static_cast<uint32_t>(TuningSource::Defaults));
+    REQUIRE(gb_get_tuning_profile(nullptr) == 0);
+}
+
+TEST_CASE("Decoders convert identically under any tuning profile", "[Tuning][GifDecoder]")
+{
+    // Every frame split across three threads, in uneven chunks
+    TuningProfile split;
+    split.convertParallelMinPixels = 1;
+    split.convertThreads = 3;
+    split.workerThreads = 4;
+    split.source = TuningSource::Host;
+    Tuning::SetProfile(split);
+    REQUIRE(Tuning::GetProfile().convertThreads == 3);
+
+    GifDecoder decoder;
+    REQUIRE(decoder.LoadFromFile("assets/sample.gif"));
+    const size_t pixelCount = static_cast<size_t>(decoder.GetWidth()) * decoder.GetHeight();
+    std::vector<uint8_t> expected(pixelCount * 4);
+    for (uint32_t index = 0; index < 4 && index < decoder.GetFrameCount(); ++index)
+    {
+        // Compare against a serial conversion of the very frame the decoder converts
+        const std::vector<uint32_t> rgba = decoder.GetFrame(index).pixels;
+        REQUIRE(rgba.size() == pixelCount);
+        Renderer::PixelFormats::ConvertRGBAToBGRAPremultipliedChunk(
+            reinterpret_cast<const uint8_t*>(rgba.data()), expected.data(), 0, pixelCount);
+        const uint8_t* converted = decoder.GetFramePixelsBGRA32Premultiplied(index);
+        REQUIRE(converted != nullptr);
+        REQUIRE(std::memcmp(converted, expected.data(), expected.size()) == 0);
+    }
+
+    Tuning::ResetProfile();
+}
@@ -0,0 +1,404 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+// The stand-in origin server below uses POSIX sockets
+#ifndef _WIN32
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "GifDecoder.h"
+
+using namespace GifBolt;
+
+namespace
+{
+const char* SAMPLE_GIF_PATH = "assets/sample.gif";
+
+std::vector<uint8_t> ReadFileBytes(const char* path)
+{
+    std::ifstream file(path, std::ios::binary);
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(file),
+                                std::istreambuf_iterator<char>());
+}
+
+/// \brief Minimal HTTP/1.1 origin on 127.0.0.1 serving a single GIF body.
+class LocalHttpServer
+{
+   public:
+    explicit LocalHttpServer(std::vector<uint8_t> body) : _body(std::move(body))
+    {
+        this->_listenSocket = socket(AF_INET, SOCK_STREAM, 0);
+        const int reuse = 1;
+        setsockopt(this->_listenSocket, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = 0;  // Let the OS pick a free port
+        bind(this->_listenSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+        listen(this->_listenSocket, 16);
+
+        socklen_t length = sizeof(address);
+        getsockname(this->_listenSocket, reinterpret_cast<sockaddr*>(&address), &length);
+        this->_port = ntohs(address.sin_port);
+
+        this->_acceptThread = std::thread(&LocalHttpServer::AcceptLoop, this);
+    }
+
+    ~LocalHttpServer()
+    {
+        this->_running = false;
+        this->Release();
+        this->_acceptThread.join();
+        for (std::thread& connection : this->_connections)
+        {
+            connection.join();
+        }
+        close(this->_listenSocket);
+    }
+
+    std::string Url() const
+    {
+        return "http://127.0.0.1:" + std::to_string(this->_port) + "/sample.gif";
+    }
+
+    /// \brief Sends everything but the last byte of each body until Release() is called.
+    void HoldLastByte()
+    {
+        std::lock_guard<std::mutex> lock(this->_mutex);
+        this->_holding = true;
+    }
+
+    void Release()
+    {
+        {
+            std::lock_guard<std::mutex> lock(this->_mutex);
+            this->_holding = false;
+        }
+        this->_released.notify_all();
+    }
+
+    std::atomic<bool> chunked{false};          ///< Use chunked transfer encoding
+    std::string cacheControl = "no-cache";     ///< Cache-Control sent with responses
+    std::atomic<int> requests{0};              ///< Requests received
+    std::atomic<int> notModifiedResponses{0};  ///< 304 responses sent
+
+   private:
+    static constexpr const char* ETAG = "\"sample-v1\"";
+
+    void AcceptLoop()
+    {
+        while (this->_running)
+        {
+            pollfd listenPoll{this->_listenSocket, POLLIN, 0};
+            if (poll(&listenPoll, 1, 50) <= 0)
+            {
+                continue;
+            }
+            const int client = accept(this->_listenSocket, nullptr, nullptr);
+            if (client >= 0)
+            {
+                this->_connections.emplace_back(&LocalHttpServer::Serve, this, client);
+            }
+        }
+    }
+
+    static void SendAll(int client, const void* data, size_t length)
+    {
+        const auto* bytes = static_cast<const char*>(data);
+        while (length > 0)
+        {
+            const ssize_t sent = send(client, bytes, length, MSG_NOSIGNAL);
+            if (sent <= 0)
+            {
+                return;
+            }
+            bytes += sent;
+            length -= static_cast<size_t>(sent);
+        }
+    }
+
+    void SendBody(int client, const uint8_t* data, size_t length)
+    {
+        if (length == 0)
+        {
+            return;
+        }
+        if (this->chunked)
+        {
+            char size[32];
+            std::snprintf(size, sizeof(size), "%zx\r\n", length);
+            SendAll(client, size, std::strlen(size));
+            SendAll(client, data, length);
+            SendAll(client, "\r\n", 2);
+        }
+        else
+        {
+            SendAll(client, data, length);
+        }
+    }
+
+    void Serve(int client)
+    {
+        std::string request;
+        char buffer[1024];
+        while (request.find("\r\n\r\n") == std::string::npos)
+        {
+            const ssize_t received = recv(client, buffer, sizeof(buffer), 0);
+            if (received <= 0)
+            {
+                close(client);
+                return;
+            }
+            request.append(buffer, static_cast<size_t>(received));
+        }
+        ++this->requests;
+
+        if (request.find(std::string("If-None-Match: ") + ETAG) != std::string::npos)
+        {
+            ++this->notModifiedResponses;
+            const std::string head = std::string("HTTP/1.1 304 Not Modified\r\nETag: ") + ETAG +
+                                     "\r\nCache-Control: " + this->cacheControl +
+                                     "\r\nConnection: close\r\n\r\n";
+            SendAll(client, head.data(), head.size());
+            close(client);
+            return;
+        }
+
+        std::string head = std::string("HTTP/1.1 200 OK\r\nContent-Type: image/gif\r\nETag: ") +
+                           ETAG + "\r\nCache-Control: " + this->cacheControl + "\r\n";
+        head += this->chunked ? "Transfer-Encoding: chunked\r\n"
+                              : "Content-Length: " + std::to_string(this->_body.size()) + "\r\n";
+        head += "Connection: close\r\n\r\n";
+        SendAll(client, head.data(), head.size());
+
+        // Send in small slices so the client sees the body arrive progressively
+        const size_t heldBack = 1;
+        const size_t firstPart = this->_body.size() - heldBack;
+        for (size_t offset = 0; offset < firstPart; offset += 4096)
+        {
+            this->SendBody(client, this->_body.data() + offset,
+                           std::min<size_t>(4096, firstPart - offset));
+        }
+        {
+            std::unique_lock<std::mutex> lock(this->_mutex);
+            this->_released.wait(lock, [this]() { return !this->_holding; });
+        }
+        this->SendBody(client, this->_body.data() + firstPart, heldBack);
+        if (this->chunked)
+        {
+            SendAll(client, "0\r\n\r\n", 5);
+        }
+        close(client);
+    }
+
+    std::vector<uint8_t> _body;
+    int _listenSocket = -1;
+    uint16_t _port = 0;
+    std::atomic<bool> _running{true};
+    std::thread _acceptThread;
+    std::vector<std::thread> _connections;  ///< Only touched by the accept thread until joined
+    std::mutex _mutex;
+    std::condition_variable _released;
+    bool _holding = false;
+};
+
+/// \brief Waits until the HTTP cache has committed a response to disk.
+bool WaitForCacheEntry(const std::filesystem::path& directory)
+{
+    for (int attempt = 0; attempt < 200; ++attempt)
+    {
+        std::error_code error;
+        for (const auto& entry : std::filesystem::directory_iterator(directory, error))
+        {
+            if (entry.path().extension() == ".meta")
+            {
+                return true;
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return false;
+}
+
+bool SameFirstFrameGeometry(GifDecoder& left, GifDecoder& right)
+{
+    const GifFrame& a = left.GetFrame(0);
+    const GifFrame& b = right.GetFrame(0);
+    return a.width == b.width && a.height == b.height && a.pixels.size() == b.pixels.size() &&
+           !a.pixels.empty();
+}
+}  // namespace
+
+TEST_CASE("GifDecoder loads GIFs from http and file URLs", "[GifDecoder][Url]")
+{
+    GifDecoder reference;
+    REQUIRE(reference.LoadFromFile(SAMPLE_GIF_PATH));
+    const uint32_t frameCount = reference.GetFrameCount();
+    REQUIRE(frameCount > 0);
+
+    LocalHttpServer server(ReadFileBytes(SAMPLE_GIF_PATH));
+    GifDecoder remote;
+    REQUIRE(remote.LoadFromUrl(server.Url()));
+    REQUIRE(remote.GetFrameCount() == frameCount);
+    REQUIRE(remote.GetWidth() == reference.GetWidth());
+    REQUIRE(SameFirstFrameGeometry(remote, reference));
+
+    server.chunked = true;
+    GifDecoder chunked;
+    REQUIRE(chunked.LoadFromUrl(server.Url()));
+    REQUIRE(chunked.GetFrameCount() == frameCount);
+
+    const std::string fileUrl =
+        "file://" + std::filesystem::absolute(SAMPLE_GIF_PATH).generic_string();
+    GifDecoder local;
+    REQUIRE(local.LoadFromUrl(fileUrl));
+    REQUIRE(local.GetFrameCount() == frameCount);
+
+    GifDecoder unsupported;
+    REQUIRE_FALSE(unsupported.LoadFromUrl("https://127.0.0.1/sample.gif"));
+}
+
+TEST_CASE("LoadFromUrl exposes frames before the download completes", "[GifDecoder][Url]")
+{
+    GifDecoder reference;
+    REQUIRE(reference.LoadFromFile(SAMPLE_GIF_PATH));
+    const uint32_t frameCount = reference.GetFrameCount();
+
+    // Every frame is sent, but the trailer byte is held back
+    LocalHttpServer server(ReadFileBytes(SAMPLE_GIF_PATH));
+    server.HoldLastByte();
+
+    GifDecoder decoder;
+    REQUIRE(decoder.LoadFromUrl(server.Url()));
+    REQUIRE(SameFirstFrameGeometry(decoder, reference));
+    REQUIRE(decoder.GetFramePixelsBGRA32Premultiplied(frameCount - 1) != nullptr);
+    REQUIRE(decoder.GetAvailableFrameCount() == frameCount);
+    REQUIRE_FALSE(decoder.IsLoadComplete());
+
+    server.Release();
+    REQUIRE(decoder.GetFrameCount() == frameCount);
+    REQUIRE(decoder.IsLoadComplete());
+}
+
+TEST_CASE("Concurrent LoadFromUrl calls for one URL share a download", "[GifDecoder][Url]")
+{
+    LocalHttpServer server(ReadFileBytes(SAMPLE_GIF_PATH));
+    server.HoldLastByte();
+
+    GifDecoder first;
+    GifDecoder second;
+    REQUIRE(first.LoadFromUrl(server.Url()));
+    REQUIRE(second.LoadFromUrl(server.Url()));
+
+    server.Release();
+    REQUIRE(first.GetFrameCount() > 0);
+    REQUIRE(second.GetFrameCount() == first.GetFrameCount());
+    REQUIRE(server.requests == 1);
+}
+
+TEST_CASE("HTTP cache revalidates stale responses and reuses fresh ones", "[GifDecoder][Url]")
+{
+    const std::filesystem::path cacheDirectory =
+        std::filesystem::temp_directory_path() / "gifbolt-url-loader-tests";
+    std::filesystem::remove_all(cacheDirectory);
+    GifDecoder::SetHttpCacheDirectory(cacheDirectory.string());
+
+    {
+        // no-cache: the second load sends If-None-Match and is answered with 304
+        LocalHttpServer server(ReadFileBytes(SAMPLE_GIF_PATH));
+        GifDecoder first;
+        REQUIRE(first.LoadFromUrl(server.Url()));
+        const uint32_t frameCount = first.GetFrameCount();
+        REQUIRE(WaitForCacheEntry(cacheDirectory));
+
+        GifDecoder second;
+        REQUIRE(second.LoadFromUrl(server.Url()));
+        REQUIRE(second.GetFrameCount() == frameCount);
+        REQUIRE(server.requests == 2);
+        REQUIRE(server.notModifiedResponses == 1);
+    }
+
+    std::filesystem::remove_all(cacheDirectory);
+
+    {
+        // max-age: the second load is served from disk without a request
+        LocalHttpServer server(ReadFileBytes(SAMPLE_GIF_PATH));
+        server.cacheControl = "max-age=60";
+        GifDecoder first;
+        REQUIRE(first.LoadFromUrl(server.Url()));
+        const uint32_t frameCount = first.GetFrameCount();
+        REQUIRE(WaitForCacheEntry(cacheDirectory));
+
+        GifDecoder second;
+        REQUIRE(second.LoadFromUrl(server.Url()));
+        REQUIRE(second.GetFrameCount() == frameCount);
+        REQUIRE(server.requests == 1);
+
+        // Each writer uses its own partial file and renames it into place
+        for (const auto& entry : std::filesystem::directory_iterator(cacheDirectory))
+        {
+            REQUIRE(entry.path().extension() != ".part");
+        }
+    }
+
+    GifDecoder::SetHttpCacheDirectory("");
+    std::filesystem::remove_all(cacheDirectory);
+}
+
+#endif  // _WIN32
+
+TEST_CASE("LoadFromUrl gives up on hosts that do not accept connections", "[GifDecoder][Url]")
+{
+    // A listener that never accepts, with its backlog filled so further SYNs go unanswered
+    const int listener = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    REQUIRE(bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0);
+    REQUIRE(listen(listener, 0) == 0);
+    socklen_t length = sizeof(address);
+    getsockname(listener, reinterpret_cast<sockaddr*>(&address), &length);
+
+    std::vector<int> queued;
+    for (int index = 0; index < 4; ++index)
+    {
+        const int client = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0);
+        connect(client, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+        queued.push_back(client);
+    }
+
+    GifDecoder::SetHttpConnectTimeoutMs(300);
+    const std::string url =
+        "http://127.0.0.1:" + std::to_string(ntohs(address.sin_port)) + "/sample.gif";
+    const auto started = std::chrono::steady_clock::now();
+    GifDecoder decoder;
+    REQUIRE_FALSE(decoder.LoadFromUrl(url));
+    REQUIRE(std::chrono::steady_clock::now() - started < std::chrono::seconds(5));
+    GifDecoder::SetHttpConnectTimeoutMs(0);
+
+    for (int client : queued)
+    {
+        close(client);
+    }
+    close(listener);
+}
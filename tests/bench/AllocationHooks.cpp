@@ -0,0 +1,119 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#include "AllocationHooks.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#if defined(__APPLE__)
+#include <malloc/malloc.h>
+#elif defined(_WIN32) || defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+namespace
+{
+std::atomic<bool> g_countAllocations{false};
+std::atomic<uint64_t> g_allocationCount{0};
+std::atomic<uint64_t> g_heapBytes{0};
+std::atomic<uint64_t> g_peakHeapBytes{0};
+
+/// \brief Gets the usable size of a block returned by malloc, or 0 where unknown.
+size_t GetBlockSize(void* memory)
+{
+#if defined(__APPLE__)
+    return malloc_size(memory);
+#elif defined(_WIN32)
+    return _msize(memory);
+#elif defined(__GLIBC__)
+    return malloc_usable_size(memory);
+#else
+    static_cast<void>(memory);
+    return 0;
+#endif
+}
+
+void RaisePeak(uint64_t bytes)
+{
+    uint64_t peak = g_peakHeapBytes.load(std::memory_order_relaxed);
+    while (bytes > peak &&
+           !g_peakHeapBytes.compare_exchange_weak(peak, bytes, std::memory_order_relaxed))
+    {
+    }
+}
+}  // namespace
+
+// Counts and sizes every heap allocation made by the process, on any thread
+void* operator new(std::size_t size)
+{
+    if (g_countAllocations.load(std::memory_order_relaxed))
+    {
+        g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (void* memory = std::malloc(size == 0 ? 1 : size))
+    {
+        const uint64_t blockSize = GetBlockSize(memory);
+        RaisePeak(g_heapBytes.fetch_add(blockSize, std::memory_order_relaxed) + blockSize);
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept
+{
+    if (memory != nullptr)
+    {
+        g_heapBytes.fetch_sub(GetBlockSize(memory), std::memory_order_relaxed);
+    }
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    operator delete(memory);
+}
+
+namespace GifBolt
+{
+namespace Bench
+{
+
+void SetAllocationCounting(bool enabled)
+{
+    g_countAllocations.store(enabled, std::memory_order_relaxed);
+}
+
+uint64_t GetAllocationCount(bool reset)
+{
+    return reset ? g_allocationCount.exchange(0, std::memory_order_relaxed)
+                 : g_allocationCount.load(std::memory_order_relaxed);
+}
+
+bool IsHeapTracked()
+{
+#if defined(__APPLE__) || defined(_WIN32) || defined(__GLIBC__)
+    return true;
+#else
+    return false;
+#endif
+}
+
+uint64_t GetHeapBytes()
+{
+    return g_heapBytes.load(std::memory_order_relaxed);
+}
+
+uint64_t GetPeakHeapBytes()
+{
+    return g_peakHeapBytes.load(std::memory_order_relaxed);
+}
+
+void ResetPeakHeapBytes()
+{
+    g_peakHeapBytes.store(GetHeapBytes(), std::memory_order_relaxed);
+}
+
+}  // namespace Bench
+}  // namespace GifBolt
@@ -0,0 +1,38 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#pragma once
+
+#include <cstdint>
+
+namespace GifBolt
+{
+namespace Bench
+{
+
+// AllocationHooks.cpp replaces the global operator new and delete of the executable it is
+// linked into. Memory allocated with malloc, such as giflib's rasters, is not seen.
+
+/// \brief Starts or stops counting heap allocations made on any thread.
+void SetAllocationCounting(bool enabled);
+
+/// \brief Gets the number of allocations counted, and restarts the count when reset is true.
+uint64_t GetAllocationCount(bool reset = false);
+
+/// \brief Gets whether the platform reports allocation sizes, without which the byte
+/// counts below stay 0.
+bool IsHeapTracked();
+
+/// \brief Gets the bytes currently allocated through operator new, as the allocator rounds
+/// them up.
+uint64_t GetHeapBytes();
+
+/// \brief Gets the most bytes allocated through operator new at once.
+/// \return Bytes since the process started or the last ResetPeakHeapBytes.
+uint64_t GetPeakHeapBytes();
+
+/// \brief Restarts peak heap tracking from the bytes allocated now.
+void ResetPeakHeapBytes();
+
+}  // namespace Bench
+}  // namespace GifBolt
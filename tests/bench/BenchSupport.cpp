@@ -0,0 +1,228 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#include "BenchSupport.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+namespace GifBolt
+{
+namespace Bench
+{
+
+namespace
+{
+#ifdef __linux__
+/// \brief Reads a "Name:   1234 kB" line of /proc/self/status.
+uint64_t ReadProcStatusBytes(const char* field)
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    const size_t fieldLength = std::strlen(field);
+    while (std::getline(status, line))
+    {
+        if (line.compare(0, fieldLength, field) == 0 && line.size() > fieldLength &&
+            line[fieldLength] == ':')
+        {
+            return std::strtoull(line.c_str() + fieldLength + 1, nullptr, 10) * 1024;
+        }
+    }
+    return 0;
+}
+#endif
+}  // namespace
+
+uint64_t GetProcessCpuTimeNs()
+{
+#ifdef _WIN32
+    FILETIME creation, exited, kernel, user;
+    if (!GetProcessTimes(GetCurrentProcess(), &creation, &exited, &kernel, &user))
+    {
+        return 0;
+    }
+    // FILETIME counts 100 ns intervals
+    const uint64_t kernel100Ns =
+        (static_cast<uint64_t>(kernel.dwHighDateTime) << 32) | kernel.dwLowDateTime;
+    const uint64_t user100Ns =
+        (static_cast<uint64_t>(user.dwHighDateTime) << 32) | user.dwLowDateTime;
+    return (kernel100Ns + user100Ns) * 100;
+#else
+    rusage usage = {};
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        return 0;
+    }
+    auto toNs = [](const timeval& time)
+    {
+        return static_cast<uint64_t>(time.tv_sec) * 1000000000ull +
+               static_cast<uint64_t>(time.tv_usec) * 1000ull;
+    };
+    return toNs(usage.ru_utime) + toNs(usage.ru_stime);
+#endif
+}
+
+uint64_t GetResidentBytes()
+{
+#if defined(__linux__)
+    return ReadProcStatusBytes("VmRSS");
+#elif defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters = {};
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    {
+        return 0;
+    }
+    return counters.WorkingSetSize;
+#else
+    return 0;
+#endif
+}
+
+uint64_t GetPeakResidentBytes()
+{
+#if defined(__linux__)
+    return ReadProcStatusBytes("VmHWM");
+#elif defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters = {};
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    {
+        return 0;
+    }
+    return counters.PeakWorkingSetSize;
+#else
+    rusage usage = {};
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        return 0;
+    }
+#ifdef __APPLE__
+    return static_cast<uint64_t>(usage.ru_maxrss);  // bytes on macOS
+#else
+    return static_cast<uint64_t>(usage.ru_maxrss) * 1024;  // kilobytes elsewhere
+#endif
+#endif
+}
+
+bool ResetPeakResidentBytes()
+{
+#ifdef __linux__
+    // Writing 5 to clear_refs resets VmHWM to the current RSS (Linux 4.0+)
+    std::FILE* file = std::fopen("/proc/self/clear_refs", "w");
+    if (file == nullptr)
+    {
+        return false;
+    }
+    const bool written = std::fputs("5", file) >= 0;
+    return std::fclose(file) == 0 && written;
+#else
+    return false;
+#endif
+}
+
+uint32_t GetThreadCount()
+{
+#if defined(__linux__)
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line))
+    {
+        if (line.compare(0, 8, "Threads:") == 0)
+        {
+            return static_cast<uint32_t>(std::strtoul(line.c_str() + 8, nullptr, 10));
+        }
+    }
+    return 0;
+#else
+    return 0;
+#endif
+}
+
+bool EvictFromPageCache(const std::string& path)
+{
+#ifdef __linux__
+    const int handle = open(path.c_str(), O_RDONLY);
+    if (handle == -1)
+    {
+        return false;
+    }
+    const bool evicted = posix_fadvise(handle, 0, 0, POSIX_FADV_DONTNEED) == 0;
+    close(handle);
+    return evicted;
+#else
+    static_cast<void>(path);
+    return false;
+#endif
+}
+
+LatencySummary Summarize(std::vector<double>& samplesMs)
+{
+    LatencySummary summary;
+    if (samplesMs.empty())
+    {
+        return summary;
+    }
+
+    std::sort(samplesMs.begin(), samplesMs.end());
+    auto percentile = [&samplesMs](double fraction)
+    {
+        const size_t rank = static_cast<size_t>(std::ceil(fraction * samplesMs.size()));
+        return samplesMs[std::min(samplesMs.size(), std::max<size_t>(rank, 1)) - 1];
+    };
+    summary.p50 = percentile(0.50);
+    summary.p90 = percentile(0.90);
+    summary.p99 = percentile(0.99);
+    summary.max = samplesMs.back();
+    return summary;
+}
+
+std::string JsonEscape(const std::string& text)
+{
+    std::string escaped;
+    escaped.reserve(text.size());
+    for (const char c : text)
+    {
+        switch (c)
+        {
+            case '"':
+                escaped += "\\\"";
+                break;
+            case '\\':
+                escaped += "\\\\";
+                break;
+            case '\n':
+                escaped += "\\n";
+                break;
+            case '\t':
+                escaped += "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    char code[8];
+                    std::snprintf(code, sizeof(code), "\\u%04x", c);
+                    escaped += code;
+                }
+                else
+                {
+                    escaped += c;
+                }
+        }
+    }
+    return escaped;
+}
+
+}  // namespace Bench
+}  // namespace GifBolt
@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace GifBolt
+{
+namespace Bench
+{
+
+/// \brief Gets the CPU time (user + system) of every thread of the process.
+/// \return Nanoseconds since the process started.
+uint64_t GetProcessCpuTimeNs();
+
+/// \brief Gets the resident set size of the process.
+/// \return Bytes, or 0 where the platform does not report it.
+uint64_t GetResidentBytes();
+
+/// \brief Gets the peak resident set size of the process.
+/// \return Bytes since the process started or the last successful ResetPeakResidentBytes.
+uint64_t GetPeakResidentBytes();
+
+/// \brief Restarts peak resident set tracking from the current resident set.
+/// \return false where the platform cannot reset it (only Linux can), in which case
+///         GetPeakResidentBytes keeps reporting the process-lifetime peak.
+bool ResetPeakResidentBytes();
+
+/// \brief Gets the number of threads in the process.
+/// \return The thread count, or 0 where the platform does not report it.
+uint32_t GetThreadCount();
+
+/// \brief Drops a file's cached pages so that its next read comes from the disk.
+/// \return false where the platform cannot (only Linux can), or the file cannot be opened.
+/// \remarks Only clean pages are dropped, which is every page of a file that was not just
+///          written; flush recently written files first.
+bool EvictFromPageCache(const std::string& path);
+
+/// \struct LatencySummary
+/// \brief Percentiles of a set of latency samples, in milliseconds.
+struct LatencySummary
+{
+    double p50 = 0.0;
+    double p90 = 0.0;
+    double p99 = 0.0;
+    double max = 0.0;
+};
+
+/// \brief Computes nearest-rank percentiles.
+/// \param samplesMs Latencies in milliseconds; sorted in place.
+LatencySummary Summarize(std::vector<double>& samplesMs);
+
+/// \brief Escapes a string for inclusion in JSON output (without the quotes).
+std::string JsonEscape(const std::string& text);
+
+}  // namespace Bench
+}  // namespace GifBolt
@@ -0,0 +1,517 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#include "CallReplay.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <thread>
+#include <unordered_map>
+
+#include "gifbolt_c.h"
+
+namespace GifBolt
+{
+namespace Bench
+{
+
+using CallRecorder::CallId;
+using CallRecorder::RecordedCall;
+
+namespace
+{
+constexpr size_t MAX_PROBLEMS = 20;  ///< Problems kept in the report; the rest are counted
+
+/// \brief Whether a function returns the same result for the same inputs, so that a different
+/// result means the replay diverged. Timing-dependent results (bytes trimmed, frames loaded so
+/// far) are not compared.
+bool HasDeterministicResult(CallId id)
+{
+    switch (id)
+    {
+        case CallId::LoadFromPath:
+        case CallId::LoadFromMemory:
+        case CallId::GetFrameCount:
+        case CallId::GetWidth:
+        case CallId::GetHeight:
+        case CallId::GetLoopCount:
+        case CallId::GetFrameDelayMs:
+        case CallId::GetInfo:
+        case CallId::GetFrameAlpha:
+        case CallId::GetFramePixelsRGBA32:
+        case CallId::GetFramePixelsBGRA32:
+        case CallId::GetFramePixelsBGRA32Scaled:
+        case CallId::CopyFramePixelsBGRA32:
+        case CallId::CopyFramePixelsBGRA32Scaled:
+        case CallId::GetBackgroundColor:
+        case CallId::RendererInitialize:
+        case CallId::RendererLoadGif:
+        case CallId::RendererLoadGifFromMemory:
+            return true;
+        default:
+            return false;
+    }
+}
+
+std::vector<uint8_t> ReadFile(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(file),
+                                std::istreambuf_iterator<char>());
+}
+
+/// \brief Finds what a recording loads, in the recording itself or in the asset directory.
+class InputResolver
+{
+   public:
+    InputResolver(const CallRecorder::Recording& recording, const std::string& assetDirectory)
+        : _recording(recording), _assetDirectory(assetDirectory)
+    {
+    }
+
+    /// \return The buffer, or nullptr if it was neither embedded nor found by hash.
+    const std::vector<uint8_t>* FindBuffer(uint64_t hash)
+    {
+        const auto embedded = this->_recording.buffers.find(hash);
+        if (embedded != this->_recording.buffers.end())
+        {
+            return &embedded->second;
+        }
+        this->IndexAssets();
+        const auto asset = this->_assetsByHash.find(hash);
+        if (asset == this->_assetsByHash.end())
+        {
+            return nullptr;
+        }
+        if (asset->second.data.empty())
+        {
+            asset->second.data = ReadFile(asset->second.path);
+        }
+        return &asset->second.data;
+    }
+
+    /// \return The recorded path if it exists, else the asset with the same file name, else
+    ///         an empty string.
+    std::string FindPath(const std::string& recordedPath) const
+    {
+        std::error_code error;
+        if (std::filesystem::exists(recordedPath, error))
+        {
+            return recordedPath;
+        }
+        if (this->_assetDirectory.empty())
+        {
+            return std::string();
+        }
+        const std::filesystem::path name = std::filesystem::path(recordedPath).filename();
+        for (const auto& entry :
+             std::filesystem::recursive_directory_iterator(this->_assetDirectory, error))
+        {
+            if (entry.is_regular_file(error) && entry.path().filename() == name)
+            {
+                return entry.path().string();
+            }
+        }
+        return std::string();
+    }
+
+   private:
+    struct Asset
+    {
+        std::filesystem::path path;
+        std::vector<uint8_t> data;  ///< Read again on first use
+    };
+
+    void IndexAssets()
+    {
+        if (this->_indexed || this->_assetDirectory.empty())
+        {
+            return;
+        }
+        this->_indexed = true;
+        std::error_code error;
+        for (const auto& entry :
+             std::filesystem::recursive_directory_iterator(this->_assetDirectory, error))
+        {
+            if (entry.is_regular_file(error))
+            {
+                const std::vector<uint8_t> data = ReadFile(entry.path());
+                const uint64_t hash = CallRecorder::HashContent(data.data(), data.size());
+                this->_assetsByHash.emplace(hash, Asset{entry.path(), {}});
+            }
+        }
+    }
+
+    const CallRecorder::Recording& _recording;
+    std::string _assetDirectory;
+    bool _indexed = false;
+    std::unordered_map<uint64_t, Asset> _assetsByHash;
+};
+
+/// \brief Issues one call.
+/// \param handles Recording handle id -> live decoder or renderer; updated by create and
+///                destroy calls.
+/// \param problem Set when the call cannot be issued.
+/// \return The result, encoded as CallRecorder::ScopedCall records it.
+int64_t Issue(const RecordedCall& call, std::unordered_map<uint32_t, void*>& handles,
+              InputResolver& inputs, std::string& problem)
+{
+    void* handle = nullptr;
+    if (call.handle != CallRecorder::NO_HANDLE && call.id != CallId::DecoderCreate &&
+        call.id != CallId::RendererCreate)
+    {
+        const auto it = handles.find(call.handle);
+        if (it == handles.end())
+        {
+            problem = "handle " + std::to_string(call.handle) +
+                      " was created before the recording started";
+            return 0;
+        }
+        handle = it->second;
+    }
+    const auto arg = [&call](uint32_t index) { return static_cast<int>(call.args[index]); };
+
+    int64_t result = 0;
+    int byteCount = 0;
+    static std::vector<uint8_t> destination;  // Stands in for the host's bitmaps; kept warm
+    switch (call.id)
+    {
+        case CallId::DecoderCreate:
+            handle = gb_decoder_create();
+            handles[call.handle] = handle;
+            return handle != nullptr ? 1 : 0;
+        case CallId::DecoderDestroy:
+            gb_decoder_destroy(handle);
+            handles.erase(call.handle);
+            break;
+        case CallId::LoadFromPath:
+        {
+            const std::string path = inputs.FindPath(call.text);
+            if (path.empty())
+            {
+                problem = "file not found: " + call.text;
+                return 0;
+            }
+            result = gb_decoder_load_from_path(handle, path.c_str());
+            break;
+        }
+        case CallId::LoadFromMemory:
+        {
+            const std::vector<uint8_t>* buffer = inputs.FindBuffer(call.contentHash);
+            if (buffer == nullptr)
+            {
+                problem = "buffer not embedded and not in the asset directory";
+                return 0;
+            }
+            result = gb_decoder_load_from_memory(handle, buffer->data(),
+                                                 static_cast<int>(buffer->size()));
+            break;
+        }
+        case CallId::LoadFromUrl:
+            result = gb_decoder_load_from_url(handle, call.text.c_str());
+            break;
+        case CallId::SetMinFrameDelayMs:
+            gb_decoder_set_min_frame_delay_ms(handle, arg(0));
+            break;
+        case CallId::SetMaxCachedFrames:
+            gb_decoder_set_max_cached_frames(handle, static_cast<unsigned int>(call.args[0]));
+            break;
+        case CallId::SetMipmapsEnabled:
+            gb_decoder_set_mipmaps_enabled(handle, arg(0));
+            break;
+        case CallId::TrimMemory:
+            result = gb_decoder_trim_memory(handle, arg(0));
+            break;
+        case CallId::TrimAllMemory:
+            result = gb_trim_memory(arg(0));
+            break;
+        case CallId::SetHttpCacheDirectory:
+            gb_set_http_cache_directory(call.text.c_str());
+            break;
+        case CallId::GetAvailableFrameCount:
+            result = gb_decoder_get_available_frame_count(handle);
+            break;
+        case CallId::IsLoadComplete:
+            result = gb_decoder_is_load_complete(handle);
+            break;
+        case CallId::GetFrameCount:
+            result = gb_decoder_get_frame_count(handle);
+            break;
+        case CallId::GetWidth:
+            result = gb_decoder_get_width(handle);
+            break;
+        case CallId::GetHeight:
+            result = gb_decoder_get_height(handle);
+            break;
+        case CallId::GetLoopCount:
+            result = gb_decoder_get_loop_count(handle);
+            break;
+        case CallId::GetFrameDelayMs:
+            result = gb_decoder_get_frame_delay_ms(handle, arg(0));
+            break;
+        case CallId::GetFrameAlpha:
+            result = gb_decoder_get_frame_alpha(handle, arg(0));
+            break;
+        case CallId::CreatePreview:
+        {
+            // Replays the decoder work; the proxy itself is not used by later calls
+            gb_preview_t preview = gb_preview_create(handle, arg(0), arg(1), arg(2));
+            result = preview != nullptr ? 1 : 0;
+            gb_preview_destroy(preview);
+            break;
+        }
+        case CallId::GetInfo:
+        {
+            gb_decoder_info_t info;
+            result = gb_decoder_get_info(handle, &info);
+            break;
+        }
+        case CallId::GetFramePixelsRGBA32:
+            result = gb_decoder_get_frame_pixels_rgba32(handle, arg(0), &byteCount) != nullptr;
+            break;
+        case CallId::GetFramePixelsBGRA32:
+            result = gb_decoder_get_frame_pixels_bgra32_premultiplied(handle, arg(0),
+                                                                      &byteCount) != nullptr;
+            break;
+        case CallId::GetFramePixelsBGRA32Scaled:
+        {
+            int width = 0;
+            int height = 0;
+            result = gb_decoder_get_frame_pixels_bgra32_premultiplied_scaled(
+                         handle, arg(0), arg(1), arg(2), &width, &height, &byteCount,
+                         arg(3)) != nullptr;
+            break;
+        }
+        case CallId::CopyFramePixelsBGRA32:
+        {
+            const int rows = gb_decoder_get_height(handle);
+            destination.resize(static_cast<size_t>(std::max(0, arg(1) * rows)));
+            result = gb_decoder_copy_frame_pixels_bgra32_premultiplied(
+                handle, arg(0), destination.data(), arg(1), static_cast<int>(destination.size()));
+            break;
+        }
+        case CallId::CopyFramePixelsBGRA32Scaled:
+            destination.resize(static_cast<size_t>(std::max(0, arg(1) * arg(2) * 4)));
+            result = gb_decoder_copy_frame_pixels_bgra32_premultiplied_scaled(
+                handle, arg(0), arg(1), arg(2), arg(3), destination.data(), arg(1) * 4,
+                static_cast<int>(destination.size()));
+            break;
+        case CallId::GetBackgroundColor:
+            result = gb_decoder_get_background_color(handle);
+            break;
+        case CallId::StartPrefetching:
+            gb_decoder_start_prefetching(handle, arg(0));
+            break;
+        case CallId::StopPrefetching:
+            gb_decoder_stop_prefetching(handle);
+            break;
+        case CallId::SetCurrentFrame:
+            gb_decoder_set_current_frame(handle, arg(0));
+            break;
+        case CallId::ResetCanvas:
+            gb_decoder_reset_canvas(handle);
+            break;
+        case CallId::RecordFramePresented:
+            gb_decoder_record_frame_presented(handle, arg(0), call.args[1], arg(2));
+            break;
+        case CallId::PresentFrame:
+        {
+            gb_frame_status_t status;
+            result = gb_decoder_present_frame(handle, arg(0), call.args[1], arg(2), &status);
+            break;
+        }
+        case CallId::RendererCreate:
+            handle = GifBolt_Create();
+            handles[call.handle] = handle;
+            return handle != nullptr ? 1 : 0;
+        case CallId::RendererDestroy:
+            GifBolt_Destroy(handle);
+            handles.erase(call.handle);
+            break;
+        case CallId::RendererInitialize:
+            result = GifBolt_Initialize(handle, static_cast<unsigned int>(call.args[0]),
+                                        static_cast<unsigned int>(call.args[1]));
+            break;
+        case CallId::RendererLoadGif:
+        {
+            const std::string path = inputs.FindPath(call.text);
+            if (path.empty())
+            {
+                problem = "file not found: " + call.text;
+                return 0;
+            }
+            result = GifBolt_LoadGif(handle, path.c_str());
+            break;
+        }
+        case CallId::RendererLoadGifFromMemory:
+        {
+            const std::vector<uint8_t>* buffer = inputs.FindBuffer(call.contentHash);
+            if (buffer == nullptr)
+            {
+                problem = "buffer not embedded and not in the asset directory";
+                return 0;
+            }
+            result = GifBolt_LoadGifFromMemory(handle, buffer->data(),
+                                               static_cast<int>(buffer->size()));
+            break;
+        }
+        case CallId::RendererPlay:
+            GifBolt_Play(handle);
+            break;
+        case CallId::RendererPause:
+            GifBolt_Pause(handle);
+            break;
+        case CallId::RendererStop:
+            GifBolt_Stop(handle);
+            break;
+        case CallId::RendererSetLooping:
+            GifBolt_SetLooping(handle, arg(0));
+            break;
+        case CallId::RendererRender:
+            result = GifBolt_Render(handle);
+            break;
+        default:
+            problem = "unknown call id " + std::to_string(static_cast<int>(call.id));
+            break;
+    }
+    return result;
+}
+
+void AppendSummary(std::string& json, const char* name, const LatencySummary& summary)
+{
+    char buffer[160];
+    std::snprintf(buffer, sizeof(buffer),
+                  ",\"%s\":{\"p50\":%.4f,\"p90\":%.4f,\"p99\":%.4f,\"max\":%.4f}", name,
+                  summary.p50, summary.p90, summary.p99, summary.max);
+    json += buffer;
+}
+}  // namespace
+
+ReplayReport ReplayCalls(const CallRecorder::Recording& recording, const ReplayOptions& options)
+{
+    using Clock = std::chrono::steady_clock;
+    ReplayReport report;
+    InputResolver inputs(recording, options.assetDirectory);
+    std::unordered_map<uint32_t, void*> handles;
+    std::map<std::string, std::pair<std::vector<double>, std::vector<double>>> samples;
+    const auto addProblem = [&report](const RecordedCall& call, const std::string& text)
+    {
+        if (report.problems.size() < MAX_PROBLEMS)
+        {
+            report.problems.push_back(std::string(CallRecorder::GetCallName(call.id)) + ": " +
+                                      text);
+        }
+    };
+
+    const uint64_t firstNs = recording.calls.empty() ? 0 : recording.calls.front().startNs;
+    const Clock::time_point begin = Clock::now();
+    for (const RecordedCall& call : recording.calls)
+    {
+        report.recordedWallMs = std::max(
+            report.recordedWallMs, (call.startNs + call.durationNs - firstNs) / 1000000.0);
+        if (options.pacing == ReplayPacing::Recorded)
+        {
+            std::this_thread::sleep_until(begin +
+                                          std::chrono::nanoseconds(call.startNs - firstNs));
+        }
+
+        std::string problem;
+        const Clock::time_point start = Clock::now();
+        const int64_t result = Issue(call, handles, inputs, problem);
+        const double replayedMs =
+            std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        if (!problem.empty())
+        {
+            ++report.callsSkipped;
+            addProblem(call, problem);
+            continue;
+        }
+
+        ++report.callsReplayed;
+        if (HasDeterministicResult(call.id) && result != call.result)
+        {
+            ++report.resultMismatches;
+            addProblem(call, "returned " + std::to_string(result) + ", recorded " +
+                                 std::to_string(call.result));
+        }
+        auto& callSamples = samples[CallRecorder::GetCallName(call.id)];
+        callSamples.first.push_back(call.durationNs / 1000000.0);
+        callSamples.second.push_back(replayedMs);
+    }
+    report.replayedWallMs = std::chrono::duration<double, std::milli>(Clock::now() - begin).count();
+
+    for (auto& entry : samples)
+    {
+        CallLatency latency;
+        latency.name = entry.first;
+        latency.calls = entry.second.first.size();
+        for (size_t i = 0; i < latency.calls; ++i)
+        {
+            latency.recordedTotalMs += entry.second.first[i];
+            latency.replayedTotalMs += entry.second.second[i];
+        }
+        latency.recordedMs = Summarize(entry.second.first);
+        latency.replayedMs = Summarize(entry.second.second);
+        report.calls.push_back(std::move(latency));
+    }
+
+    // Objects the host had not destroyed when the recording stopped
+    for (const RecordedCall& call : recording.calls)
+    {
+        const auto it = handles.find(call.handle);
+        if (it == handles.end())
+        {
+            continue;
+        }
+        if (call.id == CallId::DecoderCreate)
+        {
+            gb_decoder_destroy(it->second);
+            handles.erase(it);
+        }
+        else if (call.id == CallId::RendererCreate)
+        {
+            GifBolt_Destroy(it->second);
+            handles.erase(it);
+        }
+    }
+    return report;
+}
+
+std::string ReplayReportJson(const ReplayReport& report)
+{
+    char buffer[256];
+    std::snprintf(buffer, sizeof(buffer),
+                  "{\"callsReplayed\":%zu,\"callsSkipped\":%zu,\"resultMismatches\":%zu,"
+                  "\"recordedWallMs\":%.3f,\"replayedWallMs\":%.3f,\"calls\":[",
+                  report.callsReplayed, report.callsSkipped, report.resultMismatches,
+                  report.recordedWallMs, report.replayedWallMs);
+    std::string json = buffer;
+    for (size_t i = 0; i < report.calls.size(); ++i)
+    {
+        const CallLatency& latency = report.calls[i];
+        std::snprintf(buffer, sizeof(buffer),
+                      "%s\n  {\"name\":\"%s\",\"calls\":%zu,\"recordedTotalMs\":%.4f,"
+                      "\"replayedTotalMs\":%.4f",
+                      i == 0 ? "" : ",", latency.name.c_str(), latency.calls,
+                      latency.recordedTotalMs, latency.replayedTotalMs);
+        json += buffer;
+        AppendSummary(json, "recordedMs", latency.recordedMs);
+        AppendSummary(json, "replayedMs", latency.replayedMs);
+        json += "}";
+    }
+    json += "],\"problems\":[";
+    for (size_t i = 0; i < report.problems.size(); ++i)
+    {
+        json += (i == 0 ? "\"" : ",\"") + JsonEscape(report.problems[i]) + "\"";
+    }
+    json += "]}\n";
+    return json;
+}
+
+}  // namespace Bench
+}  // namespace GifBolt
@@ -0,0 +1,70 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "BenchSupport.h"
+#include "CallRecorder.h"
+
+namespace GifBolt
+{
+namespace Bench
+{
+
+/// \brief When replayed calls are issued.
+enum class ReplayPacing
+{
+    Recorded,         ///< Each call at its recorded offset from the start, as the host made it
+    AsFastAsPossible  ///< Back to back, to measure the library alone
+};
+
+/// \struct ReplayOptions
+/// \brief How to replay a recording.
+struct ReplayOptions
+{
+    ReplayPacing pacing = ReplayPacing::Recorded;
+    /// Directory searched, recursively, for files a recording loads but that are missing:
+    /// by file name for path loads, by content hash for memory loads that were not embedded
+    std::string assetDirectory;
+};
+
+/// \struct CallLatency
+/// \brief Latency of one C ABI function, as recorded and as replayed.
+struct CallLatency
+{
+    std::string name;
+    size_t calls = 0;
+    LatencySummary recordedMs;
+    LatencySummary replayedMs;
+    double recordedTotalMs = 0.0;
+    double replayedTotalMs = 0.0;
+};
+
+/// \struct ReplayReport
+/// \brief Outcome of a replay.
+struct ReplayReport
+{
+    size_t callsReplayed = 0;
+    size_t callsSkipped = 0;            ///< Calls whose handle or input could not be resolved
+    size_t resultMismatches = 0;        ///< Deterministic calls that returned something else
+    double recordedWallMs = 0.0;        ///< From the first recorded call to the end of the last
+    double replayedWallMs = 0.0;
+    std::vector<CallLatency> calls;     ///< One entry per function called, by name
+    std::vector<std::string> problems;  ///< The first skips and mismatches, for display
+};
+
+/// \brief Re-issues the calls of a recording through the C ABI and times each one.
+/// \details Calls are issued on the calling thread in recorded start order; calls the host
+///          made from several threads are serialized. Decoders and renderers left alive by
+///          the recording are destroyed at the end, untimed.
+ReplayReport ReplayCalls(const CallRecorder::Recording& recording, const ReplayOptions& options);
+
+/// \brief Formats a report as a JSON object, latencies in milliseconds.
+std::string ReplayReportJson(const ReplayReport& report);
+
+}  // namespace Bench
+}  // namespace GifBolt
@@ -0,0 +1,348 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#include "FeedSimulation.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <thread>
+
+#include "GifDecoder.h"
+
+namespace GifBolt
+{
+namespace Bench
+{
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+/// \brief A feed entry, laid out top to bottom.
+struct Item
+{
+    uint32_t gif;     ///< Index into the GIF list
+    double top;       ///< Offset from the top of the feed, in pixels
+    uint32_t width;   ///< Display size, in pixels
+    uint32_t height;
+};
+
+/// \brief An item in the preload range, with its decoder and playback state.
+struct LiveItem
+{
+    std::unique_ptr<GifDecoder> decoder;
+    uint32_t frame = 0;     ///< Next frame to show
+    double nextDueMs = 0;   ///< Virtual time the next frame is due
+    bool playing = false;   ///< Visible, and prefetching
+    bool starved = false;   ///< The due frame has not arrived yet (its miss was counted)
+};
+
+/// \brief Generates scroll velocity as a sequence of gestures: flings that decay, slow drags
+/// and pauses while the user reads.
+class ScrollGestures
+{
+   public:
+    explicit ScrollGestures(uint32_t seed) : _state(seed)
+    {
+    }
+
+    /// \brief Advances by dt seconds and returns the velocity in pixels per second.
+    double Advance(double dt)
+    {
+        if (this->_remaining <= 0.0)
+        {
+            this->Begin();
+        }
+        this->_remaining -= dt;
+        this->_elapsed += dt;
+        if (this->_kind == Fling)
+        {
+            // Exponential decay with a 0.6 s time constant, as in platform fling physics
+            return this->_velocity * std::exp(-this->_elapsed / 0.6);
+        }
+        return this->_velocity;
+    }
+
+   private:
+    enum Kind
+    {
+        Fling,
+        Drag,
+        Pause
+    };
+
+    /// \brief Draws a value in [low, high).
+    double Uniform(double low, double high)
+    {
+        // SplitMix64 step, as in the corpus generator, so runs match across platforms
+        uint64_t z = (this->_state += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        z ^= z >> 31;
+        return low + (high - low) * static_cast<double>(z >> 11) / 9007199254740992.0;
+    }
+
+    void Begin()
+    {
+        const double draw = this->Uniform(0.0, 1.0);
+        this->_elapsed = 0.0;
+        if (draw < 0.45)
+        {
+            this->_kind = Fling;
+            this->_velocity = this->Uniform(1500.0, 5000.0);
+            this->_remaining = 1.5;
+        }
+        else if (draw < 0.75)
+        {
+            this->_kind = Drag;
+            this->_velocity = this->Uniform(150.0, 700.0);
+            this->_remaining = this->Uniform(0.5, 2.0);
+        }
+        else
+        {
+            this->_kind = Pause;
+            this->_velocity = 0.0;
+            this->_remaining = this->Uniform(0.8, 3.0);
+        }
+        // One gesture in eight scrolls back up
+        if (this->Uniform(0.0, 1.0) < 0.125)
+        {
+            this->_velocity = -this->_velocity;
+        }
+    }
+
+    uint64_t _state;
+    Kind _kind = Pause;
+    double _velocity = 0.0;
+    double _remaining = 0.0;
+    double _elapsed = 0.0;
+};
+
+/// \brief Reads the logical screen size from a GIF header without decoding anything.
+void GetGifSize(const std::vector<uint8_t>& gif, uint32_t& width, uint32_t& height)
+{
+    width = 1;
+    height = 1;
+    if (gif.size() >= 10)
+    {
+        width = std::max(1, gif[6] | (gif[7] << 8));
+        height = std::max(1, gif[8] | (gif[9] << 8));
+    }
+}
+}  // namespace
+
+FeedResult SimulateFeed(const std::vector<std::vector<uint8_t>>& gifs, const FeedConfig& config)
+{
+    FeedResult result;
+    if (gifs.empty() || config.feedLength == 0)
+    {
+        return result;
+    }
+
+    // Lay the feed out as a single column, each GIF scaled to the column width
+    std::vector<Item> items;
+    items.reserve(config.feedLength);
+    double feedHeight = 0.0;
+    for (uint32_t i = 0; i < config.feedLength; ++i)
+    {
+        const uint32_t gif = i % static_cast<uint32_t>(gifs.size());
+        uint32_t width = 0, height = 0;
+        GetGifSize(gifs[gif], width, height);
+        const uint32_t displayHeight = std::clamp<uint32_t>(
+            static_cast<uint32_t>(static_cast<uint64_t>(config.columnWidth) * height / width),
+            64, config.columnWidth * 2);
+        items.push_back({gif, feedHeight, config.columnWidth, displayHeight});
+        feedHeight += displayHeight;
+    }
+    const double maxScroll = std::max(0.0, feedHeight - config.viewportHeight);
+
+    const double tickMs = 1000.0 / config.refreshHz;
+    const uint64_t tickCount = static_cast<uint64_t>(config.durationSeconds * config.refreshHz);
+    const double preload = static_cast<double>(config.preloadScreens) * config.viewportHeight;
+
+    ScrollGestures gestures(config.seed);
+    std::map<uint32_t, LiveItem> live;
+    std::vector<double> tickSamples, frameSamples, teardownSamples;
+    tickSamples.reserve(tickCount);
+    double scroll = 0.0;
+    uint64_t threadSum = 0;
+
+    ResetPeakResidentBytes();
+    const uint64_t cpuStart = GetProcessCpuTimeNs();
+    Clock::time_point nextTick = Clock::now();
+
+    for (uint64_t tick = 0; tick < tickCount; ++tick)
+    {
+        const double now = static_cast<double>(tick) * tickMs;  // Virtual time
+        const Clock::time_point tickStart = Clock::now();
+
+        scroll = std::clamp(scroll + gestures.Advance(tickMs / 1000.0) * tickMs / 1000.0, 0.0,
+                            maxScroll);
+        const double rangeTop = scroll - preload;
+        const double rangeBottom = scroll + config.viewportHeight + preload;
+
+        // Destroy decoders that scrolled out of the preload range
+        for (auto it = live.begin(); it != live.end();)
+        {
+            const Item& item = items[it->first];
+            if (item.top + item.height < rangeTop || item.top > rangeBottom)
+            {
+                const Clock::time_point start = Clock::now();
+                it->second.decoder.reset();
+                teardownSamples.push_back(ElapsedMs(start));
+                it = live.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        // Create decoders for items that entered it, then start and stop playback as items
+        // become visible or hidden
+        auto first = std::upper_bound(items.begin(), items.end(), rangeTop,
+                                      [](double top, const Item& item)
+                                      { return top < item.top + item.height; });
+        uint32_t playing = 0;
+        uint64_t presented = 0, missed = 0;
+        for (auto it = first; it != items.end() && it->top <= rangeBottom; ++it)
+        {
+            const uint32_t index = static_cast<uint32_t>(it - items.begin());
+            LiveItem& state = live[index];
+            if (!state.decoder)
+            {
+                state.decoder = std::make_unique<GifDecoder>();
+                const std::vector<uint8_t>& bytes = gifs[it->gif];
+                state.decoder->LoadFromMemory(bytes.data(), bytes.size());
+                ++result.decodersCreated;
+            }
+
+            const bool visible =
+                it->top + it->height > scroll && it->top < scroll + config.viewportHeight;
+            if (visible && !state.playing)
+            {
+                state.decoder->StartPrefetching(state.frame);
+                state.playing = true;
+                state.nextDueMs = now;
+            }
+            else if (!visible && state.playing)
+            {
+                state.decoder->StopPrefetching();
+                state.playing = false;
+            }
+            if (!state.playing)
+            {
+                continue;
+            }
+            ++playing;
+
+            if (now < state.nextDueMs)
+            {
+                continue;
+            }
+            // A player shows only frames that have arrived; one still loading misses
+            GifDecoder& decoder = *state.decoder;
+            const bool complete = decoder.IsLoadComplete();
+            const uint32_t available = decoder.GetAvailableFrameCount();
+            if (state.frame >= available)
+            {
+                if (!complete && !state.starved)
+                {
+                    ++missed;
+                    state.starved = true;
+                }
+                else if (available > 0)
+                {
+                    state.frame = 0;
+                }
+                continue;
+            }
+
+            const Clock::time_point frameStart = Clock::now();
+            uint32_t outWidth = 0, outHeight = 0;
+            decoder.SetCurrentFrame(state.frame);
+            const uint8_t* pixels = decoder.GetFramePixelsBGRA32PremultipliedScaled(
+                state.frame, it->width, it->height, outWidth, outHeight);
+            frameSamples.push_back(ElapsedMs(frameStart));
+            if (pixels == nullptr)
+            {
+                ++missed;
+                continue;
+            }
+            ++presented;
+            state.starved = false;
+
+            // Late frames are dropped rather than played fast to catch up
+            const double delayMs = std::max<double>(decoder.GetFrame(state.frame).delayMs, tickMs);
+            state.nextDueMs = std::max(state.nextDueMs + delayMs, now + tickMs / 2);
+            state.frame = state.frame + 1 < available || !complete ? state.frame + 1 : 0;
+        }
+
+        const double workMs = ElapsedMs(tickStart);
+        tickSamples.push_back(workMs);
+        if (workMs > tickMs)
+        {
+            ++result.jankyTicks;
+            missed += presented;
+            presented = 0;
+        }
+        result.framesPresented += presented;
+        result.framesMissed += missed;
+        result.peakLiveDecoders = std::max(result.peakLiveDecoders,
+                                           static_cast<uint32_t>(live.size()));
+        result.peakPlaying = std::max(result.peakPlaying, playing);
+
+        // Sampling happens outside the timed work; decoder bytes twice per virtual second
+        const uint32_t threads = GetThreadCount();
+        result.peakThreads = std::max(result.peakThreads, threads);
+        threadSum += threads;
+        if (tick % static_cast<uint64_t>(std::max(1.0, config.refreshHz / 2)) == 0)
+        {
+            const DecoderStats stats = GifDecoder::GetProcessStats();
+            result.peakDecoderBytes =
+                std::max(result.peakDecoderBytes, stats.rasterBytes + stats.canvasBytes +
+                                                      stats.cacheBytes + stats.poolBytes);
+        }
+
+        if (config.paced)
+        {
+            // Wait for the next refresh; after an overrun, realign instead of bursting
+            nextTick += std::chrono::duration_cast<Clock::duration>(
+                std::chrono::duration<double, std::milli>(tickMs));
+            if (nextTick < Clock::now())
+            {
+                nextTick = Clock::now();
+            }
+            std::this_thread::sleep_until(nextTick);
+        }
+    }
+
+    for (auto& entry : live)
+    {
+        const Clock::time_point start = Clock::now();
+        entry.second.decoder.reset();
+        teardownSamples.push_back(ElapsedMs(start));
+    }
+
+    result.ticks = tickCount;
+    result.meanThreads = tickCount > 0 ? static_cast<double>(threadSum) / tickCount : 0.0;
+    result.peakRssBytes = GetPeakResidentBytes();
+    result.cpuMsPerSecond = config.durationSeconds > 0.0
+                                ? (GetProcessCpuTimeNs() - cpuStart) / 1e6 / config.durationSeconds
+                                : 0.0;
+    result.tickMs = Summarize(tickSamples);
+    result.frameMs = Summarize(frameSamples);
+    result.teardownMs = Summarize(teardownSamples);
+    return result;
+}
+
+}  // namespace Bench
+}  // namespace GifBolt
@@ -0,0 +1,61 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "BenchSupport.h"
+
+namespace GifBolt
+{
+namespace Bench
+{
+
+/// \struct FeedConfig
+/// \brief A scrolling feed of GIFs driven by a virtual clock.
+/// \details Scrolling, visibility and frame timing follow virtual time, which advances by one
+///          display refresh per tick, so every run performs the same operations in the same
+///          order. The decoding work done in each tick is timed for real.
+struct FeedConfig
+{
+    double durationSeconds = 30.0;     ///< Virtual time to simulate
+    double refreshHz = 60.0;           ///< Display refresh rate; one tick per refresh
+    uint32_t feedLength = 500;         ///< Items in the feed (GIFs are reused cyclically)
+    uint32_t columnWidth = 360;        ///< Display width of each GIF, in pixels
+    uint32_t viewportHeight = 800;     ///< Visible height, in pixels
+    uint32_t preloadScreens = 1;       ///< Decoders live this many viewports above and below
+    bool paced = true;                 ///< Sleep out each refresh so background threads get
+                                       ///< real time; false runs ticks back to back
+    uint32_t seed = 1;                 ///< Seed of the scroll gestures
+};
+
+/// \struct FeedResult
+/// \brief What the feed cost and how often it missed a frame deadline.
+struct FeedResult
+{
+    uint64_t ticks = 0;             ///< Refreshes simulated
+    uint64_t jankyTicks = 0;        ///< Refreshes whose work overran the refresh interval
+    uint64_t framesPresented = 0;   ///< Frames shown when they were due
+    uint64_t framesMissed = 0;      ///< Due frames shown in janky ticks or not yet loaded
+    uint64_t decodersCreated = 0;   ///< Decoders created as items scrolled into range
+    uint32_t peakLiveDecoders = 0;  ///< Most decoders alive at once
+    uint32_t peakPlaying = 0;       ///< Most animations visible at once
+    uint32_t peakThreads = 0;       ///< Most threads in the process (0 if not reported)
+    double meanThreads = 0.0;       ///< Average threads over the ticks
+    uint64_t peakRssBytes = 0;      ///< Peak resident set during the run
+    uint64_t peakDecoderBytes = 0;  ///< Peak bytes held by decoders (DecoderStats)
+    double cpuMsPerSecond = 0.0;    ///< Process CPU time per virtual second
+    LatencySummary tickMs;          ///< Work per refresh on the UI thread
+    LatencySummary frameMs;         ///< Per frame request
+    LatencySummary teardownMs;      ///< Per decoder destruction
+};
+
+/// \brief Scrolls a feed of GIFs, creating, playing, hiding and destroying decoders.
+/// \param gifs Encoded GIFs; feed item i shows gifs[i % gifs.size()].
+/// \param config Feed shape and duration.
+FeedResult SimulateFeed(const std::vector<std::vector<uint8_t>>& gifs, const FeedConfig& config);
+
+}  // namespace Bench
+}  // namespace GifBolt
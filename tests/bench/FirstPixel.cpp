@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#include "FirstPixel.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+
+namespace GifBolt
+{
+namespace Bench
+{
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+/// \brief Reads a file to the end so that the OS caches it.
+void ReadThrough(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    char buffer[65536];
+    while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0)
+    {
+    }
+}
+
+void AppendSummary(std::string& json, const char* name, const LatencySummary& summary)
+{
+    char buffer[160];
+    std::snprintf(buffer, sizeof(buffer),
+                  "%s\"%s\":{\"p50\":%.4f,\"p90\":%.4f,\"p99\":%.4f,\"max\":%.4f}",
+                  json.size() > 1 ? "," : "", name, summary.p50, summary.p90, summary.p99,
+                  summary.max);
+    json += buffer;
+}
+}  // namespace
+
+bool MeasureFirstPixel(const std::string& path, uint32_t maxWidth, uint32_t maxHeight,
+                       bool coldCache, FirstPixelSample& sample)
+{
+    sample = FirstPixelSample();
+    if (coldCache)
+    {
+        sample.coldCache = EvictFromPageCache(path);
+    }
+    else
+    {
+        ReadThrough(path);
+    }
+
+    GifDecoder decoder;
+    const Clock::time_point start = Clock::now();
+    if (!decoder.LoadFromFile(path))
+    {
+        return false;
+    }
+    sample.loadCallMs = ElapsedMs(start);
+
+    // The header has been read, so the display size is known without waiting for frame 0
+    const uint32_t width = std::max(decoder.GetWidth(), 1u);
+    const uint32_t height = std::max(decoder.GetHeight(), 1u);
+    const double fit = std::min(static_cast<double>(maxWidth) / width,
+                                static_cast<double>(maxHeight) / height);
+    const uint32_t displayWidth = std::max(1u, static_cast<uint32_t>(std::lround(width * fit)));
+    const uint32_t displayHeight =
+        std::max(1u, static_cast<uint32_t>(std::lround(height * fit)));
+
+    uint32_t outWidth = 0, outHeight = 0;
+    const uint8_t* pixels = decoder.GetFramePixelsBGRA32PremultipliedScaled(
+        0, displayWidth, displayHeight, outWidth, outHeight);
+    sample.totalMs = ElapsedMs(start);
+    sample.stages = decoder.GetLoadTimings();
+    return pixels != nullptr;
+}
+
+FirstPixelSummary SummarizeFirstPixel(const std::vector<FirstPixelSample>& samples)
+{
+    FirstPixelSummary summary;
+    summary.samples = samples.size();
+
+    std::vector<double> values;
+    values.reserve(samples.size());
+    auto summarize = [&](auto&& getMs)
+    {
+        values.clear();
+        for (const FirstPixelSample& sample : samples)
+        {
+            values.push_back(getMs(sample));
+        }
+        return Summarize(values);
+    };
+    auto stageMs = [&](uint64_t LoadTimings::*stage)
+    { return summarize([stage](const FirstPixelSample& s) { return s.stages.*stage / 1e6; }); };
+
+    summary.totalMs = summarize([](const FirstPixelSample& s) { return s.totalMs; });
+    summary.openMs = stageMs(&LoadTimings::openNs);
+    summary.headerMs = stageMs(&LoadTimings::headerNs);
+    summary.slurpMs = stageMs(&LoadTimings::slurpNs);
+    summary.decodeMs = stageMs(&LoadTimings::decodeNs);
+    summary.composeMs = stageMs(&LoadTimings::composeNs);
+    summary.convertMs = stageMs(&LoadTimings::convertNs);
+    summary.scaleMs = stageMs(&LoadTimings::scaleNs);
+    summary.coldSamples = static_cast<size_t>(
+        std::count_if(samples.begin(), samples.end(),
+                      [](const FirstPixelSample& s) { return s.coldCache; }));
+    return summary;
+}
+
+std::string FirstPixelStagesJson(const FirstPixelSummary& summary)
+{
+    std::string json = "{";
+    AppendSummary(json, "open", summary.openMs);
+    AppendSummary(json, "header", summary.headerMs);
+    AppendSummary(json, "slurp", summary.slurpMs);
+    AppendSummary(json, "decode", summary.decodeMs);
+    AppendSummary(json, "compose", summary.composeMs);
+    AppendSummary(json, "convert", summary.convertMs);
+    AppendSummary(json, "scale", summary.scaleMs);
+    return json + "}";
+}
+
+}  // namespace Bench
+}  // namespace GifBolt
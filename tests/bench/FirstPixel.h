@@ -0,0 +1,66 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "BenchSupport.h"
+#include "GifDecoder.h"
+
+namespace GifBolt
+{
+namespace Bench
+{
+
+/// \struct FirstPixelSample
+/// \brief Time to first pixel of one load: from the load call until frame 0 is available as
+/// BGRA premultiplied at display size.
+struct FirstPixelSample
+{
+    double totalMs = 0.0;     ///< The whole path, as the user waits for it
+    double loadCallMs = 0.0;  ///< Spent inside LoadFromFile; the rest is the frame request
+    bool coldCache = false;   ///< The file was evicted from the page cache beforehand
+    LoadTimings stages;       ///< Breakdown reported by the decoder
+};
+
+/// \brief Loads a GIF file into a new decoder and requests frame 0 at display size.
+/// \param path GIF file.
+/// \param maxWidth Display bounds; frame 0 is scaled to fit them, keeping its aspect ratio,
+///                 as a view of that size would show it.
+/// \param maxHeight Display bounds.
+/// \param coldCache true to evict the file from the OS page cache first, as for a file not
+///                  read since boot; false to read it beforehand so that it is cached.
+/// \param sample Receives the timings.
+/// \return false if the GIF failed to load or frame 0 could not be produced.
+/// \remarks A cold run where eviction is not supported runs warm; see sample.coldCache.
+bool MeasureFirstPixel(const std::string& path, uint32_t maxWidth, uint32_t maxHeight,
+                       bool coldCache, FirstPixelSample& sample);
+
+/// \struct FirstPixelSummary
+/// \brief Percentiles of a set of time-to-first-pixel samples, overall and stage by stage.
+struct FirstPixelSummary
+{
+    size_t samples = 0;
+    size_t coldSamples = 0;  ///< Samples whose file was actually evicted
+    LatencySummary totalMs;
+    LatencySummary openMs;
+    LatencySummary headerMs;
+    LatencySummary slurpMs;
+    LatencySummary decodeMs;
+    LatencySummary composeMs;
+    LatencySummary convertMs;
+    LatencySummary scaleMs;
+};
+
+/// \brief Computes the percentiles of each stage independently.
+FirstPixelSummary SummarizeFirstPixel(const std::vector<FirstPixelSample>& samples);
+
+/// \brief Formats the stage percentiles as a JSON object, in milliseconds.
+/// \return {"open":{"p50":..,"p90":..,"p99":..,"max":..},"header":{...},...}
+std::string FirstPixelStagesJson(const FirstPixelSummary& summary);
+
+}  // namespace Bench
+}  // namespace GifBolt
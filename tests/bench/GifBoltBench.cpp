@@ -0,0 +1,843 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+// Runs a directory of GIFs (or the synthetic corpus) through decoding scenarios and reports
+// throughput, latency percentiles, peak RSS and CPU time as JSON. Run with --help for usage.
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "BenchSupport.h"
+#include "FeedSimulation.h"
+#include "FirstPixel.h"
+#include "GifCorpus.h"
+#include "GifDecoder.h"
+#include "MemoryFootprint.h"
+
+using namespace GifBolt;
+
+namespace
+{
+
+const char* const USAGE =
+    "Usage: GifBolt.Bench [options]\n"
+    "  --dir <path>          Benchmark every .gif under a directory (recursive)\n"
+    "  --corpus quick|full   Benchmark the synthetic corpus (default: quick)\n"
+    "  --limit <n>           Use at most n GIFs\n"
+    "  --scenarios <list>    Comma-separated subset of: probe, first-frame, full-decode,\n"
+    "                        playback-scale, concurrent, feed-scroll, memory,\n"
+    "                        first-pixel-cold, first-pixel-warm (default: all)\n"
+    "  --iterations <n>      Passes over the GIFs per scenario (default: 1)\n"
+    "  --concurrency <n>     Decoders running at once in 'concurrent' (default: 8)\n"
+    "  --feed-seconds <s>    Virtual duration of 'feed-scroll' (default: 30)\n"
+    "  --scale <w>x<h>       Bounds of the scaled frames in 'playback-scale' and\n"
+    "                        'first-pixel-*' (default: 256x256)\n"
+    "  --out <path>          Write the JSON report to a file instead of stdout\n"
+    "  --baseline <path>     Compare with a saved report; exit code 1 on regression\n"
+    "  --threshold <pct>     Change counted as a regression (default: 5)\n";
+
+const char* const ALL_SCENARIOS[] = {
+    "probe",       "first-frame", "full-decode",      "playback-scale",  "concurrent",
+    "feed-scroll", "memory",      "first-pixel-cold", "first-pixel-warm"};
+
+/// GIFs held in memory by 'feed-scroll'; the feed cycles through them
+constexpr size_t MAX_FEED_GIFS = 200;
+
+struct Options
+{
+    std::string directory;
+    Corpus::CorpusSize corpus = Corpus::CorpusSize::Quick;
+    size_t limit = SIZE_MAX;
+    std::vector<std::string> scenarios;
+    uint32_t iterations = 1;
+    uint32_t concurrency = 8;
+    uint32_t feedSeconds = 30;
+    uint32_t scaleWidth = 256;
+    uint32_t scaleHeight = 256;
+    std::string outPath;
+    std::string baselinePath;
+    double thresholdPercent = 5.0;
+};
+
+/// \brief A GIF to benchmark: generated in memory, or read from disk before each use so that
+/// a 10k-GIF sample need not fit in memory at once.
+struct Input
+{
+    std::string name;
+    std::filesystem::path path;  ///< Empty for corpus GIFs
+    std::vector<uint8_t> bytes;  ///< Corpus GIFs only
+    uint64_t size = 0;
+
+    std::vector<uint8_t> Load() const
+    {
+        if (this->path.empty())
+        {
+            return this->bytes;
+        }
+        std::ifstream file(this->path, std::ios::binary);
+        return std::vector<uint8_t>(std::istreambuf_iterator<char>(file),
+                                    std::istreambuf_iterator<char>());
+    }
+};
+
+struct ScenarioResult
+{
+    std::string name;
+    uint64_t operations = 0;  ///< GIFs processed, over every iteration
+    uint64_t failures = 0;    ///< GIFs that failed to load
+    uint64_t frames = 0;      ///< Frames produced
+    uint64_t inputBytes = 0;  ///< GIF bytes processed
+    double wallMs = 0.0;
+    double cpuMs = 0.0;
+    uint64_t peakRssBytes = 0;
+    std::vector<double> latenciesMs;  ///< Per GIF (probe, first-frame) or per frame
+    Bench::LatencySummary latency;
+    double deadlineMissPercent = 0.0;  ///< feed-scroll only
+    double heapBytesPerDecoder = 0.0;  ///< memory only: steady heap and rasters, default settings
+    std::string extraJson;             ///< Scenario-specific fields, appended to its line
+};
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+bool ParseUInt(const char* text, uint32_t& value)
+{
+    char* end = nullptr;
+    const unsigned long parsed = std::strtoul(text, &end, 10);
+    if (end == text || *end != '\0' || parsed == 0 || parsed > UINT32_MAX)
+    {
+        return false;
+    }
+    value = static_cast<uint32_t>(parsed);
+    return true;
+}
+
+bool ParseSize(const char* text, uint32_t& width, uint32_t& height)
+{
+    unsigned parsedWidth = 0, parsedHeight = 0;
+    if (std::sscanf(text, "%ux%u", &parsedWidth, &parsedHeight) != 2 || parsedWidth == 0 ||
+        parsedHeight == 0)
+    {
+        return false;
+    }
+    width = parsedWidth;
+    height = parsedHeight;
+    return true;
+}
+
+bool ParseOptions(int argc, char** argv, Options& options)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h")
+        {
+            return false;
+        }
+        if (i + 1 >= argc)
+        {
+            std::cerr << "Missing value for " << arg << "\n";
+            return false;
+        }
+        const char* value = argv[++i];
+        uint32_t number = 0;
+        if (arg == "--dir")
+        {
+            options.directory = value;
+        }
+        else if (arg == "--corpus" && std::strcmp(value, "quick") == 0)
+        {
+            options.corpus = Corpus::CorpusSize::Quick;
+        }
+        else if (arg == "--corpus" && std::strcmp(value, "full") == 0)
+        {
+            options.corpus = Corpus::CorpusSize::Full;
+        }
+        else if (arg == "--limit" && ParseUInt(value, number))
+        {
+            options.limit = number;
+        }
+        else if (arg == "--scenarios")
+        {
+            std::stringstream list(value);
+            std::string name;
+            while (std::getline(list, name, ','))
+            {
+                if (std::find(std::begin(ALL_SCENARIOS), std::end(ALL_SCENARIOS), name) ==
+                    std::end(ALL_SCENARIOS))
+                {
+                    std::cerr << "Unknown scenario " << name << "\n";
+                    return false;
+                }
+                options.scenarios.push_back(name);
+            }
+        }
+        else if (arg == "--iterations" && ParseUInt(value, number))
+        {
+            options.iterations = number;
+        }
+        else if (arg == "--concurrency" && ParseUInt(value, number))
+        {
+            options.concurrency = number;
+        }
+        else if (arg == "--feed-seconds" && ParseUInt(value, number))
+        {
+            options.feedSeconds = number;
+        }
+        else if (arg == "--scale" && ParseSize(value, options.scaleWidth, options.scaleHeight))
+        {
+            continue;
+        }
+        else if (arg == "--out")
+        {
+            options.outPath = value;
+        }
+        else if (arg == "--baseline")
+        {
+            options.baselinePath = value;
+        }
+        else if (arg == "--threshold" && std::atof(value) > 0.0)
+        {
+            options.thresholdPercent = std::atof(value);
+        }
+        else
+        {
+            std::cerr << "Invalid option " << arg << " " << value << "\n";
+            return false;
+        }
+    }
+    if (options.scenarios.empty())
+    {
+        options.scenarios.assign(std::begin(ALL_SCENARIOS), std::end(ALL_SCENARIOS));
+    }
+    return true;
+}
+
+std::vector<Input> CollectInputs(const Options& options)
+{
+    std::vector<Input> inputs;
+    if (!options.directory.empty())
+    {
+        for (const auto& entry :
+             std::filesystem::recursive_directory_iterator(options.directory))
+        {
+            std::string extension = entry.path().extension().string();
+            std::transform(extension.begin(), extension.end(), extension.begin(),
+                           [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+            if (entry.is_regular_file() && extension == ".gif")
+            {
+                Input input;
+                input.name = entry.path().filename().string();
+                input.path = entry.path();
+                input.size = entry.file_size();
+                inputs.push_back(std::move(input));
+            }
+        }
+        // Directory order is unspecified; sort so that --limit picks the same GIFs each run
+        std::sort(inputs.begin(), inputs.end(),
+                  [](const Input& a, const Input& b) { return a.path < b.path; });
+    }
+    else
+    {
+        for (const Corpus::GifSpec& spec : Corpus::GetCorpus(options.corpus))
+        {
+            Input input;
+            input.name = spec.name;
+            input.bytes = Corpus::Generate(spec);
+            input.size = input.bytes.size();
+            inputs.push_back(std::move(input));
+        }
+    }
+    if (inputs.size() > options.limit)
+    {
+        inputs.resize(options.limit);
+    }
+    return inputs;
+}
+
+/// \brief Fits the GIF inside the scale bounds, keeping its aspect ratio.
+void FitScale(const Options& options, const GifDecoder& decoder, uint32_t& width,
+              uint32_t& height)
+{
+    const double scale = std::min(static_cast<double>(options.scaleWidth) / decoder.GetWidth(),
+                                  static_cast<double>(options.scaleHeight) / decoder.GetHeight());
+    width = std::max(1u, static_cast<uint32_t>(std::lround(decoder.GetWidth() * scale)));
+    height = std::max(1u, static_cast<uint32_t>(std::lround(decoder.GetHeight() * scale)));
+}
+
+/// \brief Decodes every frame of one GIF, appending per-frame latencies.
+/// \return The number of frames produced, or 0 if the GIF failed to load.
+uint64_t DecodeAllFrames(const std::vector<uint8_t>& bytes, std::vector<double>& latenciesMs)
+{
+    GifDecoder decoder;
+    if (!decoder.LoadFromMemory(bytes.data(), bytes.size()))
+    {
+        return 0;
+    }
+    const uint32_t frameCount = decoder.GetFrameCount();
+    for (uint32_t i = 0; i < frameCount; ++i)
+    {
+        const Clock::time_point start = Clock::now();
+        if (decoder.GetFramePixelsBGRA32Premultiplied(i) == nullptr)
+        {
+            return i;
+        }
+        latenciesMs.push_back(ElapsedMs(start));
+    }
+    return frameCount;
+}
+
+/// \brief Runs one GIF through a sequential scenario.
+/// \return The time spent in the decoder, in milliseconds.
+double RunOnce(const std::string& scenario, const Options& options,
+               const std::vector<uint8_t>& bytes, ScenarioResult& result)
+{
+    const Clock::time_point start = Clock::now();
+    if (scenario == "full-decode")
+    {
+        const uint64_t frames = DecodeAllFrames(bytes, result.latenciesMs);
+        result.frames += frames;
+        result.failures += frames == 0 ? 1 : 0;
+        return ElapsedMs(start);
+    }
+
+    GifDecoder decoder;
+    if (!decoder.LoadFromMemory(bytes.data(), bytes.size()))
+    {
+        ++result.failures;
+        return ElapsedMs(start);
+    }
+
+    if (scenario == "probe")
+    {
+        // Header only: what a feed needs to lay out a placeholder
+        static_cast<void>(decoder.GetWidth() + decoder.GetHeight());
+    }
+    else if (scenario == "first-frame")
+    {
+        if (decoder.GetFramePixelsBGRA32Premultiplied(0) != nullptr)
+        {
+            ++result.frames;
+        }
+    }
+    else if (scenario == "playback-scale")
+    {
+        uint32_t width = 0, height = 0;
+        FitScale(options, decoder, width, height);
+        decoder.StartPrefetching(0);
+        const uint32_t frameCount = decoder.GetFrameCount();
+        for (uint32_t i = 0; i < frameCount; ++i)
+        {
+            const Clock::time_point frameStart = Clock::now();
+            decoder.SetCurrentFrame(i);
+            uint32_t outWidth = 0, outHeight = 0;
+            if (decoder.GetFramePixelsBGRA32PremultipliedScaled(i, width, height, outWidth,
+                                                                outHeight) == nullptr)
+            {
+                break;
+            }
+            result.latenciesMs.push_back(ElapsedMs(frameStart));
+            ++result.frames;
+        }
+        decoder.StopPrefetching();
+    }
+
+    const double elapsed = ElapsedMs(start);
+    if (scenario == "probe" || scenario == "first-frame")
+    {
+        result.latenciesMs.push_back(elapsed);
+    }
+    return elapsed;
+}
+
+ScenarioResult RunScenario(const std::string& scenario, const Options& options,
+                           const std::vector<Input>& inputs)
+{
+    ScenarioResult result;
+    result.name = scenario;
+    Bench::ResetPeakResidentBytes();
+    const uint64_t cpuStart = Bench::GetProcessCpuTimeNs();
+
+    if (scenario == "concurrent")
+    {
+        // Each worker claims the next GIF, so slow GIFs do not hold up the others; files are
+        // read by the workers, inside the timed region
+        std::atomic<size_t> next{0};
+        std::mutex resultMutex;
+        const size_t total = inputs.size() * options.iterations;
+        const Clock::time_point start = Clock::now();
+        std::vector<std::thread> workers;
+        for (uint32_t t = 0; t < options.concurrency; ++t)
+        {
+            workers.emplace_back(
+                [&]()
+                {
+                    std::vector<double> latenciesMs;
+                    uint64_t frames = 0, failures = 0, bytesRead = 0;
+                    for (size_t i = next++; i < total; i = next++)
+                    {
+                        const std::vector<uint8_t> bytes = inputs[i % inputs.size()].Load();
+                        bytesRead += bytes.size();
+                        const uint64_t decoded = DecodeAllFrames(bytes, latenciesMs);
+                        frames += decoded;
+                        failures += decoded == 0 ? 1 : 0;
+                    }
+                    std::lock_guard<std::mutex> lock(resultMutex);
+                    result.frames += frames;
+                    result.failures += failures;
+                    result.inputBytes += bytesRead;
+                    result.latenciesMs.insert(result.latenciesMs.end(), latenciesMs.begin(),
+                                              latenciesMs.end());
+                });
+        }
+        for (std::thread& worker : workers)
+        {
+            worker.join();
+        }
+        result.wallMs = ElapsedMs(start);
+        result.operations = total;
+    }
+    else if (scenario == "feed-scroll")
+    {
+        // The feed plays from memory, like GIFs already in the app's HTTP cache
+        std::vector<std::vector<uint8_t>> gifs;
+        for (size_t i = 0; i < inputs.size() && i < MAX_FEED_GIFS; ++i)
+        {
+            gifs.push_back(inputs[i].Load());
+            result.inputBytes += gifs.back().size();
+        }
+
+        Bench::FeedConfig config;
+        config.durationSeconds = options.feedSeconds;
+        const Clock::time_point start = Clock::now();
+        const Bench::FeedResult feed = Bench::SimulateFeed(gifs, config);
+        result.wallMs = ElapsedMs(start);
+        result.operations = feed.decodersCreated;
+        result.frames = feed.framesPresented;
+        result.latency = feed.frameMs;
+        const uint64_t due = feed.framesPresented + feed.framesMissed;
+        result.deadlineMissPercent = due > 0 ? 100.0 * feed.framesMissed / due : 0.0;
+
+        char buffer[640];
+        std::snprintf(
+            buffer, sizeof(buffer),
+            ",\"feed\":{\"virtualSeconds\":%u,\"ticks\":%llu,\"jankyTicks\":%llu,"
+            "\"framesMissed\":%llu,\"deadlineMissPercent\":%.3f,\"peakLiveDecoders\":%u,"
+            "\"peakPlaying\":%u,\"peakThreads\":%u,\"meanThreads\":%.1f,"
+            "\"peakDecoderBytes\":%llu,\"cpuMsPerSecond\":%.2f,\"tickMs\":{\"p50\":%.4f,"
+            "\"p99\":%.4f,\"max\":%.4f},\"teardownMs\":{\"p50\":%.4f,\"p99\":%.4f,"
+            "\"max\":%.4f}}",
+            options.feedSeconds, static_cast<unsigned long long>(feed.ticks),
+            static_cast<unsigned long long>(feed.jankyTicks),
+            static_cast<unsigned long long>(feed.framesMissed), result.deadlineMissPercent,
+            feed.peakLiveDecoders, feed.peakPlaying, feed.peakThreads, feed.meanThreads,
+            static_cast<unsigned long long>(feed.peakDecoderBytes), feed.cpuMsPerSecond,
+            feed.tickMs.p50, feed.tickMs.p99, feed.tickMs.max, feed.teardownMs.p50,
+            feed.teardownMs.p99, feed.teardownMs.max);
+        result.extraJson = buffer;
+    }
+    else if (scenario == "memory")
+    {
+        // Every GIF under every settings variant; footprints are averaged over the GIFs
+        const std::vector<Bench::MemoryConfig> configs = Bench::GetMemoryConfigs();
+        std::vector<Bench::MemoryFootprint> sums(configs.size());
+        const Clock::time_point start = Clock::now();
+        for (const Input& input : inputs)
+        {
+            const std::vector<uint8_t> bytes = input.Load();
+            result.inputBytes += bytes.size();
+            for (size_t c = 0; c < configs.size(); ++c)
+            {
+                const Bench::MemoryFootprint footprint =
+                    Bench::MeasureFootprint(bytes, configs[c]);
+                Bench::MemoryFootprint& sum = sums[c];
+                sum.fixedHeapBytes += footprint.fixedHeapBytes;
+                sum.steadyHeapBytes += footprint.steadyHeapBytes;
+                sum.peakHeapBytes += footprint.peakHeapBytes;
+                sum.steadyRssBytes += footprint.steadyRssBytes;
+                sum.peakRssBytes += footprint.peakRssBytes;
+                sum.retainedHeapBytes += footprint.retainedHeapBytes;
+                sum.rasterBytes += footprint.rasterBytes;
+                sum.canvasBytes += footprint.canvasBytes;
+                sum.frameCacheBytes += footprint.frameCacheBytes;
+                sum.conversionCacheBytes += footprint.conversionCacheBytes;
+                sum.poolBytes += footprint.poolBytes;
+                sum.otherHeapBytes += footprint.otherHeapBytes;
+                ++result.operations;
+            }
+        }
+        result.wallMs = ElapsedMs(start);
+
+        const double count = static_cast<double>(std::max<size_t>(inputs.size(), 1));
+        result.heapBytesPerDecoder =
+            (sums[0].steadyHeapBytes + sums[0].rasterBytes) / count;
+        char total[64];
+        std::snprintf(total, sizeof(total), ",\"heapBytesPerDecoder\":%.0f",
+                      result.heapBytesPerDecoder);
+        result.extraJson = std::string(total) + ",\"memory\":[";
+        for (size_t c = 0; c < configs.size(); ++c)
+        {
+            const Bench::MemoryFootprint& sum = sums[c];
+            char buffer[640];
+            std::snprintf(
+                buffer, sizeof(buffer),
+                "%s{\"settings\":\"%s\",\"fixedHeapBytes\":%.0f,\"steadyHeapBytes\":%.0f,"
+                "\"peakHeapBytes\":%.0f,\"steadyRssBytes\":%.0f,\"peakRssGrowthBytes\":%.0f,"
+                "\"retainedHeapBytes\":%.0f,\"rasterBytes\":%.0f,\"canvasBytes\":%.0f,"
+                "\"frameCacheBytes\":%.0f,\"conversionCacheBytes\":%.0f,\"poolBytes\":%.0f,"
+                "\"otherHeapBytes\":%.0f}",
+                c > 0 ? "," : "", Bench::JsonEscape(configs[c].name).c_str(),
+                sum.fixedHeapBytes / count, sum.steadyHeapBytes / count,
+                sum.peakHeapBytes / count, sum.steadyRssBytes / count,
+                sum.peakRssBytes / count, sum.retainedHeapBytes / count,
+                sum.rasterBytes / count, sum.canvasBytes / count, sum.frameCacheBytes / count,
+                sum.conversionCacheBytes / count, sum.poolBytes / count,
+                sum.otherHeapBytes / count);
+            result.extraJson += buffer;
+        }
+        result.extraJson += "]";
+    }
+    else if (scenario == "first-pixel-cold" || scenario == "first-pixel-warm")
+    {
+        // Loads go through files, so corpus GIFs are written out first
+        const bool cold = scenario == "first-pixel-cold";
+        const std::filesystem::path directory =
+            std::filesystem::temp_directory_path() / "gifbolt-bench-first-pixel";
+        std::vector<std::string> paths;
+        for (const Input& input : inputs)
+        {
+            if (!input.path.empty())
+            {
+                paths.push_back(input.path.string());
+                continue;
+            }
+            std::filesystem::create_directories(directory);
+            paths.push_back((directory / (input.name + ".gif")).string());
+            std::ofstream file(paths.back(), std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char*>(input.bytes.data()),
+                       static_cast<std::streamsize>(input.bytes.size()));
+        }
+
+        std::vector<Bench::FirstPixelSample> samples;
+        for (uint32_t iteration = 0; iteration < options.iterations; ++iteration)
+        {
+            for (size_t i = 0; i < inputs.size(); ++i)
+            {
+                Bench::FirstPixelSample sample;
+                ++result.operations;
+                result.inputBytes += inputs[i].size;
+                if (!Bench::MeasureFirstPixel(paths[i], options.scaleWidth, options.scaleHeight,
+                                              cold, sample))
+                {
+                    ++result.failures;
+                    continue;
+                }
+                ++result.frames;
+                result.wallMs += sample.totalMs;
+                result.latenciesMs.push_back(sample.totalMs);
+                samples.push_back(sample);
+            }
+        }
+        std::error_code ignored;
+        std::filesystem::remove_all(directory, ignored);
+
+        const Bench::FirstPixelSummary summary = Bench::SummarizeFirstPixel(samples);
+        result.extraJson = ",\"coldSamples\":" + std::to_string(summary.coldSamples) +
+                           ",\"stagesMs\":" + Bench::FirstPixelStagesJson(summary);
+    }
+    else
+    {
+        // Files are read outside the timed region, so wall time is decoder time only
+        for (uint32_t iteration = 0; iteration < options.iterations; ++iteration)
+        {
+            for (const Input& input : inputs)
+            {
+                const std::vector<uint8_t> bytes = input.Load();
+                result.wallMs += RunOnce(scenario, options, bytes, result);
+                result.inputBytes += bytes.size();
+                ++result.operations;
+            }
+        }
+    }
+
+    result.cpuMs = (Bench::GetProcessCpuTimeNs() - cpuStart) / 1e6;
+    result.peakRssBytes = Bench::GetPeakResidentBytes();
+    if (!result.latenciesMs.empty())
+    {
+        result.latency = Bench::Summarize(result.latenciesMs);
+    }
+    return result;
+}
+
+double PerSecond(double count, double wallMs)
+{
+    return wallMs > 0.0 ? count * 1000.0 / wallMs : 0.0;
+}
+
+/// \brief The metrics compared against a baseline, as they appear in the report.
+struct Metrics
+{
+    double operationsPerSecond = 0.0;
+    double framesPerSecond = 0.0;
+    double p99 = 0.0;
+    double cpuMs = 0.0;
+    double peakRssBytes = 0.0;
+    double deadlineMissPercent = 0.0;
+    double heapBytesPerDecoder = 0.0;
+};
+
+Metrics GetMetrics(const ScenarioResult& result)
+{
+    Metrics metrics;
+    metrics.operationsPerSecond = PerSecond(static_cast<double>(result.operations), result.wallMs);
+    metrics.framesPerSecond = PerSecond(static_cast<double>(result.frames), result.wallMs);
+    metrics.p99 = result.latency.p99;
+    metrics.cpuMs = result.cpuMs;
+    metrics.peakRssBytes = static_cast<double>(result.peakRssBytes);
+    metrics.deadlineMissPercent = result.deadlineMissPercent;
+    metrics.heapBytesPerDecoder = result.heapBytesPerDecoder;
+    return metrics;
+}
+
+/// \brief Finds a numeric field on a report line.
+double FindNumber(const std::string& line, const std::string& key)
+{
+    const size_t position = line.find("\"" + key + "\":");
+    return position == std::string::npos ? 0.0
+                                         : std::atof(line.c_str() + position + key.size() + 3);
+}
+
+/// \brief Reads the scenario metrics of a saved report.
+/// \details Reports put each scenario on its own line, which keeps this reader trivial.
+std::map<std::string, Metrics> ReadBaseline(const std::string& path)
+{
+    std::map<std::string, Metrics> baseline;
+    std::ifstream file(path);
+    std::string line;
+    const std::string prefix = "{\"name\":\"";
+    while (std::getline(file, line))
+    {
+        const size_t start = line.find(prefix);
+        if (start == std::string::npos)
+        {
+            continue;
+        }
+        const size_t nameStart = start + prefix.size();
+        const std::string name = line.substr(nameStart, line.find('"', nameStart) - nameStart);
+        Metrics& metrics = baseline[name];
+        metrics.operationsPerSecond = FindNumber(line, "operationsPerSecond");
+        metrics.framesPerSecond = FindNumber(line, "framesPerSecond");
+        metrics.p99 = FindNumber(line, "p99");
+        metrics.cpuMs = FindNumber(line, "cpuMs");
+        metrics.peakRssBytes = FindNumber(line, "peakRssBytes");
+        metrics.deadlineMissPercent = FindNumber(line, "deadlineMissPercent");
+        metrics.heapBytesPerDecoder = FindNumber(line, "heapBytesPerDecoder");
+    }
+    return baseline;
+}
+
+struct Comparison
+{
+    std::string scenario;
+    const char* metric;
+    double baseline;
+    double current;
+    double changePercent;
+    bool regression;
+};
+
+std::vector<Comparison> Compare(const std::vector<ScenarioResult>& results,
+                                const std::map<std::string, Metrics>& baseline,
+                                double thresholdPercent)
+{
+    std::vector<Comparison> comparisons;
+    for (const ScenarioResult& result : results)
+    {
+        const auto found = baseline.find(result.name);
+        if (found == baseline.end())
+        {
+            continue;
+        }
+        const Metrics& before = found->second;
+        const Metrics after = GetMetrics(result);
+
+        // higherIsBetter: throughput; otherwise latency, CPU time and memory
+        auto add = [&](const char* metric, double was, double now, bool higherIsBetter)
+        {
+            if (was <= 0.0)
+            {
+                return;
+            }
+            const double change = (now - was) / was * 100.0;
+            const bool regression =
+                higherIsBetter ? change < -thresholdPercent : change > thresholdPercent;
+            comparisons.push_back({result.name, metric, was, now, change, regression});
+        };
+        add("operationsPerSecond", before.operationsPerSecond, after.operationsPerSecond, true);
+        add("framesPerSecond", before.framesPerSecond, after.framesPerSecond, true);
+        add("p99", before.p99, after.p99, false);
+        add("cpuMs", before.cpuMs, after.cpuMs, false);
+        add("peakRssBytes", before.peakRssBytes, after.peakRssBytes, false);
+        add("deadlineMissPercent", before.deadlineMissPercent, after.deadlineMissPercent, false);
+        add("heapBytesPerDecoder", before.heapBytesPerDecoder, after.heapBytesPerDecoder, false);
+    }
+    return comparisons;
+}
+
+void WriteReport(std::ostream& out, const Options& options, const std::vector<Input>& inputs,
+                 const std::vector<ScenarioResult>& results,
+                 const std::vector<Comparison>& comparisons)
+{
+    uint64_t inputBytes = 0;
+    for (const Input& input : inputs)
+    {
+        inputBytes += input.size;
+    }
+
+    char buffer[2048];
+    out << "{\n";
+    out << "  \"tool\": \"GifBolt.Bench\",\n";
+    out << "  \"source\": \""
+        << Bench::JsonEscape(!options.directory.empty() ? options.directory
+                             : options.corpus == Corpus::CorpusSize::Full ? "corpus:full"
+                                                                          : "corpus:quick")
+        << "\",\n";
+    out << "  \"gifs\": " << inputs.size() << ",\n";
+    out << "  \"inputBytes\": " << inputBytes << ",\n";
+    out << "  \"iterations\": " << options.iterations << ",\n";
+    out << "  \"concurrency\": " << options.concurrency << ",\n";
+    out << "  \"scale\": \"" << options.scaleWidth << "x" << options.scaleHeight << "\",\n";
+    out << "  \"scenarios\": [\n";
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const ScenarioResult& result = results[i];
+        const Metrics metrics = GetMetrics(result);
+        std::snprintf(
+            buffer, sizeof(buffer),
+            "    {\"name\":\"%s\",\"operations\":%llu,\"failures\":%llu,\"frames\":%llu,"
+            "\"wallMs\":%.3f,\"operationsPerSecond\":%.2f,\"framesPerSecond\":%.2f,"
+            "\"megabytesPerSecond\":%.3f,\"latencyMs\":{\"p50\":%.4f,\"p90\":%.4f,"
+            "\"p99\":%.4f,\"max\":%.4f},\"cpuMs\":%.3f,\"peakRssBytes\":%llu",
+            result.name.c_str(), static_cast<unsigned long long>(result.operations),
+            static_cast<unsigned long long>(result.failures),
+            static_cast<unsigned long long>(result.frames), result.wallMs,
+            metrics.operationsPerSecond, metrics.framesPerSecond,
+            PerSecond(result.inputBytes / 1e6, result.wallMs), result.latency.p50,
+            result.latency.p90, result.latency.p99, result.latency.max, result.cpuMs,
+            static_cast<unsigned long long>(result.peakRssBytes));
+        // Scenario-specific fields can outgrow the buffer
+        out << buffer << result.extraJson << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "  ]";
+
+    if (!comparisons.empty())
+    {
+        out << ",\n  \"thresholdPercent\": " << options.thresholdPercent << ",\n";
+        out << "  \"comparison\": [\n";
+        for (size_t i = 0; i < comparisons.size(); ++i)
+        {
+            const Comparison& c = comparisons[i];
+            std::snprintf(buffer, sizeof(buffer),
+                          "    {\"scenario\":\"%s\",\"metric\":\"%s\",\"baseline\":%.4f,"
+                          "\"current\":%.4f,\"changePercent\":%.2f,\"regression\":%s}%s\n",
+                          c.scenario.c_str(), c.metric, c.baseline, c.current, c.changePercent,
+                          c.regression ? "true" : "false", i + 1 < comparisons.size() ? "," : "");
+            out << buffer;
+        }
+        out << "  ]";
+    }
+    out << "\n}\n";
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!ParseOptions(argc, argv, options))
+    {
+        std::cerr << USAGE;
+        return 2;
+    }
+
+    try
+    {
+        const std::vector<Input> inputs = CollectInputs(options);
+        if (inputs.empty())
+        {
+            std::cerr << "No GIFs to benchmark\n";
+            return 2;
+        }
+
+        std::vector<ScenarioResult> results;
+        for (const std::string& scenario : options.scenarios)
+        {
+            std::cerr << "Running " << scenario << " over " << inputs.size() << " GIFs...\n";
+            results.push_back(RunScenario(scenario, options, inputs));
+        }
+
+        std::vector<Comparison> comparisons;
+        if (!options.baselinePath.empty())
+        {
+            const std::map<std::string, Metrics> baseline = ReadBaseline(options.baselinePath);
+            if (baseline.empty())
+            {
+                std::cerr << "No scenarios found in baseline " << options.baselinePath << "\n";
+                return 2;
+            }
+            comparisons = Compare(results, baseline, options.thresholdPercent);
+        }
+
+        if (options.outPath.empty())
+        {
+            WriteReport(std::cout, options, inputs, results, comparisons);
+        }
+        else
+        {
+            std::ofstream out(options.outPath);
+            WriteReport(out, options, inputs, results, comparisons);
+            if (!out)
+            {
+                std::cerr << "Cannot write " << options.outPath << "\n";
+                return 2;
+            }
+        }
+
+        bool regressed = false;
+        for (const Comparison& c : comparisons)
+        {
+            if (c.regression)
+            {
+                std::cerr << "REGRESSION " << c.scenario << " " << c.metric << ": " << c.baseline
+                          << " -> " << c.current << " (" << c.changePercent << "%)\n";
+                regressed = true;
+            }
+        }
+        return regressed ? 1 : 0;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << "\n";
+        return 2;
+    }
+}
@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+// Replays a recording of C ABI calls (gb_record_start, or GIFBOLT_RECORD_CALLS) against the
+// library and reports per-call latency, recorded and replayed, as JSON. Run with --help for
+// usage.
+
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "CallRecorder.h"
+#include "CallReplay.h"
+
+using namespace GifBolt;
+
+namespace
+{
+
+const char* const USAGE =
+    "Usage: GifBolt.Replay <recording> [options]\n"
+    "  --fast                Issue calls back to back instead of at their recorded times\n"
+    "  --assets <dir>        Look up missing files by name, and buffers that were not\n"
+    "                        embedded by content hash, under this directory\n"
+    "  --iterations <n>      Replay the recording n times; one report per pass (default: 1)\n"
+    "  --out <path>          Write the JSON reports to a file instead of stdout\n";
+
+struct Options
+{
+    std::string recordingPath;
+    Bench::ReplayOptions replay;
+    uint32_t iterations = 1;
+    std::string outPath;
+};
+
+bool ParseOptions(int argc, char** argv, Options& options)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h")
+        {
+            return false;
+        }
+        if (arg == "--fast")
+        {
+            options.replay.pacing = Bench::ReplayPacing::AsFastAsPossible;
+            continue;
+        }
+        if (arg.rfind("--", 0) != 0)
+        {
+            options.recordingPath = arg;
+            continue;
+        }
+        if (i + 1 >= argc)
+        {
+            std::cerr << "Missing value for " << arg << "\n";
+            return false;
+        }
+        const char* value = argv[++i];
+        if (arg == "--assets")
+        {
+            options.replay.assetDirectory = value;
+        }
+        else if (arg == "--iterations" && std::atoi(value) > 0)
+        {
+            options.iterations = static_cast<uint32_t>(std::atoi(value));
+        }
+        else if (arg == "--out")
+        {
+            options.outPath = value;
+        }
+        else
+        {
+            std::cerr << "Unknown option " << arg << " " << value << "\n";
+            return false;
+        }
+    }
+    return !options.recordingPath.empty();
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!ParseOptions(argc, argv, options))
+    {
+        std::cerr << USAGE;
+        return 2;
+    }
+
+    try
+    {
+        CallRecorder::Recording recording;
+        if (!CallRecorder::Read(options.recordingPath, recording))
+        {
+            std::cerr << "Not a GifBolt call recording: " << options.recordingPath << "\n";
+            return 2;
+        }
+        std::cerr << "Replaying " << recording.calls.size() << " calls ("
+                  << recording.buffers.size() << " embedded buffers)...\n";
+
+        std::ofstream file;
+        if (!options.outPath.empty())
+        {
+            file.open(options.outPath);
+        }
+        std::ostream& out = options.outPath.empty() ? std::cout : file;
+        bool diverged = false;
+        for (uint32_t pass = 0; pass < options.iterations; ++pass)
+        {
+            const Bench::ReplayReport report = Bench::ReplayCalls(recording, options.replay);
+            out << Bench::ReplayReportJson(report);
+            for (const std::string& problem : report.problems)
+            {
+                std::cerr << problem << "\n";
+            }
+            diverged = diverged || report.callsSkipped > 0 || report.resultMismatches > 0;
+        }
+        if (!out)
+        {
+            std::cerr << "Cannot write " << options.outPath << "\n";
+            return 2;
+        }
+        return diverged ? 1 : 0;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << "\n";
+        return 2;
+    }
+}
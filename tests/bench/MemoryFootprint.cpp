@@ -0,0 +1,177 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#include "MemoryFootprint.h"
+
+#include <algorithm>
+#include <memory>
+
+#include "AllocationHooks.h"
+#include "BenchSupport.h"
+#include "GifDecoder.h"
+
+namespace GifBolt
+{
+namespace Bench
+{
+
+namespace
+{
+/// Canvas bytes of all instances together, beyond which fewer instances are measured
+constexpr uint64_t MAX_CANVAS_BYTES = 256ull * 1024 * 1024;
+
+/// \brief Plays every frame once, unscaled or scaled to fit the configured bounds.
+void PlayLoop(GifDecoder& decoder, const MemoryConfig& config)
+{
+    const uint32_t frameCount = decoder.GetFrameCount();
+    uint32_t outWidth = 0, outHeight = 0;
+    for (uint32_t i = 0; i < frameCount; ++i)
+    {
+        decoder.SetCurrentFrame(i);
+        if (config.scaledWidth > 0 && config.scaledHeight > 0)
+        {
+            decoder.GetFramePixelsBGRA32PremultipliedScaled(
+                i, std::min(config.scaledWidth, decoder.GetWidth()),
+                std::min(config.scaledHeight, decoder.GetHeight()), outWidth, outHeight);
+        }
+        else
+        {
+            decoder.GetFramePixelsBGRA32Premultiplied(i);
+        }
+    }
+}
+
+std::unique_ptr<GifDecoder> CreateDecoder(const MemoryConfig& config)
+{
+    auto decoder = std::make_unique<GifDecoder>();
+    decoder->SetMaxCachedFrames(config.maxCachedFrames);
+    decoder->SetMipmapsEnabled(config.mipmaps);
+    return decoder;
+}
+
+void Load(GifDecoder& decoder, const std::vector<uint8_t>& gif, const MemoryConfig& config)
+{
+    decoder.LoadFromMemory(gif.data(), gif.size());
+    if (config.prefetch)
+    {
+        decoder.StartPrefetching(0);
+    }
+    PlayLoop(decoder, config);
+}
+
+int64_t Difference(uint64_t after, uint64_t before)
+{
+    return static_cast<int64_t>(after) - static_cast<int64_t>(before);
+}
+
+uint64_t PerInstance(int64_t bytes, uint32_t instances)
+{
+    return bytes > 0 ? static_cast<uint64_t>(bytes) / instances : 0;
+}
+}  // namespace
+
+std::vector<MemoryConfig> GetMemoryConfigs()
+{
+    std::vector<MemoryConfig> configs(7);
+    configs[0].name = "default";
+    configs[1].name = "cache-1";
+    configs[1].maxCachedFrames = 1;
+    configs[2].name = "cache-64";
+    configs[2].maxCachedFrames = 64;
+    configs[3].name = "prefetch";
+    configs[3].prefetch = true;
+    configs[4].name = "scaled-256";
+    configs[4].scaledWidth = 256;
+    configs[4].scaledHeight = 256;
+    configs[5].name = "scaled-256-mips";
+    configs[5].scaledWidth = 256;
+    configs[5].scaledHeight = 256;
+    configs[5].mipmaps = true;
+    configs[6].name = "scaled-256-mips-cache-64";
+    configs[6].scaledWidth = 256;
+    configs[6].scaledHeight = 256;
+    configs[6].mipmaps = true;
+    configs[6].maxCachedFrames = 64;
+    return configs;
+}
+
+MemoryFootprint MeasureFootprint(const std::vector<uint8_t>& gif, const MemoryConfig& config)
+{
+    MemoryFootprint footprint;
+    uint32_t instances = std::max<uint32_t>(config.instances, 1);
+
+    {
+        std::unique_ptr<GifDecoder> warmUp = CreateDecoder(config);
+        Load(*warmUp, gif, config);
+
+        // Large canvases get fewer instances so that a run stays near MAX_CANVAS_BYTES
+        const uint64_t canvasBytes = warmUp->GetStats().canvasBytes;
+        if (canvasBytes > 0)
+        {
+            instances = static_cast<uint32_t>(std::clamp<uint64_t>(
+                MAX_CANVAS_BYTES / canvasBytes, 1, instances));
+        }
+    }
+
+    const uint64_t heapBefore = GetHeapBytes();
+    const uint64_t rssBefore = GetResidentBytes();
+    ResetPeakHeapBytes();
+    const bool peakRssReset = ResetPeakResidentBytes();
+
+    std::vector<std::unique_ptr<GifDecoder>> decoders;
+    decoders.reserve(instances);
+    const uint64_t heapReserved = GetHeapBytes();
+    for (uint32_t i = 0; i < instances; ++i)
+    {
+        decoders.push_back(CreateDecoder(config));
+    }
+    footprint.fixedHeapBytes = PerInstance(Difference(GetHeapBytes(), heapReserved), instances);
+
+    for (const std::unique_ptr<GifDecoder>& decoder : decoders)
+    {
+        Load(*decoder, gif, config);
+    }
+
+    // Measure while the prefetch threads still run, so their stacks count as resident
+    const uint64_t rssAfter = GetResidentBytes();
+    footprint.steadyHeapBytes = PerInstance(Difference(GetHeapBytes(), heapBefore), instances);
+    footprint.peakHeapBytes = PerInstance(Difference(GetPeakHeapBytes(), heapBefore), instances);
+    if (rssBefore > 0 && rssAfter > 0)
+    {
+        footprint.steadyRssBytes = Difference(rssAfter, rssBefore) / instances;
+    }
+    if (peakRssReset)
+    {
+        footprint.peakRssBytes = Difference(GetPeakResidentBytes(), rssBefore) / instances;
+    }
+
+    uint64_t cacheBytes = 0;
+    for (const std::unique_ptr<GifDecoder>& decoder : decoders)
+    {
+        const DecoderStats stats = decoder->GetStats();
+        footprint.rasterBytes += stats.rasterBytes;
+        footprint.canvasBytes += stats.canvasBytes;
+        footprint.frameCacheBytes += stats.frameCacheBytes;
+        cacheBytes += stats.cacheBytes;
+        footprint.poolBytes += stats.poolBytes;
+    }
+    footprint.conversionCacheBytes = (cacheBytes - footprint.frameCacheBytes) / instances;
+    footprint.rasterBytes /= instances;
+    footprint.canvasBytes /= instances;
+    footprint.frameCacheBytes /= instances;
+    footprint.poolBytes /= instances;
+
+    // giflib's rasters are malloc'd, so the heap hooks never saw them
+    const uint64_t attributed = footprint.canvasBytes + footprint.frameCacheBytes +
+                                footprint.conversionCacheBytes + footprint.poolBytes;
+    footprint.otherHeapBytes =
+        footprint.steadyHeapBytes > attributed ? footprint.steadyHeapBytes - attributed : 0;
+
+    decoders.clear();
+    const int64_t retained = Difference(GetHeapBytes(), heapBefore);
+    footprint.retainedHeapBytes = retained > 0 ? static_cast<uint64_t>(retained) : 0;
+    return footprint;
+}
+
+}  // namespace Bench
+}  // namespace GifBolt
@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace GifBolt
+{
+namespace Bench
+{
+
+/// \struct MemoryConfig
+/// \brief Decoder settings and playback of one memory measurement.
+struct MemoryConfig
+{
+    std::string name;               ///< Label in reports
+    uint32_t maxCachedFrames = 10;  ///< SetMaxCachedFrames (10 is the decoder default)
+    bool prefetch = false;          ///< Run the prefetch thread during playback
+    bool mipmaps = false;           ///< SetMipmapsEnabled
+    uint32_t scaledWidth = 0;       ///< Bounds of scaled frame requests; 0 plays unscaled
+    uint32_t scaledHeight = 0;
+    uint32_t instances = 8;         ///< Decoders measured side by side (fewer for large
+                                    ///< canvases); results are per decoder
+};
+
+/// \brief Gets the settings matrix: cache size, prefetch and the scaled-cache configuration,
+/// each varied from the decoder defaults.
+std::vector<MemoryConfig> GetMemoryConfigs();
+
+/// \struct MemoryFootprint
+/// \brief Memory held by one decoder, averaged over MemoryConfig::instances decoders.
+/// \details Heap bytes count operator new allocations (AllocationHooks.h); giflib's rasters
+///          are allocated with malloc and appear only in rasterBytes and the resident set.
+///          Steady values are taken after one full playback loop; peaks cover loading and
+///          playback.
+struct MemoryFootprint
+{
+    uint64_t fixedHeapBytes = 0;     ///< Heap of a constructed decoder that has loaded nothing
+    uint64_t steadyHeapBytes = 0;    ///< Heap after playback
+    uint64_t peakHeapBytes = 0;      ///< Most heap held at once
+    int64_t steadyRssBytes = 0;      ///< Resident set growth after playback (0 if not reported)
+    int64_t peakRssBytes = 0;        ///< Peak resident set growth (0 if not reported)
+    uint64_t retainedHeapBytes = 0;  ///< Heap still held once every decoder is destroyed, in
+                                     ///< total rather than per decoder (a leak shows here)
+
+    // DecoderStats after playback
+    uint64_t rasterBytes = 0;           ///< giflib SavedImages rasters and color maps
+    uint64_t canvasBytes = 0;           ///< Composition canvas and previous canvas
+    uint64_t frameCacheBytes = 0;       ///< Composed frames
+    uint64_t conversionCacheBytes = 0;  ///< Converted, scaled and mip caches
+    uint64_t poolBytes = 0;             ///< Idle pooled buffers and arenas
+    uint64_t otherHeapBytes = 0;  ///< Steady heap not in the above: per-instance structures,
+                                  ///< frame records and container overhead
+};
+
+/// \brief Loads a GIF into side-by-side decoders, plays one loop on each and measures their
+/// memory.
+/// \details A discarded warm-up run first sets up process-wide state (the thread pool,
+///          allocator arenas) so that it is not charged to the decoders. Run nothing else in
+///          the process meanwhile: resident set and heap are process-wide.
+MemoryFootprint MeasureFootprint(const std::vector<uint8_t>& gif, const MemoryConfig& config);
+
+}  // namespace Bench
+}  // namespace GifBolt
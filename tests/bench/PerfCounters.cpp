@@ -0,0 +1,165 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#include "PerfCounters.h"
+
+#include <chrono>
+#include <cstring>
+
+#ifdef __linux__
+#include <cerrno>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace GifBolt
+{
+namespace Bench
+{
+
+namespace
+{
+uint64_t NowNs()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+}
+
+#ifdef __linux__
+const uint64_t COUNTER_CONFIGS[] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                    PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+const char* const COUNTER_NAMES[] = {"cycles", "instructions", "cache-misses",
+                                     "branch-misses"};
+
+/// \brief Opens a disabled user-space hardware counter on the calling thread.
+/// \return The file descriptor, or -1 with errno set.
+int OpenCounter(uint64_t config)
+{
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+/// \brief Reads a counter, scaled up for the time it was multiplexed out.
+uint64_t ReadCounter(int fd)
+{
+    uint64_t values[3] = {0, 0, 0};  // value, time enabled, time running
+    if (read(fd, values, sizeof(values)) != static_cast<ssize_t>(sizeof(values)) ||
+        values[2] == 0)
+    {
+        return 0;
+    }
+    if (values[2] >= values[1])
+    {
+        return values[0];
+    }
+    return static_cast<uint64_t>(static_cast<double>(values[0]) * values[1] / values[2]);
+}
+#endif
+}  // namespace
+
+PerfCounters::PerfCounters()
+{
+    for (int& fd : this->_fds)
+    {
+        fd = -1;
+    }
+#ifdef __linux__
+    for (int i = 0; i < COUNTER_COUNT; ++i)
+    {
+        this->_fds[i] = OpenCounter(COUNTER_CONFIGS[i]);
+        if (this->_fds[i] < 0)
+        {
+            const int error = errno;
+            this->_unavailableReason += this->_unavailableReason.empty() ? "" : "; ";
+            this->_unavailableReason += std::string(COUNTER_NAMES[i]) + ": " +
+                                        std::strerror(error);
+            if (error == EACCES || error == EPERM)
+            {
+                this->_unavailableReason += " (see /proc/sys/kernel/perf_event_paranoid)";
+            }
+        }
+    }
+#else
+    this->_unavailableReason = "hardware counters need Linux perf_event_open";
+#endif
+}
+
+PerfCounters::~PerfCounters()
+{
+#ifdef __linux__
+    for (int fd : this->_fds)
+    {
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+    }
+#endif
+}
+
+bool PerfCounters::IsAvailable() const
+{
+    return this->_fds[0] >= 0 && this->_fds[1] >= 0;
+}
+
+const std::string& PerfCounters::GetUnavailableReason() const
+{
+    return this->_unavailableReason;
+}
+
+void PerfCounters::Start()
+{
+#ifdef __linux__
+    for (int fd : this->_fds)
+    {
+        if (fd >= 0)
+        {
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+#endif
+    this->_startNs = NowNs();
+}
+
+PerfSample PerfCounters::Stop()
+{
+    PerfSample sample;
+    sample.wallNs = NowNs() - this->_startNs;
+#ifdef __linux__
+    for (int fd : this->_fds)
+    {
+        if (fd >= 0)
+        {
+            ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        }
+    }
+    uint64_t* const counts[] = {&sample.cycles, &sample.instructions, &sample.cacheMisses,
+                                &sample.branchMisses};
+    bool* const available[] = {&sample.hasCycles, &sample.hasInstructions,
+                               &sample.hasCacheMisses, &sample.hasBranchMisses};
+    for (int i = 0; i < COUNTER_COUNT; ++i)
+    {
+        if (this->_fds[i] >= 0)
+        {
+            *counts[i] = ReadCounter(this->_fds[i]);
+            *available[i] = true;
+        }
+    }
+#endif
+    return sample;
+}
+
+}  // namespace Bench
+}  // namespace GifBolt
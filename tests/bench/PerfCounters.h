@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace GifBolt
+{
+namespace Bench
+{
+
+/// \struct PerfSample
+/// \brief Hardware counters and wall-clock time over a measured region of the calling thread.
+/// \remarks A counter the platform does not provide reads 0 and its has* flag is false.
+struct PerfSample
+{
+    uint64_t wallNs = 0;
+    uint64_t cycles = 0;
+    uint64_t instructions = 0;
+    uint64_t cacheMisses = 0;   ///< Last-level cache misses
+    uint64_t branchMisses = 0;  ///< Mispredicted branches
+    bool hasCycles = false;
+    bool hasInstructions = false;
+    bool hasCacheMisses = false;
+    bool hasBranchMisses = false;
+};
+
+/// \class PerfCounters
+/// \brief Counts CPU cycles, instructions, cache misses and branch misses of the calling
+/// thread with perf_event_open.
+/// \details Only user-space events are counted, which perf_event_paranoid allows up to level 2.
+///          Counters that cannot be opened (not Linux, a container without perf access, a
+///          virtual machine without a PMU) are left out; wall-clock time is always measured.
+///          Counts are scaled when the kernel multiplexes the counters.
+class PerfCounters
+{
+   public:
+    PerfCounters();
+    ~PerfCounters();
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    /// \brief Gets whether cycles and instructions are counted.
+    bool IsAvailable() const;
+
+    /// \brief Gets why counters are missing, for display.
+    /// \return An empty string when all four counters are available.
+    const std::string& GetUnavailableReason() const;
+
+    /// \brief Resets and starts the counters.
+    void Start();
+
+    /// \brief Stops the counters.
+    /// \return The counts since Start.
+    PerfSample Stop();
+
+   private:
+    static constexpr int COUNTER_COUNT = 4;
+    int _fds[COUNTER_COUNT];
+    std::string _unavailableReason;
+    uint64_t _startNs = 0;
+};
+
+}  // namespace Bench
+}  // namespace GifBolt
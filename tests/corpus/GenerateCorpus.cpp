@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+// Writes the synthetic GIF corpus to a directory, for profiling outside the test binary:
+//   GifBolt.CorpusGen <output-directory> [--full]
+
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+#include "GifCorpus.h"
+
+using namespace GifBolt;
+
+int main(int argc, char** argv)
+{
+    if (argc < 2 || argc > 3 || (argc == 3 && std::strcmp(argv[2], "--full") != 0))
+    {
+        std::cerr << "Usage: " << argv[0] << " <output-directory> [--full]\n";
+        return 2;
+    }
+
+    const std::filesystem::path directory = argv[1];
+    const Corpus::CorpusSize size =
+        argc == 3 ? Corpus::CorpusSize::Full : Corpus::GetCorpusSizeFromEnvironment();
+
+    try
+    {
+        std::filesystem::create_directories(directory);
+        for (const Corpus::GifSpec& spec : Corpus::GetCorpus(size))
+        {
+            const std::vector<uint8_t> bytes = Corpus::Generate(spec);
+            const std::filesystem::path path = directory / (spec.name + ".gif");
+            std::ofstream file(path, std::ios::binary);
+            file.write(reinterpret_cast<const char*>(bytes.data()),
+                       static_cast<std::streamsize>(bytes.size()));
+            if (!file)
+            {
+                std::cerr << "Cannot write " << path.string() << "\n";
+                return 1;
+            }
+            std::cout << path.string() << " (" << bytes.size() << " bytes)\n";
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
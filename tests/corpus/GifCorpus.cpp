@@ -0,0 +1,287 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#include "GifCorpus.h"
+
+#include <gif_lib.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+namespace GifBolt
+{
+namespace Corpus
+{
+
+namespace
+{
+constexpr int PALETTE_SIZE = 256;
+constexpr int TRANSPARENT_INDEX = 0;  ///< Reserved for transparency when the spec uses it
+constexpr int INTERLACED_OFFSETS[] = {0, 4, 2, 1};
+constexpr int INTERLACED_JUMPS[] = {8, 8, 4, 2};
+
+/// \brief SplitMix64: small, fast and identical on every platform, unlike the standard
+/// library distributions.
+class Random
+{
+   public:
+    explicit Random(uint64_t seed) : _state(seed)
+    {
+    }
+
+    uint32_t Next()
+    {
+        uint64_t z = (this->_state += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return static_cast<uint32_t>((z ^ (z >> 31)) >> 32);
+    }
+
+    /// \brief Draws a value in [0, bound).
+    uint32_t Below(uint32_t bound)
+    {
+        return bound == 0 ? 0 : this->Next() % bound;
+    }
+
+   private:
+    uint64_t _state;
+};
+
+int WriteToVector(GifFileType* gif, const GifByteType* data, int length)
+{
+    auto* bytes = static_cast<std::vector<uint8_t>*>(gif->UserData);
+    bytes->insert(bytes->end(), data, data + length);
+    return length;
+}
+
+ColorMapObject* MakePalette(Random& random)
+{
+    GifColorType colors[PALETTE_SIZE];
+    for (GifColorType& color : colors)
+    {
+        const uint32_t rgb = random.Next();
+        color.Red = static_cast<GifByteType>(rgb);
+        color.Green = static_cast<GifByteType>(rgb >> 8);
+        color.Blue = static_cast<GifByteType>(rgb >> 16);
+    }
+    return GifMakeMapObject(PALETTE_SIZE, colors);
+}
+
+int GetDisposal(DisposalMix mix, Random& random)
+{
+    switch (mix)
+    {
+        case DisposalMix::Keep:
+            return DISPOSE_DO_NOT;
+        case DisposalMix::Background:
+            return DISPOSE_BACKGROUND;
+        case DisposalMix::Previous:
+            return DISPOSE_PREVIOUS;
+        case DisposalMix::Mixed:
+        default:
+            return static_cast<int>(random.Below(4));  // DISPOSAL_UNSPECIFIED..DISPOSE_PREVIOUS
+    }
+}
+
+int GetDelayCs(DelayPattern pattern, Random& random)
+{
+    switch (pattern)
+    {
+        case DelayPattern::Zero:
+            return 0;
+        case DelayPattern::Pathological:
+        {
+            const uint32_t draw = random.Below(16);
+            return draw == 15 ? 65535 : static_cast<int>(draw / 5);
+        }
+        case DelayPattern::Regular:
+        default:
+            return 4;
+    }
+}
+
+/// \brief Fills a frame with diagonal bands (long LZW runs) broken up by noise and
+/// transparent pixels, so that encoding and decoding do representative work.
+void FillFrame(std::vector<GifByteType>& pixels, int width, int height, uint32_t frame,
+               const GifSpec& spec, Random& random)
+{
+    const int firstColor = spec.transparencyPercent > 0 ? TRANSPARENT_INDEX + 1 : 0;
+    const int colorCount = PALETTE_SIZE - firstColor;
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            int index;
+            if (random.Below(100) < spec.transparencyPercent)
+            {
+                index = TRANSPARENT_INDEX;
+            }
+            else if (random.Below(4) == 0)
+            {
+                index = firstColor + static_cast<int>(random.Below(colorCount));
+            }
+            else
+            {
+                index = firstColor + static_cast<int>((x + y * 3 + frame * 7) / 8) % colorCount;
+            }
+            pixels[static_cast<size_t>(y) * width + x] = static_cast<GifByteType>(index);
+        }
+    }
+}
+}  // namespace
+
+std::vector<GifSpec> GetCorpus(CorpusSize size)
+{
+    std::vector<GifSpec> corpus;
+    auto add = [&corpus](const char* name, uint16_t width, uint16_t height, uint32_t frames,
+                         uint8_t subrectPercent, DisposalMix disposal,
+                         uint8_t transparencyPercent, bool localPalettes, bool interlaced,
+                         DelayPattern delays)
+    {
+        GifSpec spec;
+        spec.name = name;
+        spec.width = width;
+        spec.height = height;
+        spec.frameCount = frames;
+        spec.subrectPercent = subrectPercent;
+        spec.disposal = disposal;
+        spec.transparencyPercent = transparencyPercent;
+        spec.localPalettes = localPalettes;
+        spec.interlaced = interlaced;
+        spec.delays = delays;
+        spec.seed = static_cast<uint32_t>(corpus.size() + 1);
+        corpus.push_back(spec);
+    };
+
+    // Emoji and icons
+    add("tiny-16x16", 16, 16, 8, 100, DisposalMix::Keep, 0, false, false, DelayPattern::Regular);
+    add("icon-64x64-transparent", 64, 64, 24, 50, DisposalMix::Background, 30, false, false,
+        DelayPattern::Regular);
+    // Stickers and reactions
+    add("sticker-256x256-mixed", 256, 256, 30, 40, DisposalMix::Mixed, 10, true, false,
+        DelayPattern::Regular);
+    add("previous-128x128-pathological", 128, 128, 40, 60, DisposalMix::Previous, 20, false,
+        false, DelayPattern::Pathological);
+    // Video clips
+    add("clip-480x270-interlaced", 480, 270, 12, 100, DisposalMix::Keep, 0, false, true,
+        DelayPattern::Regular);
+    // Long loops of small deltas
+    add("long-64x64-subrect", 64, 64, 300, 25, DisposalMix::Keep, 0, false, false,
+        DelayPattern::Zero);
+
+    if (size == CorpusSize::Full)
+    {
+        add("hd-1920x1080-mixed", 1920, 1080, 20, 50, DisposalMix::Mixed, 5, true, false,
+            DelayPattern::Regular);
+        add("uhd-3840x2160-interlaced", 3840, 2160, 6, 30, DisposalMix::Keep, 0, false, true,
+            DelayPattern::Regular);
+        add("huge-8192x8192", 8192, 8192, 2, 10, DisposalMix::Background, 0, false, false,
+            DelayPattern::Pathological);
+    }
+    return corpus;
+}
+
+CorpusSize GetCorpusSizeFromEnvironment()
+{
+    const char* value = std::getenv("GIFBOLT_CORPUS");
+    return value != nullptr && std::strcmp(value, "full") == 0 ? CorpusSize::Full
+                                                               : CorpusSize::Quick;
+}
+
+std::vector<uint8_t> Generate(const GifSpec& spec)
+{
+    std::vector<uint8_t> bytes;
+    int error = 0;
+    GifFileType* gif = EGifOpen(&bytes, WriteToVector, &error);
+    if (gif == nullptr)
+    {
+        throw std::runtime_error(std::string("EGifOpen failed: ") + GifErrorString(error));
+    }
+
+    Random random(spec.seed);
+    ColorMapObject* globalPalette = MakePalette(random);
+    auto check = [&](int result)
+    {
+        if (result == GIF_ERROR)
+        {
+            const int gifError = gif->Error;
+            GifFreeMapObject(globalPalette);
+            EGifCloseFile(gif, nullptr);
+            throw std::runtime_error(std::string("Encoding ") + spec.name +
+                                     " failed: " + GifErrorString(gifError));
+        }
+    };
+
+    EGifSetGifVersion(gif, true);
+    check(EGifPutScreenDesc(gif, spec.width, spec.height, 8, 0, globalPalette));
+
+    // NETSCAPE2.0 application extension: loop forever
+    const GifByteType loop[] = {0x01, 0x00, 0x00};
+    check(EGifPutExtensionLeader(gif, APPLICATION_EXT_FUNC_CODE));
+    check(EGifPutExtensionBlock(gif, 11, "NETSCAPE2.0"));
+    check(EGifPutExtensionBlock(gif, static_cast<int>(sizeof(loop)), loop));
+    check(EGifPutExtensionTrailer(gif));
+
+    std::vector<GifByteType> pixels;
+    for (uint32_t frame = 0; frame < spec.frameCount; ++frame)
+    {
+        // The first frame covers the canvas, as encoders emit it; later ones are subrects
+        int width = spec.width;
+        int height = spec.height;
+        if (frame > 0)
+        {
+            width = std::max(1, spec.width * spec.subrectPercent / 100);
+            height = std::max(1, spec.height * spec.subrectPercent / 100);
+        }
+        const int left = static_cast<int>(random.Below(spec.width - width + 1));
+        const int top = static_cast<int>(random.Below(spec.height - height + 1));
+
+        GraphicsControlBlock control = {};
+        control.DisposalMode = GetDisposal(spec.disposal, random);
+        control.DelayTime = GetDelayCs(spec.delays, random);
+        control.TransparentColor =
+            spec.transparencyPercent > 0 ? TRANSPARENT_INDEX : NO_TRANSPARENT_COLOR;
+        GifByteType extension[4];
+        const size_t extensionLength = EGifGCBToExtension(&control, extension);
+        check(EGifPutExtension(gif, GRAPHICS_EXT_FUNC_CODE, static_cast<int>(extensionLength),
+                               extension));
+
+        ColorMapObject* localPalette = spec.localPalettes ? MakePalette(random) : nullptr;
+        const int descResult =
+            EGifPutImageDesc(gif, left, top, width, height, spec.interlaced, localPalette);
+        GifFreeMapObject(localPalette);
+        check(descResult);
+
+        pixels.resize(static_cast<size_t>(width) * height);
+        FillFrame(pixels, width, height, frame, spec, random);
+        if (spec.interlaced)
+        {
+            // giflib writes lines in the order given, so interlaced rows go pass by pass
+            for (int pass = 0; pass < 4; ++pass)
+            {
+                for (int y = INTERLACED_OFFSETS[pass]; y < height; y += INTERLACED_JUMPS[pass])
+                {
+                    check(EGifPutLine(gif, pixels.data() + static_cast<size_t>(y) * width,
+                                      width));
+                }
+            }
+        }
+        else
+        {
+            check(EGifPutLine(gif, pixels.data(), width * height));
+        }
+    }
+
+    GifFreeMapObject(globalPalette);
+    if (EGifCloseFile(gif, &error) == GIF_ERROR)
+    {
+        throw std::runtime_error(std::string("Encoding ") + spec.name +
+                                 " failed: " + GifErrorString(error));
+    }
+    return bytes;
+}
+
+}  // namespace Corpus
+}  // namespace GifBolt
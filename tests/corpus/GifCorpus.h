@@ -0,0 +1,76 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2026 GifBolt Contributors
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace GifBolt
+{
+namespace Corpus
+{
+
+/// \enum DisposalMix
+/// \brief Disposal methods assigned to the frames of a generated GIF.
+enum class DisposalMix : uint8_t
+{
+    Keep = 0,        ///< Every frame is left in place (DISPOSE_DO_NOT)
+    Background = 1,  ///< Every frame is cleared to the background
+    Previous = 2,    ///< Every frame restores the previous canvas
+    Mixed = 3        ///< Unspecified, keep, background and previous drawn at random
+};
+
+/// \enum DelayPattern
+/// \brief Frame delays of a generated GIF.
+enum class DelayPattern : uint8_t
+{
+    Regular = 0,      ///< 4 cs (25 fps) on every frame
+    Zero = 1,         ///< 0 cs on every frame, which players clamp
+    Pathological = 2  ///< 0, 1 and 2 cs mixed with occasional 655.35 s stalls
+};
+
+/// \enum CorpusSize
+/// \brief Which specs GetCorpus returns.
+enum class CorpusSize : uint8_t
+{
+    Quick = 0,  ///< Canvases up to 480x270; generated and decoded in well under a second
+    Full = 1    ///< Adds 1080p, 4K and 8192x8192 canvases (several GB of decoder memory)
+};
+
+/// \struct GifSpec
+/// \brief Shape of one generated GIF. The same spec always produces the same bytes.
+struct GifSpec
+{
+    std::string name;                             ///< Unique, file-name-safe identifier
+    uint16_t width = 64;                          ///< Canvas width in pixels
+    uint16_t height = 64;                         ///< Canvas height in pixels
+    uint32_t frameCount = 8;                      ///< Number of frames
+    uint8_t subrectPercent = 100;                 ///< Side of later frames, % of the canvas side
+    DisposalMix disposal = DisposalMix::Keep;     ///< Disposal methods of the frames
+    uint8_t transparencyPercent = 0;              ///< Share of transparent pixels, in percent
+    bool localPalettes = false;                   ///< Give each frame its own color table
+    bool interlaced = false;                      ///< Store frames interlaced
+    DelayPattern delays = DelayPattern::Regular;  ///< Frame delays
+    uint32_t seed = 1;                            ///< Seed for pixel content and placement
+};
+
+/// \brief Gets the standard corpus.
+/// \param size Quick for unit-test runs; Full to include the large canvases.
+/// \return Specs covering canvas size, frame count, subrect size, disposal, transparency,
+///         palettes, interlacing and delays.
+std::vector<GifSpec> GetCorpus(CorpusSize size);
+
+/// \brief Gets the corpus size selected by the GIFBOLT_CORPUS environment variable.
+/// \return Full when GIFBOLT_CORPUS is "full"; Quick otherwise.
+CorpusSize GetCorpusSizeFromEnvironment();
+
+/// \brief Encodes the GIF described by spec with giflib's encoder.
+/// \param spec Shape of the GIF.
+/// \return The GIF file bytes.
+/// \throws std::runtime_error if giflib reports an error.
+std::vector<uint8_t> Generate(const GifSpec& spec);
+
+}  // namespace Corpus
+}  // namespace GifBolt